@@ -0,0 +1,130 @@
+/*!
+    \file http_chunked_server.cpp
+    \brief HTTP chunked response server example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "asio_service.h"
+
+#include "server/http/http_server.h"
+
+#include <iostream>
+
+class HTTPChunkedSession : public CppServer::HTTP::HTTPSession
+{
+public:
+    using CppServer::HTTP::HTTPSession::HTTPSession;
+
+protected:
+    void onReceivedRequest(const CppServer::HTTP::HTTPRequest& request) override
+    {
+        if ((request.method() != "GET") && (request.method() != "POST"))
+        {
+            SendResponseAsync(response().MakeErrorResponse(405, "Unsupported HTTP method: " + std::string(request.method())));
+            return;
+        }
+
+        // Send the response header without the body length
+        SendResponseAsync(response().Clear().SetBegin(200).SetContentType(".txt").SetBodyChunked());
+
+        // Stream the response body with chunks of the unknown count
+        SendResponseChunkAsync("Requested URL: " + std::string(request.url()) + "\n");
+        if (!request.body().empty())
+            SendResponseChunkAsync("Received body: " + std::string(request.body()) + "\n");
+        for (int i = 1; i <= 10; ++i)
+            SendResponseChunkAsync("Line " + std::to_string(i) + "\n");
+
+        // Complete the response body
+        SendResponseChunkEndAsync();
+    }
+
+    void onReceivedRequestError(const CppServer::HTTP::HTTPRequest& request, const std::string& error) override
+    {
+        std::cout << "Request error: " << error << std::endl;
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "HTTP session caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+};
+
+class HTTPChunkedServer : public CppServer::HTTP::HTTPServer
+{
+public:
+    using CppServer::HTTP::HTTPServer::HTTPServer;
+
+protected:
+    std::shared_ptr<CppServer::Asio::TCPSession> CreateSession(const std::shared_ptr<CppServer::Asio::TCPServer>& server) override
+    {
+        return std::make_shared<HTTPChunkedSession>(std::dynamic_pointer_cast<CppServer::HTTP::HTTPServer>(server));
+    }
+
+protected:
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "HTTP server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    // HTTP server port
+    int port = 8080;
+    if (argc > 1)
+        port = std::atoi(argv[1]);
+
+    std::cout << "HTTP server port: " << port << std::endl;
+    std::cout << "HTTP server website: " << "http://localhost:" << port << "/" << std::endl;
+
+    std::cout << std::endl;
+
+    // Create a new Asio service
+    auto service = std::make_shared<AsioService>();
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create a new HTTP server
+    auto server = std::make_shared<HTTPChunkedServer>(service, port);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << "Press Enter to stop the server or '!' to restart the server..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.empty())
+            break;
+
+        // Restart the server
+        if (line == "!")
+        {
+            std::cout << "Server restarting...";
+            server->Restart();
+            std::cout << "Done!" << std::endl;
+            continue;
+        }
+    }
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*!
+    \file http_proxy_server.cpp
+    \brief HTTP proxy server example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "asio_service.h"
+
+#include "server/http/http_proxy_server.h"
+
+#include <iostream>
+
+class ProxyServer : public CppServer::HTTP::HTTPProxyServer
+{
+public:
+    using CppServer::HTTP::HTTPProxyServer::HTTPProxyServer;
+
+protected:
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "HTTP proxy server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    // HTTP proxy server port
+    int port = 8000;
+    if (argc > 1)
+        port = std::atoi(argv[1]);
+
+    std::cout << "HTTP proxy server port: " << port << std::endl;
+
+    std::cout << std::endl;
+
+    // Create a new Asio service
+    auto service = std::make_shared<AsioService>();
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create a new HTTP proxy server
+    auto server = std::make_shared<ProxyServer>(service, port);
+    server->SetupBalancing(CppServer::HTTP::HTTPProxyBalancing::LeastOutstanding);
+    server->SetupHealthCheck("/", CppCommon::Timespan::seconds(5));
+
+    // Add upstream HTTP servers (address:port pairs)
+    for (int i = 2; i < argc; ++i)
+    {
+        std::string upstream = argv[i];
+        size_t separator = upstream.rfind(':');
+        if (separator == std::string::npos)
+            continue;
+        server->AddUpstream(upstream.substr(0, separator), std::atoi(upstream.substr(separator + 1).c_str()));
+    }
+    if (server->upstreams().empty())
+        server->AddUpstream("127.0.0.1", 8080);
+
+    for (const auto& upstream : server->upstreams())
+        std::cout << "Upstream: " << upstream->address() << ":" << upstream->port() << std::endl;
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << "Press Enter to stop the server or '!' to show upstream statistics..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.empty())
+            break;
+
+        // Show upstream statistics
+        if (line == "!")
+        {
+            for (const auto& upstream : server->upstreams())
+            {
+                CppServer::Asio::LatencyHistogramSnapshot snapshot;
+                upstream->LatencySnapshot(snapshot);
+                std::cout << upstream->address() << ":" << upstream->port() << (upstream->IsHealthy() ? " healthy" : " unhealthy")
+                          << ", requests: " << upstream->requests() << ", errors: " << upstream->errors() << ", outstanding: " << upstream->outstanding()
+                          << ", latency: " << upstream->latency().microseconds() << " us, p99: " << snapshot.Percentile(0.99) / 1000 << " us" << std::endl;
+            }
+            continue;
+        }
+    }
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*!
+    \file tcp_proxy.cpp
+    \brief TCP proxy server example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "asio_service.h"
+
+#include "server/asio/tcp_proxy_server.h"
+
+#include <iostream>
+
+class ProxyServer : public CppServer::Asio::TCPProxyServer
+{
+public:
+    using CppServer::Asio::TCPProxyServer::TCPProxyServer;
+
+protected:
+    void onConnected(std::shared_ptr<CppServer::Asio::TCPSession>& session) override
+    {
+        std::cout << "TCP proxy session with Id " << session->id() << " connected!" << std::endl;
+    }
+
+    void onDisconnected(std::shared_ptr<CppServer::Asio::TCPSession>& session) override
+    {
+        auto proxy_session = std::static_pointer_cast<CppServer::Asio::TCPProxySession>(session);
+        std::cout << "TCP proxy session with Id " << session->id() << " disconnected! Forwarded " << proxy_session->bytes_upstream() << " bytes upstream and " << proxy_session->bytes_downstream() << " bytes downstream" << std::endl;
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "TCP proxy server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    // TCP proxy server port
+    int port = 2222;
+    if (argc > 1)
+        port = std::atoi(argv[1]);
+    // Upstream address
+    std::string upstream_address = "127.0.0.1";
+    if (argc > 2)
+        upstream_address = argv[2];
+    // Upstream port
+    int upstream_port = 1111;
+    if (argc > 3)
+        upstream_port = std::atoi(argv[3]);
+
+    std::cout << "TCP proxy server port: " << port << std::endl;
+    std::cout << "Upstream address: " << upstream_address << std::endl;
+    std::cout << "Upstream port: " << upstream_port << std::endl;
+    std::cout << "Zero-copy supported: " << (CppServer::Asio::TCPProxyServer::IsZeroCopySupported() ? "yes" : "no") << std::endl;
+
+    std::cout << std::endl;
+
+    // Create a new Asio service
+    auto service = std::make_shared<AsioService>();
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create a new TCP proxy server
+    auto server = std::make_shared<ProxyServer>(service, port, upstream_address, upstream_port);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << "Press Enter to stop the server or '!' to restart the server..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.empty())
+            break;
+
+        // Restart the server
+        if (line == "!")
+        {
+            std::cout << "Server restarting...";
+            server->Restart();
+            std::cout << "Done!" << std::endl;
+            continue;
+        }
+    }
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << "Forwarded " << server->bytes_upstream() << " bytes upstream and " << server->bytes_downstream() << " bytes downstream" << std::endl;
+
+    return 0;
+}
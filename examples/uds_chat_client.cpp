@@ -0,0 +1,135 @@
+/*!
+    \file uds_chat_client.cpp
+    \brief Unix domain socket chat client example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "asio_service.h"
+
+#include "server/asio/uds_client.h"
+#include "filesystem/path.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <iostream>
+
+#if defined(CPPSERVER_UDS)
+
+class ChatClient : public CppServer::Asio::UDSClient
+{
+public:
+    using CppServer::Asio::UDSClient::UDSClient;
+
+    void DisconnectAndStop()
+    {
+        _stop = true;
+        DisconnectAsync();
+        while (IsConnected())
+            CppCommon::Thread::Yield();
+    }
+
+protected:
+    void onConnected() override
+    {
+        std::cout << "Chat Unix domain socket client connected a new session with Id " << id() << std::endl;
+    }
+
+    void onDisconnected() override
+    {
+        std::cout << "Chat Unix domain socket client disconnected a session with Id " << id() << std::endl;
+
+        // Wait for a while...
+        CppCommon::Thread::Sleep(1000);
+
+        // Try to connect again
+        if (!_stop)
+            ConnectAsync();
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        std::cout << "Incoming: " << std::string((const char*)buffer, size) << std::endl;
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Chat Unix domain socket client caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+
+private:
+    std::atomic<bool> _stop{false};
+};
+
+int main(int argc, char** argv)
+{
+    // Unix domain socket server path
+    std::string path = (CppCommon::Path::temp() / "cppserver-uds-chat.sock").string();
+    if (argc > 1)
+        path = argv[1];
+
+    std::cout << "Unix domain socket server path: " << path << std::endl;
+
+    std::cout << std::endl;
+
+    // Create a new Asio service
+    auto service = std::make_shared<AsioService>();
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create a new Unix domain socket chat client
+    auto client = std::make_shared<ChatClient>(service, path);
+
+    // Connect the client
+    std::cout << "Client connecting...";
+    client->ConnectAsync();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << "Press Enter to stop the client or '!' to reconnect the client..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.empty())
+            break;
+
+        // Reconnect the client
+        if (line == "!")
+        {
+            std::cout << "Client reconnecting...";
+            client->IsConnected() ? client->ReconnectAsync() : client->ConnectAsync();
+            std::cout << "Done!" << std::endl;
+            continue;
+        }
+
+        // Send the entered text to the chat server
+        client->SendAsync(line);
+    }
+
+    // Disconnect the client
+    std::cout << "Client disconnecting...";
+    client->DisconnectAndStop();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::cout << "Unix domain sockets are not supported on this platform!" << std::endl;
+    return -1;
+}
+
+#endif
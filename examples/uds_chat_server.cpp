@@ -0,0 +1,146 @@
+/*!
+    \file uds_chat_server.cpp
+    \brief Unix domain socket chat server example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "asio_service.h"
+
+#include "server/asio/uds_server.h"
+#include "filesystem/path.h"
+
+#include <iostream>
+
+#if defined(CPPSERVER_UDS)
+
+class ChatSession : public CppServer::Asio::UDSSession
+{
+public:
+    using CppServer::Asio::UDSSession::UDSSession;
+
+protected:
+    void onConnected() override
+    {
+        std::cout << "Chat Unix domain socket session with Id " << id() << " connected!" << std::endl;
+
+        // Send invite message
+        std::string message("Hello from Unix domain socket chat! Please send a message or '!' to disconnect the client!");
+        SendAsync(message);
+    }
+
+    void onDisconnected() override
+    {
+        std::cout << "Chat Unix domain socket session with Id " << id() << " disconnected!" << std::endl;
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        std::string message((const char*)buffer, size);
+        std::cout << "Incoming: " << message << std::endl;
+
+        // Multicast message to all connected sessions
+        server()->Multicast(message);
+
+        // If the buffer starts with '!' the disconnect the current session
+        if (message == "!")
+            Disconnect();
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Chat Unix domain socket session caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+};
+
+class ChatServer : public CppServer::Asio::UDSServer
+{
+public:
+    using CppServer::Asio::UDSServer::UDSServer;
+
+protected:
+    std::shared_ptr<CppServer::Asio::UDSSession> CreateSession(const std::shared_ptr<CppServer::Asio::UDSServer>& server) override
+    {
+        return std::make_shared<ChatSession>(server);
+    }
+
+protected:
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Chat Unix domain socket server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    // Unix domain socket server path
+    std::string path = (CppCommon::Path::temp() / "cppserver-uds-chat.sock").string();
+    if (argc > 1)
+        path = argv[1];
+
+    std::cout << "Unix domain socket server path: " << path << std::endl;
+
+    std::cout << std::endl;
+
+    // Create a new Asio service
+    auto service = std::make_shared<AsioService>();
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create a new Unix domain socket chat server
+    auto server = std::make_shared<ChatServer>(service, path);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << "Press Enter to stop the server or '!' to restart the server..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.empty())
+            break;
+
+        // Restart the server
+        if (line == "!")
+        {
+            std::cout << "Server restarting...";
+            server->Restart();
+            std::cout << "Done!" << std::endl;
+            continue;
+        }
+
+        // Multicast admin message to all sessions
+        line = "(admin) " + line;
+        server->Multicast(line);
+    }
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::cout << "Unix domain sockets are not supported on this platform!" << std::endl;
+    return -1;
+}
+
+#endif
@@ -53,6 +53,11 @@
 
 #endif
 
+// Unix domain sockets are used only on platforms which support both stream and datagram sockets
+#if (defined(ASIO_HAS_LOCAL_SOCKETS) || defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)) && !defined(_WIN32) && !defined(_WIN64)
+#define CPPSERVER_UDS
+#endif
+
 namespace CppServer {
 
 /*!
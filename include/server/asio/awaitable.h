@@ -0,0 +1,355 @@
+/*!
+    \file awaitable.h
+    \brief Asio C++20 coroutine awaitables definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_AWAITABLE_H
+#define CPPSERVER_ASIO_AWAITABLE_H
+
+#include "service.h"
+
+#include "time/timespan.h"
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#define CPPSERVER_COROUTINES
+#endif
+
+#if defined(CPPSERVER_COROUTINES)
+
+#include <algorithm>
+#include <coroutine>
+#include <cstring>
+
+namespace CppServer {
+namespace Asio {
+
+//! Asio coroutine task
+/*!
+    Fire-and-forget coroutine type which could be used to write sequential
+    protocol logic with co_await of session/client awaitables. The task is
+    started immediately and destroys its frame on completion.
+
+    Not thread-safe.
+*/
+class Task
+{
+public:
+    //! Coroutine promise type
+    struct promise_type
+    {
+        Task get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const { throw; }
+    };
+};
+
+//! Asio awaiter
+/*!
+    Base awaiter for session/client asynchronous operations. The awaited
+    operation is started on the owner executor (strand or IO service) and
+    the coroutine is resumed on the same executor when the operation is
+    completed or the timeout is expired.
+
+    Handlers are allocated in awaiter handler storages, so awaiting does not
+    perform any heap allocations. Zero timeout means wait without timeout.
+
+    Not thread-safe.
+*/
+template <typename TResult>
+class Awaiter
+{
+public:
+    //! Initialize the awaiter with a given owner executor and timeout
+    /*!
+        \param io_service - Owner Asio IO service
+        \param strand - Owner Asio service strand
+        \param strand_required - Strand required flag
+        \param timeout - Timeout
+    */
+    Awaiter(const std::shared_ptr<asio::io_service>& io_service, asio::io_service::strand& strand, bool strand_required, const CppCommon::Timespan& timeout)
+        : _result(),
+          _io_service(io_service),
+          _strand(strand),
+          _strand_required(strand_required),
+          _timer(*io_service),
+          _timeout(timeout),
+          _starting(false),
+          _completed(false),
+          _timer_armed(false)
+    {
+    }
+    Awaiter(const Awaiter&) = delete;
+    Awaiter(Awaiter&&) = delete;
+    virtual ~Awaiter() = default;
+
+    Awaiter& operator=(const Awaiter&) = delete;
+    Awaiter& operator=(Awaiter&&) = delete;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        _handle = handle;
+
+        // Dispatch the start handler
+        auto start_handler = make_alloc_handler(_start_storage, [this]() { Start(); });
+        if (_strand_required)
+            _strand.dispatch(start_handler);
+        else
+            _io_service->dispatch(start_handler);
+    }
+    TResult await_resume() { return std::move(_result); }
+
+    //! Complete the awaited operation with the given result
+    /*!
+        Must be called from the owner executor.
+
+        \param result - Operation result
+    */
+    void Complete(TResult result)
+    {
+        if (_completed)
+            return;
+
+        _completed = true;
+        _result = std::move(result);
+
+        // Resume the coroutine from the timer handler or immediately
+        if (_timer_armed)
+        {
+            asio::error_code ec;
+            _timer.cancel(ec);
+        }
+        else if (!_starting)
+            _handle.resume();
+    }
+
+protected:
+    // Operation result
+    TResult _result;
+
+    //! Handle the awaited operation start
+    /*!
+        Called from the owner executor. The operation could be completed
+        immediately with Complete() call.
+    */
+    virtual void onStart() = 0;
+    //! Handle the awaited operation timeout
+    /*!
+        Called from the owner executor. The awaiter should be detached from
+        its owner and the timeout result should be stored in _result.
+    */
+    virtual void onTimeout() = 0;
+
+private:
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Asio service strand for serialized handler execution
+    asio::io_service::strand& _strand;
+    bool _strand_required;
+    // Timeout timer
+    asio::system_timer _timer;
+    CppCommon::Timespan _timeout;
+    // Awaiting coroutine
+    std::coroutine_handle<> _handle;
+    bool _starting;
+    bool _completed;
+    bool _timer_armed;
+    // Handler storages
+    HandlerStorage _start_storage;
+    HandlerStorage _timer_storage;
+
+    //! Start the awaited operation
+    void Start()
+    {
+        _starting = true;
+        onStart();
+        _starting = false;
+
+        // Resume the coroutine if the operation was completed immediately
+        if (_completed)
+        {
+            _handle.resume();
+            return;
+        }
+
+        // Wait for the operation without timeout
+        if (_timeout.total() <= 0)
+            return;
+
+        // Async wait for timeout
+        _timer_armed = true;
+        _timer.expires_from_now(_timeout.chrono());
+        auto async_wait_handler = make_alloc_handler(_timer_storage, [this](const asio::error_code& ec)
+        {
+            // Call the timeout handler if the operation is still pending
+            if (!_completed)
+            {
+                _completed = true;
+                onTimeout();
+            }
+
+            _handle.resume();
+        });
+        if (_strand_required)
+            _timer.async_wait(bind_executor(_strand, async_wait_handler));
+        else
+            _timer.async_wait(async_wait_handler);
+    }
+};
+
+//! Asio connect awaiter
+/*!
+    Awaits the asynchronous connect of the owner client.
+    Result is 'true' if the client was successfully connected.
+
+    Not thread-safe.
+*/
+template <class TOwner, class TResolver>
+class ConnectAwaiter : public Awaiter<bool>
+{
+public:
+    //! Initialize the connect awaiter
+    /*!
+        \param owner - Owner client
+        \param strand_required - Strand required flag
+        \param resolver - Resolver to resolve the server endpoint (nullptr to connect to the known address)
+        \param timeout - Timeout
+    */
+    ConnectAwaiter(const std::shared_ptr<TOwner>& owner, bool strand_required, const std::shared_ptr<TResolver>& resolver, const CppCommon::Timespan& timeout)
+        : Awaiter<bool>(owner->io_service(), owner->strand(), strand_required, timeout),
+          _owner(owner),
+          _resolver(resolver)
+    {
+    }
+
+    //! Get the resolver
+    const std::shared_ptr<TResolver>& resolver() const noexcept { return _resolver; }
+
+protected:
+    void onStart() override { _owner->StartConnectAwaiter(this); }
+    void onTimeout() override { _owner->CancelConnectAwaiter(this); _result = false; }
+
+private:
+    std::shared_ptr<TOwner> _owner;
+    std::shared_ptr<TResolver> _resolver;
+};
+
+//! Asio receive awaiter
+/*!
+    Awaits the next part of data received by the owner session/client.
+    Result is the size of received data (zero on timeout or disconnect).
+
+    Not thread-safe.
+*/
+template <class TOwner>
+class ReceiveAwaiter : public Awaiter<size_t>
+{
+public:
+    //! Default limit of received data cached for the pending awaiter
+    static constexpr size_t CACHE_LIMIT = 1024 * 1024;
+
+    //! Initialize the receive awaiter
+    /*!
+        \param owner - Owner session/client
+        \param strand_required - Strand required flag
+        \param buffer - Buffer to receive
+        \param size - Buffer size to receive
+        \param timeout - Timeout
+    */
+    ReceiveAwaiter(const std::shared_ptr<TOwner>& owner, bool strand_required, void* buffer, size_t size, const CppCommon::Timespan& timeout)
+        : Awaiter<size_t>(owner->io_service(), owner->strand(), strand_required, timeout),
+          _owner(owner),
+          _buffer(buffer),
+          _size(size)
+    {
+    }
+
+    //! Get the receive buffer
+    void* buffer() const noexcept { return _buffer; }
+    //! Get the receive buffer size
+    size_t size() const noexcept { return _size; }
+
+protected:
+    void onStart() override { _owner->StartReceiveAwaiter(this); }
+    void onTimeout() override { _owner->CancelReceiveAwaiter(this); _result = 0; }
+
+private:
+    std::shared_ptr<TOwner> _owner;
+    void* _buffer;
+    size_t _size;
+};
+
+//! Asio send awaiter
+/*!
+    Awaits until the given buffer is completely sent by the owner session/client.
+    Result is the size of sent data (partial on timeout or disconnect).
+
+    Not thread-safe.
+*/
+template <class TOwner>
+class SendAwaiter : public Awaiter<size_t>
+{
+public:
+    //! Initialize the send awaiter
+    /*!
+        \param owner - Owner session/client
+        \param strand_required - Strand required flag
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \param timeout - Timeout
+    */
+    SendAwaiter(const std::shared_ptr<TOwner>& owner, bool strand_required, const void* buffer, size_t size, const CppCommon::Timespan& timeout)
+        : Awaiter<size_t>(owner->io_service(), owner->strand(), strand_required, timeout),
+          _owner(owner),
+          _buffer(buffer),
+          _size(size),
+          _target(0)
+    {
+    }
+
+    //! Get the send buffer
+    const void* buffer() const noexcept { return _buffer; }
+    //! Get the send buffer size
+    size_t size() const noexcept { return _size; }
+    //! Get the sent bytes target of the owner to complete the operation
+    /*!
+        Target is counted in bytes of the owner normal priority send lane, so
+        high priority and conflated data sent ahead of the awaited buffer does
+        not complete the operation early.
+    */
+    uint64_t target() const noexcept { return _target; }
+
+    //! Setup the sent bytes target of the owner
+    void SetupTarget(uint64_t target) noexcept { _target = target; }
+
+    //! Calculate the size of sent data for the given sent bytes of the owner
+    size_t Sent(uint64_t sent) const noexcept
+    {
+        if (sent >= _target)
+            return _size;
+        uint64_t remain = _target - sent;
+        return (remain >= _size) ? 0 : (size_t)(_size - remain);
+    }
+
+protected:
+    void onStart() override { _owner->StartSendAwaiter(this); }
+    void onTimeout() override { _result = Sent(_owner->CancelSendAwaiter(this)); }
+
+private:
+    std::shared_ptr<TOwner> _owner;
+    const void* _buffer;
+    size_t _size;
+    uint64_t _target;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif
+
+#endif // CPPSERVER_ASIO_AWAITABLE_H
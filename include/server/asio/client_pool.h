@@ -0,0 +1,368 @@
+/*!
+    \file client_pool.h
+    \brief Asio client connection pool definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_CLIENT_POOL_H
+#define CPPSERVER_ASIO_CLIENT_POOL_H
+
+#include "ssl_client.h"
+#include "tcp_client.h"
+
+#include "errors/exceptions.h"
+
+#include "time/timespan.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! Is the given TCP client ready to be used by the connection pool?
+inline bool IsPooledClientReady(const TCPClient& client) noexcept { return client.IsConnected(); }
+//! Is the given SSL client ready to be used by the connection pool?
+inline bool IsPooledClientReady(const SSLClient& client) noexcept { return client.IsHandshaked(); }
+
+template <class TClient>
+class ClientPool;
+
+//! Pooled client ready notification
+/*!
+    Connection pool subscribes to the ready notification of the connecting
+    client, so it does not poll the client state. The notification is sent
+    only once: when the client is ready or when it failed to connect.
+
+    Thread-safe.
+*/
+class PooledClientBase
+{
+    template <class TClient>
+    friend class ClientPool;
+
+public:
+    //! Ready handler ('true' if the client is ready, 'false' if the client failed to connect)
+    typedef std::function<void(bool ready)> ReadyHandler;
+
+protected:
+    PooledClientBase() = default;
+    PooledClientBase(const PooledClientBase&) = delete;
+    PooledClientBase(PooledClientBase&&) = delete;
+    ~PooledClientBase() = default;
+
+    PooledClientBase& operator=(const PooledClientBase&) = delete;
+    PooledClientBase& operator=(PooledClientBase&&) = delete;
+
+    //! Notify the connection pool that the client is ready or failed to connect
+    /*!
+        \param ready - Ready flag
+    */
+    void NotifyReady(bool ready);
+
+private:
+    std::mutex _ready_lock;
+    ReadyHandler _ready_handler;
+    Scheduler::Token _ready_token;
+
+    //! Subscribe to the ready notification with the given connect timeout token
+    void SetupReadyHandler(const ReadyHandler& handler, const Scheduler::Token& token);
+    //! Unsubscribe from the ready notification
+    /*!
+        \return 'true' if the ready notification was pending, 'false' if it was already sent
+    */
+    bool CancelReady();
+};
+
+//! Pooled client
+/*!
+    Pooled client extends the given client (e.g. TCPClient, HTTPClient or
+    SSLClient) with the ready notification of the connection pool: TCP
+    clients are ready when they are connected and SSL clients are ready
+    when they are handshaked.
+
+    Derived classes which override onConnected(), onHandshaked() or
+    onDisconnected() handlers must call the base ones.
+
+    Thread-safe.
+*/
+template <class TClient, bool SSL = std::is_base_of_v<SSLClient, TClient>>
+class PooledClient : public TClient, public PooledClientBase
+{
+public:
+    using TClient::TClient;
+
+protected:
+    void onConnected() override { TClient::onConnected(); NotifyReady(true); }
+    void onDisconnected() override { NotifyReady(false); TClient::onDisconnected(); }
+};
+
+//! Pooled SSL client
+template <class TClient>
+class PooledClient<TClient, true> : public TClient, public PooledClientBase
+{
+public:
+    using TClient::TClient;
+
+protected:
+    void onHandshaked() override { TClient::onHandshaked(); NotifyReady(true); }
+    void onDisconnected() override { NotifyReady(false); TClient::onDisconnected(); }
+};
+
+//! Asio client connection pool
+/*!
+    Client connection pool keeps connected clients (e.g. TCPClient, SSLClient
+    or HTTPClient) to the same backends, so short-lived requests do not pay
+    TCP and TLS handshakes each time. Clients are pooled by their endpoint
+    (address and port).
+
+    Pooled clients are created with the Asio service round-robin, so
+    connections are distributed across service working threads. Idle clients
+    are checked out in least recently used order, so requests rotate over
+    all working threads as well.
+
+    Background health check removes disconnected and unhealthy idle clients,
+    evicts clients idle for too long and keeps at least the minimal number of
+    connections for each known endpoint.
+
+    Pooled client type must be derived from PooledClient, so the pool is
+    notified when the connecting client is ready or failed to connect.
+    Failed connects are retried by the health check.
+
+    Thread-safe.
+*/
+template <class TClient>
+class ClientPool : public std::enable_shared_from_this<ClientPool<TClient>>
+{
+    static_assert(std::is_base_of_v<PooledClientBase, TClient>, "Pooled client must be derived from PooledClient!");
+
+public:
+    //! Client factory
+    typedef std::function<std::shared_ptr<TClient>(const std::shared_ptr<Service>& service, const std::string& address, int port)> Factory;
+    //! Checkout handler (called with nullptr if the checkout deadline is expired)
+    typedef std::function<void(const std::shared_ptr<TClient>& client)> CheckoutHandler;
+    //! Health check handler
+    typedef std::function<bool(const std::shared_ptr<TClient>& client)> HealthCheck;
+
+    //! Initialize client connection pool with a given Asio service and client factory
+    /*!
+        \param service - Asio service
+        \param factory - Client factory (default is nullptr to create clients with the Asio service, address and port)
+    */
+    explicit ClientPool(const std::shared_ptr<Service>& service, const Factory& factory = nullptr);
+    ClientPool(const ClientPool&) = delete;
+    ClientPool(ClientPool&&) = delete;
+    ~ClientPool() = default;
+
+    ClientPool& operator=(const ClientPool&) = delete;
+    ClientPool& operator=(ClientPool&&) = delete;
+
+    //! Get the Asio service
+    std::shared_ptr<Service>& service() noexcept { return _service; }
+
+    //! Get the number of pooled clients (idle, checked out and connecting)
+    size_t size() const;
+    //! Get the number of pooled clients of the given endpoint
+    /*!
+        \param address - Server address
+        \param port - Server port number
+        \return Number of pooled clients of the given endpoint
+    */
+    size_t size(const std::string& address, int port) const;
+    //! Get the number of idle clients
+    size_t idle() const;
+
+    //! Get the number of checkouts
+    uint64_t checkouts() const noexcept { return _checkouts; }
+    //! Get the number of checkouts served with an idle client
+    uint64_t hits() const noexcept { return _hits; }
+    //! Get the number of checkouts with the expired deadline
+    uint64_t timeouts() const noexcept { return _timeouts; }
+    //! Get the ratio of checkouts served with an idle client
+    double hit_rate() const noexcept { return (_checkouts > 0) ? ((double)_hits / _checkouts) : 0.0; }
+    //! Get the average wait time of served checkouts
+    CppCommon::Timespan wait_time() const noexcept { return CppCommon::Timespan::nanoseconds((_served > 0) ? (_wait_time / _served) : 0); }
+    //! Get the maximal wait time of served checkouts
+    CppCommon::Timespan max_wait_time() const noexcept { return CppCommon::Timespan::nanoseconds(_wait_time_max); }
+
+    //! Get the option: minimal number of clients of each endpoint
+    size_t option_min_size() const noexcept { return _option_min_size; }
+    //! Get the option: maximal number of clients of each endpoint
+    size_t option_max_size() const noexcept { return _option_max_size; }
+    //! Get the option: idle timeout
+    const CppCommon::Timespan& option_idle_timeout() const noexcept { return _option_idle_timeout; }
+    //! Get the option: connect timeout
+    const CppCommon::Timespan& option_connect_timeout() const noexcept { return _option_connect_timeout; }
+    //! Get the option: health check interval
+    const CppCommon::Timespan& option_health_check_interval() const noexcept { return _option_health_check_interval; }
+
+    //! Is the pool started?
+    bool IsStarted() const noexcept { return _started; }
+
+    //! Start the pool
+    /*!
+        \return 'true' if the pool was successfully started, 'false' if the pool is already started
+    */
+    bool Start();
+    //! Stop the pool
+    /*!
+        All idle clients are disconnected and all pending checkouts are
+        completed with nullptr. Checked out clients are disconnected when
+        they are returned to the pool.
+
+        \return 'true' if the pool was successfully stopped, 'false' if the pool is already stopped
+    */
+    bool Stop();
+
+    //! Checkout a connected client of the given endpoint (asynchronous)
+    /*!
+        If there is no idle client a new one is connected unless the maximal
+        number of clients of the endpoint is reached. Otherwise the checkout
+        waits for a returned client until the deadline is expired.
+
+        The handler is called on the working thread of the checked out client
+        or with nullptr if the deadline is expired.
+
+        \param address - Server address
+        \param port - Server port number
+        \param deadline - Checkout deadline
+        \param handler - Checkout handler
+        \return 'true' if the checkout was successfully started, 'false' if the pool is not started
+    */
+    bool CheckoutAsync(const std::string& address, int port, const CppCommon::Timespan& deadline, const CheckoutHandler& handler);
+    //! Return the checked out client to the pool
+    /*!
+        Disconnected client is removed from the pool.
+
+        \param client - Checked out client
+    */
+    void Checkin(const std::shared_ptr<TClient>& client);
+    //! Remove the checked out client from the pool and disconnect it
+    /*!
+        \param client - Checked out client
+    */
+    void Discard(const std::shared_ptr<TClient>& client);
+
+    //! Setup option: minimal number of clients of each endpoint
+    /*!
+        Health check keeps at least the given number of connected clients for
+        each endpoint which was checked out at least once. Default is zero.
+
+        \param size - Minimal number of clients
+    */
+    void SetupMinSize(size_t size) noexcept { _option_min_size = size; }
+    //! Setup option: maximal number of clients of each endpoint
+    /*!
+        \param size - Maximal number of clients (default is 16)
+    */
+    void SetupMaxSize(size_t size) noexcept { _option_max_size = (size > 0) ? size : 1; }
+    //! Setup option: idle timeout
+    /*!
+        Clients idle for the given timeout are disconnected while the number
+        of clients of the endpoint is above the minimal one. Default is 60 seconds.
+
+        \param timeout - Idle timeout (zero means disabled)
+    */
+    void SetupIdleTimeout(const CppCommon::Timespan& timeout) noexcept { _option_idle_timeout = timeout; }
+    //! Setup option: connect timeout
+    /*!
+        Connecting clients are removed from the pool if they are not ready
+        during the given timeout. Default is 10 seconds.
+
+        \param timeout - Connect timeout
+    */
+    void SetupConnectTimeout(const CppCommon::Timespan& timeout) noexcept { _option_connect_timeout = timeout; }
+    //! Setup option: health check
+    /*!
+        Additional health check handler is called for idle clients under the
+        pool lock, so it should be fast (e.g. check the client state). Should
+        be called before the pool is started. Default is 1 second interval
+        and no additional health check handler.
+
+        \param interval - Health check interval
+        \param check - Additional health check handler of idle clients (default is nullptr)
+    */
+    void SetupHealthCheck(const CppCommon::Timespan& interval, const HealthCheck& check = nullptr) { _option_health_check_interval = interval; _health_check = check; }
+
+private:
+    // Idle client
+    struct IdleClient
+    {
+        std::shared_ptr<TClient> client;
+        uint64_t timestamp;
+    };
+
+    // Pending checkout
+    struct Waiter
+    {
+        CheckoutHandler handler;
+        uint64_t timestamp;
+        Scheduler::Token token;
+        bool completed{false};
+    };
+
+    // Clients of a single endpoint
+    struct Endpoint
+    {
+        std::string address;
+        int port;
+        size_t size{0};
+        std::deque<IdleClient> idle;
+        std::deque<std::shared_ptr<Waiter>> waiters;
+    };
+
+    // Asio service & client factory
+    std::shared_ptr<Service> _service;
+    Factory _factory;
+    HealthCheck _health_check;
+    // Pooled endpoints
+    mutable std::mutex _lock;
+    std::map<std::string, Endpoint> _endpoints;
+    std::atomic<bool> _started;
+    Scheduler::Token _health_token;
+    // Pool statistic
+    std::atomic<uint64_t> _checkouts{0};
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _timeouts{0};
+    std::atomic<uint64_t> _served{0};
+    std::atomic<uint64_t> _wait_time{0};
+    std::atomic<uint64_t> _wait_time_max{0};
+    // Options
+    size_t _option_min_size{0};
+    size_t _option_max_size{16};
+    CppCommon::Timespan _option_idle_timeout{CppCommon::Timespan::seconds(60)};
+    CppCommon::Timespan _option_connect_timeout{CppCommon::Timespan::seconds(10)};
+    CppCommon::Timespan _option_health_check_interval{CppCommon::Timespan::seconds(1)};
+
+    //! Get the endpoint key
+    static std::string Key(const std::string& address, int port) { return address + ":" + std::to_string(port); }
+
+    //! Connect a new client of the given endpoint (must be called under the lock)
+    void Connect(Endpoint& endpoint);
+    //! Remove the client which failed to connect without the replacement
+    void Fail(const std::shared_ptr<TClient>& client);
+    //! Release the ready client to the pending checkout or to idle clients
+    void Release(const std::shared_ptr<TClient>& client);
+    //! Complete the checkout started at the given timestamp with the given client
+    void Complete(const CheckoutHandler& handler, uint64_t timestamp, const std::shared_ptr<TClient>& client);
+    //! Check the health of idle clients
+    void CheckHealth();
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#include "client_pool.inl"
+
+#endif // CPPSERVER_ASIO_CLIENT_POOL_H
@@ -0,0 +1,475 @@
+/*!
+    \file client_pool.inl
+    \brief Asio client connection pool inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include <algorithm>
+
+namespace CppServer {
+namespace Asio {
+
+inline void PooledClientBase::NotifyReady(bool ready)
+{
+    ReadyHandler handler;
+
+    {
+        std::scoped_lock locker(_ready_lock);
+
+        if (!_ready_handler)
+            return;
+
+        // The notification is sent only once
+        handler = std::move(_ready_handler);
+        _ready_handler = nullptr;
+        _ready_token.Cancel();
+    }
+
+    handler(ready);
+}
+
+inline void PooledClientBase::SetupReadyHandler(const ReadyHandler& handler, const Scheduler::Token& token)
+{
+    std::scoped_lock locker(_ready_lock);
+
+    _ready_handler = handler;
+    _ready_token = token;
+}
+
+inline bool PooledClientBase::CancelReady()
+{
+    std::scoped_lock locker(_ready_lock);
+
+    if (!_ready_handler)
+        return false;
+
+    _ready_handler = nullptr;
+    _ready_token.Cancel();
+    return true;
+}
+
+template <class TClient>
+inline ClientPool<TClient>::ClientPool(const std::shared_ptr<Service>& service, const Factory& factory)
+    : _service(service),
+      _factory(factory),
+      _started(false)
+{
+    assert((service != nullptr) && "Asio service is invalid!");
+    if (service == nullptr)
+        throw CppCommon::ArgumentException("Asio service is invalid!");
+
+    // Create clients with the Asio service, address and port by default
+    if (!_factory)
+    {
+        if constexpr (std::is_constructible_v<TClient, const std::shared_ptr<Service>&, const std::string&, int>)
+            _factory = [](const std::shared_ptr<Service>& service, const std::string& address, int port) { return std::make_shared<TClient>(service, address, port); };
+        else
+            throw CppCommon::ArgumentException("Client factory is required!");
+    }
+}
+
+template <class TClient>
+inline size_t ClientPool<TClient>::size() const
+{
+    std::scoped_lock locker(_lock);
+
+    size_t result = 0;
+    for (const auto& endpoint : _endpoints)
+        result += endpoint.second.size;
+    return result;
+}
+
+template <class TClient>
+inline size_t ClientPool<TClient>::size(const std::string& address, int port) const
+{
+    std::scoped_lock locker(_lock);
+
+    auto it = _endpoints.find(Key(address, port));
+    return (it != _endpoints.end()) ? it->second.size : 0;
+}
+
+template <class TClient>
+inline size_t ClientPool<TClient>::idle() const
+{
+    std::scoped_lock locker(_lock);
+
+    size_t result = 0;
+    for (const auto& endpoint : _endpoints)
+        result += endpoint.second.idle.size();
+    return result;
+}
+
+template <class TClient>
+inline bool ClientPool<TClient>::Start()
+{
+    if (IsStarted())
+        return false;
+
+    _started = true;
+
+    // Start the background health check
+    if (_option_health_check_interval.total() > 0)
+    {
+        std::weak_ptr<ClientPool<TClient>> weak(this->weak_from_this());
+        _health_token = _service->SchedulePeriodic(_option_health_check_interval, [weak]()
+        {
+            auto self = weak.lock();
+            if (self)
+                self->CheckHealth();
+        });
+    }
+
+    return true;
+}
+
+template <class TClient>
+inline bool ClientPool<TClient>::Stop()
+{
+    if (!IsStarted())
+        return false;
+
+    _started = false;
+
+    // Stop the background health check
+    _health_token.Cancel();
+
+    std::vector<std::shared_ptr<TClient>> clients;
+    std::vector<std::shared_ptr<Waiter>> waiters;
+
+    {
+        std::scoped_lock locker(_lock);
+
+        // Collect idle clients and pending checkouts of all endpoints
+        for (auto& endpoint : _endpoints)
+        {
+            for (auto& idle : endpoint.second.idle)
+                clients.emplace_back(std::move(idle.client));
+            for (auto& waiter : endpoint.second.waiters)
+            {
+                if (waiter->completed)
+                    continue;
+
+                waiter->completed = true;
+                waiter->token.Cancel();
+                waiters.emplace_back(waiter);
+            }
+        }
+        _endpoints.clear();
+    }
+
+    // Disconnect idle clients
+    for (auto& client : clients)
+        client->DisconnectAsync();
+
+    // Complete pending checkouts
+    for (auto& waiter : waiters)
+        waiter->handler(nullptr);
+
+    return true;
+}
+
+template <class TClient>
+inline bool ClientPool<TClient>::CheckoutAsync(const std::string& address, int port, const CppCommon::Timespan& deadline, const CheckoutHandler& handler)
+{
+    if (!IsStarted())
+        return false;
+
+    ++_checkouts;
+
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+    std::shared_ptr<TClient> client;
+    std::vector<std::shared_ptr<TClient>> clients;
+
+    {
+        std::scoped_lock locker(_lock);
+
+        // Find or create the endpoint
+        std::string key = Key(address, port);
+        auto it = _endpoints.find(key);
+        if (it == _endpoints.end())
+        {
+            it = _endpoints.emplace(key, Endpoint()).first;
+            it->second.address = address;
+            it->second.port = port;
+        }
+        auto& endpoint = it->second;
+
+        // Take the least recently used ready idle client
+        while (!endpoint.idle.empty())
+        {
+            auto idle = std::move(endpoint.idle.front());
+            endpoint.idle.pop_front();
+            if (IsPooledClientReady(*idle.client))
+            {
+                client = std::move(idle.client);
+                break;
+            }
+
+            // Remove the disconnected client
+            clients.emplace_back(std::move(idle.client));
+            --endpoint.size;
+        }
+
+        if (!client)
+        {
+            // Register the pending checkout with the deadline
+            auto waiter = std::make_shared<Waiter>();
+            waiter->handler = handler;
+            waiter->timestamp = timestamp;
+            std::weak_ptr<ClientPool<TClient>> weak(this->weak_from_this());
+            std::weak_ptr<Waiter> weak_waiter(waiter);
+            waiter->token = _service->ScheduleAfter(deadline, [weak, weak_waiter, key]()
+            {
+                auto self = weak.lock();
+                auto waiter = weak_waiter.lock();
+                if (!self || !waiter)
+                    return;
+
+                {
+                    std::scoped_lock locker(self->_lock);
+
+                    if (waiter->completed)
+                        return;
+                    waiter->completed = true;
+
+                    // Remove the pending checkout
+                    auto it = self->_endpoints.find(key);
+                    if (it != self->_endpoints.end())
+                    {
+                        auto& waiters = it->second.waiters;
+                        waiters.erase(std::remove(waiters.begin(), waiters.end(), waiter), waiters.end());
+                    }
+                }
+
+                // Complete the checkout with the expired deadline
+                ++self->_timeouts;
+                waiter->handler(nullptr);
+            });
+            endpoint.waiters.emplace_back(waiter);
+
+            // Connect a new client if the endpoint is not full
+            if (endpoint.size < _option_max_size)
+                Connect(endpoint);
+        }
+    }
+
+    // Disconnect removed clients
+    for (auto& removed : clients)
+        removed->DisconnectAsync();
+
+    // Complete the checkout with the idle client
+    if (client)
+    {
+        ++_hits;
+        Complete(handler, timestamp, client);
+    }
+
+    return true;
+}
+
+template <class TClient>
+inline void ClientPool<TClient>::Checkin(const std::shared_ptr<TClient>& client)
+{
+    Release(client);
+}
+
+template <class TClient>
+inline void ClientPool<TClient>::Discard(const std::shared_ptr<TClient>& client)
+{
+    {
+        std::scoped_lock locker(_lock);
+
+        auto it = _endpoints.find(Key(client->address(), client->port()));
+        if (it != _endpoints.end())
+        {
+            auto& endpoint = it->second;
+            if (endpoint.size > 0)
+                --endpoint.size;
+
+            // Connect a replacement client for pending checkouts
+            if (IsStarted() && !endpoint.waiters.empty() && (endpoint.size < _option_max_size))
+                Connect(endpoint);
+        }
+    }
+
+    client->DisconnectAsync();
+}
+
+template <class TClient>
+inline void ClientPool<TClient>::Connect(Endpoint& endpoint)
+{
+    // Create a new client
+    auto client = _factory(_service, endpoint.address, endpoint.port);
+    ++endpoint.size;
+
+    std::weak_ptr<ClientPool<TClient>> weak(this->weak_from_this());
+    std::weak_ptr<TClient> weak_client(client);
+
+    // Remove the client which is not ready during the connect timeout
+    auto token = _service->ScheduleAfter(_option_connect_timeout, [weak, client]()
+    {
+        if (!client->CancelReady())
+            return;
+
+        auto self = weak.lock();
+        if (self)
+            self->Fail(client);
+        else
+            client->DisconnectAsync();
+    });
+
+    // Release the ready client or remove the client which failed to connect
+    client->SetupReadyHandler([weak, weak_client](bool ready)
+    {
+        auto client = weak_client.lock();
+        if (!client)
+            return;
+
+        auto self = weak.lock();
+        if (!self)
+            client->DisconnectAsync();
+        else if (ready)
+            self->Release(client);
+        else
+            self->Fail(client);
+    }, token);
+
+    // Connect the client or remove it immediately if it failed to start connecting
+    if (!client->ConnectAsync() && client->CancelReady())
+        --endpoint.size;
+}
+
+template <class TClient>
+inline void ClientPool<TClient>::Fail(const std::shared_ptr<TClient>& client)
+{
+    {
+        std::scoped_lock locker(_lock);
+
+        auto it = _endpoints.find(Key(client->address(), client->port()));
+        if ((it != _endpoints.end()) && (it->second.size > 0))
+            --it->second.size;
+    }
+
+    client->DisconnectAsync();
+}
+
+template <class TClient>
+inline void ClientPool<TClient>::Release(const std::shared_ptr<TClient>& client)
+{
+    std::shared_ptr<Waiter> waiter;
+    bool disconnect = false;
+
+    {
+        std::scoped_lock locker(_lock);
+
+        auto it = _endpoints.find(Key(client->address(), client->port()));
+        if (!IsStarted() || (it == _endpoints.end()))
+            disconnect = true;
+        else
+        {
+            auto& endpoint = it->second;
+            if (!IsPooledClientReady(*client))
+            {
+                // Remove the disconnected client
+                disconnect = true;
+                if (endpoint.size > 0)
+                    --endpoint.size;
+
+                // Connect a replacement client for pending checkouts
+                if (!endpoint.waiters.empty() && (endpoint.size < _option_max_size))
+                    Connect(endpoint);
+            }
+            else
+            {
+                // Find the first pending checkout
+                while (!endpoint.waiters.empty())
+                {
+                    auto pending = std::move(endpoint.waiters.front());
+                    endpoint.waiters.pop_front();
+                    if (!pending->completed)
+                    {
+                        pending->completed = true;
+                        pending->token.Cancel();
+                        waiter = std::move(pending);
+                        break;
+                    }
+                }
+
+                // Keep the client idle if there is no pending checkout
+                if (!waiter)
+                    endpoint.idle.push_back(IdleClient{ client, CppCommon::Timestamp::nano() });
+            }
+        }
+    }
+
+    // Disconnect the removed client
+    if (disconnect)
+        client->DisconnectAsync();
+
+    // Complete the pending checkout
+    if (waiter)
+        Complete(waiter->handler, waiter->timestamp, client);
+}
+
+template <class TClient>
+inline void ClientPool<TClient>::Complete(const CheckoutHandler& handler, uint64_t timestamp, const std::shared_ptr<TClient>& client)
+{
+    // Update wait time statistic
+    uint64_t wait = CppCommon::Timestamp::nano() - timestamp;
+    ++_served;
+    _wait_time += wait;
+    uint64_t wait_max = _wait_time_max;
+    while ((wait > wait_max) && !_wait_time_max.compare_exchange_weak(wait_max, wait));
+
+    // Call the checkout handler on the client working thread
+    client->io_service()->post([handler, client]() { handler(client); });
+}
+
+template <class TClient>
+inline void ClientPool<TClient>::CheckHealth()
+{
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+    uint64_t idle_timeout = (uint64_t)std::max<int64_t>(_option_idle_timeout.total(), 0);
+    size_t min_size = std::min(_option_min_size, _option_max_size);
+    std::vector<std::shared_ptr<TClient>> clients;
+
+    {
+        std::scoped_lock locker(_lock);
+
+        for (auto& item : _endpoints)
+        {
+            auto& endpoint = item.second;
+
+            // Remove disconnected and unhealthy idle clients, evict clients idle for too long
+            for (auto it = endpoint.idle.begin(); it != endpoint.idle.end();)
+            {
+                bool expired = (idle_timeout > 0) && ((timestamp - it->timestamp) >= idle_timeout) && (endpoint.size > min_size);
+                if (expired || !IsPooledClientReady(*it->client) || (_health_check && !_health_check(it->client)))
+                {
+                    clients.emplace_back(std::move(it->client));
+                    it = endpoint.idle.erase(it);
+                    --endpoint.size;
+                }
+                else
+                    ++it;
+            }
+
+            // Keep the minimal number of clients
+            while (endpoint.size < min_size)
+                Connect(endpoint);
+
+            // Connect a new client for pending checkouts
+            if (!endpoint.waiters.empty() && (endpoint.size < _option_max_size))
+                Connect(endpoint);
+        }
+    }
+
+    // Disconnect removed clients
+    for (auto& client : clients)
+        client->DisconnectAsync();
+}
+
+} // namespace Asio
+} // namespace CppServer
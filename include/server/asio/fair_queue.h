@@ -0,0 +1,151 @@
+/*!
+    \file fair_queue.h
+    \brief Asio fair queue definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_FAIR_QUEUE_H
+#define CPPSERVER_ASIO_FAIR_QUEUE_H
+
+#include "asio.h"
+#include "memory.h"
+
+#include <deque>
+#include <memory>
+
+namespace CppServer {
+namespace Asio {
+
+//! Fair queue scheduling class
+enum class SchedulingClass
+{
+    Control,    //!< Control entries are served before all bulk entries
+    Bulk        //!< Bulk entries share the rest of the working thread time with deficit round-robin
+};
+
+//! Session send priority lane
+enum class SendPriority
+{
+    Normal,     //!< Normal priority data is sent in order of sending
+    High        //!< High priority data is sent at the next write boundary ahead of normal priority data
+};
+
+//! Asio fair queue
+/*!
+    Fair queue is used to share the working thread of a single Asio IO service
+    between ready entries (e.g. sessions with received data) with deficit
+    round-robin algorithm. Each round every ready entry gets its quantum added
+    to its deficit and may process up to deficit bytes. Entries which still
+    have pending data are moved to the tail of the queue, so the next round is
+    posted to the Asio IO service and other handlers (e.g. receive handlers of
+    light sessions) are executed in between.
+
+    Control entries are served before all bulk entries in every round.
+
+    Not thread-safe. Fair queue must be used only from the working thread of
+    its Asio IO service.
+*/
+class FairQueue : public std::enable_shared_from_this<FairQueue>
+{
+public:
+    //! Fair queue entry
+    /*!
+        Entry which should be embedded into the object with pending data.
+        Fair queue keeps the entry owner alive while the entry is queued.
+
+        Not thread-safe.
+    */
+    class Entry
+    {
+        friend class FairQueue;
+
+    public:
+        Entry() noexcept = default;
+        Entry(const Entry&) = delete;
+        Entry(Entry&&) = delete;
+        virtual ~Entry() = default;
+
+        Entry& operator=(const Entry&) = delete;
+        Entry& operator=(Entry&&) = delete;
+
+        //! Get the entry quantum in bytes
+        size_t quantum() const noexcept { return _quantum; }
+        //! Get the entry scheduling class
+        SchedulingClass scheduling_class() const noexcept { return _class; }
+
+        //! Is the entry queued?
+        bool IsQueued() const noexcept { return _queued; }
+
+        //! Setup the entry quantum in bytes
+        void SetupQuantum(size_t quantum) noexcept { _quantum = (quantum > 0) ? quantum : 1; }
+        //! Setup the entry scheduling class
+        void SetupSchedulingClass(SchedulingClass scheduling_class) noexcept { _class = scheduling_class; }
+
+    protected:
+        //! Handle entry dispatch notification
+        /*!
+            Notification is called once per round of the fair queue. Handler should
+            process up to the given budget of bytes and report whether the entry has
+            more pending data. Entries without pending data are removed from the queue
+            and their deficit is reset.
+
+            \param budget - Budget of bytes to process
+            \param pending - Pending data flag to fill
+            \return Number of processed bytes
+        */
+        virtual size_t onDispatch(size_t budget, bool& pending) = 0;
+
+    private:
+        size_t _quantum{65536};
+        size_t _deficit{0};
+        SchedulingClass _class{SchedulingClass::Bulk};
+        bool _queued{false};
+    };
+
+    //! Initialize fair queue with a given Asio IO service
+    /*!
+        \param io_service - Asio IO service
+    */
+    explicit FairQueue(const std::shared_ptr<asio::io_service>& io_service);
+    FairQueue(const FairQueue&) = delete;
+    FairQueue(FairQueue&&) = delete;
+    ~FairQueue() = default;
+
+    FairQueue& operator=(const FairQueue&) = delete;
+    FairQueue& operator=(FairQueue&&) = delete;
+
+    //! Get the number of queued entries
+    size_t size() const noexcept { return _control.size() + _bulk.size(); }
+
+    //! Enqueue the given entry
+    /*!
+        Entry will be dispatched in the next round of the fair queue.
+        Queued entries are kept alive with the given shared pointer.
+
+        \param entry - Fair queue entry
+    */
+    void Enqueue(const std::shared_ptr<Entry>& entry);
+
+private:
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Ready entries
+    std::deque<std::shared_ptr<Entry>> _control;
+    std::deque<std::shared_ptr<Entry>> _bulk;
+    bool _dispatching;
+    HandlerStorage _dispatch_storage;
+
+    //! Post the next round of the fair queue
+    void Post();
+    //! Perform a single round of the fair queue
+    void Dispatch();
+    //! Perform a single round over the given ready entries
+    void DispatchRound(std::deque<std::shared_ptr<Entry>>& entries);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_FAIR_QUEUE_H
@@ -0,0 +1,77 @@
+/*!
+    \file fast_open.h
+    \brief TCP Fast Open definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_FAST_OPEN_H
+#define CPPSERVER_ASIO_FAST_OPEN_H
+
+#include "asio.h"
+
+namespace CppServer {
+namespace Asio {
+
+//! TCP Fast Open
+/*!
+    TCP Fast Open (RFC 7413) allows to send the first data with the SYN
+    packet and save a round trip of the TCP handshake on repeated
+    connections to the same server.
+
+    All methods silently fail with 'false' if the OS does not support
+    TCP Fast Open (currently it is supported on Linux only).
+
+    Not thread-safe.
+*/
+class FastOpen
+{
+public:
+    FastOpen() = delete;
+    FastOpen(const FastOpen&) = delete;
+    FastOpen(FastOpen&&) = delete;
+    ~FastOpen() = delete;
+
+    FastOpen& operator=(const FastOpen&) = delete;
+    FastOpen& operator=(FastOpen&&) = delete;
+
+    //! Is TCP Fast Open supported?
+    static bool IsSupported() noexcept;
+
+    //! Enable TCP Fast Open on the given server acceptor
+    /*!
+        Should be called before the acceptor starts listening.
+
+        \param acceptor - Server acceptor
+        \param queue - Maximal number of pending TCP Fast Open requests
+        \return 'true' if TCP Fast Open was successfully enabled, 'false' if the OS does not support it
+    */
+    static bool EnableServer(asio::ip::tcp::acceptor& acceptor, size_t queue);
+    //! Enable TCP Fast Open connect on the given client socket
+    /*!
+        Should be called on the opened socket before it is connected. Connect
+        completes immediately if the TCP Fast Open cookie of the server is
+        cached, and the first sent data is carried with the SYN packet.
+
+        \param socket - Client socket
+        \return 'true' if TCP Fast Open was successfully enabled, 'false' if the OS does not support it
+    */
+    static bool EnableClient(asio::ip::tcp::socket& socket);
+
+    //! Was data carried with the SYN packet of the given connected socket?
+    /*!
+        For accepted sockets the result is known right after the accept. For
+        connected sockets the result is known after the SYN-ACK is received
+        (e.g. when the first response is received).
+
+        \param socket - Connected socket
+        \return 'true' if the connection used TCP Fast Open, 'false' otherwise
+    */
+    static bool IsUsed(asio::ip::tcp::socket& socket);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_FAST_OPEN_H
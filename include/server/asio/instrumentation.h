@@ -0,0 +1,195 @@
+/*!
+    \file instrumentation.h
+    \brief Asio service instrumentation definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_INSTRUMENTATION_H
+#define CPPSERVER_ASIO_INSTRUMENTATION_H
+
+#include "time/timestamp.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! Latency histogram snapshot
+struct LatencyHistogramSnapshot
+{
+    //! Count of histogram buckets
+    static const size_t BUCKETS = 40;
+
+    //! Histogram buckets
+    /*!
+        Bucket with the index 0 counts latencies below 1 nanosecond. Bucket with
+        the index i counts latencies in range [2^(i-1), 2^i) nanoseconds. The last
+        bucket also counts all greater latencies.
+    */
+    std::array<uint64_t, BUCKETS> buckets{};
+
+    //! Get the total count of recorded latencies
+    uint64_t count() const noexcept;
+
+    //! Get the latency percentile estimation
+    /*!
+        \param percentile - Percentile in range [0.0, 1.0]
+        \return Upper bound of the bucket which contains the given percentile in nanoseconds
+    */
+    uint64_t Percentile(double percentile) const noexcept;
+};
+
+//! Service thread statistics snapshot
+struct ServiceThreadStatisticsSnapshot
+{
+    //! Number of handlers completed by the working thread
+    uint64_t completions{0};
+    //! Number of handlers completed by the working thread per second during the last statistics interval
+    uint64_t completions_per_second{0};
+    //! Last measured event loop lag in nanoseconds
+    uint64_t loop_lag{0};
+    //! Maximal event loop lag during the last statistics interval in nanoseconds
+    uint64_t loop_lag_max{0};
+    //! Event loop lag histogram
+    LatencyHistogramSnapshot loop_lag_histogram;
+    //! Handler execution time histogram
+    LatencyHistogramSnapshot handler_histogram;
+};
+
+//! Service statistics snapshot
+struct ServiceStatisticsSnapshot
+{
+    //! Statistics of all service working threads
+    std::vector<ServiceThreadStatisticsSnapshot> threads;
+
+    //! Get the maximal event loop lag of all working threads in nanoseconds
+    uint64_t loop_lag_max() const noexcept;
+};
+
+//! Latency histogram
+/*!
+    Lock-free histogram with power of two buckets. Latencies are recorded
+    by a single working thread and could be read from any thread.
+
+    Thread-safe.
+*/
+class LatencyHistogram
+{
+public:
+    LatencyHistogram() noexcept = default;
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    ~LatencyHistogram() noexcept = default;
+
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+
+    //! Record the given latency
+    /*!
+        \param latency - Latency in nanoseconds
+    */
+    void Record(uint64_t latency) noexcept;
+
+    //! Make the histogram snapshot
+    /*!
+        \param snapshot - Snapshot to fill
+    */
+    void Snapshot(LatencyHistogramSnapshot& snapshot) const noexcept;
+
+    //! Reset the histogram
+    void Reset() noexcept;
+
+private:
+    std::array<std::atomic<uint64_t>, LatencyHistogramSnapshot::BUCKETS> _buckets{};
+};
+
+//! Service thread statistics
+/*!
+    Statistics collected by a single service working thread. While the
+    instrumentation is enabled the working thread binds its statistics
+    as the current one, so handler wrappers could record their execution
+    time with a single thread-local check. When the instrumentation is
+    disabled the current statistics is null and nothing is recorded.
+
+    Thread-safe.
+*/
+class alignas(64) ServiceThreadStatistics
+{
+public:
+    ServiceThreadStatistics() noexcept = default;
+    ServiceThreadStatistics(const ServiceThreadStatistics&) = delete;
+    ServiceThreadStatistics(ServiceThreadStatistics&&) = delete;
+    ~ServiceThreadStatistics() noexcept = default;
+
+    ServiceThreadStatistics& operator=(const ServiceThreadStatistics&) = delete;
+    ServiceThreadStatistics& operator=(ServiceThreadStatistics&&) = delete;
+
+    //! Get the statistics of the current working thread
+    /*!
+        \return Current working thread statistics or null if the instrumentation is disabled
+    */
+    static ServiceThreadStatistics* current() noexcept { return _current; }
+    //! Bind the given statistics to the current working thread
+    /*!
+        \param statistics - Working thread statistics (null to unbind)
+    */
+    static void Bind(ServiceThreadStatistics* statistics) noexcept { _current = statistics; }
+
+    //! Get the last measured event loop lag in nanoseconds
+    uint64_t loop_lag() const noexcept { return _loop_lag.load(std::memory_order_relaxed); }
+
+    //! Record the handler completion
+    void RecordCompletion() noexcept;
+    //! Record the handler execution time
+    /*!
+        \param latency - Handler execution time in nanoseconds
+    */
+    void RecordHandler(uint64_t latency) noexcept;
+    //! Record the event loop lag
+    /*!
+        \param latency - Event loop lag in nanoseconds
+    */
+    void RecordLoopLag(uint64_t latency) noexcept;
+
+    //! Update the completions rate and reset the maximal event loop lag of the statistics interval
+    /*!
+        \param timestamp - Current timestamp in nanoseconds
+    */
+    void Update(uint64_t timestamp) noexcept;
+
+    //! Make the statistics snapshot
+    /*!
+        \param snapshot - Snapshot to fill
+    */
+    void Snapshot(ServiceThreadStatisticsSnapshot& snapshot) const noexcept;
+
+    //! Reset the statistics
+    void Reset() noexcept;
+
+private:
+    std::atomic<uint64_t> _completions{0};
+    std::atomic<uint64_t> _completions_per_second{0};
+    std::atomic<uint64_t> _loop_lag{0};
+    std::atomic<uint64_t> _loop_lag_max{0};
+    std::atomic<uint64_t> _loop_lag_interval_max{0};
+    LatencyHistogram _loop_lag_histogram;
+    LatencyHistogram _handler_histogram;
+    // Statistics interval state is updated by the single statistics task
+    uint64_t _update_completions{0};
+    uint64_t _update_timestamp{0};
+
+    static inline thread_local ServiceThreadStatistics* _current = nullptr;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#include "instrumentation.inl"
+
+#endif // CPPSERVER_ASIO_INSTRUMENTATION_H
@@ -0,0 +1,132 @@
+/*!
+    \file instrumentation.inl
+    \brief Asio service instrumentation inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppServer {
+namespace Asio {
+
+inline uint64_t LatencyHistogramSnapshot::count() const noexcept
+{
+    uint64_t result = 0;
+    for (auto bucket : buckets)
+        result += bucket;
+    return result;
+}
+
+inline uint64_t LatencyHistogramSnapshot::Percentile(double percentile) const noexcept
+{
+    uint64_t total = count();
+    if (total == 0)
+        return 0;
+
+    // Find the bucket which contains the given percentile
+    uint64_t threshold = (uint64_t)(percentile * total);
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < BUCKETS; ++i)
+    {
+        accumulated += buckets[i];
+        if ((accumulated > threshold) || (accumulated == total))
+            return (i == 0) ? 1 : (1ull << i);
+    }
+
+    return 1ull << (BUCKETS - 1);
+}
+
+inline uint64_t ServiceStatisticsSnapshot::loop_lag_max() const noexcept
+{
+    uint64_t result = 0;
+    for (const auto& thread : threads)
+        if (thread.loop_lag_max > result)
+            result = thread.loop_lag_max;
+    return result;
+}
+
+inline void LatencyHistogram::Record(uint64_t latency) noexcept
+{
+    // Calculate the power of two bucket index
+    size_t index = 0;
+    while ((latency > 0) && (index < (LatencyHistogramSnapshot::BUCKETS - 1)))
+    {
+        latency >>= 1;
+        ++index;
+    }
+
+    _buckets[index].fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void LatencyHistogram::Snapshot(LatencyHistogramSnapshot& snapshot) const noexcept
+{
+    for (size_t i = 0; i < LatencyHistogramSnapshot::BUCKETS; ++i)
+        snapshot.buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+}
+
+inline void LatencyHistogram::Reset() noexcept
+{
+    for (auto& bucket : _buckets)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+inline void ServiceThreadStatistics::RecordCompletion() noexcept
+{
+    _completions.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void ServiceThreadStatistics::RecordHandler(uint64_t latency) noexcept
+{
+    _handler_histogram.Record(latency);
+}
+
+inline void ServiceThreadStatistics::RecordLoopLag(uint64_t latency) noexcept
+{
+    _loop_lag.store(latency, std::memory_order_relaxed);
+    _loop_lag_histogram.Record(latency);
+
+    // Update the maximal event loop lag of the current statistics interval
+    uint64_t maximum = _loop_lag_interval_max.load(std::memory_order_relaxed);
+    while ((latency > maximum) && !_loop_lag_interval_max.compare_exchange_weak(maximum, latency, std::memory_order_relaxed));
+}
+
+inline void ServiceThreadStatistics::Update(uint64_t timestamp) noexcept
+{
+    uint64_t completions = _completions.load(std::memory_order_relaxed);
+
+    // Calculate the completions rate of the statistics interval
+    if ((_update_timestamp > 0) && (timestamp > _update_timestamp))
+        _completions_per_second.store((completions - _update_completions) * 1000000000 / (timestamp - _update_timestamp), std::memory_order_relaxed);
+
+    _update_completions = completions;
+    _update_timestamp = timestamp;
+
+    // Start a new statistics interval for the maximal event loop lag
+    _loop_lag_max.store(_loop_lag_interval_max.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+inline void ServiceThreadStatistics::Snapshot(ServiceThreadStatisticsSnapshot& snapshot) const noexcept
+{
+    snapshot.completions = _completions.load(std::memory_order_relaxed);
+    snapshot.completions_per_second = _completions_per_second.load(std::memory_order_relaxed);
+    snapshot.loop_lag = _loop_lag.load(std::memory_order_relaxed);
+    snapshot.loop_lag_max = _loop_lag_max.load(std::memory_order_relaxed);
+    _loop_lag_histogram.Snapshot(snapshot.loop_lag_histogram);
+    _handler_histogram.Snapshot(snapshot.handler_histogram);
+}
+
+inline void ServiceThreadStatistics::Reset() noexcept
+{
+    _completions.store(0, std::memory_order_relaxed);
+    _completions_per_second.store(0, std::memory_order_relaxed);
+    _loop_lag.store(0, std::memory_order_relaxed);
+    _loop_lag_max.store(0, std::memory_order_relaxed);
+    _loop_lag_interval_max.store(0, std::memory_order_relaxed);
+    _loop_lag_histogram.Reset();
+    _handler_histogram.Reset();
+    _update_completions = 0;
+    _update_timestamp = 0;
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,105 @@
+/*!
+    \file journal.h
+    \brief Asio multicast journal definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_JOURNAL_H
+#define CPPSERVER_ASIO_JOURNAL_H
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! Asio multicast journal
+/*!
+    Multicast journal is a bounded in-memory ring of the last multicast
+    messages. Each message gets a sequence number starting from one.
+    Messages are stored by the same shared immutable buffers which are
+    multicast to working threads, so journaling does not copy data.
+
+    The oldest messages are evicted when either the messages limit or the
+    bytes limit is exceeded. The latest message is always kept.
+
+    Thread-safe.
+*/
+class MulticastJournal
+{
+public:
+    //! Journal message type
+    typedef std::shared_ptr<const std::vector<uint8_t>> Message;
+
+    //! Initialize multicast journal with given limits
+    /*!
+        \param messages - Limit of journal messages (zero means unlimited)
+        \param bytes - Limit of journal bytes (zero means unlimited)
+    */
+    MulticastJournal(size_t messages, size_t bytes);
+    MulticastJournal(const MulticastJournal&) = delete;
+    MulticastJournal(MulticastJournal&&) = delete;
+    ~MulticastJournal() = default;
+
+    MulticastJournal& operator=(const MulticastJournal&) = delete;
+    MulticastJournal& operator=(MulticastJournal&&) = delete;
+
+    //! Get the limit of journal messages
+    size_t limit_messages() const noexcept { return _limit_messages; }
+    //! Get the limit of journal bytes
+    size_t limit_bytes() const noexcept { return _limit_bytes; }
+
+    //! Get the number of journal messages
+    size_t size() const;
+    //! Get the number of journal bytes
+    size_t bytes() const;
+    //! Get the sequence number of the oldest journal message
+    uint64_t first_sequence() const;
+    //! Get the sequence number which will be assigned to the next journal message
+    uint64_t next_sequence() const;
+
+    //! Append the given message to the journal
+    /*!
+        \param message - Message to append
+        \return Sequence number of the appended message
+    */
+    uint64_t Append(const Message& message);
+
+    //! Read journal messages starting from the given sequence number
+    /*!
+        Messages are read until the given bytes budget is exhausted, but at
+        least one message is read if available. If some requested messages
+        were already evicted reading starts from the oldest journal message.
+
+        \param sequence - Sequence number of the first message to read
+        \param budget - Budget of bytes to read
+        \param messages - Messages vector to fill
+        \return Sequence number of the first read message
+    */
+    uint64_t Read(uint64_t sequence, size_t budget, std::vector<Message>& messages) const;
+
+    //! Clear the journal
+    /*!
+        Sequence numbers are not reset, so sessions never receive
+        a new message with an already used sequence number.
+    */
+    void Clear();
+
+private:
+    mutable std::mutex _lock;
+    std::deque<Message> _messages;
+    uint64_t _first_sequence;
+    size_t _bytes;
+    size_t _limit_messages;
+    size_t _limit_bytes;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_JOURNAL_H
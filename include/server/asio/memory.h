@@ -9,6 +9,8 @@
 #ifndef CPPSERVER_ASIO_MEMORY_H
 #define CPPSERVER_ASIO_MEMORY_H
 
+#include "instrumentation.h"
+
 #include <memory>
 
 namespace CppServer {
@@ -126,6 +128,9 @@ private:
     member function are used by the asynchronous operations to obtain the
     allocator. Calls to operator() are forwarded to the encapsulated handler.
 
+    If the service instrumentation is enabled for the current working thread
+    then the handler execution time is recorded into its statistics.
+
     Not thread-safe.
 */
 template <typename THandler>
@@ -153,7 +158,20 @@ public:
 
     //! Wrap the handler
     template <typename ...Args>
-    void operator()(Args&&... args) { _handler(std::forward<Args>(args)...); }
+    void operator()(Args&&... args)
+    {
+        ServiceThreadStatistics* statistics = ServiceThreadStatistics::current();
+        if (statistics == nullptr)
+        {
+            _handler(std::forward<Args>(args)...);
+            return;
+        }
+
+        // Measure the handler execution time
+        uint64_t timestamp = CppCommon::Timestamp::nano();
+        _handler(std::forward<Args>(args)...);
+        statistics->RecordHandler(CppCommon::Timestamp::nano() - timestamp);
+    }
 
 private:
     HandlerStorage& _storage;
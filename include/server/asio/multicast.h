@@ -0,0 +1,82 @@
+/*!
+    \file multicast.h
+    \brief Asio batched multicast definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_MULTICAST_H
+#define CPPSERVER_ASIO_MULTICAST_H
+
+#include "service.h"
+
+#include "system/uuid.h"
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! Multicast the given handler to all sessions batched by their working threads
+/*!
+    Sessions are split by the Asio IO service which owns them and a single
+    task is posted to each Asio IO service. The task calls the given handler
+    for all its sessions on the owning working thread, so sessions append
+    to their send buffers and start writing locally. Cross-thread wake-ups
+    are reduced from one per session to one per working thread.
+
+    If the Asio IO service is shared by several working threads (thread-pool
+    design) tasks are posted through the service strand. Otherwise two tasks
+    of consecutive multicasts could run concurrently on different threads and
+    append to the same session send buffer in the wrong order.
+
+    The method must be called under the shared lock of the given sessions.
+
+    \param service - Asio service
+    \param sessions - Sessions map
+    \param handler - Handler to call for each session with the session shared pointer
+*/
+template <class TSession, class THandler>
+void MulticastBatched(const std::shared_ptr<Service>& service, const std::map<CppCommon::UUID, std::shared_ptr<TSession>>& sessions, const THandler& handler)
+{
+    typedef std::vector<std::shared_ptr<TSession>> Batch;
+
+    // Split sessions by their working threads
+    std::vector<std::pair<std::shared_ptr<asio::io_service>, std::shared_ptr<Batch>>> batches;
+    for (const auto& session : sessions)
+    {
+        const auto& io_service = session.second->io_service();
+
+        auto it = batches.begin();
+        while ((it != batches.end()) && (it->first != io_service))
+            ++it;
+        if (it == batches.end())
+            it = batches.emplace(batches.end(), io_service, std::make_shared<Batch>());
+
+        it->second->push_back(session.second);
+    }
+
+    // Post a single multicast task per working thread
+    for (const auto& batch : batches)
+    {
+        auto sessions_batch = batch.second;
+        auto multicast_handler = [sessions_batch, handler]()
+        {
+            for (const auto& session : *sessions_batch)
+                handler(session);
+        };
+        if (service->IsStrandRequired())
+            service->Post(multicast_handler);
+        else
+            batch.first->post(multicast_handler);
+    }
+}
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_MULTICAST_H
@@ -0,0 +1,123 @@
+/*!
+    \file poll.h
+    \brief Asio poll-based synchronous I/O with timeout definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_POLL_H
+#define CPPSERVER_ASIO_POLL_H
+
+#include "asio.h"
+
+#include "time/timespan.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#define CPPSERVER_POLL
+#endif
+
+namespace CppServer {
+namespace Asio {
+
+//! Poll-based synchronous I/O with timeout
+/*!
+    Timed synchronous I/O helpers which perform a non-blocking socket
+    operation and wait for the socket readiness with poll() until the
+    deadline. No timers, mutexes, condition variables or heap allocations
+    are used per call.
+
+    On platforms without poll() support timed operations fall back to
+    Asio asynchronous operations with the timeout timer.
+
+    Not thread-safe.
+*/
+class Poll
+{
+public:
+    Poll() = delete;
+    Poll(const Poll&) = delete;
+    Poll(Poll&&) = delete;
+    ~Poll() = delete;
+
+    Poll& operator=(const Poll&) = delete;
+    Poll& operator=(Poll&&) = delete;
+
+#if defined(CPPSERVER_POLL)
+    //! Wait for the socket to be ready for reading or writing until the deadline
+    /*!
+        \param socket - Native socket handle
+        \param write - Wait for write readiness flag
+        \param deadline - Deadline
+        \param ec - Error code (asio::error::timed_out if the deadline is expired)
+        \return 'true' if the socket is ready, 'false' on timeout or error
+    */
+    static bool Wait(int socket, bool write, const std::chrono::steady_clock::time_point& deadline, asio::error_code& ec);
+#endif
+
+    //! Send some data into the stream socket with timeout
+    /*!
+        \param socket - Stream socket
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \param timeout - Timeout
+        \param ec - Error code (asio::error::timed_out if the timeout is expired)
+        \return Size of sent data
+    */
+    template <class TSocket>
+    static size_t Send(TSocket& socket, const void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec);
+    //! Receive some data from the stream socket with timeout
+    /*!
+        \param socket - Stream socket
+        \param buffer - Buffer to receive
+        \param size - Buffer size to receive
+        \param timeout - Timeout
+        \param ec - Error code (asio::error::timed_out if the timeout is expired)
+        \return Size of received data
+    */
+    template <class TSocket>
+    static size_t Receive(TSocket& socket, void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec);
+
+    //! Send the datagram into the given endpoint with timeout
+    /*!
+        \param socket - Datagram socket
+        \param endpoint - Endpoint to send
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \param timeout - Timeout
+        \param ec - Error code (asio::error::timed_out if the timeout is expired)
+        \return Size of sent datagram
+    */
+    template <class TSocket, class TEndpoint>
+    static size_t SendTo(TSocket& socket, const TEndpoint& endpoint, const void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec);
+    //! Receive the datagram from the given endpoint with timeout
+    /*!
+        \param socket - Datagram socket
+        \param endpoint - Endpoint to receive from
+        \param buffer - Datagram buffer to receive
+        \param size - Datagram buffer size to receive
+        \param timeout - Timeout
+        \param ec - Error code (asio::error::timed_out if the timeout is expired)
+        \return Size of received datagram
+    */
+    template <class TSocket, class TEndpoint>
+    static size_t ReceiveFrom(TSocket& socket, TEndpoint& endpoint, void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec);
+
+private:
+#if !defined(CPPSERVER_POLL)
+    //! Perform the asynchronous operation and wait for its completion with timeout
+    template <class TSocket, class TOperation>
+    static size_t Async(TSocket& socket, TOperation operation, const CppCommon::Timespan& timeout, asio::error_code& ec);
+#endif
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#include "poll.inl"
+
+#endif // CPPSERVER_ASIO_POLL_H
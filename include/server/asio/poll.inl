@@ -0,0 +1,207 @@
+/*!
+    \file poll.inl
+    \brief Asio poll-based synchronous I/O with timeout inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#if defined(CPPSERVER_POLL)
+#include <sys/socket.h>
+#include <cerrno>
+#endif
+
+namespace CppServer {
+namespace Asio {
+
+#if defined(CPPSERVER_POLL)
+
+#if defined(MSG_NOSIGNAL)
+#define CPPSERVER_POLL_FLAGS (MSG_DONTWAIT | MSG_NOSIGNAL)
+#else
+#define CPPSERVER_POLL_FLAGS MSG_DONTWAIT
+#endif
+
+template <class TSocket>
+inline size_t Poll::Send(TSocket& socket, const void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout.chrono();
+    for (;;)
+    {
+        // Try to send data without blocking
+        auto result = ::send(socket.native_handle(), buffer, size, CPPSERVER_POLL_FLAGS);
+        if (result >= 0)
+        {
+            ec.clear();
+            return (size_t)result;
+        }
+        if (errno == EINTR)
+            continue;
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+        {
+            ec = asio::error_code(errno, asio::error::get_system_category());
+            return 0;
+        }
+
+        // Wait until the socket is ready for writing
+        if (!Wait(socket.native_handle(), true, deadline, ec))
+            return 0;
+    }
+}
+
+template <class TSocket>
+inline size_t Poll::Receive(TSocket& socket, void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout.chrono();
+    for (;;)
+    {
+        // Try to receive data without blocking
+        auto result = ::recv(socket.native_handle(), buffer, size, MSG_DONTWAIT);
+        if (result > 0)
+        {
+            ec.clear();
+            return (size_t)result;
+        }
+        if (result == 0)
+        {
+            ec = asio::error::eof;
+            return 0;
+        }
+        if (errno == EINTR)
+            continue;
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+        {
+            ec = asio::error_code(errno, asio::error::get_system_category());
+            return 0;
+        }
+
+        // Wait until the socket is ready for reading
+        if (!Wait(socket.native_handle(), false, deadline, ec))
+            return 0;
+    }
+}
+
+template <class TSocket, class TEndpoint>
+inline size_t Poll::SendTo(TSocket& socket, const TEndpoint& endpoint, const void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout.chrono();
+    for (;;)
+    {
+        // Try to send the datagram without blocking
+        auto result = ::sendto(socket.native_handle(), buffer, size, CPPSERVER_POLL_FLAGS, endpoint.data(), (socklen_t)endpoint.size());
+        if (result >= 0)
+        {
+            ec.clear();
+            return (size_t)result;
+        }
+        if (errno == EINTR)
+            continue;
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+        {
+            ec = asio::error_code(errno, asio::error::get_system_category());
+            return 0;
+        }
+
+        // Wait until the socket is ready for writing
+        if (!Wait(socket.native_handle(), true, deadline, ec))
+            return 0;
+    }
+}
+
+template <class TSocket, class TEndpoint>
+inline size_t Poll::ReceiveFrom(TSocket& socket, TEndpoint& endpoint, void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout.chrono();
+    for (;;)
+    {
+        // Try to receive the datagram without blocking
+        socklen_t length = (socklen_t)endpoint.capacity();
+        auto result = ::recvfrom(socket.native_handle(), buffer, size, MSG_DONTWAIT, endpoint.data(), &length);
+        if (result >= 0)
+        {
+            endpoint.resize(length);
+            ec.clear();
+            return (size_t)result;
+        }
+        if (errno == EINTR)
+            continue;
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+        {
+            ec = asio::error_code(errno, asio::error::get_system_category());
+            return 0;
+        }
+
+        // Wait until the socket is ready for reading
+        if (!Wait(socket.native_handle(), false, deadline, ec))
+            return 0;
+    }
+}
+
+#undef CPPSERVER_POLL_FLAGS
+
+#else
+
+template <class TSocket, class TOperation>
+inline size_t Poll::Async(TSocket& socket, TOperation operation, const CppCommon::Timespan& timeout, asio::error_code& ec)
+{
+    int done = 0;
+    std::mutex mtx;
+    std::condition_variable cv;
+    asio::system_timer timer(socket.get_executor());
+
+    // Prepare done handler
+    auto async_done_handler = [&](asio::error_code error)
+    {
+        std::unique_lock<std::mutex> lck(mtx);
+        if (done++ == 0)
+        {
+            ec = error;
+            socket.cancel();
+            timer.cancel();
+        }
+        cv.notify_one();
+    };
+
+    // Async wait for timeout
+    timer.expires_from_now(timeout.chrono());
+    timer.async_wait([&](const asio::error_code& error) { async_done_handler(error ? error : asio::error::timed_out); });
+
+    // Async perform the operation
+    size_t result = 0;
+    operation([&](std::error_code error, size_t size) { result = size; async_done_handler(error); });
+
+    // Wait for complete or timeout
+    std::unique_lock<std::mutex> lck(mtx);
+    cv.wait(lck, [&]() { return done == 2; });
+
+    return result;
+}
+
+template <class TSocket>
+inline size_t Poll::Send(TSocket& socket, const void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec)
+{
+    return Async(socket, [&](auto handler) { socket.async_write_some(asio::buffer(buffer, size), handler); }, timeout, ec);
+}
+
+template <class TSocket>
+inline size_t Poll::Receive(TSocket& socket, void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec)
+{
+    return Async(socket, [&](auto handler) { socket.async_read_some(asio::buffer(buffer, size), handler); }, timeout, ec);
+}
+
+template <class TSocket, class TEndpoint>
+inline size_t Poll::SendTo(TSocket& socket, const TEndpoint& endpoint, const void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec)
+{
+    return Async(socket, [&](auto handler) { socket.async_send_to(asio::buffer(buffer, size), endpoint, handler); }, timeout, ec);
+}
+
+template <class TSocket, class TEndpoint>
+inline size_t Poll::ReceiveFrom(TSocket& socket, TEndpoint& endpoint, void* buffer, size_t size, const CppCommon::Timespan& timeout, asio::error_code& ec)
+{
+    return Async(socket, [&](auto handler) { socket.async_receive_from(asio::buffer(buffer, size), endpoint, handler); }, timeout, ec);
+}
+
+#endif
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,169 @@
+/*!
+    \file rate_limiter.h
+    \brief Asio rate limiter definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_RATE_LIMITER_H
+#define CPPSERVER_ASIO_RATE_LIMITER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace CppServer {
+namespace Asio {
+
+//! Token bucket
+/*!
+    Token bucket is implemented with the generic cell rate algorithm which
+    keeps only the theoretical arrival time of the next token. Tokens are
+    consumed after the operation is completed, so the bucket could go into
+    debt and the next operation should be delayed until the debt is repaid.
+
+    Thread-safe.
+*/
+class TokenBucket
+{
+public:
+    TokenBucket() noexcept : _rate(0), _burst(0), _tolerance(0), _tat(0) {}
+    TokenBucket(const TokenBucket&) = delete;
+    TokenBucket(TokenBucket&&) = delete;
+    ~TokenBucket() noexcept = default;
+
+    TokenBucket& operator=(const TokenBucket&) = delete;
+    TokenBucket& operator=(TokenBucket&&) = delete;
+
+    //! Get the rate of tokens per second
+    uint64_t rate() const noexcept { return _rate; }
+    //! Get the count of tokens which could be consumed at once
+    uint64_t burst() const noexcept { return _burst; }
+
+    //! Is the token bucket limited?
+    bool IsLimited() const noexcept { return _rate > 0; }
+    //! Is the token bucket full?
+    /*!
+        \param timestamp - Current timestamp in nanoseconds
+    */
+    bool IsFull(uint64_t timestamp) const noexcept { return _tat <= timestamp; }
+
+    //! Setup the token bucket
+    /*!
+        \param rate - Rate of tokens per second (zero means unlimited)
+        \param burst - Count of tokens which could be consumed at once
+    */
+    void Setup(uint64_t rate, uint64_t burst) noexcept;
+
+    //! Consume the given count of tokens
+    /*!
+        \param tokens - Count of tokens to consume
+        \param timestamp - Current timestamp in nanoseconds
+    */
+    void Consume(uint64_t tokens, uint64_t timestamp) noexcept;
+
+    //! Get the count of tokens available to consume without the debt
+    /*!
+        \param timestamp - Current timestamp in nanoseconds
+        \return Count of available tokens (maximal value for the unlimited bucket)
+    */
+    uint64_t Available(uint64_t timestamp) const noexcept;
+    //! Get the delay until the bucket debt is repaid and the given count of tokens is available
+    /*!
+        Count of tokens is limited by the burst, so the delay is always finite.
+
+        \param timestamp - Current timestamp in nanoseconds
+        \param tokens - Count of tokens required (default is 0)
+        \return Delay in nanoseconds
+    */
+    uint64_t Delay(uint64_t timestamp, uint64_t tokens = 0) const noexcept;
+
+    //! Reset the token bucket to the full state
+    void Reset() noexcept { _tat = 0; }
+
+private:
+    std::atomic<uint64_t> _rate;
+    std::atomic<uint64_t> _burst;
+    std::atomic<uint64_t> _tolerance;
+    std::atomic<uint64_t> _tat;
+};
+
+//! Rate limiter
+/*!
+    Rate limiter combines token buckets for bytes and messages per second.
+    Each bucket allows a burst of one second worth of tokens.
+
+    Thread-safe.
+*/
+class RateLimiter
+{
+public:
+    RateLimiter() noexcept = default;
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter(RateLimiter&&) = delete;
+    ~RateLimiter() noexcept = default;
+
+    RateLimiter& operator=(const RateLimiter&) = delete;
+    RateLimiter& operator=(RateLimiter&&) = delete;
+
+    //! Get the limit of bytes per second
+    uint64_t bytes_per_second() const noexcept { return _bytes.rate(); }
+    //! Get the limit of messages per second
+    uint64_t messages_per_second() const noexcept { return _messages.rate(); }
+
+    //! Is the rate limiter limited?
+    bool IsLimited() const noexcept { return _bytes.IsLimited() || _messages.IsLimited(); }
+    //! Is the rate limiter full?
+    /*!
+        \param timestamp - Current timestamp in nanoseconds
+    */
+    bool IsFull(uint64_t timestamp) const noexcept { return _bytes.IsFull(timestamp) && _messages.IsFull(timestamp); }
+
+    //! Setup the rate limiter
+    /*!
+        \param bytes_per_second - Limit of bytes per second (zero means unlimited)
+        \param messages_per_second - Limit of messages per second (zero means unlimited)
+    */
+    void Setup(uint64_t bytes_per_second, uint64_t messages_per_second) noexcept
+    { _bytes.Setup(bytes_per_second, bytes_per_second); _messages.Setup(messages_per_second, messages_per_second); }
+
+    //! Consume the given count of bytes and messages
+    /*!
+        \param bytes - Count of bytes to consume
+        \param messages - Count of messages to consume
+        \param timestamp - Current timestamp in nanoseconds
+    */
+    void Consume(uint64_t bytes, uint64_t messages, uint64_t timestamp) noexcept
+    { _bytes.Consume(bytes, timestamp); _messages.Consume(messages, timestamp); }
+
+    //! Get the count of bytes available to consume without the debt
+    /*!
+        \param timestamp - Current timestamp in nanoseconds
+        \return Count of available bytes (maximal value for the unlimited bytes rate)
+    */
+    uint64_t Available(uint64_t timestamp) const noexcept { return _bytes.Available(timestamp); }
+    //! Get the delay until the rate limiter debt is repaid and the given count of bytes is available
+    /*!
+        \param timestamp - Current timestamp in nanoseconds
+        \param bytes - Count of bytes required (default is 0)
+        \return Delay in nanoseconds
+    */
+    uint64_t Delay(uint64_t timestamp, uint64_t bytes = 0) const noexcept
+    { return std::max(_bytes.Delay(timestamp, bytes), _messages.Delay(timestamp)); }
+
+    //! Reset the rate limiter to the full state
+    void Reset() noexcept { _bytes.Reset(); _messages.Reset(); }
+
+private:
+    TokenBucket _bytes;
+    TokenBucket _messages;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#include "rate_limiter.inl"
+
+#endif // CPPSERVER_ASIO_RATE_LIMITER_H
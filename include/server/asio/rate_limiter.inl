@@ -0,0 +1,65 @@
+/*!
+    \file rate_limiter.inl
+    \brief Asio rate limiter inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppServer {
+namespace Asio {
+
+inline void TokenBucket::Setup(uint64_t rate, uint64_t burst) noexcept
+{
+    _rate = rate;
+    _burst = burst;
+    _tolerance = (rate > 0) ? (burst * 1000000000 / rate) : 0;
+    _tat = 0;
+}
+
+inline void TokenBucket::Consume(uint64_t tokens, uint64_t timestamp) noexcept
+{
+    uint64_t rate = _rate;
+    if ((rate == 0) || (tokens == 0))
+        return;
+
+    // Calculate the emission interval of the consumed tokens
+    uint64_t increment = std::max<uint64_t>(tokens * 1000000000 / rate, 1);
+
+    // Shift the theoretical arrival time of the next token
+    uint64_t tat = _tat.load(std::memory_order_relaxed);
+    while (!_tat.compare_exchange_weak(tat, std::max(tat, timestamp) + increment, std::memory_order_relaxed));
+}
+
+inline uint64_t TokenBucket::Available(uint64_t timestamp) const noexcept
+{
+    uint64_t rate = _rate;
+    if (rate == 0)
+        return std::numeric_limits<uint64_t>::max();
+
+    // Tokens are available for the interval between the theoretical arrival time and the tolerance limit
+    uint64_t tat = std::max(_tat.load(std::memory_order_relaxed), timestamp);
+    uint64_t allowed = timestamp + _tolerance;
+    if (tat >= allowed)
+        return 0;
+
+    uint64_t interval = allowed - tat;
+    return (interval / 1000000000) * rate + (interval % 1000000000) * rate / 1000000000;
+}
+
+inline uint64_t TokenBucket::Delay(uint64_t timestamp, uint64_t tokens) const noexcept
+{
+    uint64_t rate = _rate;
+    if (rate == 0)
+        return 0;
+
+    // Calculate the emission interval of the required tokens
+    uint64_t increment = std::min<uint64_t>(tokens, _burst) * 1000000000 / rate;
+
+    uint64_t tat = std::max(_tat.load(std::memory_order_relaxed), timestamp) + increment;
+    uint64_t allowed = timestamp + _tolerance;
+    return (tat > allowed) ? (tat - allowed) : 0;
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,151 @@
+/*!
+    \file resolver_cache.h
+    \brief Asio DNS resolver cache definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_RESOLVER_CACHE_H
+#define CPPSERVER_ASIO_RESOLVER_CACHE_H
+
+#include "asio.h"
+
+#include "time/timespan.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! Asio DNS resolver cache
+/*!
+    DNS resolver cache keeps results of asynchronous DNS resolutions for the
+    given time to live, so repeated connects to the same host do not pay
+    the resolution latency each time.
+
+    Failed resolutions are cached for the separate negative time to live.
+    Concurrent lookups of the same host and service are coalesced into
+    a single resolution. If background refresh is enabled the cached entry
+    which is used after 3/4 of its time to live is refreshed in background
+    while the cached results are still served to callers.
+
+    Thread-safe.
+*/
+template <class TProtocol>
+class ResolverCache : public std::enable_shared_from_this<ResolverCache<TProtocol>>
+{
+public:
+    //! Resolver results type
+    typedef typename TProtocol::resolver::results_type Results;
+    //! Resolve handler
+    typedef std::function<void(std::error_code ec, const Results& results)> Handler;
+
+    //! Initialize DNS resolver cache with a given Asio IO service
+    /*!
+        \param io_service - Asio IO service
+    */
+    explicit ResolverCache(const std::shared_ptr<asio::io_service>& io_service);
+    ResolverCache(const ResolverCache&) = delete;
+    ResolverCache(ResolverCache&&) = delete;
+    ~ResolverCache() = default;
+
+    ResolverCache& operator=(const ResolverCache&) = delete;
+    ResolverCache& operator=(ResolverCache&&) = delete;
+
+    //! Get the number of cached entries
+    size_t size() const;
+
+    //! Get the number of lookups
+    uint64_t lookups() const noexcept { return _lookups; }
+    //! Get the number of lookups served from the cache
+    uint64_t hits() const noexcept { return _hits; }
+    //! Get the number of lookups coalesced with the pending resolution
+    uint64_t coalesced() const noexcept { return _coalesced; }
+    //! Get the number of started DNS resolutions
+    uint64_t resolutions() const noexcept { return _resolutions; }
+    //! Get the number of started background refreshes
+    uint64_t refreshes() const noexcept { return _refreshes; }
+
+    //! Get the option: time to live of resolved entries
+    const CppCommon::Timespan& option_ttl() const noexcept { return _option_ttl; }
+    //! Get the option: time to live of failed entries
+    const CppCommon::Timespan& option_negative_ttl() const noexcept { return _option_negative_ttl; }
+    //! Get the option: background refresh
+    bool option_refresh() const noexcept { return _option_refresh; }
+
+    //! Resolve the given host and service with the given resolver (asynchronous)
+    /*!
+        The handler is called on the resolver working thread.
+
+        \param resolver - Asio resolver used if the resolution is required
+        \param host - Host name
+        \param service - Service name or port number
+        \param handler - Resolve handler
+    */
+    void ResolveAsync(typename TProtocol::resolver& resolver, const std::string& host, const std::string& service, const Handler& handler);
+
+    //! Clear all cached entries
+    void Clear();
+
+    //! Setup option: time to live of resolved and failed entries
+    /*!
+        System resolver does not provide record TTLs, so the given time to live
+        is applied to all resolved entries.
+
+        \param ttl - Time to live of resolved entries
+        \param negative_ttl - Time to live of failed entries
+    */
+    void SetupTTL(const CppCommon::Timespan& ttl, const CppCommon::Timespan& negative_ttl) noexcept { _option_ttl = ttl; _option_negative_ttl = negative_ttl; }
+    //! Setup option: background refresh
+    /*!
+        \param enable - Enable/disable option
+    */
+    void SetupRefresh(bool enable) noexcept { _option_refresh = enable; }
+
+private:
+    // Cached entry
+    struct Entry
+    {
+        std::error_code error;
+        Results results;
+        uint64_t expiration;
+        uint64_t refresh;
+    };
+
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Cached entries & pending resolutions
+    mutable std::mutex _lock;
+    std::map<std::string, Entry> _entries;
+    std::map<std::string, std::vector<Handler>> _pending;
+    // Cache statistic
+    std::atomic<uint64_t> _lookups{0};
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _coalesced{0};
+    std::atomic<uint64_t> _resolutions{0};
+    std::atomic<uint64_t> _refreshes{0};
+    // Options
+    CppCommon::Timespan _option_ttl{CppCommon::Timespan::seconds(60)};
+    CppCommon::Timespan _option_negative_ttl{CppCommon::Timespan::seconds(1)};
+    bool _option_refresh{true};
+
+    //! Start the DNS resolution of the given cached entry
+    void Resolve(typename TProtocol::resolver& resolver, const std::string& key, const std::string& host, const std::string& service);
+    //! Complete the DNS resolution of the given cached entry
+    void Complete(const std::string& key, std::error_code ec, const Results& results);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#include "resolver_cache.inl"
+
+#endif // CPPSERVER_ASIO_RESOLVER_CACHE_H
@@ -0,0 +1,141 @@
+/*!
+    \file resolver_cache.inl
+    \brief Asio DNS resolver cache inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include <algorithm>
+
+namespace CppServer {
+namespace Asio {
+
+template <class TProtocol>
+inline ResolverCache<TProtocol>::ResolverCache(const std::shared_ptr<asio::io_service>& io_service)
+    : _io_service(io_service)
+{
+}
+
+template <class TProtocol>
+inline size_t ResolverCache<TProtocol>::size() const
+{
+    std::scoped_lock locker(_lock);
+
+    return _entries.size();
+}
+
+template <class TProtocol>
+inline void ResolverCache<TProtocol>::ResolveAsync(typename TProtocol::resolver& resolver, const std::string& host, const std::string& service, const Handler& handler)
+{
+    ++_lookups;
+
+    std::string key = host + ":" + service;
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+
+    {
+        std::scoped_lock locker(_lock);
+
+        // Serve the lookup from the cache
+        auto it = _entries.find(key);
+        if ((it != _entries.end()) && (timestamp < it->second.expiration))
+        {
+            ++_hits;
+
+            std::error_code ec = it->second.error;
+            Results results = it->second.results;
+            _io_service->post([handler, ec, results]() { handler(ec, results); });
+
+            // Refresh the resolved entry in background
+            if (_option_refresh && !ec && (timestamp >= it->second.refresh) && (_pending.find(key) == _pending.end()))
+            {
+                ++_refreshes;
+                _pending[key];
+                Resolve(resolver, key, host, service);
+            }
+            return;
+        }
+
+        // Coalesce the lookup with the pending resolution or background refresh
+        auto pending = _pending.find(key);
+        if (pending != _pending.end())
+        {
+            ++_coalesced;
+            pending->second.push_back(handler);
+            return;
+        }
+
+        // Register the lookup as the pending resolution
+        _pending[key].push_back(handler);
+    }
+
+    // Resolve the lookup
+    Resolve(resolver, key, host, service);
+}
+
+template <class TProtocol>
+inline void ResolverCache<TProtocol>::Clear()
+{
+    std::scoped_lock locker(_lock);
+
+    _entries.clear();
+}
+
+template <class TProtocol>
+inline void ResolverCache<TProtocol>::Resolve(typename TProtocol::resolver& resolver, const std::string& key, const std::string& host, const std::string& service)
+{
+    ++_resolutions;
+
+    auto self(this->shared_from_this());
+    auto async_resolve_handler = [this, self, key](std::error_code ec, Results results)
+    {
+        Complete(key, ec, results);
+    };
+    typename TProtocol::resolver::query query(host, service);
+    resolver.async_resolve(query, async_resolve_handler);
+}
+
+template <class TProtocol>
+inline void ResolverCache<TProtocol>::Complete(const std::string& key, std::error_code ec, const Results& results)
+{
+    std::vector<Handler> waiters;
+
+    {
+        std::scoped_lock locker(_lock);
+
+        // Take pending lookups
+        auto it = _pending.find(key);
+        if (it != _pending.end())
+        {
+            waiters = std::move(it->second);
+            _pending.erase(it);
+        }
+
+        uint64_t timestamp = CppCommon::Timestamp::nano();
+        uint64_t ttl = (uint64_t)std::max<int64_t>(_option_ttl.total(), 0);
+        uint64_t negative_ttl = (uint64_t)std::max<int64_t>(_option_negative_ttl.total(), 0);
+
+        if (!ec)
+        {
+            // Cache resolved results
+            if (ttl > 0)
+                _entries[key] = Entry{ ec, results, timestamp + ttl, timestamp + ttl / 4 * 3 };
+        }
+        else if (ec != asio::error::operation_aborted)
+        {
+            // Keep serving still valid results if the background refresh failed,
+            // otherwise cache the failure
+            auto entry = _entries.find(key);
+            bool valid = (entry != _entries.end()) && !entry->second.error && (timestamp < entry->second.expiration);
+            if (!valid && (negative_ttl > 0))
+                _entries[key] = Entry{ ec, Results(), timestamp + negative_ttl, timestamp + negative_ttl };
+        }
+    }
+
+    // Complete pending lookups
+    for (auto& waiter : waiters)
+        waiter(ec, results);
+}
+
+} // namespace Asio
+} // namespace CppServer
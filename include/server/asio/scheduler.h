@@ -0,0 +1,196 @@
+/*!
+    \file scheduler.h
+    \brief Asio scheduler definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_SCHEDULER_H
+#define CPPSERVER_ASIO_SCHEDULER_H
+
+#include "asio.h"
+
+#include "time/time.h"
+#include "time/timespan.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! Asio scheduler
+/*!
+    Scheduler is used to run a huge number of short-lived delayed and
+    periodic actions on a single Asio IO service with a single Asio timer.
+
+    Scheduled tasks are stored in a reusable slots pool and are ordered
+    with a binary heap by their expiry time. Cancel operation is O(1),
+    canceled tasks are lazily removed from the heap.
+
+    Periodic tasks are scheduled without drift: the next expiry time is
+    calculated from the previous expiry time instead of the current time.
+    Missed periods are skipped. The scheduled expiry time of the running
+    task is available with deadline(), so periodic tasks could measure
+    their own run delay.
+
+    Thread-safe.
+*/
+class Scheduler : public std::enable_shared_from_this<Scheduler>
+{
+public:
+    //! Scheduled task token
+    /*!
+        Cheap copyable token which could be used to cancel the scheduled task.
+        Token becomes invalid when the one-shot task is completed or canceled.
+
+        Thread-safe.
+    */
+    class Token
+    {
+        friend class Scheduler;
+
+    public:
+        Token() noexcept : _index(0), _generation(0) {}
+        Token(const Token&) = default;
+        Token(Token&&) noexcept = default;
+        ~Token() = default;
+
+        Token& operator=(const Token&) = default;
+        Token& operator=(Token&&) noexcept = default;
+
+        //! Check if the token is bound to the alive scheduler
+        explicit operator bool() const noexcept { return !_scheduler.expired(); }
+
+        //! Is the scheduled task pending?
+        bool IsPending() const;
+
+        //! Cancel the scheduled task
+        /*!
+            \return 'true' if the task was successfully canceled, 'false' if the task is already completed or canceled
+        */
+        bool Cancel();
+
+    private:
+        std::weak_ptr<Scheduler> _scheduler;
+        uint32_t _index;
+        uint32_t _generation;
+
+        Token(const std::shared_ptr<Scheduler>& scheduler, uint32_t index, uint32_t generation) noexcept
+            : _scheduler(scheduler), _index(index), _generation(generation)
+        {}
+    };
+
+    //! Initialize scheduler with a given Asio IO service
+    /*!
+        \param io_service - Asio IO service
+    */
+    explicit Scheduler(const std::shared_ptr<asio::io_service>& io_service);
+    Scheduler(const Scheduler&) = delete;
+    Scheduler(Scheduler&&) = delete;
+    ~Scheduler() = default;
+
+    Scheduler& operator=(const Scheduler&) = delete;
+    Scheduler& operator=(Scheduler&&) = delete;
+
+    //! Get the number of pending tasks
+    size_t size() const noexcept { return _size; }
+
+    //! Schedule the given action to run once after the given timeout
+    /*!
+        \param timeout - Timeout
+        \param action - Action function
+        \return Scheduled task token
+    */
+    Token ScheduleAfter(const CppCommon::Timespan& timeout, std::function<void()> action);
+    //! Schedule the given action to run once at the given absolute time
+    /*!
+        \param time - Absolute time
+        \param action - Action function
+        \return Scheduled task token
+    */
+    Token ScheduleAt(const CppCommon::UtcTime& time, std::function<void()> action);
+    //! Schedule the given action to run periodically with the given period
+    /*!
+        The first run is performed after the given period.
+
+        \param period - Period
+        \param action - Action function
+        \return Scheduled task token
+    */
+    Token SchedulePeriodic(const CppCommon::Timespan& period, std::function<void()> action);
+
+    //! Cancel the scheduled task with the given token
+    /*!
+        \param token - Scheduled task token
+        \return 'true' if the task was successfully canceled, 'false' if the task is already completed or canceled
+    */
+    bool Cancel(const Token& token);
+
+    //! Get the scheduled expiry time of the task running in the current thread
+    /*!
+        Valid only inside the task action.
+
+        \return Scheduled expiry time of the running task
+    */
+    static std::chrono::steady_clock::time_point deadline() noexcept { return _deadline; }
+
+private:
+    typedef std::chrono::steady_clock::time_point TimePoint;
+    typedef std::chrono::steady_clock::duration Duration;
+
+    // Scheduled task
+    struct Task
+    {
+        std::function<void()> action;
+        Duration period{0};
+        uint32_t generation{0};
+        bool pending{false};
+    };
+
+    // Scheduled task heap item
+    struct Item
+    {
+        TimePoint time;
+        uint32_t index;
+        uint32_t generation;
+
+        bool operator>(const Item& item) const noexcept { return time > item.time; }
+    };
+
+    std::mutex _lock;
+    // Scheduled tasks
+    std::vector<Task> _tasks;
+    std::vector<uint32_t> _free;
+    std::vector<Item> _heap;
+    std::atomic<size_t> _size;
+    // Scheduler timer
+    asio::steady_timer _timer;
+    TimePoint _timer_time;
+    bool _timer_armed;
+    // Scheduled expiry time of the running task
+    static inline thread_local TimePoint _deadline;
+
+    //! Schedule a new task
+    Token Schedule(const TimePoint& time, const Duration& period, std::function<void()>&& action);
+    //! Is the task with the given index and generation pending?
+    bool IsPending(uint32_t index, uint32_t generation);
+    //! Release the task slot
+    void Release(uint32_t index);
+    //! Remove canceled tasks from the heap
+    void Compact();
+    //! Arm the scheduler timer for the nearest task
+    void Arm();
+    //! Run all expired tasks
+    void Run();
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_SCHEDULER_H
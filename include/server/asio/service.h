@@ -10,13 +10,18 @@
 #define CPPSERVER_ASIO_SERVICE_H
 
 #include "asio.h"
+#include "fair_queue.h"
+#include "instrumentation.h"
 #include "memory.h"
+#include "scheduler.h"
+#include "timing_wheel.h"
 
 #include "threads/thread.h"
 
 #include <atomic>
 #include <cassert>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -82,6 +87,48 @@ public:
     //! Is the service started?
     bool IsStarted() const noexcept { return _started; }
 
+    //! Get the option: statistics instrumentation
+    bool option_statistics() const noexcept { return _option_statistics; }
+    //! Get the option: statistics interval
+    const CppCommon::Timespan& option_statistics_interval() const noexcept { return _option_statistics_interval; }
+
+    //! Setup option: statistics instrumentation
+    /*!
+        When the statistics instrumentation is enabled each working thread records
+        completed handlers count and execution time of the handlers. Event loop lag
+        is measured with a probe scheduled ten times per statistics interval as the
+        delay between the scheduled probe time and the probe handler execution.
+        Once per statistics interval onStatistics() handler is called with the
+        service statistics snapshot.
+
+        When the statistics instrumentation is disabled the working threads run
+        Asio IO services without any additional overhead.
+
+        This option will be applied on the next service start.
+
+        \param enable - Enable/disable statistics instrumentation
+        \param interval - Statistics interval (default is 1 second)
+    */
+    void SetupStatistics(bool enable, const CppCommon::Timespan& interval = CppCommon::Timespan::seconds(1)) noexcept
+    { _option_statistics = enable; _option_statistics_interval = interval; }
+
+    //! Get the service statistics snapshot
+    /*!
+        Statistics are collected only for service working threads and only
+        if the statistics instrumentation is enabled.
+
+        \return Service statistics snapshot
+    */
+    ServiceStatisticsSnapshot statistics() const;
+    //! Get the last measured event loop lag of the most lagging working thread
+    /*!
+        Cheap alternative to the statistics snapshot which could be used
+        to check the service overload state frequently.
+
+        \return Event loop lag in nanoseconds
+    */
+    uint64_t loop_lag() const noexcept;
+
     //! Start the service
     /*!
         \param polling - Polling loop mode with idle handler call (default is false)
@@ -110,6 +157,88 @@ public:
     virtual std::shared_ptr<asio::io_service>& GetAsioService() noexcept
     { return _services[++_round_robin_index % _services.size()]; }
 
+    //! Get the timing wheel of the given Asio IO service
+    /*!
+        Timing wheel is created on the first request and shared by all
+        sessions bound to the same Asio IO service.
+
+        \param io_service - Asio IO service
+        \return Timing wheel of the given Asio IO service
+    */
+    std::shared_ptr<TimingWheel> GetTimingWheel(const std::shared_ptr<asio::io_service>& io_service);
+    //! Get the fair queue of the given Asio IO service
+    /*!
+        Fair queue is created on the first request and shared by all
+        sessions bound to the same Asio IO service.
+
+        \param io_service - Asio IO service
+        \return Fair queue of the given Asio IO service
+    */
+    std::shared_ptr<FairQueue> GetFairQueue(const std::shared_ptr<asio::io_service>& io_service);
+
+    //! Get the scheduler of the given Asio IO service
+    /*!
+        \param io_service - Asio IO service
+        \return Scheduler of the given Asio IO service or null if the Asio IO service is not hosted by the service
+    */
+    std::shared_ptr<Scheduler> GetScheduler(const std::shared_ptr<asio::io_service>& io_service) noexcept;
+
+    //! Schedule the given action to run once after the given timeout
+    /*!
+        Action will be run on the next available Asio IO service selected with
+        round-robin algorithm. In thread-pool design actions are not serialized
+        with the service strand.
+
+        \param timeout - Timeout
+        \param action - Action function
+        \return Scheduled task token
+    */
+    Scheduler::Token ScheduleAfter(const CppCommon::Timespan& timeout, std::function<void()> action)
+    { return GetNextScheduler()->ScheduleAfter(timeout, std::move(action)); }
+    //! Schedule the given action to run once after the given timeout on the given Asio IO service
+    /*!
+        \param io_service - Asio IO service
+        \param timeout - Timeout
+        \param action - Action function
+        \return Scheduled task token
+    */
+    Scheduler::Token ScheduleAfter(const std::shared_ptr<asio::io_service>& io_service, const CppCommon::Timespan& timeout, std::function<void()> action);
+    //! Schedule the given action to run once at the given absolute time
+    /*!
+        \param time - Absolute time
+        \param action - Action function
+        \return Scheduled task token
+    */
+    Scheduler::Token ScheduleAt(const CppCommon::UtcTime& time, std::function<void()> action)
+    { return GetNextScheduler()->ScheduleAt(time, std::move(action)); }
+    //! Schedule the given action to run once at the given absolute time on the given Asio IO service
+    /*!
+        \param io_service - Asio IO service
+        \param time - Absolute time
+        \param action - Action function
+        \return Scheduled task token
+    */
+    Scheduler::Token ScheduleAt(const std::shared_ptr<asio::io_service>& io_service, const CppCommon::UtcTime& time, std::function<void()> action);
+    //! Schedule the given action to run periodically with the given period
+    /*!
+        Periodic actions are scheduled without drift and the first run is
+        performed after the given period.
+
+        \param period - Period
+        \param action - Action function
+        \return Scheduled task token
+    */
+    Scheduler::Token SchedulePeriodic(const CppCommon::Timespan& period, std::function<void()> action)
+    { return GetNextScheduler()->SchedulePeriodic(period, std::move(action)); }
+    //! Schedule the given action to run periodically with the given period on the given Asio IO service
+    /*!
+        \param io_service - Asio IO service
+        \param period - Period
+        \param action - Action function
+        \return Scheduled task token
+    */
+    Scheduler::Token SchedulePeriodic(const std::shared_ptr<asio::io_service>& io_service, const CppCommon::Timespan& period, std::function<void()> action);
+
     //! Dispatch the given handler
     /*!
         The given handler may be executed immediately if this function is called from IO service thread.
@@ -151,6 +280,15 @@ protected:
     //! Handle service idle notification
     virtual void onIdle() { CppCommon::Thread::Yield(); }
 
+    //! Handle service statistics notification
+    /*!
+        Notification is called once per statistics interval if the statistics
+        instrumentation is enabled.
+
+        \param statistics - Service statistics snapshot
+    */
+    virtual void onStatistics(const ServiceStatisticsSnapshot& statistics) {}
+
     //! Handle error notification
     /*!
         \param error - Error code
@@ -173,9 +311,34 @@ private:
     // Asio service state
     std::atomic<bool> _started;
     std::atomic<size_t> _round_robin_index;
+    // Asio IO services schedulers
+    std::vector<std::shared_ptr<Scheduler>> _schedulers;
+    // Asio IO services timing wheels
+    std::mutex _timing_wheels_lock;
+    std::vector<std::pair<std::shared_ptr<asio::io_service>, std::shared_ptr<TimingWheel>>> _timing_wheels;
+    // Asio IO services fair queues
+    std::mutex _fair_queues_lock;
+    std::vector<std::pair<std::shared_ptr<asio::io_service>, std::shared_ptr<FairQueue>>> _fair_queues;
+    // Asio service working threads statistics
+    std::vector<std::unique_ptr<ServiceThreadStatistics>> _statistics;
+    std::vector<Scheduler::Token> _statistics_tokens;
+    // Options
+    std::atomic<bool> _option_statistics;
+    CppCommon::Timespan _option_statistics_interval;
 
     //! Service thread
-    static void ServiceThread(const std::shared_ptr<Service>& service, const std::shared_ptr<asio::io_service>& io_service);
+    static void ServiceThread(const std::shared_ptr<Service>& service, const std::shared_ptr<asio::io_service>& io_service, ServiceThreadStatistics* statistics);
+
+    //! Start the statistics instrumentation tasks
+    void StartStatistics();
+    //! Stop the statistics instrumentation tasks
+    void StopStatistics();
+
+    //! Get the next available scheduler using round-robin algorithm
+    std::shared_ptr<Scheduler>& GetNextScheduler() noexcept
+    { return _schedulers[++_round_robin_index % _schedulers.size()]; }
+    //! Get the scheduler of the given Asio IO service or throw an exception if the Asio IO service is not hosted by the service
+    std::shared_ptr<Scheduler>& GetSchedulerChecked(const std::shared_ptr<asio::io_service>& io_service);
 
     //! Send error notification
     void SendError(std::error_code ec);
@@ -0,0 +1,123 @@
+/*!
+    \file shm_channel.h
+    \brief Shared memory channel definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_SHM_CHANNEL_H
+#define CPPSERVER_ASIO_SHM_CHANNEL_H
+
+#include "asio.h"
+#include "shm_ring.h"
+
+#if defined(__linux__)
+#define CPPSERVER_SHM
+#endif
+
+namespace CppServer {
+namespace Asio {
+
+//! Shared memory channel
+/*!
+    Shared memory channel is a pair of single producer / single consumer
+    ring buffers (one for each direction) placed into the anonymous shared
+    memory segment (memfd) together with a pair of wakeup events (eventfd).
+
+    The server side creates the channel and passes its handles to the
+    client side over the connected Unix domain socket (SCM_RIGHTS). After
+    that both sides exchange data through the rings without syscalls.
+    A side which has nothing to do arms its wakeup flag in the shared
+    memory and waits for its wakeup event. The other side signals the
+    event only if the flag is armed, so no syscalls are made while both
+    sides are busy.
+
+    Shared memory channel is supported on Linux only.
+
+    Not thread-safe.
+*/
+class SHMChannel
+{
+public:
+    SHMChannel() noexcept;
+    SHMChannel(const SHMChannel&) = delete;
+    SHMChannel(SHMChannel&&) = delete;
+    ~SHMChannel() { Close(); }
+
+    SHMChannel& operator=(const SHMChannel&) = delete;
+    SHMChannel& operator=(SHMChannel&&) = delete;
+
+    //! Is the shared memory channel supported?
+    static bool IsSupported() noexcept;
+
+    //! Get the input ring buffer
+    SHMRing& input() noexcept { return _input; }
+    //! Get the output ring buffer
+    SHMRing& output() noexcept { return _output; }
+    //! Get the ring buffers capacity
+    size_t capacity() const noexcept { return _output.capacity(); }
+    //! Get the wakeup event handle of this side
+    int event() const noexcept { return _local_event; }
+
+    //! Is the channel opened?
+    bool IsOpened() const noexcept { return _memory != nullptr; }
+
+    //! Create a new channel (server side)
+    /*!
+        \param capacity - Capacity of each ring buffer in bytes (will be rounded up to a power of two)
+        \param ec - Error code
+        \return 'true' if the channel was successfully created, 'false' on error
+    */
+    bool Create(size_t capacity, asio::error_code& ec);
+    //! Send the channel handles into the connected Unix domain socket (server side)
+    /*!
+        \param socket - Native handle of the connected Unix domain socket
+        \param ec - Error code
+        \return 'true' if the channel handles were successfully sent, 'false' on error
+    */
+    bool SendHandles(int socket, asio::error_code& ec);
+    //! Receive the channel handles from the connected Unix domain socket and open the channel (client side)
+    /*!
+        \param socket - Native handle of the connected Unix domain socket
+        \param ec - Error code
+        \return 'true' if the channel was successfully opened, 'false' on error
+    */
+    bool ReceiveHandles(int socket, asio::error_code& ec);
+    //! Close the channel
+    void Close();
+
+    //! Arm the wakeup flag of this side
+    /*!
+        Rings should be checked once again after arming the wakeup flag
+        and the flag should be disarmed if there is something to do.
+        Otherwise the wakeup signal could be lost.
+    */
+    void Arm() noexcept;
+    //! Disarm the wakeup flag of this side
+    void Disarm() noexcept;
+    //! Wake up the other side if it waits for its wakeup event
+    void Notify() noexcept;
+
+private:
+    // Shared memory header
+    struct Header;
+
+    Header* _header;
+    void* _memory;
+    size_t _size;
+    int _side;
+    int _memory_handle;
+    int _local_event;
+    int _remote_event;
+    SHMRing _input;
+    SHMRing _output;
+
+    //! Map the shared memory segment and attach ring buffers
+    bool Map(size_t size, bool initialize, asio::error_code& ec);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_SHM_CHANNEL_H
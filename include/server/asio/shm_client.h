@@ -0,0 +1,297 @@
+/*!
+    \file shm_client.h
+    \brief Shared memory client definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_SHM_CLIENT_H
+#define CPPSERVER_ASIO_SHM_CLIENT_H
+
+#include "service.h"
+#include "shm_channel.h"
+
+#include "system/uuid.h"
+
+#include <mutex>
+#include <vector>
+
+#if defined(CPPSERVER_SHM)
+
+namespace CppServer {
+namespace Asio {
+
+//! Shared memory client
+/*!
+    Shared memory client is used to read/write data from/into the connected shared memory server.
+    It has the same callback API as TCP client, so protocol code (e.g. FBE protocol clients)
+    could be used with it unchanged. The client connects to the server Unix domain socket,
+    receives the shared memory channel and exchanges all data through the shared memory
+    ring buffers without syscalls.
+
+    Received data is passed to onReceived() directly from the shared memory
+    ring buffer without copying, so the received buffer is valid only until
+    the handler returns.
+
+    Thread-safe.
+*/
+class SHMClient : public std::enable_shared_from_this<SHMClient>
+{
+public:
+    //! Initialize shared memory client with a given Asio service and server socket path
+    /*!
+        \param service - Asio service
+        \param path - Server socket path
+    */
+    SHMClient(const std::shared_ptr<Service>& service, const std::string& path);
+    //! Initialize shared memory client with a given Asio service and endpoint
+    /*!
+        \param service - Asio service
+        \param endpoint - Server Unix domain socket endpoint
+    */
+    SHMClient(const std::shared_ptr<Service>& service, const asio::local::stream_protocol::endpoint& endpoint);
+    SHMClient(const SHMClient&) = delete;
+    SHMClient(SHMClient&&) = delete;
+    virtual ~SHMClient() = default;
+
+    SHMClient& operator=(const SHMClient&) = delete;
+    SHMClient& operator=(SHMClient&&) = delete;
+
+    //! Get the client Id
+    const CppCommon::UUID& id() const noexcept { return _id; }
+
+    //! Get the Asio service
+    std::shared_ptr<Service>& service() noexcept { return _service; }
+    //! Get the Asio IO service
+    std::shared_ptr<asio::io_service>& io_service() noexcept { return _io_service; }
+    //! Get the Asio service strand for serialized handler execution
+    asio::io_service::strand& strand() noexcept { return _strand; }
+    //! Get the client endpoint
+    asio::local::stream_protocol::endpoint& endpoint() noexcept { return _endpoint; }
+    //! Get the client control socket
+    asio::local::stream_protocol::socket& socket() noexcept { return _socket; }
+    //! Get the client shared memory channel
+    SHMChannel& channel() noexcept { return _channel; }
+
+    //! Get the server socket path
+    const std::string& path() const noexcept { return _path; }
+
+    //! Get the number of bytes pending sent by the client
+    uint64_t bytes_pending() const noexcept { return _bytes_pending; }
+    //! Get the number of bytes sent by the client
+    uint64_t bytes_sent() const noexcept { return _bytes_sent; }
+    //! Get the number of bytes received by the client
+    uint64_t bytes_received() const noexcept { return _bytes_received; }
+
+    //! Get the option: send buffer limit
+    size_t option_send_buffer_limit() const noexcept { return _send_buffer_limit; }
+    //! Get the option: busy polling
+    size_t option_busy_polling() const noexcept { return _busy_polling; }
+
+    //! Is the client connected?
+    bool IsConnected() const noexcept { return _connected; }
+
+    //! Connect the client (synchronous)
+    /*!
+        Received data is delivered by the Asio service after successful connection.
+
+        \return 'true' if the client was successfully connected, 'false' if the client failed to connect
+    */
+    virtual bool Connect();
+    //! Disconnect the client (synchronous)
+    /*!
+        \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
+    */
+    virtual bool Disconnect() { return DisconnectInternal(); }
+    //! Reconnect the client (synchronous)
+    /*!
+        \return 'true' if the client was successfully reconnected, 'false' if the client is already reconnected
+    */
+    virtual bool Reconnect();
+
+    //! Connect the client (asynchronous)
+    /*!
+        \return 'true' if the client was successfully connected, 'false' if the client failed to connect
+    */
+    virtual bool ConnectAsync();
+    //! Disconnect the client (asynchronous)
+    /*!
+        \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
+    */
+    virtual bool DisconnectAsync() { return DisconnectInternalAsync(false); }
+    //! Reconnect the client (asynchronous)
+    /*!
+        \return 'true' if the client was successfully reconnected, 'false' if the client is already reconnected
+    */
+    virtual bool ReconnectAsync();
+
+    //! Send data to the server (asynchronous)
+    /*!
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \return 'true' if the data was successfully sent, 'false' if the client is not connected
+    */
+    virtual bool SendAsync(const void* buffer, size_t size);
+    //! Send text to the server (asynchronous)
+    /*!
+        \param text - Text to send
+        \return 'true' if the text was successfully sent, 'false' if the client is not connected
+    */
+    virtual bool SendAsync(std::string_view text) { return SendAsync(text.data(), text.size()); }
+
+    //! Setup option: send buffer limit
+    /*!
+        Data which does not fit into the shared memory ring buffer is kept
+        in the send buffer until the server consumes the ring buffer.
+        The client will be disconnected if the send buffer limit is met.
+        Default is unlimited.
+
+        \param limit - Send buffer limit
+    */
+    void SetupSendBufferLimit(size_t limit) noexcept { _send_buffer_limit = limit; }
+    //! Setup option: busy polling
+    /*!
+        The client will spin the given number of iterations checking its ring
+        buffers before it arms the wakeup and waits for the server signal. This
+        reduces the latency at the cost of the CPU usage and is useful only when
+        both sides run on dedicated CPU cores. Default is 0 (disabled).
+
+        \param spins - Number of busy polling iterations
+    */
+    void SetupBusyPolling(size_t spins) noexcept { _busy_polling = spins; }
+
+protected:
+    //! Handle client connected notification
+    virtual void onConnected() {}
+    //! Handle client disconnected notification
+    virtual void onDisconnected() {}
+
+    //! Handle buffer received notification
+    /*!
+        Notification is called when another part of buffer was received
+        from the server.
+
+        \param buffer - Received buffer
+        \param size - Received buffer size
+    */
+    virtual void onReceived(const void* buffer, size_t size) {}
+    //! Handle buffer sent notification
+    /*!
+        Notification is called when another part of buffer was sent
+        to the server.
+
+        This handler could be used to send another buffer to the server
+        for instance when the pending size is zero.
+
+        \param sent - Size of sent buffer
+        \param pending - Size of pending buffer
+    */
+    virtual void onSent(size_t sent, size_t pending) {}
+
+    //! Handle empty send buffer notification
+    /*!
+        Notification is called when the send buffer is empty and ready
+        for a new data to send.
+
+        This handler could be used to send another buffer to the server.
+    */
+    virtual void onEmpty() {}
+
+    //! Handle error notification
+    /*!
+        \param error - Error code
+        \param category - Error category
+        \param message - Error message
+    */
+    virtual void onError(int error, const std::string& category, const std::string& message) {}
+
+private:
+    // Client Id
+    CppCommon::UUID _id;
+    // Asio service
+    std::shared_ptr<Service> _service;
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Asio service strand for serialized handler execution
+    asio::io_service::strand _strand;
+    bool _strand_required;
+    // Server socket path
+    std::string _path;
+    // Server endpoint & client control socket
+    asio::local::stream_protocol::endpoint _endpoint;
+    asio::local::stream_protocol::socket _socket;
+    std::atomic<bool> _connecting;
+    std::atomic<bool> _connected;
+    uint8_t _control_buffer;
+    HandlerStorage _control_storage;
+    // Client shared memory channel
+    SHMChannel _channel;
+    asio::posix::stream_descriptor _event;
+    uint64_t _event_buffer;
+    HandlerStorage _event_storage;
+    std::atomic<bool> _receiving;
+    size_t _busy_polling;
+    // Client statistic
+    uint64_t _bytes_pending;
+    uint64_t _bytes_sent;
+    uint64_t _bytes_received;
+    // Send buffer
+    std::mutex _send_lock;
+    size_t _send_buffer_limit{0};
+    std::vector<uint8_t> _send_buffer;
+    size_t _send_buffer_offset;
+
+    //! Disconnect the client (synchronous)
+    /*!
+        \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
+    */
+    bool DisconnectInternal();
+    //! Disconnect the client (asynchronous)
+    /*!
+        \param dispatch - Dispatch flag
+        \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
+    */
+    bool DisconnectInternalAsync(bool dispatch);
+
+    //! Open the shared memory channel received from the connected server
+    /*!
+        \param ec - Error code
+        \return 'true' if the channel was successfully opened, 'false' on error
+    */
+    bool OpenChannel(asio::error_code& ec);
+    //! Complete the client connection with the opened channel
+    void Connected();
+
+    //! Wait for the server disconnect on the control socket
+    void TryControl();
+    //! Process the shared memory channel until there is nothing to do
+    void TryProcess();
+    //! Wait for the wakeup event from the server
+    void TryWait();
+    //! Try to receive new data from the input ring buffer
+    /*!
+        \return 'true' if some data was received, 'false' if the input ring buffer is empty
+    */
+    bool TryReceive();
+    //! Try to send pending data into the output ring buffer
+    /*!
+        \return 'true' if some data was sent, 'false' if nothing was sent
+    */
+    bool TrySend();
+    //! Is there something to receive or to send?
+    bool IsReady();
+
+    //! Clear send/receive buffers
+    void ClearBuffers();
+
+    //! Send error notification
+    void SendError(std::error_code ec);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_SHM
+
+#endif // CPPSERVER_ASIO_SHM_CLIENT_H
@@ -0,0 +1,123 @@
+/*!
+    \file shm_ring.h
+    \brief Shared memory ring buffer definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_SHM_RING_H
+#define CPPSERVER_ASIO_SHM_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace CppServer {
+namespace Asio {
+
+//! Shared memory ring buffer
+/*!
+    Single producer / single consumer byte ring buffer placed into the
+    given memory region. Producer and consumer indexes are kept in the
+    separate cache lines of the ring header, so the ring could be shared
+    between two processes that map the same memory.
+
+    Each process side keeps a cached copy of the other side index and
+    reloads it only when the cached value says the ring is full (for the
+    producer) or empty (for the consumer).
+
+    Thread-safe for one producer thread and one consumer thread.
+*/
+class SHMRing
+{
+public:
+    //! Get the memory size required for the ring buffer with a given capacity
+    /*!
+        \param capacity - Ring buffer capacity in bytes (must be a power of two)
+        \return Memory size in bytes
+    */
+    static constexpr size_t Size(size_t capacity) noexcept { return sizeof(Header) + capacity; }
+
+    //! Initialize the empty ring buffer
+    SHMRing() noexcept : _header(nullptr), _buffer(nullptr), _capacity(0), _mask(0), _tail_cache(0), _head_cache(0) {}
+    //! Initialize the ring buffer over the given memory
+    /*!
+        \param memory - Memory of at least Size(capacity) bytes aligned to the cache line
+        \param capacity - Ring buffer capacity in bytes (must be a power of two)
+        \param initialize - Reset the ring header (should be done once by the memory owner)
+    */
+    SHMRing(void* memory, size_t capacity, bool initialize) noexcept;
+    SHMRing(const SHMRing&) = delete;
+    SHMRing(SHMRing&&) = delete;
+    ~SHMRing() = default;
+
+    SHMRing& operator=(const SHMRing&) = delete;
+    SHMRing& operator=(SHMRing&&) = delete;
+
+    //! Check if the ring buffer is valid
+    explicit operator bool() const noexcept { return _header != nullptr; }
+
+    //! Get the ring buffer capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the number of bytes available to read
+    size_t size() const noexcept;
+    //! Get the number of bytes available to write
+    size_t free() const noexcept { return _capacity - size(); }
+    //! Is the ring buffer empty?
+    bool empty() const noexcept { return size() == 0; }
+
+    //! Attach the ring buffer to the given memory
+    /*!
+        \param memory - Memory of at least Size(capacity) bytes aligned to the cache line
+        \param capacity - Ring buffer capacity in bytes (must be a power of two)
+        \param initialize - Reset the ring header (should be done once by the memory owner)
+    */
+    void Attach(void* memory, size_t capacity, bool initialize) noexcept;
+    //! Detach the ring buffer from the memory
+    void Detach() noexcept;
+
+    //! Write data into the ring buffer (producer side)
+    /*!
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Size of written data (could be less than the buffer size if the ring buffer is full)
+    */
+    size_t Write(const void* buffer, size_t size) noexcept;
+
+    //! Peek the continuous block of data from the ring buffer (consumer side)
+    /*!
+        The returned block is valid until the next call of Consume().
+
+        \param buffer - Pointer to the continuous block of data
+        \return Size of the continuous block of data (zero if the ring buffer is empty)
+    */
+    size_t Peek(const void*& buffer) noexcept;
+    //! Consume the given size of data from the ring buffer (consumer side)
+    /*!
+        \param size - Size of data to consume (must not exceed the peeked size)
+    */
+    void Consume(size_t size) noexcept;
+
+private:
+    // Ring header placed at the beginning of the shared memory
+    struct Header
+    {
+        alignas(64) std::atomic<uint64_t> head;
+        alignas(64) std::atomic<uint64_t> tail;
+    };
+
+    Header* _header;
+    uint8_t* _buffer;
+    size_t _capacity;
+    size_t _mask;
+    // Cached index of the consumer (producer side)
+    uint64_t _tail_cache;
+    // Cached index of the producer (consumer side)
+    uint64_t _head_cache;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_SHM_RING_H
@@ -0,0 +1,255 @@
+/*!
+    \file shm_server.h
+    \brief Shared memory server definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_SHM_SERVER_H
+#define CPPSERVER_ASIO_SHM_SERVER_H
+
+#include "shm_session.h"
+
+#include "system/uuid.h"
+
+#if defined(CPPSERVER_SHM)
+
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! Shared memory server
+/*!
+    Shared memory server is used to connect, disconnect and manage shared memory sessions.
+    It has the same callback API as TCP server, but is intended for the same-host peers.
+    Clients connect to the Unix domain socket bound to a filesystem path, which is used
+    only to pass the shared memory channel to the client and to detect the disconnect.
+    All session data is exchanged through the shared memory ring buffers without syscalls.
+
+    Thread-safe.
+*/
+class SHMServer : public std::enable_shared_from_this<SHMServer>
+{
+    friend class SHMSession;
+
+public:
+    //! Initialize shared memory server with a given Asio service and socket path
+    /*!
+        \param service - Asio service
+        \param path - Socket path
+    */
+    SHMServer(const std::shared_ptr<Service>& service, const std::string& path);
+    //! Initialize shared memory server with a given Asio service and endpoint
+    /*!
+        \param service - Asio service
+        \param endpoint - Server Unix domain socket endpoint
+    */
+    SHMServer(const std::shared_ptr<Service>& service, const asio::local::stream_protocol::endpoint& endpoint);
+    SHMServer(const SHMServer&) = delete;
+    SHMServer(SHMServer&&) = delete;
+    virtual ~SHMServer() = default;
+
+    SHMServer& operator=(const SHMServer&) = delete;
+    SHMServer& operator=(SHMServer&&) = delete;
+
+    //! Get the server Id
+    const CppCommon::UUID& id() const noexcept { return _id; }
+
+    //! Get the Asio service
+    std::shared_ptr<Service>& service() noexcept { return _service; }
+    //! Get the Asio IO service
+    std::shared_ptr<asio::io_service>& io_service() noexcept { return _io_service; }
+    //! Get the Asio service strand for serialized handler execution
+    asio::io_service::strand& strand() noexcept { return _strand; }
+    //! Get the server endpoint
+    asio::local::stream_protocol::endpoint& endpoint() noexcept { return _endpoint; }
+    //! Get the server acceptor
+    asio::local::stream_protocol::acceptor& acceptor() noexcept { return _acceptor; }
+
+    //! Get the server socket path
+    const std::string& path() const noexcept { return _path; }
+
+    //! Get the number of sessions connected to the server
+    uint64_t connected_sessions() const noexcept { return _sessions.size(); }
+    //! Get the number of bytes pending sent by the server
+    uint64_t bytes_pending() const noexcept { return _bytes_pending; }
+    //! Get the number of bytes sent by the server
+    uint64_t bytes_sent() const noexcept { return _bytes_sent; }
+    //! Get the number of bytes received by the server
+    uint64_t bytes_received() const noexcept { return _bytes_received; }
+
+    //! Get the option: unlink socket path
+    bool option_unlink_path() const noexcept { return _option_unlink_path; }
+    //! Get the option: ring buffer size
+    size_t option_ring_size() const noexcept { return _option_ring_size; }
+    //! Get the option: busy polling
+    size_t option_busy_polling() const noexcept { return _option_busy_polling; }
+
+    //! Is the server started?
+    bool IsStarted() const noexcept { return _started; }
+
+    //! Start the server
+    /*!
+        \return 'true' if the server was successfully started, 'false' if the server failed to start
+    */
+    virtual bool Start();
+    //! Stop the server
+    /*!
+        \return 'true' if the server was successfully stopped, 'false' if the server is already stopped
+    */
+    virtual bool Stop();
+    //! Restart the server
+    /*!
+        \return 'true' if the server was successfully restarted, 'false' if the server failed to restart
+    */
+    virtual bool Restart();
+
+    //! Multicast data to all connected sessions
+    /*!
+        \param buffer - Buffer to multicast
+        \param size - Buffer size
+        \return 'true' if the data was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool Multicast(const void* buffer, size_t size);
+    //! Multicast text to all connected sessions
+    /*!
+        \param text - Text to multicast
+        \return 'true' if the text was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool Multicast(std::string_view text) { return Multicast(text.data(), text.size()); }
+
+    //! Disconnect all connected sessions
+    /*!
+        \return 'true' if all sessions were successfully disconnected, 'false' if the server is not started
+    */
+    virtual bool DisconnectAll();
+
+    //! Find a session with a given Id
+    /*!
+        \param id - Session Id
+        \return Session with a given Id or null if the session it not connected
+    */
+    std::shared_ptr<SHMSession> FindSession(const CppCommon::UUID& id);
+
+    //! Setup option: unlink socket path
+    /*!
+        This option will remove the stale socket file before the server
+        is started and remove the socket file after the server is stopped.
+        The Unix domain socket bind fails if the socket file already exists.
+
+        \param enable - Enable/disable option
+    */
+    void SetupUnlinkPath(bool enable) noexcept { _option_unlink_path = enable; }
+    //! Setup option: ring buffer size
+    /*!
+        Size of the shared memory ring buffer for each direction of the session.
+        It will be rounded up to a power of two. Default is 1 MiB.
+
+        \param size - Ring buffer size
+    */
+    void SetupRingSize(size_t size) noexcept { _option_ring_size = size; }
+    //! Setup option: busy polling
+    /*!
+        Sessions will spin the given number of iterations checking their ring
+        buffers before they arm the wakeup and wait for the peer signal. This
+        reduces the latency at the cost of the CPU usage and is useful only when
+        both sides run on dedicated CPU cores. Default is 0 (disabled).
+
+        \param spins - Number of busy polling iterations
+    */
+    void SetupBusyPolling(size_t spins) noexcept { _option_busy_polling = spins; }
+
+protected:
+    //! Create Shared memory session factory method
+    /*!
+        \param server - Shared memory server
+        \return Shared memory session
+    */
+    virtual std::shared_ptr<SHMSession> CreateSession(const std::shared_ptr<SHMServer>& server) { return std::make_shared<SHMSession>(server); }
+
+protected:
+    //! Handle server started notification
+    virtual void onStarted() {}
+    //! Handle server stopped notification
+    virtual void onStopped() {}
+
+    //! Handle session connected notification
+    /*!
+        \param session - Connected session
+    */
+    virtual void onConnected(std::shared_ptr<SHMSession>& session) {}
+    //! Handle session disconnected notification
+    /*!
+        \param session - Disconnected session
+    */
+    virtual void onDisconnected(std::shared_ptr<SHMSession>& session) {}
+
+    //! Handle error notification
+    /*!
+        \param error - Error code
+        \param category - Error category
+        \param message - Error message
+    */
+    virtual void onError(int error, const std::string& category, const std::string& message) {}
+
+protected:
+    // Server sessions
+    std::shared_mutex _sessions_lock;
+    std::map<CppCommon::UUID, std::shared_ptr<SHMSession>> _sessions;
+
+private:
+    // Server Id
+    CppCommon::UUID _id;
+    // Asio service
+    std::shared_ptr<Service> _service;
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Asio service strand for serialized handler execution
+    asio::io_service::strand _strand;
+    bool _strand_required;
+    // Server socket path
+    std::string _path;
+    // Server endpoint, acceptor & socket
+    std::shared_ptr<SHMSession> _session;
+    asio::local::stream_protocol::endpoint _endpoint;
+    asio::local::stream_protocol::acceptor _acceptor;
+    std::atomic<bool> _started;
+    HandlerStorage _acceptor_storage;
+    // Server statistic
+    uint64_t _bytes_pending;
+    uint64_t _bytes_sent;
+    uint64_t _bytes_received;
+    // Options
+    bool _option_unlink_path;
+    size_t _option_ring_size;
+    size_t _option_busy_polling;
+
+    //! Accept new connections
+    void Accept();
+
+    //! Register a new session
+    void RegisterSession();
+    //! Unregister the given session
+    /*!
+        \param id - Session Id
+    */
+    void UnregisterSession(const CppCommon::UUID& id);
+
+    //! Clear multicast buffer
+    void ClearBuffers();
+
+    //! Send error notification
+    void SendError(std::error_code ec);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_SHM
+
+#endif // CPPSERVER_ASIO_SHM_SERVER_H
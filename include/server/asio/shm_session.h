@@ -0,0 +1,228 @@
+/*!
+    \file shm_session.h
+    \brief Shared memory session definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_SHM_SESSION_H
+#define CPPSERVER_ASIO_SHM_SESSION_H
+
+#include "service.h"
+#include "shm_channel.h"
+
+#include "system/uuid.h"
+
+#if defined(CPPSERVER_SHM)
+
+namespace CppServer {
+namespace Asio {
+
+class SHMServer;
+
+//! Shared memory session
+/*!
+    Shared memory session is used to read and write data from the connected shared memory client.
+
+    Received data is passed to onReceived() directly from the shared memory
+    ring buffer without copying, so the received buffer is valid only until
+    the handler returns.
+
+    Thread-safe.
+*/
+class SHMSession : public std::enable_shared_from_this<SHMSession>
+{
+    friend class SHMServer;
+
+public:
+    //! Initialize the session with a given server
+    /*!
+        \param server - Connected server
+    */
+    explicit SHMSession(const std::shared_ptr<SHMServer>& server);
+    SHMSession(const SHMSession&) = delete;
+    SHMSession(SHMSession&&) = delete;
+    virtual ~SHMSession() = default;
+
+    SHMSession& operator=(const SHMSession&) = delete;
+    SHMSession& operator=(SHMSession&&) = delete;
+
+    //! Get the session Id
+    const CppCommon::UUID& id() const noexcept { return _id; }
+
+    //! Get the server
+    std::shared_ptr<SHMServer>& server() noexcept { return _server; }
+    //! Get the Asio IO service
+    std::shared_ptr<asio::io_service>& io_service() noexcept { return _io_service; }
+    //! Get the Asio service strand for serialized handler execution
+    asio::io_service::strand& strand() noexcept { return _strand; }
+    //! Get the session control socket
+    asio::local::stream_protocol::socket& socket() noexcept { return _socket; }
+    //! Get the session shared memory channel
+    SHMChannel& channel() noexcept { return _channel; }
+
+    //! Get the number of bytes pending sent by the session
+    uint64_t bytes_pending() const noexcept { return _bytes_pending; }
+    //! Get the number of bytes sent by the session
+    uint64_t bytes_sent() const noexcept { return _bytes_sent; }
+    //! Get the number of bytes received by the session
+    uint64_t bytes_received() const noexcept { return _bytes_received; }
+
+    //! Get the option: send buffer limit
+    size_t option_send_buffer_limit() const noexcept { return _send_buffer_limit; }
+
+    //! Is the session connected?
+    bool IsConnected() const noexcept { return _connected; }
+
+    //! Disconnect the session
+    /*!
+        \return 'true' if the section was successfully disconnected, 'false' if the section is already disconnected
+    */
+    virtual bool Disconnect() { return Disconnect(false); }
+
+    //! Send data to the client (asynchronous)
+    /*!
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \return 'true' if the data was successfully sent, 'false' if the session is not connected
+    */
+    virtual bool SendAsync(const void* buffer, size_t size);
+    //! Send text to the client (asynchronous)
+    /*!
+        \param text - Text to send
+        \return 'true' if the text was successfully sent, 'false' if the session is not connected
+    */
+    virtual bool SendAsync(std::string_view text) { return SendAsync(text.data(), text.size()); }
+
+    //! Setup option: send buffer limit
+    /*!
+        Data which does not fit into the shared memory ring buffer is kept
+        in the send buffer until the client consumes the ring buffer.
+        The session will be disconnected if the send buffer limit is met.
+        Default is unlimited.
+
+        \param limit - Send buffer limit
+    */
+    void SetupSendBufferLimit(size_t limit) noexcept { _send_buffer_limit = limit; }
+
+protected:
+    //! Handle session connected notification
+    virtual void onConnected() {}
+    //! Handle session disconnected notification
+    virtual void onDisconnected() {}
+
+    //! Handle buffer received notification
+    /*!
+        Notification is called when another part of buffer was received
+        from the client.
+
+        \param buffer - Received buffer
+        \param size - Received buffer size
+    */
+    virtual void onReceived(const void* buffer, size_t size) {}
+    //! Handle buffer sent notification
+    /*!
+        Notification is called when another part of buffer was sent
+        to the client.
+
+        This handler could be used to send another buffer to the client
+        for instance when the pending size is zero.
+
+        \param sent - Size of sent buffer
+        \param pending - Size of pending buffer
+    */
+    virtual void onSent(size_t sent, size_t pending) {}
+
+    //! Handle empty send buffer notification
+    /*!
+        Notification is called when the send buffer is empty and ready
+        for a new data to send.
+
+        This handler could be used to send another buffer to the client.
+    */
+    virtual void onEmpty() {}
+
+    //! Handle error notification
+    /*!
+        \param error - Error code
+        \param category - Error category
+        \param message - Error message
+    */
+    virtual void onError(int error, const std::string& category, const std::string& message) {}
+
+private:
+    // Session Id
+    CppCommon::UUID _id;
+    // Server & session
+    std::shared_ptr<SHMServer> _server;
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Asio service strand for serialized handler execution
+    asio::io_service::strand _strand;
+    bool _strand_required;
+    // Session control socket
+    asio::local::stream_protocol::socket _socket;
+    std::atomic<bool> _connected;
+    uint8_t _control_buffer;
+    HandlerStorage _control_storage;
+    // Session shared memory channel
+    SHMChannel _channel;
+    asio::posix::stream_descriptor _event;
+    uint64_t _event_buffer;
+    HandlerStorage _event_storage;
+    std::atomic<bool> _receiving;
+    size_t _busy_polling;
+    // Session statistic
+    uint64_t _bytes_pending;
+    uint64_t _bytes_sent;
+    uint64_t _bytes_received;
+    // Send buffer
+    std::mutex _send_lock;
+    size_t _send_buffer_limit{0};
+    std::vector<uint8_t> _send_buffer;
+    size_t _send_buffer_offset;
+
+    //! Connect the session
+    void Connect();
+    //! Disconnect the session
+    /*!
+        \param dispatch - Dispatch flag
+        \return 'true' if the session was successfully disconnected, 'false' if the session is already disconnected
+    */
+    bool Disconnect(bool dispatch);
+
+    //! Wait for the client disconnect on the control socket
+    void TryControl();
+    //! Process the shared memory channel until there is nothing to do
+    void TryProcess();
+    //! Wait for the wakeup event from the client
+    void TryWait();
+    //! Try to receive new data from the input ring buffer
+    /*!
+        \return 'true' if some data was received, 'false' if the input ring buffer is empty
+    */
+    bool TryReceive();
+    //! Try to send pending data into the output ring buffer
+    /*!
+        \return 'true' if some data was sent, 'false' if nothing was sent
+    */
+    bool TrySend();
+    //! Is there something to receive or to send?
+    bool IsReady();
+
+    //! Clear send/receive buffers
+    void ClearBuffers();
+    //! Reset server
+    void ResetServer();
+
+    //! Send error notification
+    void SendError(std::error_code ec);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_SHM
+
+#endif // CPPSERVER_ASIO_SHM_SESSION_H
@@ -10,11 +10,14 @@
 #define CPPSERVER_ASIO_SSL_CLIENT_H
 
 #include "ssl_context.h"
+#include "fast_open.h"
+#include "tcp_connector.h"
 #include "tcp_resolver.h"
 
 #include "system/uuid.h"
 #include "time/timespan.h"
 
+#include <algorithm>
 #include <mutex>
 #include <vector>
 
@@ -91,6 +94,14 @@ public:
     uint64_t bytes_sent() const noexcept { return _bytes_sent; }
     //! Get the number of bytes received by the client
     uint64_t bytes_received() const noexcept { return _bytes_received; }
+    //! Get the number of auto-reconnect attempts
+    uint64_t reconnect_attempts() const noexcept { return _reconnect_attempts; }
+    //! Get the number of successful auto-reconnects
+    uint64_t reconnects() const noexcept { return _reconnects; }
+    //! Get the recovery time of the last successful auto-reconnect
+    CppCommon::Timespan reconnect_recovery_time() const noexcept { return CppCommon::Timespan::nanoseconds(_reconnect_recovery); }
+    //! Get the number of connects with data carried by the SYN packet (TCP Fast Open)
+    uint64_t fast_open_connects() const noexcept { return _fast_open_connects; }
 
     //! Get the option: keep alive
     bool option_keep_alive() const noexcept { return _option_keep_alive; }
@@ -104,6 +115,22 @@ public:
     size_t option_send_buffer_limit() const { return _send_buffer_limit; }
     //! Get the option: send buffer size
     size_t option_send_buffer_size() const;
+    //! Get the option: auto-reconnect
+    bool option_auto_reconnect() const noexcept { return _option_auto_reconnect; }
+    //! Get the option: minimal auto-reconnect delay
+    const CppCommon::Timespan& option_reconnect_delay_min() const noexcept { return _option_reconnect_delay_min; }
+    //! Get the option: maximal auto-reconnect delay
+    const CppCommon::Timespan& option_reconnect_delay_max() const noexcept { return _option_reconnect_delay_max; }
+    //! Get the option: auto-reconnect delay jitter
+    double option_reconnect_jitter() const noexcept { return _option_reconnect_jitter; }
+    //! Get the option: preserve send buffer across auto-reconnects
+    bool option_preserve_send_buffer() const noexcept { return _option_preserve_send_buffer; }
+    //! Get the option: delay between parallel connection attempts
+    const CppCommon::Timespan& option_connect_stagger() const noexcept { return _option_connect_stagger; }
+    //! Get the option: timeout of each parallel connection attempt
+    const CppCommon::Timespan& option_connect_attempt_timeout() const noexcept { return _option_connect_attempt_timeout; }
+    //! Get the option: TCP Fast Open
+    bool option_fast_open() const noexcept { return _option_fast_open; }
 
     //! Is the client connected?
     bool IsConnected() const noexcept { return _connected; }
@@ -131,7 +158,7 @@ public:
     /*!
         \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
     */
-    virtual bool Disconnect() { return DisconnectInternal(); }
+    virtual bool Disconnect() { StopReconnect(); return DisconnectInternal(); }
     //! Reconnect the client (synchronous)
     /*!
         \return 'true' if the client was successfully reconnected, 'false' if the client is already reconnected
@@ -153,7 +180,7 @@ public:
     /*!
         \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
     */
-    virtual bool DisconnectAsync() { return DisconnectInternalAsync(false); }
+    virtual bool DisconnectAsync() { StopReconnect(); return DisconnectInternalAsync(false); }
     //! Reconnect the client (asynchronous)
     /*!
         \return 'true' if the client was successfully reconnected, 'false' if the client is already reconnected
@@ -192,6 +219,10 @@ public:
 
     //! Send data to the server (asynchronous)
     /*!
+        If the send buffer is preserved across auto-reconnects data could be
+        sent while the client is reconnecting. It will be sent as soon as
+        the client is connected again.
+
         \param buffer - Buffer to send
         \param size - Buffer size
         \return 'true' if the data was successfully sent, 'false' if the client is not connected
@@ -283,8 +314,91 @@ public:
         \param size - Send buffer size
     */
     void SetupSendBufferSize(size_t size);
+    //! Setup option: auto-reconnect
+    /*!
+        When the option is enabled the client connected with ConnectAsync()
+        is reconnected automatically after connect failures and disconnects
+        which were not requested with Disconnect() or DisconnectAsync().
+        Reconnect attempts are delayed with exponential backoff and jitter.
+        Default is disabled.
+
+        \param enable - Enable/disable option
+    */
+    void SetupAutoReconnect(bool enable) noexcept { _option_auto_reconnect = enable; }
+    //! Setup option: auto-reconnect backoff
+    /*!
+        The first reconnect attempt is delayed for the minimal delay and each
+        next attempt doubles the delay up to the maximal one. The delay of each
+        attempt is reduced by a random part up to the given jitter, so clients
+        disconnected at once do not reconnect at once. Default is 100 milliseconds
+        of the minimal delay, 30 seconds of the maximal delay and 0.2 jitter.
+
+        \param delay_min - Minimal reconnect delay
+        \param delay_max - Maximal reconnect delay
+        \param jitter - Jitter in range [0, 1] (default is 0.2)
+    */
+    void SetupReconnectBackoff(const CppCommon::Timespan& delay_min, const CppCommon::Timespan& delay_max, double jitter = 0.2) noexcept
+    { _option_reconnect_delay_min = delay_min; _option_reconnect_delay_max = delay_max; _option_reconnect_jitter = std::clamp(jitter, 0.0, 1.0); }
+    //! Setup option: preserve send buffer across auto-reconnects
+    /*!
+        When the option is enabled unsent data is kept across auto-reconnects
+        and is sent to the server after the client is connected again. Data
+        could be also sent while the client is reconnecting. The buffer which
+        was partially written to the socket is dropped to keep messages intact.
+
+        Clients of protocols which require a handshake after connect (e.g.
+        HTTP and WebSocket) refuse the option, because preserved data would be
+        sent before the handshake. Default is disabled.
+
+        \param enable - Enable/disable option
+        \return 'true' if the option was successfully applied, 'false' if the option is not supported by the client
+    */
+    virtual bool SetupPreserveSendBuffer(bool enable) noexcept { _option_preserve_send_buffer = enable; return true; }
+    //! Setup option: delay between parallel connection attempts
+    /*!
+        Asynchronous connect with the DNS resolver tries resolved endpoints
+        with "Happy Eyeballs" algorithm (RFC 8305): endpoints are interleaved
+        by their address family starting from IPv6 and the next connection
+        attempt is started after the given delay or immediately after the
+        previous attempt fails. The first established connection wins.
+        Default is 250 milliseconds.
+
+        \param stagger - Delay between connection attempts (zero means sequential connection attempts)
+    */
+    void SetupConnectStagger(const CppCommon::Timespan& stagger) noexcept { _option_connect_stagger = stagger; }
+    //! Setup option: timeout of each parallel connection attempt
+    /*!
+        Connection attempts which are not established during the given timeout
+        are cancelled, so a blackholed endpoint does not wait for the full TCP
+        connect timeout. Used only with parallel connection attempts.
+
+        \param timeout - Timeout of each connection attempt (default is zero, which means no timeout)
+    */
+    void SetupConnectAttemptTimeout(const CppCommon::Timespan& timeout) noexcept { _option_connect_attempt_timeout = timeout; }
+    //! Setup option: TCP Fast Open
+    /*!
+        This option will enable TCP_FASTOPEN_CONNECT on the client socket for
+        asynchronous connects if the OS support this feature. If the server
+        TCP Fast Open cookie is cached the connect completes immediately and
+        the first data sent from onConnected() is carried with the SYN packet.
+        Resolver-based connects use it only with parallel connection attempts.
+
+        \param enable - Enable/disable option
+    */
+    void SetupFastOpen(bool enable) noexcept { _option_fast_open = enable; }
 
 protected:
+    //! Disconnect the client (internal asynchronous)
+    /*!
+        Unlike DisconnectAsync() the internal disconnect keeps auto-reconnect
+        armed, so it should be used by derived clients to drop the connection
+        on protocol errors, timeouts or the peer request.
+
+        \param dispatch - Dispatch flag
+        \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
+    */
+    bool DisconnectInternalAsync(bool dispatch);
+
     //! Handle client connected notification
     virtual void onConnected() {}
     //! Handle session handshaked notification
@@ -323,6 +437,24 @@ protected:
     */
     virtual void onEmpty() {}
 
+    //! Handle client reconnecting notification
+    /*!
+        Notification is called when the next auto-reconnect attempt is scheduled.
+
+        \param attempt - Attempt number since the connection was lost
+        \param delay - Delay before the attempt
+    */
+    virtual void onReconnecting(uint64_t attempt, const CppCommon::Timespan& delay) {}
+    //! Handle client reconnected notification
+    /*!
+        Notification is called after onHandshaked() when the client was
+        successfully connected by auto-reconnect.
+
+        \param attempts - Count of attempts since the connection was lost
+        \param recovery - Time since the connection was lost
+    */
+    virtual void onReconnected(uint64_t attempts, const CppCommon::Timespan& recovery) {}
+
     //! Handle error notification
     /*!
         \param error - Error code
@@ -373,20 +505,50 @@ private:
     std::vector<uint8_t> _send_buffer_flush;
     size_t _send_buffer_flush_offset;
     HandlerStorage _send_storage;
+    // Client auto-reconnect
+    std::mutex _reconnect_lock;
+    std::atomic<bool> _reconnect_armed{false};
+    std::shared_ptr<TCPResolver> _reconnect_resolver;
+    Scheduler::Token _reconnect_token;
+    uint64_t _reconnect_attempt{0};
+    uint64_t _reconnect_timestamp{0};
+    std::atomic<uint64_t> _reconnect_attempts{0};
+    std::atomic<uint64_t> _reconnects{0};
+    std::atomic<uint64_t> _reconnect_recovery{0};
+    // Client TCP Fast Open
+    bool _fast_open_pending{false};
+    std::atomic<uint64_t> _fast_open_connects{0};
     // Options
     bool _option_keep_alive;
     bool _option_no_delay;
+    bool _option_auto_reconnect{false};
+    CppCommon::Timespan _option_reconnect_delay_min{CppCommon::Timespan::milliseconds(100)};
+    CppCommon::Timespan _option_reconnect_delay_max{CppCommon::Timespan::seconds(30)};
+    double _option_reconnect_jitter{0.2};
+    bool _option_preserve_send_buffer{false};
+    CppCommon::Timespan _option_connect_stagger{CppCommon::Timespan::milliseconds(250)};
+    CppCommon::Timespan _option_connect_attempt_timeout{CppCommon::Timespan::nanoseconds(0)};
+    bool _option_fast_open{false};
 
     //! Disconnect the client (internal synchronous)
     bool DisconnectInternal();
-    //! Disconnect the client (internal asynchronous)
-    bool DisconnectInternalAsync(bool dispatch);
 
     //! Try to receive new data
     void TryReceive();
     //! Try to send pending data
     void TrySend();
 
+    //! Arm auto-reconnect with the given DNS resolver
+    void StartReconnect(const std::shared_ptr<TCPResolver>& resolver);
+    //! Disarm auto-reconnect and cancel the scheduled reconnect attempt
+    void StopReconnect();
+    //! Schedule the next auto-reconnect attempt if auto-reconnect is armed
+    void ScheduleReconnect();
+    //! Complete auto-reconnect after the client is connected
+    void CompleteReconnect();
+    //! Is the send buffer preserved across auto-reconnects?
+    bool IsSendBufferPreserved() const noexcept { return _option_auto_reconnect && _option_preserve_send_buffer && _reconnect_armed; }
+
     //! Clear send/receive buffers
     void ClearBuffers();
 
@@ -9,8 +9,13 @@
 #ifndef CPPSERVER_ASIO_SSL_SERVER_H
 #define CPPSERVER_ASIO_SSL_SERVER_H
 
+#include "fast_open.h"
+#include "multicast.h"
+#include "rate_limiter.h"
 #include "ssl_context.h"
 #include "ssl_session.h"
+#include "statistics.h"
+#include "subscription.h"
 
 #include "system/uuid.h"
 
@@ -89,9 +94,20 @@ public:
     //! Get the number of bytes pending sent by the server
     uint64_t bytes_pending() const noexcept { return _bytes_pending; }
     //! Get the number of bytes sent by the server
-    uint64_t bytes_sent() const noexcept { return _bytes_sent; }
+    uint64_t bytes_sent() const noexcept { return _statistics.bytes_sent(); }
     //! Get the number of bytes received by the server
-    uint64_t bytes_received() const noexcept { return _bytes_received; }
+    uint64_t bytes_received() const noexcept { return _statistics.bytes_received(); }
+    //! Get the number of sessions connected with TCP Fast Open
+    uint64_t fast_open_sessions() const noexcept { return _fast_open_sessions; }
+
+    //! Get the server statistics snapshot
+    /*!
+        Server-wide counters are aggregated from per-thread shards, so the
+        snapshot is cheap for the working threads and could be taken at any time.
+
+        \return Server statistics snapshot
+    */
+    ServerStatisticsSnapshot statistics();
 
     //! Get the option: keep alive
     bool option_keep_alive() const noexcept { return _option_keep_alive; }
@@ -101,6 +117,12 @@ public:
     bool option_reuse_address() const noexcept { return _option_reuse_address; }
     //! Get the option: reuse port
     bool option_reuse_port() const noexcept { return _option_reuse_port; }
+    //! Get the option: TCP Fast Open queue length
+    size_t option_fast_open() const noexcept { return _option_fast_open; }
+    //! Get the option: receive rate limiter
+    const RateLimiter& option_receive_rate_limit() const noexcept { return _receive_limiter; }
+    //! Get the option: send rate limiter
+    const RateLimiter& option_send_rate_limit() const noexcept { return _send_limiter; }
 
     //! Is the server started?
     bool IsStarted() const noexcept { return _started; }
@@ -134,6 +156,61 @@ public:
         \return 'true' if the text was successfully multicast, 'false' if the server is not started
     */
     virtual bool Multicast(std::string_view text) { return Multicast(text.data(), text.size()); }
+    //! Multicast data to all connected sessions conflated by the given key
+    /*!
+        Slow sessions which have not yet flushed the previous data with the same
+        key get it replaced in place, so their memory stays bounded and they always
+        get the freshest data for each key.
+
+        \param key - Conflation key (e.g. topic or instrument)
+        \param buffer - Buffer to multicast
+        \param size - Buffer size
+        \return 'true' if the data was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool MulticastConflated(std::string_view key, const void* buffer, size_t size);
+    //! Multicast text to all connected sessions conflated by the given key
+    /*!
+        \param key - Conflation key (e.g. topic or instrument)
+        \param text - Text to multicast
+        \return 'true' if the text was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool MulticastConflated(std::string_view key, std::string_view text) { return MulticastConflated(key, text.data(), text.size()); }
+
+    //! Join the given session to the given subscription group
+    /*!
+        Sessions leave all subscription groups automatically when disconnected.
+
+        \param group - Group name (e.g. topic)
+        \param session - Session to join
+        \return 'true' if the session successfully joined the group, 'false' if the session is already a member of the group or is not connected
+    */
+    virtual bool JoinGroup(std::string_view group, const std::shared_ptr<SSLSession>& session) { return _groups.Join(group, session); }
+    //! Leave the given subscription group by the given session
+    /*!
+        \param group - Group name (e.g. topic)
+        \param session - Session to leave
+        \return 'true' if the session successfully left the group, 'false' if the session is not a member of the group
+    */
+    virtual bool LeaveGroup(std::string_view group, const std::shared_ptr<SSLSession>& session) { return _groups.Leave(group, session); }
+
+    //! Publish data to all sessions joined the given subscription group
+    /*!
+        Unlike multicast only group members are touched. Data is copied once
+        and posted once per working thread which owns any group members.
+
+        \param group - Group name (e.g. topic)
+        \param buffer - Buffer to publish
+        \param size - Buffer size
+        \return 'true' if the data was successfully published, 'false' if the server is not started
+    */
+    virtual bool PublishToGroup(std::string_view group, const void* buffer, size_t size);
+    //! Publish text to all sessions joined the given subscription group
+    /*!
+        \param group - Group name (e.g. topic)
+        \param text - Text to publish
+        \return 'true' if the text was successfully published, 'false' if the server is not started
+    */
+    virtual bool PublishToGroup(std::string_view group, std::string_view text) { return PublishToGroup(group, text.data(), text.size()); }
 
     //! Disconnect all connected sessions
     /*!
@@ -178,6 +255,35 @@ public:
         \param enable - Enable/disable option
     */
     void SetupReusePort(bool enable) noexcept { _option_reuse_port = enable; }
+    //! Setup option: TCP Fast Open
+    /*!
+        This option will enable TCP_FASTOPEN on the server acceptor if the OS
+        support this feature, so clients with the cached TCP Fast Open cookie
+        could send their first data with the SYN packet. Default is zero (disabled).
+
+        \param queue - Maximal number of pending TCP Fast Open requests (zero means disabled)
+    */
+    void SetupFastOpen(size_t queue) noexcept { _option_fast_open = queue; }
+    //! Setup option: receive rate limit
+    /*!
+        Server-wide receive budget shared by all sessions. Sessions stop receiving
+        new data when either the session or the server receive budget is exhausted.
+        Default is unlimited.
+
+        \param bytes_per_second - Limit of received bytes per second (zero means unlimited)
+        \param messages_per_second - Limit of received messages per second (zero means unlimited, default is 0)
+    */
+    void SetupReceiveRateLimit(uint64_t bytes_per_second, uint64_t messages_per_second = 0) noexcept { _receive_limiter.Setup(bytes_per_second, messages_per_second); }
+    //! Setup option: send rate limit
+    /*!
+        Server-wide send budget shared by all sessions. Sessions delay sending
+        when either the session or the server send budget is exhausted.
+        Default is unlimited.
+
+        \param bytes_per_second - Limit of sent bytes per second (zero means unlimited)
+        \param messages_per_second - Limit of sent messages per second (zero means unlimited, default is 0)
+    */
+    void SetupSendRateLimit(uint64_t bytes_per_second, uint64_t messages_per_second = 0) noexcept { _send_limiter.Setup(bytes_per_second, messages_per_second); }
 
 protected:
     //! Create SSL session factory method
@@ -244,13 +350,19 @@ private:
     HandlerStorage _acceptor_storage;
     // Server statistic
     uint64_t _bytes_pending;
-    uint64_t _bytes_sent;
-    uint64_t _bytes_received;
+    ServerStatistics _statistics;
+    std::atomic<uint64_t> _fast_open_sessions;
+    // Server subscription groups
+    SubscriptionGroups<SSLSession> _groups;
+    // Server rate limits
+    RateLimiter _receive_limiter;
+    RateLimiter _send_limiter;
     // Options
     bool _option_keep_alive;
     bool _option_no_delay;
     bool _option_reuse_address;
     bool _option_reuse_port;
+    size_t _option_fast_open;
 
     //! Accept new connections
     void Accept();
@@ -9,10 +9,17 @@
 #ifndef CPPSERVER_ASIO_SSL_SESSION_H
 #define CPPSERVER_ASIO_SSL_SESSION_H
 
+#include "rate_limiter.h"
 #include "service.h"
 
 #include "system/uuid.h"
 
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace CppServer {
 namespace Asio {
 
@@ -29,6 +36,9 @@ class SSLSession : public std::enable_shared_from_this<SSLSession>
     friend class SSLServer;
 
 public:
+    //! Size of the normal priority data slice written to the socket at once
+    static constexpr size_t SEND_SLICE = 64 * 1024;
+
     //! Initialize the session with a given server
     /*!
         \param server - Connected server
@@ -70,6 +80,10 @@ public:
     size_t option_send_buffer_limit() const noexcept { return _send_buffer_limit; }
     //! Get the option: send buffer size
     size_t option_send_buffer_size() const;
+    //! Get the option: receive rate limiter
+    const RateLimiter& option_receive_rate_limit() const noexcept { return _receive_limiter; }
+    //! Get the option: send rate limiter
+    const RateLimiter& option_send_rate_limit() const noexcept { return _send_limiter; }
 
     //! Is the session connected?
     bool IsConnected() const noexcept { return _connected; }
@@ -82,6 +96,19 @@ public:
     */
     virtual bool Disconnect() { return DisconnectAsync(false); }
 
+    //! Join the session to the given subscription group of the server
+    /*!
+        \param group - Group name (e.g. topic)
+        \return 'true' if the session successfully joined the group, 'false' if the session is already a member of the group or is not connected
+    */
+    bool JoinGroup(std::string_view group);
+    //! Leave the given subscription group of the server
+    /*!
+        \param group - Group name (e.g. topic)
+        \return 'true' if the session successfully left the group, 'false' if the session is not a member of the group
+    */
+    bool LeaveGroup(std::string_view group);
+
     //! Send data to the client (synchronous)
     /*!
         \param buffer - Buffer to send
@@ -118,13 +145,58 @@ public:
         \param size - Buffer size
         \return 'true' if the data was successfully sent, 'false' if the session is not connected
     */
-    virtual bool SendAsync(const void* buffer, size_t size);
+    virtual bool SendAsync(const void* buffer, size_t size) { return SendAsync(buffer, size, SendPriority::Normal); }
     //! Send text to the client (asynchronous)
     /*!
         \param text - Text to send
         \return 'true' if the text was successfully sent, 'false' if the session is not connected
     */
     virtual bool SendAsync(std::string_view text) { return SendAsync(text.data(), text.size()); }
+    //! Send data to the client with the given priority (asynchronous)
+    /*!
+        High priority data is sent at the next write boundary ahead of all
+        pending normal priority data. Normal priority data is written to the
+        socket by slices of whole messages (SEND_SLICE bytes or one larger
+        message), so high priority data waits for one slice at most and
+        messages are never interleaved. Could be used for heartbeats and
+        control messages which should not wait behind bulk transfers.
+
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \param priority - Send priority lane
+        \return 'true' if the data was successfully sent, 'false' if the session is not connected
+    */
+    virtual bool SendAsync(const void* buffer, size_t size, SendPriority priority);
+    //! Send text to the client with the given priority (asynchronous)
+    /*!
+        \param text - Text to send
+        \param priority - Send priority lane
+        \return 'true' if the text was successfully sent, 'false' if the session is not connected
+    */
+    virtual bool SendAsync(std::string_view text, SendPriority priority) { return SendAsync(text.data(), text.size(), priority); }
+    //! Send data to the client conflated by the given key (asynchronous)
+    /*!
+        If the previous data with the same key is not yet flushed to the socket,
+        it is replaced in place with the given data instead of appending. So the
+        memory used by a slow client stays bounded by the number of keys and the
+        client always gets the freshest data for each key. Conflated data is sent
+        after pending high priority data and after each slice of normal priority
+        data, so it is not starved by normal priority traffic. Keys are sent in
+        order of the first update of each key.
+
+        \param key - Conflation key (e.g. topic or instrument)
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \return 'true' if the data was successfully sent, 'false' if the session is not connected
+    */
+    virtual bool SendConflatedAsync(std::string_view key, const void* buffer, size_t size);
+    //! Send text to the client conflated by the given key (asynchronous)
+    /*!
+        \param key - Conflation key (e.g. topic or instrument)
+        \param text - Text to send
+        \return 'true' if the text was successfully sent, 'false' if the session is not connected
+    */
+    virtual bool SendConflatedAsync(std::string_view key, std::string_view text) { return SendConflatedAsync(key, text.data(), text.size()); }
 
     //! Receive data from the client (synchronous)
     /*!
@@ -189,6 +261,30 @@ public:
         \param size - Send buffer size
     */
     void SetupSendBufferSize(size_t size);
+    //! Setup option: receive rate limit
+    /*!
+        When the receive budget is exhausted the session stops receiving new
+        data until the budget is refilled, so TCP flow control pushes back on
+        the client. Each receive operation reads no more than the available
+        budget and waits until the budget allows to fill the receive buffer
+        (or the whole burst). Each completed receive operation is counted as
+        a message.
+        Only asynchronous receive is limited. Default is unlimited.
+
+        \param bytes_per_second - Limit of received bytes per second (zero means unlimited)
+        \param messages_per_second - Limit of received messages per second (zero means unlimited, default is 0)
+    */
+    void SetupReceiveRateLimit(uint64_t bytes_per_second, uint64_t messages_per_second = 0) noexcept { _receive_limiter.Setup(bytes_per_second, messages_per_second); }
+    //! Setup option: send rate limit
+    /*!
+        When the send budget is exhausted the session delays sending of pending
+        data until the budget is refilled. Each asynchronous send call is counted
+        as a message. Only asynchronous send is limited. Default is unlimited.
+
+        \param bytes_per_second - Limit of sent bytes per second (zero means unlimited)
+        \param messages_per_second - Limit of sent messages per second (zero means unlimited, default is 0)
+    */
+    void SetupSendRateLimit(uint64_t bytes_per_second, uint64_t messages_per_second = 0) noexcept { _send_limiter.Setup(bytes_per_second, messages_per_second); }
 
 protected:
     //! Handle session connected notification
@@ -255,6 +351,7 @@ private:
     uint64_t _bytes_pending;
     uint64_t _bytes_sending;
     uint64_t _bytes_sent;
+    uint64_t _bytes_sent_main{0};
     uint64_t _bytes_received;
     // Receive buffer
     bool _receiving;
@@ -266,9 +363,22 @@ private:
     std::mutex _send_lock;
     size_t _send_buffer_limit{0};
     std::vector<uint8_t> _send_buffer_main;
+    std::deque<size_t> _send_buffer_main_marks;
+    size_t _send_buffer_main_offset{0};
+    std::vector<uint8_t> _send_buffer_high;
+    std::map<std::string, size_t, std::less<>> _send_conflated_index;
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> _send_conflated;
+    size_t _send_conflated_size{0};
+    bool _send_conflated_turn{false};
     std::vector<uint8_t> _send_buffer_flush;
     size_t _send_buffer_flush_offset;
+    bool _send_buffer_flush_main{false};
     HandlerStorage _send_storage;
+    // Session rate limits
+    RateLimiter _receive_limiter;
+    RateLimiter _send_limiter;
+    bool _receive_throttled;
+    bool _send_throttled;
 
     //! Connect the session
     void Connect();
@@ -286,6 +396,26 @@ private:
     //! Try to send pending data
     void TrySend();
 
+    //! Get the receive or send throttling delay of the session and the server
+    /*!
+        \param receive - Receive or send flag
+        \param size - Count of bytes required (default is 0)
+        \return Throttling delay in nanoseconds
+    */
+    uint64_t ThrottleDelay(bool receive, size_t size = 0) const;
+    //! Get the receive size limited by the receive budget of the session and the server
+    /*!
+        \param size - Receive buffer size
+        \return Receive size
+    */
+    size_t ReceiveBudget(size_t size) const;
+    //! Throttle receive or send operations for the given delay
+    /*!
+        \param receive - Receive or send flag
+        \param delay - Throttling delay in nanoseconds
+    */
+    void Throttle(bool receive, uint64_t delay);
+
     //! Clear send/receive buffers
     void ClearBuffers();
     //! Reset server
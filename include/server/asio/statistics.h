@@ -0,0 +1,100 @@
+/*!
+    \file statistics.h
+    \brief Asio server statistics definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_STATISTICS_H
+#define CPPSERVER_ASIO_STATISTICS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace CppServer {
+namespace Asio {
+
+//! Server statistics snapshot
+struct ServerStatisticsSnapshot
+{
+    //! Number of sessions connected to the server
+    uint64_t connected_sessions{0};
+    //! Number of bytes sent by the server
+    uint64_t bytes_sent{0};
+    //! Number of bytes received by the server
+    uint64_t bytes_received{0};
+    //! Number of sessions disconnected by the server overload control
+    uint64_t shed_connections{0};
+    //! Number of requests rejected by the server overload control
+    uint64_t shed_requests{0};
+};
+
+//! Server statistics
+/*!
+    Server-wide statistic counters which are updated from all working
+    threads. Counters are kept in per-thread cache-line-padded shards
+    to avoid false sharing and are aggregated on read.
+
+    Thread-safe.
+*/
+class ServerStatistics
+{
+public:
+    ServerStatistics() noexcept = default;
+    ServerStatistics(const ServerStatistics&) = delete;
+    ServerStatistics(ServerStatistics&&) = delete;
+    ~ServerStatistics() noexcept = default;
+
+    ServerStatistics& operator=(const ServerStatistics&) = delete;
+    ServerStatistics& operator=(ServerStatistics&&) = delete;
+
+    //! Get the number of bytes sent
+    uint64_t bytes_sent() const noexcept;
+    //! Get the number of bytes received
+    uint64_t bytes_received() const noexcept;
+
+    //! Add the given number of sent bytes
+    /*!
+        \param size - Number of sent bytes
+    */
+    void AddBytesSent(uint64_t size) noexcept;
+    //! Add the given number of received bytes
+    /*!
+        \param size - Number of received bytes
+    */
+    void AddBytesReceived(uint64_t size) noexcept;
+
+    //! Make the statistics snapshot
+    /*!
+        \param snapshot - Snapshot to fill
+    */
+    void Snapshot(ServerStatisticsSnapshot& snapshot) const noexcept;
+
+    //! Reset all counters
+    void Reset() noexcept;
+
+private:
+    static const size_t SHARDS = 64;
+    static const size_t CACHE_LINE = 64;
+
+    // Statistic counters shard
+    struct alignas(CACHE_LINE) Shard
+    {
+        std::atomic<uint64_t> bytes_sent{0};
+        std::atomic<uint64_t> bytes_received{0};
+    };
+
+    Shard _shards[SHARDS];
+
+    //! Get the statistic counters shard of the current thread
+    Shard& CurrentShard() noexcept;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#include "statistics.inl"
+
+#endif // CPPSERVER_ASIO_STATISTICS_H
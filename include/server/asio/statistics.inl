@@ -0,0 +1,67 @@
+/*!
+    \file statistics.inl
+    \brief Asio server statistics inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppServer {
+namespace Asio {
+
+inline uint64_t ServerStatistics::bytes_sent() const noexcept
+{
+    uint64_t result = 0;
+    for (const auto& shard : _shards)
+        result += shard.bytes_sent.load(std::memory_order_relaxed);
+    return result;
+}
+
+inline uint64_t ServerStatistics::bytes_received() const noexcept
+{
+    uint64_t result = 0;
+    for (const auto& shard : _shards)
+        result += shard.bytes_received.load(std::memory_order_relaxed);
+    return result;
+}
+
+inline void ServerStatistics::AddBytesSent(uint64_t size) noexcept
+{
+    CurrentShard().bytes_sent.fetch_add(size, std::memory_order_relaxed);
+}
+
+inline void ServerStatistics::AddBytesReceived(uint64_t size) noexcept
+{
+    CurrentShard().bytes_received.fetch_add(size, std::memory_order_relaxed);
+}
+
+inline void ServerStatistics::Snapshot(ServerStatisticsSnapshot& snapshot) const noexcept
+{
+    snapshot.bytes_sent = 0;
+    snapshot.bytes_received = 0;
+    for (const auto& shard : _shards)
+    {
+        snapshot.bytes_sent += shard.bytes_sent.load(std::memory_order_relaxed);
+        snapshot.bytes_received += shard.bytes_received.load(std::memory_order_relaxed);
+    }
+}
+
+inline void ServerStatistics::Reset() noexcept
+{
+    for (auto& shard : _shards)
+    {
+        shard.bytes_sent.store(0, std::memory_order_relaxed);
+        shard.bytes_received.store(0, std::memory_order_relaxed);
+    }
+}
+
+inline ServerStatistics::Shard& ServerStatistics::CurrentShard() noexcept
+{
+    // Each thread gets its own shard index in round-robin order
+    static std::atomic<size_t> counter(0);
+    thread_local size_t index = counter.fetch_add(1, std::memory_order_relaxed) % SHARDS;
+    return _shards[index];
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,131 @@
+/*!
+    \file subscription.h
+    \brief Asio subscription groups definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_SUBSCRIPTION_H
+#define CPPSERVER_ASIO_SUBSCRIPTION_H
+
+#include "service.h"
+
+#include "system/uuid.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! Asio subscription groups
+/*!
+    Subscription groups are used to publish data only to sessions which
+    joined the named group (e.g. topic) instead of iterating all server
+    sessions.
+
+    Members of each group are partitioned by the Asio IO service which
+    owns the session, so published data is copied once and posted once
+    per working thread rather than once per session. Partition members
+    are stored in immutable copy-on-write lists, so publishing does not
+    copy members and joining or leaving never blocks published handlers.
+
+    If the Asio IO service is shared by several working threads (thread-pool
+    design) published data is posted through the service strand to keep the
+    order of consecutive publications.
+
+    Thread-safe.
+*/
+template <class TSession>
+class SubscriptionGroups
+{
+public:
+    SubscriptionGroups() = default;
+    SubscriptionGroups(const SubscriptionGroups&) = delete;
+    SubscriptionGroups(SubscriptionGroups&&) = delete;
+    ~SubscriptionGroups() = default;
+
+    SubscriptionGroups& operator=(const SubscriptionGroups&) = delete;
+    SubscriptionGroups& operator=(SubscriptionGroups&&) = delete;
+
+    //! Get the number of groups
+    size_t size() const;
+    //! Get the number of members of the given group
+    /*!
+        \param group - Group name
+        \return Number of group members
+    */
+    size_t size(std::string_view group) const;
+
+    //! Join the given session to the given group
+    /*!
+        \param group - Group name
+        \param session - Session to join
+        \return 'true' if the session successfully joined the group, 'false' if the session is already a member of the group or is not connected
+    */
+    bool Join(std::string_view group, const std::shared_ptr<TSession>& session);
+    //! Leave the given group by the given session
+    /*!
+        Empty groups are removed.
+
+        \param group - Group name
+        \param session - Session to leave
+        \return 'true' if the session successfully left the group, 'false' if the session is not a member of the group
+    */
+    bool Leave(std::string_view group, const std::shared_ptr<TSession>& session);
+    //! Leave all groups by the given session
+    /*!
+        \param session - Session to leave
+    */
+    void LeaveAll(const std::shared_ptr<TSession>& session);
+
+    //! Publish data to all members of the given group
+    /*!
+        \param group - Group name
+        \param buffer - Buffer to publish
+        \param size - Buffer size
+        \return Number of group members the data was published to
+    */
+    size_t Publish(std::string_view group, const void* buffer, size_t size);
+
+    //! Clear all groups
+    void Clear();
+
+private:
+    typedef std::vector<std::shared_ptr<TSession>> Members;
+
+    // Group members of a single Asio IO service
+    struct Partition
+    {
+        std::shared_ptr<Service> service;
+        std::shared_ptr<asio::io_service> io_service;
+        std::shared_ptr<const Members> members;
+    };
+
+    // Group partitions
+    struct Group
+    {
+        std::vector<Partition> partitions;
+        size_t size{0};
+    };
+
+    mutable std::shared_mutex _lock;
+    std::map<std::string, Group, std::less<>> _groups;
+    std::map<CppCommon::UUID, std::vector<std::string>> _memberships;
+
+    //! Remove the given session from the given group without lock
+    bool LeaveInternal(typename std::map<std::string, Group, std::less<>>::iterator it, const std::shared_ptr<TSession>& session);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#include "subscription.inl"
+
+#endif // CPPSERVER_ASIO_SUBSCRIPTION_H
@@ -0,0 +1,182 @@
+/*!
+    \file subscription.inl
+    \brief Asio subscription groups inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include <algorithm>
+
+namespace CppServer {
+namespace Asio {
+
+template <class TSession>
+inline size_t SubscriptionGroups<TSession>::size() const
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    return _groups.size();
+}
+
+template <class TSession>
+inline size_t SubscriptionGroups<TSession>::size(std::string_view group) const
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    auto it = _groups.find(group);
+    return (it != _groups.end()) ? it->second.size : 0;
+}
+
+template <class TSession>
+inline bool SubscriptionGroups<TSession>::Join(std::string_view group, const std::shared_ptr<TSession>& session)
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    // Disconnected sessions have already left all groups
+    if (!session->IsConnected())
+        return false;
+
+    // Find or create the group
+    auto it = _groups.find(group);
+    if (it == _groups.end())
+        it = _groups.emplace(std::string(group), Group()).first;
+
+    // Find or create the partition of the session Asio IO service
+    auto partition = std::find_if(it->second.partitions.begin(), it->second.partitions.end(), [&session](const Partition& p) { return p.io_service == session->io_service(); });
+    if (partition == it->second.partitions.end())
+        partition = it->second.partitions.insert(it->second.partitions.end(), Partition{ session->server()->service(), session->io_service(), std::make_shared<const Members>() });
+
+    // Check the session is not a member of the group
+    if (std::find(partition->members->begin(), partition->members->end(), session) != partition->members->end())
+        return false;
+
+    // Copy partition members with the new session
+    auto members = std::make_shared<Members>(*partition->members);
+    members->push_back(session);
+    partition->members = members;
+    ++it->second.size;
+
+    // Register the session membership
+    _memberships[session->id()].emplace_back(group);
+
+    return true;
+}
+
+template <class TSession>
+inline bool SubscriptionGroups<TSession>::Leave(std::string_view group, const std::shared_ptr<TSession>& session)
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    auto it = _groups.find(group);
+    if (it == _groups.end())
+        return false;
+
+    if (!LeaveInternal(it, session))
+        return false;
+
+    // Unregister the session membership
+    auto membership = _memberships.find(session->id());
+    if (membership != _memberships.end())
+    {
+        auto& groups = membership->second;
+        groups.erase(std::remove(groups.begin(), groups.end(), group), groups.end());
+        if (groups.empty())
+            _memberships.erase(membership);
+    }
+
+    return true;
+}
+
+template <class TSession>
+inline void SubscriptionGroups<TSession>::LeaveAll(const std::shared_ptr<TSession>& session)
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    auto membership = _memberships.find(session->id());
+    if (membership == _memberships.end())
+        return;
+
+    // Leave all joined groups
+    for (const auto& group : membership->second)
+    {
+        auto it = _groups.find(group);
+        if (it != _groups.end())
+            LeaveInternal(it, session);
+    }
+
+    _memberships.erase(membership);
+}
+
+template <class TSession>
+inline bool SubscriptionGroups<TSession>::LeaveInternal(typename std::map<std::string, Group, std::less<>>::iterator it, const std::shared_ptr<TSession>& session)
+{
+    // Find the partition of the session Asio IO service
+    auto& partitions = it->second.partitions;
+    auto partition = std::find_if(partitions.begin(), partitions.end(), [&session](const Partition& p) { return p.io_service == session->io_service(); });
+    if (partition == partitions.end())
+        return false;
+
+    // Copy partition members without the session
+    auto members = std::make_shared<Members>();
+    members->reserve(partition->members->size());
+    for (const auto& member : *partition->members)
+        if (member != session)
+            members->push_back(member);
+    if (members->size() == partition->members->size())
+        return false;
+    --it->second.size;
+
+    // Remove empty partition and group
+    if (members->empty())
+        partitions.erase(partition);
+    else
+        partition->members = members;
+    if (partitions.empty())
+        _groups.erase(it);
+
+    return true;
+}
+
+template <class TSession>
+inline size_t SubscriptionGroups<TSession>::Publish(std::string_view group, const void* buffer, size_t size)
+{
+    std::shared_lock<std::shared_mutex> locker(_lock);
+
+    auto it = _groups.find(group);
+    if (it == _groups.end())
+        return 0;
+
+    // Copy the published data once for all working threads
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    auto data = std::make_shared<const std::vector<uint8_t>>(bytes, bytes + size);
+
+    // Post the data once per working thread to all its group members
+    for (const auto& partition : it->second.partitions)
+    {
+        auto members = partition.members;
+        auto publish_handler = [members, data]()
+        {
+            for (const auto& member : *members)
+                member->SendAsync(data->data(), data->size());
+        };
+        if (partition.service->IsStrandRequired())
+            partition.service->Post(publish_handler);
+        else
+            partition.io_service->post(publish_handler);
+    }
+
+    return it->second.size;
+}
+
+template <class TSession>
+inline void SubscriptionGroups<TSession>::Clear()
+{
+    std::unique_lock<std::shared_mutex> locker(_lock);
+
+    _groups.clear();
+    _memberships.clear();
+}
+
+} // namespace Asio
+} // namespace CppServer
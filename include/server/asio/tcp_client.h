@@ -9,11 +9,15 @@
 #ifndef CPPSERVER_ASIO_TCP_CLIENT_H
 #define CPPSERVER_ASIO_TCP_CLIENT_H
 
+#include "awaitable.h"
+#include "fast_open.h"
+#include "tcp_connector.h"
 #include "tcp_resolver.h"
 
 #include "system/uuid.h"
 #include "time/timespan.h"
 
+#include <algorithm>
 #include <mutex>
 #include <vector>
 
@@ -28,6 +32,13 @@ namespace Asio {
 */
 class TCPClient : public std::enable_shared_from_this<TCPClient>
 {
+    friend class TCPProxyClient;
+#if defined(CPPSERVER_COROUTINES)
+    friend class ConnectAwaiter<TCPClient, TCPResolver>;
+    friend class ReceiveAwaiter<TCPClient>;
+    friend class SendAwaiter<TCPClient>;
+#endif
+
 public:
     //! Initialize TCP client with a given Asio service, server address and port number
     /*!
@@ -83,6 +94,14 @@ public:
     uint64_t bytes_sent() const noexcept { return _bytes_sent; }
     //! Get the number of bytes received by the client
     uint64_t bytes_received() const noexcept { return _bytes_received; }
+    //! Get the number of auto-reconnect attempts
+    uint64_t reconnect_attempts() const noexcept { return _reconnect_attempts; }
+    //! Get the number of successful auto-reconnects
+    uint64_t reconnects() const noexcept { return _reconnects; }
+    //! Get the recovery time of the last successful auto-reconnect
+    CppCommon::Timespan reconnect_recovery_time() const noexcept { return CppCommon::Timespan::nanoseconds(_reconnect_recovery); }
+    //! Get the number of connects with data carried by the SYN packet (TCP Fast Open)
+    uint64_t fast_open_connects() const noexcept { return _fast_open_connects; }
 
     //! Get the option: keep alive
     bool option_keep_alive() const noexcept { return _option_keep_alive; }
@@ -96,6 +115,22 @@ public:
     size_t option_send_buffer_limit() const noexcept { return _send_buffer_limit; }
     //! Get the option: send buffer size
     size_t option_send_buffer_size() const;
+    //! Get the option: auto-reconnect
+    bool option_auto_reconnect() const noexcept { return _option_auto_reconnect; }
+    //! Get the option: minimal auto-reconnect delay
+    const CppCommon::Timespan& option_reconnect_delay_min() const noexcept { return _option_reconnect_delay_min; }
+    //! Get the option: maximal auto-reconnect delay
+    const CppCommon::Timespan& option_reconnect_delay_max() const noexcept { return _option_reconnect_delay_max; }
+    //! Get the option: auto-reconnect delay jitter
+    double option_reconnect_jitter() const noexcept { return _option_reconnect_jitter; }
+    //! Get the option: preserve send buffer across auto-reconnects
+    bool option_preserve_send_buffer() const noexcept { return _option_preserve_send_buffer; }
+    //! Get the option: delay between parallel connection attempts
+    const CppCommon::Timespan& option_connect_stagger() const noexcept { return _option_connect_stagger; }
+    //! Get the option: timeout of each parallel connection attempt
+    const CppCommon::Timespan& option_connect_attempt_timeout() const noexcept { return _option_connect_attempt_timeout; }
+    //! Get the option: TCP Fast Open
+    bool option_fast_open() const noexcept { return _option_fast_open; }
 
     //! Is the client connected?
     bool IsConnected() const noexcept { return _connected; }
@@ -121,7 +156,7 @@ public:
     /*!
         \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
     */
-    virtual bool Disconnect() { return DisconnectInternal(); }
+    virtual bool Disconnect() { StopReconnect(); return DisconnectInternal(); }
     //! Reconnect the client (synchronous)
     /*!
         \return 'true' if the client was successfully reconnected, 'false' if the client is already reconnected
@@ -143,13 +178,33 @@ public:
     /*!
         \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
     */
-    virtual bool DisconnectAsync() { return DisconnectInternalAsync(false); }
+    virtual bool DisconnectAsync() { StopReconnect(); return DisconnectInternalAsync(false); }
     //! Reconnect the client (asynchronous)
     /*!
         \return 'true' if the client was successfully reconnected, 'false' if the client is already reconnected
     */
     virtual bool ReconnectAsync();
 
+#if defined(CPPSERVER_COROUTINES)
+    //! Connect the client with timeout (C++20 coroutine)
+    /*!
+        Awaitable is resumed on the client executor when the client is
+        connected, failed to connect or the timeout is expired. The client
+        socket is closed on timeout.
+
+        \param timeout - Timeout (zero means wait without timeout)
+        \return Awaitable 'true' if the client was successfully connected, 'false' if the client failed to connect
+    */
+    [[nodiscard]] ConnectAwaiter<TCPClient, TCPResolver> ConnectAsync(const CppCommon::Timespan& timeout);
+    //! Connect the client using the given DNS resolver with timeout (C++20 coroutine)
+    /*!
+        \param resolver - DNS resolver
+        \param timeout - Timeout (zero means wait without timeout)
+        \return Awaitable 'true' if the client was successfully connected, 'false' if the client failed to connect
+    */
+    [[nodiscard]] ConnectAwaiter<TCPClient, TCPResolver> ConnectAsync(const std::shared_ptr<TCPResolver>& resolver, const CppCommon::Timespan& timeout);
+#endif
+
     //! Send data to the server (synchronous)
     /*!
         \param buffer - Buffer to send
@@ -182,6 +237,10 @@ public:
 
     //! Send data to the server (asynchronous)
     /*!
+        If the send buffer is preserved across auto-reconnects data could be
+        sent while the client is reconnecting. It will be sent as soon as
+        the client is connected again.
+
         \param buffer - Buffer to send
         \param size - Buffer size
         \return 'true' if the data was successfully sent, 'false' if the client is not connected
@@ -227,6 +286,74 @@ public:
     //! Receive data from the server (asynchronous)
     virtual void ReceiveAsync();
 
+    //! Is receiving of data paused?
+    bool IsReceivePaused() const noexcept { return _receive_paused; }
+    //! Pause receiving of data
+    /*!
+        The receive loop is stopped after the pending receive operation is
+        completed, so the server is pushed back by TCP flow control. Could be
+        used to apply backpressure when received data is forwarded to a slow
+        consumer.
+    */
+    void PauseReceive() noexcept { _receive_paused = true; }
+    //! Resume receiving of data paused with PauseReceive()
+    void ResumeReceive();
+
+#if defined(CPPSERVER_COROUTINES)
+    //! Send data to the server with timeout (C++20 coroutine)
+    /*!
+        Awaitable is resumed on the client executor when the whole buffer is
+        sent, the timeout is expired or the client is disconnected.
+
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \param timeout - Timeout (zero means wait without timeout)
+        \return Awaitable size of sent data
+    */
+    [[nodiscard]] SendAwaiter<TCPClient> SendAsync(const void* buffer, size_t size, const CppCommon::Timespan& timeout);
+    //! Send text to the server with timeout (C++20 coroutine)
+    /*!
+        \param text - Text to send
+        \param timeout - Timeout (zero means wait without timeout)
+        \return Awaitable size of sent text
+    */
+    [[nodiscard]] SendAwaiter<TCPClient> SendAsync(std::string_view text, const CppCommon::Timespan& timeout) { return SendAsync(text.data(), text.size(), timeout); }
+
+    //! Receive data from the server with timeout (C++20 coroutine)
+    /*!
+        Awaitable is resumed on the client executor with the next part of
+        received data. The first call starts the awaiting mode: from now on all
+        received data that is not consumed by the pending awaiter (including data
+        received between awaits, e.g. while the coroutine awaits SendAsync()) is
+        cached for the next await until StopReceiveAwaiting() is called.
+        The cache is bounded by the receive buffer limit (or 1 MiB if it is not
+        set), the client is disconnected if the limit is exceeded. The client
+        onReceived() handler is still called for all received data.
+
+        \param buffer - Buffer to receive
+        \param size - Buffer size to receive
+        \param timeout - Timeout (zero means wait without timeout)
+        \return Awaitable size of received data (zero on timeout or disconnect)
+    */
+    [[nodiscard]] ReceiveAwaiter<TCPClient> ReceiveAsync(void* buffer, size_t size, const CppCommon::Timespan& timeout);
+
+    //! Is the client in the receive awaiting mode?
+    bool IsReceiveAwaiting() const noexcept { return _receive_awaiting; }
+    //! Start the receive awaiting mode
+    /*!
+        Start caching received data for coroutine receive awaiters before the
+        first ReceiveAsync() call, e.g. in onConnected() handler, so the data
+        received before the first await is not missed.
+    */
+    void StartReceiveAwaiting() noexcept { _receive_awaiting = true; }
+    //! Stop the receive awaiting mode
+    /*!
+        Cached data is dropped. The pending receive awaiter is still resumed
+        with the next received data, but the rest of it is not cached.
+    */
+    void StopReceiveAwaiting();
+#endif
+
     //! Setup option: keep alive
     /*!
         This option will setup SO_KEEPALIVE if the OS support this feature.
@@ -273,8 +400,107 @@ public:
         \param size - Send buffer size
     */
     void SetupSendBufferSize(size_t size);
+    //! Setup option: auto-reconnect
+    /*!
+        When the option is enabled the client connected with ConnectAsync()
+        is reconnected automatically after connect failures and disconnects
+        which were not requested with Disconnect() or DisconnectAsync().
+        Reconnect attempts are delayed with exponential backoff and jitter.
+        Default is disabled.
+
+        \param enable - Enable/disable option
+    */
+    void SetupAutoReconnect(bool enable) noexcept { _option_auto_reconnect = enable; }
+    //! Setup option: auto-reconnect backoff
+    /*!
+        The first reconnect attempt is delayed for the minimal delay and each
+        next attempt doubles the delay up to the maximal one. The delay of each
+        attempt is reduced by a random part up to the given jitter, so clients
+        disconnected at once do not reconnect at once. Default is 100 milliseconds
+        of the minimal delay, 30 seconds of the maximal delay and 0.2 jitter.
+
+        \param delay_min - Minimal reconnect delay
+        \param delay_max - Maximal reconnect delay
+        \param jitter - Jitter in range [0, 1] (default is 0.2)
+    */
+    void SetupReconnectBackoff(const CppCommon::Timespan& delay_min, const CppCommon::Timespan& delay_max, double jitter = 0.2) noexcept
+    { _option_reconnect_delay_min = delay_min; _option_reconnect_delay_max = delay_max; _option_reconnect_jitter = std::clamp(jitter, 0.0, 1.0); }
+    //! Setup option: preserve send buffer across auto-reconnects
+    /*!
+        When the option is enabled unsent data is kept across auto-reconnects
+        and is sent to the server after the client is connected again. Data
+        could be also sent while the client is reconnecting. The buffer which
+        was partially written to the socket is dropped to keep messages intact.
+
+        Clients of protocols which require a handshake after connect (e.g.
+        HTTP and WebSocket) refuse the option, because preserved data would be
+        sent before the handshake. Default is disabled.
+
+        \param enable - Enable/disable option
+        \return 'true' if the option was successfully applied, 'false' if the option is not supported by the client
+    */
+    virtual bool SetupPreserveSendBuffer(bool enable) noexcept { _option_preserve_send_buffer = enable; return true; }
+    //! Setup option: delay between parallel connection attempts
+    /*!
+        Asynchronous connect with the DNS resolver tries resolved endpoints
+        with "Happy Eyeballs" algorithm (RFC 8305): endpoints are interleaved
+        by their address family starting from IPv6 and the next connection
+        attempt is started after the given delay or immediately after the
+        previous attempt fails. The first established connection wins.
+        Default is 250 milliseconds.
+
+        \param stagger - Delay between connection attempts (zero means sequential connection attempts)
+    */
+    void SetupConnectStagger(const CppCommon::Timespan& stagger) noexcept { _option_connect_stagger = stagger; }
+    //! Setup option: timeout of each parallel connection attempt
+    /*!
+        Connection attempts which are not established during the given timeout
+        are cancelled, so a blackholed endpoint does not wait for the full TCP
+        connect timeout. Used only with parallel connection attempts.
+
+        \param timeout - Timeout of each connection attempt (default is zero, which means no timeout)
+    */
+    void SetupConnectAttemptTimeout(const CppCommon::Timespan& timeout) noexcept { _option_connect_attempt_timeout = timeout; }
+    //! Setup option: TCP Fast Open
+    /*!
+        This option will enable TCP_FASTOPEN_CONNECT on the client socket for
+        asynchronous connects if the OS support this feature. If the server
+        TCP Fast Open cookie is cached the connect completes immediately and
+        the first data sent from onConnected() is carried with the SYN packet.
+        Resolver-based connects use it only with parallel connection attempts.
+
+        \param enable - Enable/disable option
+    */
+    void SetupFastOpen(bool enable) noexcept { _option_fast_open = enable; }
 
 protected:
+    //! Initialize TCP client bound to the given Asio IO service and strand
+    /*!
+        Client handlers are executed by the given IO service (or strand if it
+        is required by the Asio service) instead of the one selected from the
+        Asio service. It is used to serialize the client with another session
+        or client which touches its socket (e.g. the proxy upstream client and
+        its proxy session).
+
+        \param service - Asio service
+        \param io_service - Asio IO service
+        \param strand - Asio IO service strand
+        \param address - Server address
+        \param port - Server port number
+    */
+    TCPClient(const std::shared_ptr<Service>& service, const std::shared_ptr<asio::io_service>& io_service, const asio::io_service::strand& strand, const std::string& address, int port);
+
+    //! Disconnect the client (internal asynchronous)
+    /*!
+        Unlike DisconnectAsync() the internal disconnect keeps auto-reconnect
+        armed, so it should be used by derived clients to drop the connection
+        on protocol errors, timeouts or the peer request.
+
+        \param dispatch - Dispatch flag
+        \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
+    */
+    bool DisconnectInternalAsync(bool dispatch);
+
     //! Handle client connected notification
     virtual void onConnected() {}
     //! Handle client disconnected notification
@@ -311,6 +537,24 @@ protected:
     */
     virtual void onEmpty() {}
 
+    //! Handle client reconnecting notification
+    /*!
+        Notification is called when the next auto-reconnect attempt is scheduled.
+
+        \param attempt - Attempt number since the connection was lost
+        \param delay - Delay before the attempt
+    */
+    virtual void onReconnecting(uint64_t attempt, const CppCommon::Timespan& delay) {}
+    //! Handle client reconnected notification
+    /*!
+        Notification is called after onConnected() when the client was
+        successfully connected by auto-reconnect.
+
+        \param attempts - Count of attempts since the connection was lost
+        \param recovery - Time since the connection was lost
+    */
+    virtual void onReconnected(uint64_t attempts, const CppCommon::Timespan& recovery) {}
+
     //! Handle error notification
     /*!
         \param error - Error code
@@ -319,6 +563,21 @@ protected:
     */
     virtual void onError(int error, const std::string& category, const std::string& message) {}
 
+#if defined(CPPSERVER_COROUTINES)
+    //! Is the pending connect awaiter resumed when the client is connected?
+    /*!
+        Clients with an additional protocol handshake (e.g. WebSocket) should
+        return 'false' and resume the connect awaiter with ResumeConnectAwaiter()
+        when the handshake is completed.
+    */
+    virtual bool IsConnectAwaiterResumedOnConnect() const noexcept { return true; }
+    //! Resume the pending connect awaiter
+    /*!
+        \param connected - Connected flag
+    */
+    void ResumeConnectAwaiter(bool connected);
+#endif
+
 private:
     // Client Id
     CppCommon::UUID _id;
@@ -346,6 +605,8 @@ private:
     uint64_t _bytes_received;
     // Receive buffer
     bool _receiving;
+    bool _receive_detached{false};
+    std::atomic<bool> _receive_paused{false};
     size_t _receive_buffer_limit{0};
     std::vector<uint8_t> _receive_buffer;
     HandlerStorage _receive_storage;
@@ -357,25 +618,90 @@ private:
     std::vector<uint8_t> _send_buffer_flush;
     size_t _send_buffer_flush_offset;
     HandlerStorage _send_storage;
+    // Client auto-reconnect
+    std::mutex _reconnect_lock;
+    std::atomic<bool> _reconnect_armed{false};
+    std::shared_ptr<TCPResolver> _reconnect_resolver;
+    Scheduler::Token _reconnect_token;
+    uint64_t _reconnect_attempt{0};
+    uint64_t _reconnect_timestamp{0};
+    std::atomic<uint64_t> _reconnect_attempts{0};
+    std::atomic<uint64_t> _reconnects{0};
+    std::atomic<uint64_t> _reconnect_recovery{0};
+    // Client TCP Fast Open
+    bool _fast_open_pending{false};
+    std::atomic<uint64_t> _fast_open_connects{0};
     // Options
     bool _option_keep_alive;
     bool _option_no_delay;
+    bool _option_auto_reconnect{false};
+    CppCommon::Timespan _option_reconnect_delay_min{CppCommon::Timespan::milliseconds(100)};
+    CppCommon::Timespan _option_reconnect_delay_max{CppCommon::Timespan::seconds(30)};
+    double _option_reconnect_jitter{0.2};
+    bool _option_preserve_send_buffer{false};
+    CppCommon::Timespan _option_connect_stagger{CppCommon::Timespan::milliseconds(250)};
+    CppCommon::Timespan _option_connect_attempt_timeout{CppCommon::Timespan::nanoseconds(0)};
+    bool _option_fast_open{false};
+#if defined(CPPSERVER_COROUTINES)
+    // Coroutine awaiters
+    ConnectAwaiter<TCPClient, TCPResolver>* _connect_awaiter{nullptr};
+    std::atomic<bool> _receive_awaiting{false};
+    std::vector<uint8_t> _receive_awaiter_cache;
+    ReceiveAwaiter<TCPClient>* _receive_awaiter{nullptr};
+    SendAwaiter<TCPClient>* _send_awaiter{nullptr};
+#endif
 
     //! Disconnect the client (internal synchronous)
     bool DisconnectInternal();
-    //! Disconnect the client (internal asynchronous)
-    bool DisconnectInternalAsync(bool dispatch);
 
     //! Try to receive new data
     void TryReceive();
     //! Try to send pending data
     void TrySend();
 
+    //! Arm auto-reconnect with the given DNS resolver
+    void StartReconnect(const std::shared_ptr<TCPResolver>& resolver);
+    //! Disarm auto-reconnect and cancel the scheduled reconnect attempt
+    void StopReconnect();
+    //! Schedule the next auto-reconnect attempt if auto-reconnect is armed
+    void ScheduleReconnect();
+    //! Complete auto-reconnect after the client is connected
+    void CompleteReconnect();
+    //! Is the send buffer preserved across auto-reconnects?
+    bool IsSendBufferPreserved() const noexcept { return _option_auto_reconnect && _option_preserve_send_buffer && _reconnect_armed; }
+
     //! Clear send/receive buffers
     void ClearBuffers();
 
     //! Send error notification
     void SendError(std::error_code ec);
+
+#if defined(CPPSERVER_COROUTINES)
+    //! Start the connect awaiter
+    void StartConnectAwaiter(ConnectAwaiter<TCPClient, TCPResolver>* awaiter);
+    //! Cancel the connect awaiter
+    void CancelConnectAwaiter(ConnectAwaiter<TCPClient, TCPResolver>* awaiter);
+    //! Start the receive awaiter
+    void StartReceiveAwaiter(ReceiveAwaiter<TCPClient>* awaiter);
+    //! Cancel the receive awaiter
+    void CancelReceiveAwaiter(ReceiveAwaiter<TCPClient>* awaiter);
+    //! Resume the receive awaiter with the received data
+    /*!
+        \param buffer - Received buffer
+        \param size - Received buffer size
+        \return 'true' if the received data was successfully processed, 'false' if the receive buffer limit is met
+    */
+    bool ResumeReceiveAwaiter(const void* buffer, size_t size);
+    //! Start the send awaiter
+    void StartSendAwaiter(SendAwaiter<TCPClient>* awaiter);
+    //! Cancel the send awaiter
+    /*!
+        \return Total number of bytes sent by the client
+    */
+    uint64_t CancelSendAwaiter(SendAwaiter<TCPClient>* awaiter);
+    //! Resume all pending awaiters on disconnect
+    void ResumeAwaiters();
+#endif
 };
 
 /*! \example tcp_chat_client.cpp TCP chat client example */
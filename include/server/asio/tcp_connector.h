@@ -0,0 +1,129 @@
+/*!
+    \file tcp_connector.h
+    \brief TCP parallel connector definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_TCP_CONNECTOR_H
+#define CPPSERVER_ASIO_TCP_CONNECTOR_H
+
+#include "fast_open.h"
+
+#include "time/timespan.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! TCP parallel connector
+/*!
+    TCP parallel connector implements "Happy Eyeballs" connection algorithm
+    (RFC 8305). Resolved endpoints are interleaved by their address family
+    starting from IPv6 and connection attempts are started one by one with
+    the given stagger delay. The next attempt is started immediately if the
+    previous one fails. The first established connection wins and all other
+    attempts are cancelled, so the connect latency is bounded by the fastest
+    reachable endpoint instead of the sum of all failed attempts.
+
+    Each connect operation should use its own connector instance.
+
+    Thread-safe.
+*/
+class TCPConnector : public std::enable_shared_from_this<TCPConnector>
+{
+public:
+    //! Connect handler
+    typedef std::function<void(std::error_code ec, const asio::ip::tcp::endpoint& endpoint)> Handler;
+
+    //! Initialize parallel connector with a given Asio IO service
+    /*!
+        \param io_service - Asio IO service
+        \param stagger - Delay between connection attempts
+        \param timeout - Timeout of each connection attempt (zero means no timeout)
+        \param fast_open - Enable TCP Fast Open connect for connection attempts (default is false)
+    */
+    TCPConnector(const std::shared_ptr<asio::io_service>& io_service, const CppCommon::Timespan& stagger, const CppCommon::Timespan& timeout, bool fast_open = false);
+    TCPConnector(const TCPConnector&) = delete;
+    TCPConnector(TCPConnector&&) = delete;
+    ~TCPConnector() = default;
+
+    TCPConnector& operator=(const TCPConnector&) = delete;
+    TCPConnector& operator=(TCPConnector&&) = delete;
+
+    //! Get the delay between connection attempts
+    const CppCommon::Timespan& stagger() const noexcept { return _stagger; }
+    //! Get the timeout of each connection attempt
+    const CppCommon::Timespan& timeout() const noexcept { return _timeout; }
+    //! Is TCP Fast Open connect enabled?
+    bool fast_open() const noexcept { return _fast_open; }
+
+    //! Connect the given socket to the fastest reachable endpoint (asynchronous)
+    /*!
+        The winning connection is moved into the given socket before the
+        handler is called. The given socket must not be used until then.
+        The handler is called with the error of the last failed attempt
+        if all attempts failed.
+
+        \param socket - Socket to connect
+        \param endpoints - Resolved endpoints
+        \param handler - Connect handler
+    */
+    void ConnectAsync(asio::ip::tcp::socket& socket, const asio::ip::tcp::resolver::results_type& endpoints, const Handler& handler);
+
+    //! Sort endpoints in the order of connection attempts
+    /*!
+        Endpoints are interleaved by their address family starting from IPv6.
+        The order of endpoints within the same address family is preserved.
+
+        \param endpoints - Resolved endpoints
+        \return Sorted endpoints
+    */
+    static std::vector<asio::ip::tcp::endpoint> SortEndpoints(const asio::ip::tcp::resolver::results_type& endpoints);
+
+private:
+    // Connection attempt
+    struct Attempt
+    {
+        asio::ip::tcp::socket socket;
+        asio::system_timer timer;
+        asio::ip::tcp::endpoint endpoint;
+        bool finished;
+
+        explicit Attempt(asio::io_service& io_service) : socket(io_service), timer(io_service), finished(false) {}
+    };
+
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Asio service strand for serialized handler execution
+    asio::io_service::strand _strand;
+    // Stagger timer
+    asio::system_timer _timer;
+    CppCommon::Timespan _stagger;
+    CppCommon::Timespan _timeout;
+    bool _fast_open;
+    // Connect operation
+    asio::ip::tcp::socket* _socket;
+    Handler _handler;
+    std::vector<asio::ip::tcp::endpoint> _endpoints;
+    std::vector<std::unique_ptr<Attempt>> _attempts;
+    size_t _pending;
+    std::error_code _error;
+    bool _completed;
+
+    //! Start the next connection attempt
+    void StartAttempt();
+    //! Finish the connection attempt with the given error
+    void FinishAttempt(Attempt& attempt, std::error_code ec);
+    //! Complete the connect operation
+    void Complete(std::error_code ec, const asio::ip::tcp::endpoint& endpoint);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_TCP_CONNECTOR_H
@@ -0,0 +1,66 @@
+/*!
+    \file tcp_proxy_client.h
+    \brief TCP proxy upstream client definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_TCP_PROXY_CLIENT_H
+#define CPPSERVER_ASIO_TCP_PROXY_CLIENT_H
+
+#include "tcp_client.h"
+
+namespace CppServer {
+namespace Asio {
+
+class TCPProxySession;
+
+//! TCP proxy upstream client
+/*!
+    TCP proxy upstream client is the connection from the proxy session
+    to the proxy server upstream. It never receives data by itself, all
+    data is forwarded by the owning proxy session. Disconnect of the
+    upstream client disconnects the proxy session.
+
+    The upstream client is bound to the IO service (strand) of its proxy
+    session, so the proxy session forwarding handlers and the upstream
+    client connect/disconnect handlers never touch the upstream socket
+    concurrently.
+
+    Thread-safe.
+*/
+class TCPProxyClient : public TCPClient
+{
+public:
+    //! Initialize the upstream client with a given proxy session, Asio service, upstream address and port number
+    /*!
+        \param session - Proxy session (the upstream client is bound to its IO service and strand)
+        \param service - Asio service
+        \param address - Upstream address
+        \param port - Upstream port number
+    */
+    TCPProxyClient(const std::shared_ptr<TCPProxySession>& session, const std::shared_ptr<Service>& service, const std::string& address, int port);
+    TCPProxyClient(const TCPProxyClient&) = delete;
+    TCPProxyClient(TCPProxyClient&&) = delete;
+    virtual ~TCPProxyClient() = default;
+
+    TCPProxyClient& operator=(const TCPProxyClient&) = delete;
+    TCPProxyClient& operator=(TCPProxyClient&&) = delete;
+
+    //! Get the proxy session
+    std::shared_ptr<TCPProxySession> session() const noexcept { return _session.lock(); }
+
+protected:
+    void onConnected() override;
+    void onDisconnected() override;
+
+private:
+    // Proxy session
+    std::weak_ptr<TCPProxySession> _session;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_TCP_PROXY_CLIENT_H
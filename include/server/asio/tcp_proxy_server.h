@@ -0,0 +1,128 @@
+/*!
+    \file tcp_proxy_server.h
+    \brief TCP proxy server definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_TCP_PROXY_SERVER_H
+#define CPPSERVER_ASIO_TCP_PROXY_SERVER_H
+
+#include "tcp_proxy_session.h"
+#include "tcp_server.h"
+
+namespace CppServer {
+namespace Asio {
+
+//! TCP proxy server
+/*!
+    TCP proxy server accepts client connections and forwards each of them
+    to the upstream address and port number using a separate upstream TCP
+    client. On Linux data is forwarded with splice() through a pipe without
+    copying it into the user space (zero-copy), on other platforms or with
+    the disabled zero-copy option data is copied through a user space buffer.
+
+    Thread-safe.
+*/
+class TCPProxyServer : public TCPServer
+{
+    friend class TCPProxySession;
+
+public:
+    //! Initialize TCP proxy server with a given Asio service, port number, upstream address and port number
+    /*!
+        \param service - Asio service
+        \param port - Port number
+        \param upstream_address - Upstream address
+        \param upstream_port - Upstream port number
+        \param protocol - Internet protocol type (default is IPv4)
+    */
+    TCPProxyServer(const std::shared_ptr<Service>& service, int port, const std::string& upstream_address, int upstream_port, InternetProtocol protocol = InternetProtocol::IPv4);
+    //! Initialize TCP proxy server with a given Asio service, server address, port number, upstream address and port number
+    /*!
+        \param service - Asio service
+        \param address - Server address
+        \param port - Port number
+        \param upstream_address - Upstream address
+        \param upstream_port - Upstream port number
+    */
+    TCPProxyServer(const std::shared_ptr<Service>& service, const std::string& address, int port, const std::string& upstream_address, int upstream_port);
+    TCPProxyServer(const TCPProxyServer&) = delete;
+    TCPProxyServer(TCPProxyServer&&) = delete;
+    virtual ~TCPProxyServer() = default;
+
+    TCPProxyServer& operator=(const TCPProxyServer&) = delete;
+    TCPProxyServer& operator=(TCPProxyServer&&) = delete;
+
+    //! Get the upstream address
+    const std::string& upstream_address() const noexcept { return _upstream_address; }
+    //! Get the upstream port number
+    int upstream_port() const noexcept { return _upstream_port; }
+
+    //! Get the number of bytes forwarded from clients to the upstream
+    uint64_t bytes_upstream() const noexcept { return _bytes_upstream; }
+    //! Get the number of bytes forwarded from the upstream to clients
+    uint64_t bytes_downstream() const noexcept { return _bytes_downstream; }
+
+    //! Get the option: zero-copy forwarding
+    bool option_zero_copy() const noexcept { return _option_zero_copy; }
+    //! Get the option: pipe size
+    size_t option_pipe_size() const noexcept { return _option_pipe_size; }
+
+    //! Setup option: zero-copy forwarding
+    /*!
+        This option will forward data with splice() through a pipe
+        without copying it into the user space. The option is ignored
+        if zero-copy forwarding is not supported by the platform.
+        Default is enabled.
+
+        \param enable - Enable/disable zero-copy forwarding
+    */
+    void SetupZeroCopy(bool enable) noexcept { _option_zero_copy = enable; }
+    //! Setup option: pipe size
+    /*!
+        This option will set the size of the pipe (or the user space buffer)
+        used to forward data in each direction. It limits the amount of data
+        in flight inside the proxy for each direction. Default is 64 KiB.
+
+        \param size - Pipe size in bytes
+    */
+    void SetupPipeSize(size_t size) noexcept { _option_pipe_size = size; }
+
+    //! Is zero-copy forwarding supported by the platform?
+    static bool IsZeroCopySupported() noexcept;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<TCPProxySession>(std::dynamic_pointer_cast<TCPProxyServer>(server)); }
+
+    //! Create a new upstream client for the given proxy session
+    /*!
+        Override this method to customize the upstream client
+        (e.g. to select the upstream from several ones). The upstream
+        client must be created with the given session, so it is bound
+        to the session IO service (strand).
+
+        \param session - Proxy session
+        \return Upstream client
+    */
+    virtual std::shared_ptr<TCPProxyClient> CreateUpstream(const std::shared_ptr<TCPProxySession>& session) { return std::make_shared<TCPProxyClient>(session, service(), _upstream_address, _upstream_port); }
+
+private:
+    // Upstream address & port number
+    std::string _upstream_address;
+    int _upstream_port;
+    // Proxy statistic
+    std::atomic<uint64_t> _bytes_upstream{0};
+    std::atomic<uint64_t> _bytes_downstream{0};
+    // Options
+    bool _option_zero_copy{true};
+    size_t _option_pipe_size{65536};
+};
+
+/*! \example tcp_proxy.cpp TCP proxy server example */
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_TCP_PROXY_SERVER_H
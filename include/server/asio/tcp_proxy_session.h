@@ -0,0 +1,159 @@
+/*!
+    \file tcp_proxy_session.h
+    \brief TCP proxy session definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_TCP_PROXY_SESSION_H
+#define CPPSERVER_ASIO_TCP_PROXY_SESSION_H
+
+#include "tcp_proxy_client.h"
+#include "tcp_session.h"
+
+#include <atomic>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+class TCPProxyServer;
+
+//! TCP proxy session
+/*!
+    TCP proxy session pairs the accepted client connection with the upstream
+    TCP client connected to the proxy server upstream. Data is forwarded in
+    both directions outside of the usual session receive/send buffers:
+
+    - with zero-copy enabled (Linux only) data is moved by splice() from one
+      socket into a pipe and from the pipe into another socket, so it never
+      leaves the kernel (SIGPIPE raised by splice() for the closed peer is
+      suppressed, so it is handled as the usual disconnect);
+    - otherwise data is copied through a small user space buffer.
+
+    Each direction holds no more than one pipe (buffer) of data. Reading
+    from the source socket stops until the destination socket consumes it,
+    so a slow side throttles the fast one with the usual TCP flow control.
+    End of stream from one side is forwarded as a half-close (shutdown of
+    the sending direction) to another side. The session is disconnected
+    when both directions are finished or any of them failed.
+
+    The upstream client shares the IO service (strand) of the session, so
+    all forwarding handlers and the upstream connect/disconnect handlers
+    (including the upstream socket close) are executed on the same session
+    executor.
+
+    onReceived() and onSent() handlers are not called for the proxy session.
+    Override onConnected() and onDisconnected() handlers only with a call to
+    the base class implementation.
+
+    Thread-safe.
+*/
+class TCPProxySession : public TCPSession
+{
+    friend class TCPProxyClient;
+
+public:
+    //! Initialize the session with a given proxy server
+    /*!
+        \param server - Connected proxy server
+    */
+    explicit TCPProxySession(const std::shared_ptr<TCPProxyServer>& server);
+    TCPProxySession(const TCPProxySession&) = delete;
+    TCPProxySession(TCPProxySession&&) = delete;
+    virtual ~TCPProxySession();
+
+    TCPProxySession& operator=(const TCPProxySession&) = delete;
+    TCPProxySession& operator=(TCPProxySession&&) = delete;
+
+    //! Get the upstream client
+    std::shared_ptr<TCPProxyClient>& upstream() noexcept { return _upstream; }
+
+    //! Get the number of bytes forwarded from the client to the upstream
+    uint64_t bytes_upstream() const noexcept { return _pumps[0].bytes; }
+    //! Get the number of bytes forwarded from the upstream to the client
+    uint64_t bytes_downstream() const noexcept { return _pumps[1].bytes; }
+
+    //! Is the session forwarding data?
+    bool IsForwarding() const noexcept { return _forwarding; }
+    //! Is the session using zero-copy forwarding?
+    bool IsZeroCopy() const noexcept { return _zero_copy; }
+
+protected:
+    void onConnected() override;
+    void onDisconnected() override;
+
+private:
+    // Proxy server
+    std::weak_ptr<TCPProxyServer> _proxy_server;
+    // Upstream client
+    std::shared_ptr<TCPProxyClient> _upstream;
+    std::atomic<bool> _forwarding;
+    bool _zero_copy;
+    size_t _chunk_size;
+
+    // Single direction of the data forwarding
+    struct Pump
+    {
+        asio::ip::tcp::socket* source{nullptr};
+        asio::ip::tcp::socket* destination{nullptr};
+        int pipe[2]{-1, -1};
+        std::vector<uint8_t> buffer;
+        size_t capacity{0};
+        size_t offset{0};
+        size_t pending{0};
+        bool eof{false};
+        bool finished{false};
+        std::atomic<uint64_t> bytes{0};
+    };
+    Pump _pumps[2];
+
+    //! Start forwarding data between the session and the connected upstream
+    void StartForwarding();
+    //! Prepare the given pump to forward data
+    /*!
+        \param pump - Pump to prepare
+        \param ec - Error code
+        \return 'true' if the pump was successfully prepared, 'false' on error
+    */
+    bool Prepare(Pump& pump, std::error_code& ec);
+    //! Forward data in the given direction until any socket would block
+    /*!
+        \param index - Pump index (0 - upstream, 1 - downstream)
+    */
+    void Forward(size_t index);
+    //! Wait for the given socket readiness and forward data again
+    /*!
+        \param index - Pump index (0 - upstream, 1 - downstream)
+        \param socket - Socket to wait
+        \param type - Wait type
+    */
+    void Wait(size_t index, asio::ip::tcp::socket& socket, asio::socket_base::wait_type type);
+    //! Post the forward handler to continue later
+    /*!
+        \param index - Pump index (0 - upstream, 1 - downstream)
+    */
+    void Continue(size_t index);
+    //! Receive data from the source socket into the pump
+    /*!
+        \param pump - Pump to fill
+        \param ec - Error code
+        \return Count of received bytes (0 if the operation would block or on error)
+    */
+    size_t Fill(Pump& pump, std::error_code& ec);
+    //! Send data from the pump into the destination socket
+    /*!
+        \param pump - Pump to flush
+        \param ec - Error code
+        \return Count of sent bytes (0 if the operation would block or on error)
+    */
+    size_t Flush(Pump& pump, std::error_code& ec);
+    //! Close pipes of all pumps
+    void ClosePipes();
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_TCP_PROXY_SESSION_H
@@ -9,7 +9,13 @@
 #ifndef CPPSERVER_ASIO_TCP_SERVER_H
 #define CPPSERVER_ASIO_TCP_SERVER_H
 
+#include "fast_open.h"
+#include "journal.h"
+#include "multicast.h"
+#include "rate_limiter.h"
 #include "tcp_session.h"
+#include "statistics.h"
+#include "subscription.h"
 
 #include "system/uuid.h"
 
@@ -83,9 +89,30 @@ public:
     //! Get the number of bytes pending sent by the server
     uint64_t bytes_pending() const noexcept { return _bytes_pending; }
     //! Get the number of bytes sent by the server
-    uint64_t bytes_sent() const noexcept { return _bytes_sent; }
+    uint64_t bytes_sent() const noexcept { return _statistics.bytes_sent(); }
     //! Get the number of bytes received by the server
-    uint64_t bytes_received() const noexcept { return _bytes_received; }
+    uint64_t bytes_received() const noexcept { return _statistics.bytes_received(); }
+    //! Get the number of sessions connected with TCP Fast Open
+    uint64_t fast_open_sessions() const noexcept { return _fast_open_sessions; }
+    //! Get the number of sessions disconnected by the overload control
+    uint64_t shed_connections() const noexcept { return _shed_connections; }
+    //! Get the number of requests rejected by the overload control
+    uint64_t shed_requests() const noexcept { return _shed_requests; }
+    //! Get the number of sessions joined the given subscription group
+    size_t group_size(std::string_view group) const { return _groups.size(group); }
+    //! Get the multicast journal (nullptr if the journal is disabled)
+    const std::shared_ptr<MulticastJournal>& journal() const noexcept { return _journal; }
+    //! Get the sequence number of the next multicast message (zero if the journal is disabled)
+    uint64_t journal_sequence() const { return _journal ? _journal->next_sequence() : 0; }
+
+    //! Get the server statistics snapshot
+    /*!
+        Server-wide counters are aggregated from per-thread shards, so the
+        snapshot is cheap for the working threads and could be taken at any time.
+
+        \return Server statistics snapshot
+    */
+    ServerStatisticsSnapshot statistics();
 
     //! Get the option: keep alive
     bool option_keep_alive() const noexcept { return _option_keep_alive; }
@@ -95,9 +122,33 @@ public:
     bool option_reuse_address() const noexcept { return _option_reuse_address; }
     //! Get the option: reuse port
     bool option_reuse_port() const noexcept { return _option_reuse_port; }
+    //! Get the option: TCP Fast Open queue length
+    size_t option_fast_open() const noexcept { return _option_fast_open; }
+    //! Get the option: idle timeout
+    const CppCommon::Timespan& option_idle_timeout() const noexcept { return _option_idle_timeout; }
+    //! Get the option: read timeout
+    const CppCommon::Timespan& option_read_timeout() const noexcept { return _option_read_timeout; }
+    //! Get the option: write timeout
+    const CppCommon::Timespan& option_write_timeout() const noexcept { return _option_write_timeout; }
+    //! Get the option: overload loop lag
+    const CppCommon::Timespan& option_overload_loop_lag() const noexcept { return _option_overload_loop_lag; }
+    //! Get the option: overload pending bytes
+    size_t option_overload_pending_bytes() const noexcept { return _option_overload_pending_bytes; }
+    //! Get the option: overload shed sessions
+    size_t option_overload_shed_sessions() const noexcept { return _option_overload_shed_sessions; }
+    //! Get the option: fair scheduling quantum
+    size_t option_fair_quantum() const noexcept { return _option_fair_quantum; }
+    //! Get the option: multicast journal replay chunk
+    size_t option_replay_chunk() const noexcept { return _option_replay_chunk; }
+    //! Get the option: receive rate limiter
+    const RateLimiter& option_receive_rate_limit() const noexcept { return _receive_limiter; }
+    //! Get the option: send rate limiter
+    const RateLimiter& option_send_rate_limit() const noexcept { return _send_limiter; }
 
     //! Is the server started?
     bool IsStarted() const noexcept { return _started; }
+    //! Is the server overloaded?
+    bool IsOverloaded() const noexcept { return _overloaded; }
 
     //! Start the server
     /*!
@@ -128,6 +179,61 @@ public:
         \return 'true' if the text was successfully multicast, 'false' if the server is not started
     */
     virtual bool Multicast(std::string_view text) { return Multicast(text.data(), text.size()); }
+    //! Multicast data to all connected sessions conflated by the given key
+    /*!
+        Slow sessions which have not yet flushed the previous data with the same
+        key get it replaced in place, so their memory stays bounded and they always
+        get the freshest data for each key.
+
+        \param key - Conflation key (e.g. topic or instrument)
+        \param buffer - Buffer to multicast
+        \param size - Buffer size
+        \return 'true' if the data was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool MulticastConflated(std::string_view key, const void* buffer, size_t size);
+    //! Multicast text to all connected sessions conflated by the given key
+    /*!
+        \param key - Conflation key (e.g. topic or instrument)
+        \param text - Text to multicast
+        \return 'true' if the text was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool MulticastConflated(std::string_view key, std::string_view text) { return MulticastConflated(key, text.data(), text.size()); }
+
+    //! Join the given session to the given subscription group
+    /*!
+        Sessions leave all subscription groups automatically when disconnected.
+
+        \param group - Group name (e.g. topic)
+        \param session - Session to join
+        \return 'true' if the session successfully joined the group, 'false' if the session is already a member of the group or is not connected
+    */
+    virtual bool JoinGroup(std::string_view group, const std::shared_ptr<TCPSession>& session) { return _groups.Join(group, session); }
+    //! Leave the given subscription group by the given session
+    /*!
+        \param group - Group name (e.g. topic)
+        \param session - Session to leave
+        \return 'true' if the session successfully left the group, 'false' if the session is not a member of the group
+    */
+    virtual bool LeaveGroup(std::string_view group, const std::shared_ptr<TCPSession>& session) { return _groups.Leave(group, session); }
+
+    //! Publish data to all sessions joined the given subscription group
+    /*!
+        Unlike multicast only group members are touched. Data is copied once
+        and posted once per working thread which owns any group members.
+
+        \param group - Group name (e.g. topic)
+        \param buffer - Buffer to publish
+        \param size - Buffer size
+        \return 'true' if the data was successfully published, 'false' if the server is not started
+    */
+    virtual bool PublishToGroup(std::string_view group, const void* buffer, size_t size);
+    //! Publish text to all sessions joined the given subscription group
+    /*!
+        \param group - Group name (e.g. topic)
+        \param text - Text to publish
+        \return 'true' if the text was successfully published, 'false' if the server is not started
+    */
+    virtual bool PublishToGroup(std::string_view group, std::string_view text) { return PublishToGroup(group, text.data(), text.size()); }
 
     //! Disconnect all connected sessions
     /*!
@@ -142,6 +248,13 @@ public:
     */
     std::shared_ptr<TCPSession> FindSession(const CppCommon::UUID& id);
 
+    //! Account the request rejected by the overload control
+    /*!
+        Protocol sessions call this method when they reject a new request
+        because the server is overloaded.
+    */
+    void AddShedRequest() noexcept { ++_shed_requests; }
+
     //! Setup option: keep alive
     /*!
         This option will setup SO_KEEPALIVE if the OS support this feature.
@@ -172,6 +285,133 @@ public:
         \param enable - Enable/disable option
     */
     void SetupReusePort(bool enable) noexcept { _option_reuse_port = enable; }
+    //! Setup option: TCP Fast Open
+    /*!
+        This option will enable TCP_FASTOPEN on the server acceptor if the OS
+        support this feature, so clients with the cached TCP Fast Open cookie
+        could send their first data with the SYN packet. Default is zero (disabled).
+
+        \param queue - Maximal number of pending TCP Fast Open requests (zero means disabled)
+    */
+    void SetupFastOpen(size_t queue) noexcept { _option_fast_open = queue; }
+    //! Setup option: idle timeout
+    /*!
+        The session will be disconnected if it does not receive or send any
+        data during the given timeout. Session timeouts are tracked with the
+        timing wheel of the session Asio IO service, so the timeout accuracy
+        is limited by the timing wheel resolution. Default is zero (disabled).
+
+        \param timeout - Idle timeout
+    */
+    void SetupIdleTimeout(const CppCommon::Timespan& timeout) noexcept { _option_idle_timeout = timeout; }
+    //! Setup option: read timeout
+    /*!
+        The session will be disconnected if it does not receive any data
+        during the given timeout. Default is zero (disabled).
+
+        \param timeout - Read timeout
+    */
+    void SetupReadTimeout(const CppCommon::Timespan& timeout) noexcept { _option_read_timeout = timeout; }
+    //! Setup option: write timeout
+    /*!
+        The session will be disconnected if its pending send operation does
+        not make any progress during the given timeout. Default is zero (disabled).
+
+        \param timeout - Write timeout
+    */
+    void SetupWriteTimeout(const CppCommon::Timespan& timeout) noexcept { _option_write_timeout = timeout; }
+    //! Setup option: overload loop lag
+    /*!
+        The server becomes overloaded when the event loop lag of the Asio service
+        meets the given threshold and leaves the overload state when the event loop
+        lag drops below a half of the threshold. Event loop lag is measured only if
+        the Asio service statistics instrumentation is enabled. Overload state is
+        checked every 100 milliseconds if any overload threshold is set before the
+        server start. Default is zero (disabled).
+
+        Overloaded server pauses accepting new connections and HTTP sessions reject
+        new requests with 503 Service Unavailable response.
+
+        \param threshold - Event loop lag threshold
+    */
+    void SetupOverloadLoopLag(const CppCommon::Timespan& threshold) noexcept { _option_overload_loop_lag = threshold; }
+    //! Setup option: overload pending bytes
+    /*!
+        The server becomes overloaded when the total number of bytes pending
+        sent by all sessions meets the given threshold and leaves the overload
+        state when it drops below a half of the threshold. Default is zero (disabled).
+
+        \param threshold - Pending bytes threshold
+    */
+    void SetupOverloadPendingBytes(size_t threshold) noexcept { _option_overload_pending_bytes = threshold; }
+    //! Setup option: overload shed sessions
+    /*!
+        The overloaded server will disconnect the given number of sessions with
+        the lowest priority on each overload check. Sessions with equal priority
+        are ordered by their pending bytes, so the most lagging sessions are shed
+        first. Default is zero (disabled).
+
+        \param count - Count of sessions to shed per overload check
+    */
+    void SetupOverloadShedSessions(size_t count) noexcept { _option_overload_shed_sessions = count; }
+    //! Setup option: fair scheduling quantum
+    /*!
+        When the fair scheduling is enabled received data of all sessions bound
+        to the same Asio IO service is delivered to onReceived() handlers with
+        deficit round-robin algorithm. Each round a session may process up to its
+        quantum of received bytes, so a session with a firehose of incoming data
+        cannot starve its neighbours. The session does not receive new data until
+        all previously received data is processed. Sessions could override the
+        quantum and choose their scheduling class.
+
+        Fair scheduling is applied only for io-service-per-thread design and is
+        ignored when strands are required. Default is zero (disabled).
+
+        \param quantum - Default quantum of received bytes per round (zero means disabled)
+    */
+    void SetupFairQuantum(size_t quantum) noexcept { _option_fair_quantum = quantum; }
+    //! Setup option: multicast journal
+    /*!
+        When the journal is enabled the last multicast messages are kept in
+        the bounded in-memory ring, so late-joining sessions could request
+        the replay of missed messages with TCPSession::ReplayAsync(). Each
+        multicast message gets the next sequence number of the journal.
+        Conflated multicast and subscription groups are not journaled.
+        Should be called before the server is started. Default is disabled.
+
+        \param messages - Limit of journal messages (zero means unlimited)
+        \param bytes - Limit of journal bytes (zero means unlimited, default is 0)
+    */
+    void SetupJournal(size_t messages, size_t bytes = 0) { _journal = ((messages > 0) || (bytes > 0)) ? std::make_shared<MulticastJournal>(messages, bytes) : nullptr; }
+    //! Setup option: multicast journal replay chunk
+    /*!
+        Replaying session appends the next chunk of journal messages only
+        when its pending bytes fall below the replay chunk, so the replay
+        of a long journal does not flood send buffers. Default is 65536.
+
+        \param chunk - Replay chunk size in bytes
+    */
+    void SetupReplayChunk(size_t chunk) noexcept { _option_replay_chunk = (chunk > 0) ? chunk : 1; }
+    //! Setup option: receive rate limit
+    /*!
+        Server-wide receive budget shared by all sessions. Sessions stop receiving
+        new data when either the session or the server receive budget is exhausted.
+        Default is unlimited.
+
+        \param bytes_per_second - Limit of received bytes per second (zero means unlimited)
+        \param messages_per_second - Limit of received messages per second (zero means unlimited, default is 0)
+    */
+    void SetupReceiveRateLimit(uint64_t bytes_per_second, uint64_t messages_per_second = 0) noexcept { _receive_limiter.Setup(bytes_per_second, messages_per_second); }
+    //! Setup option: send rate limit
+    /*!
+        Server-wide send budget shared by all sessions. Sessions delay sending
+        when either the session or the server send budget is exhausted.
+        Default is unlimited.
+
+        \param bytes_per_second - Limit of sent bytes per second (zero means unlimited)
+        \param messages_per_second - Limit of sent messages per second (zero means unlimited, default is 0)
+    */
+    void SetupSendRateLimit(uint64_t bytes_per_second, uint64_t messages_per_second = 0) noexcept { _send_limiter.Setup(bytes_per_second, messages_per_second); }
 
 protected:
     //! Create TCP session factory method
@@ -181,6 +421,22 @@ protected:
     */
     virtual std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) { return std::make_shared<TCPSession>(server); }
 
+    //! Append the given multicast data to the journal
+    /*!
+        \param data - Multicast data
+        \return Sequence number of the journal message (zero if the journal is disabled)
+    */
+    uint64_t Journal(const MulticastJournal::Message& data) { return _journal ? _journal->Append(data) : 0; }
+    //! Send the journaled multicast data to the given session (asynchronous)
+    /*!
+        \param session - Session to send
+        \param sequence - Sequence number of the journal message (zero if the journal is disabled)
+        \param data - Multicast data
+        \return 'true' if the data was successfully sent, 'false' if the session is not connected
+    */
+    static bool SendJournaled(const std::shared_ptr<TCPSession>& session, uint64_t sequence, const MulticastJournal::Message& data)
+    { return (sequence > 0) ? session->SendJournaled(sequence, data->data(), data->size()) : session->SendAsync(data->data(), data->size()); }
+
 protected:
     //! Handle server started notification
     virtual void onStarted() {}
@@ -198,6 +454,12 @@ protected:
     */
     virtual void onDisconnected(std::shared_ptr<TCPSession>& session) {}
 
+    //! Handle server overload state changed notification
+    /*!
+        \param overloaded - Overload state
+    */
+    virtual void onOverloaded(bool overloaded) {}
+
     //! Handle error notification
     /*!
         \param error - Error code
@@ -232,17 +494,44 @@ private:
     HandlerStorage _acceptor_storage;
     // Server statistic
     uint64_t _bytes_pending;
-    uint64_t _bytes_sent;
-    uint64_t _bytes_received;
+    ServerStatistics _statistics;
+    std::atomic<uint64_t> _fast_open_sessions;
+    // Server overload control
+    std::atomic<bool> _overloaded;
+    std::atomic<bool> _accept_paused;
+    std::atomic<uint64_t> _shed_connections;
+    std::atomic<uint64_t> _shed_requests;
+    Scheduler::Token _overload_token;
+    // Server subscription groups
+    SubscriptionGroups<TCPSession> _groups;
+    // Server multicast journal
+    std::shared_ptr<MulticastJournal> _journal;
+    // Server rate limits
+    RateLimiter _receive_limiter;
+    RateLimiter _send_limiter;
     // Options
     bool _option_keep_alive;
     bool _option_no_delay;
     bool _option_reuse_address;
     bool _option_reuse_port;
+    size_t _option_fast_open;
+    CppCommon::Timespan _option_idle_timeout;
+    CppCommon::Timespan _option_read_timeout;
+    CppCommon::Timespan _option_write_timeout;
+    CppCommon::Timespan _option_overload_loop_lag;
+    size_t _option_overload_pending_bytes;
+    size_t _option_overload_shed_sessions;
+    size_t _option_fair_quantum;
+    size_t _option_replay_chunk;
 
     //! Accept new connections
     void Accept();
 
+    //! Check the server overload state
+    void CheckOverload();
+    //! Disconnect sessions with the lowest priority
+    void ShedSessions();
+
     //! Register a new session
     void RegisterSession();
     //! Unregister the given session
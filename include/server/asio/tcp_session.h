@@ -9,10 +9,19 @@
 #ifndef CPPSERVER_ASIO_TCP_SESSION_H
 #define CPPSERVER_ASIO_TCP_SESSION_H
 
+#include "awaitable.h"
+#include "journal.h"
+#include "rate_limiter.h"
 #include "service.h"
 
 #include "system/uuid.h"
 
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace CppServer {
 namespace Asio {
 
@@ -27,8 +36,16 @@ class TCPServer;
 class TCPSession : public std::enable_shared_from_this<TCPSession>
 {
     friend class TCPServer;
+    friend class TCPProxySession;
+#if defined(CPPSERVER_COROUTINES)
+    friend class ReceiveAwaiter<TCPSession>;
+    friend class SendAwaiter<TCPSession>;
+#endif
 
 public:
+    //! Size of the normal priority data slice written to the socket at once
+    static constexpr size_t SEND_SLICE = 64 * 1024;
+
     //! Initialize the session with a given server
     /*!
         \param server - Connected server
@@ -36,7 +53,7 @@ public:
     explicit TCPSession(const std::shared_ptr<TCPServer>& server);
     TCPSession(const TCPSession&) = delete;
     TCPSession(TCPSession&&) = delete;
-    virtual ~TCPSession() = default;
+    virtual ~TCPSession();
 
     TCPSession& operator=(const TCPSession&) = delete;
     TCPSession& operator=(TCPSession&&) = delete;
@@ -68,9 +85,21 @@ public:
     size_t option_send_buffer_limit() const noexcept { return _send_buffer_limit; }
     //! Get the option: send buffer size
     size_t option_send_buffer_size() const;
+    //! Get the option: priority
+    int option_priority() const noexcept { return _priority; }
+    //! Get the option: receive rate limiter
+    const RateLimiter& option_receive_rate_limit() const noexcept { return _receive_limiter; }
+    //! Get the option: send rate limiter
+    const RateLimiter& option_send_rate_limit() const noexcept { return _send_limiter; }
+    //! Get the option: fair scheduling quantum
+    size_t option_fair_quantum() const noexcept { return _fair_quantum; }
+    //! Get the option: scheduling class
+    SchedulingClass option_scheduling_class() const noexcept { return _scheduling_class; }
 
     //! Is the session connected?
     bool IsConnected() const noexcept { return _connected; }
+    //! Is the session replaying the multicast journal?
+    bool IsReplaying() const noexcept { return _replaying; }
 
     //! Disconnect the session
     /*!
@@ -78,6 +107,34 @@ public:
     */
     virtual bool Disconnect() { return Disconnect(false); }
 
+    //! Join the session to the given subscription group of the server
+    /*!
+        \param group - Group name (e.g. topic)
+        \return 'true' if the session successfully joined the group, 'false' if the session is already a member of the group or is not connected
+    */
+    bool JoinGroup(std::string_view group);
+    //! Leave the given subscription group of the server
+    /*!
+        \param group - Group name (e.g. topic)
+        \return 'true' if the session successfully left the group, 'false' if the session is not a member of the group
+    */
+    bool LeaveGroup(std::string_view group);
+
+    //! Replay the multicast journal of the server starting from the given sequence number (asynchronous)
+    /*!
+        Journal messages are streamed with backpressure: the next chunk of
+        messages is appended only when the session pending bytes fall below
+        the server replay chunk size. Live multicast messages are skipped while
+        replaying and delivered from the journal instead, so the session gets
+        all messages in the journal order without gaps and duplicates. When the
+        replay catches up with the journal onReplayed() handler is called and
+        live multicast messages are delivered as usual.
+
+        \param sequence - Sequence number of the first message to replay (sequence numbers start from one)
+        \return 'true' if the replay was successfully started, 'false' if the server journal is disabled, the session is not connected or is already replaying
+    */
+    bool ReplayAsync(uint64_t sequence);
+
     //! Send data to the client (synchronous)
     /*!
         \param buffer - Buffer to send
@@ -114,13 +171,58 @@ public:
         \param size - Buffer size
         \return 'true' if the data was successfully sent, 'false' if the session is not connected
     */
-    virtual bool SendAsync(const void* buffer, size_t size);
+    virtual bool SendAsync(const void* buffer, size_t size) { return SendAsync(buffer, size, SendPriority::Normal); }
     //! Send text to the client (asynchronous)
     /*!
         \param text - Text to send
         \return 'true' if the text was successfully sent, 'false' if the session is not connected
     */
     virtual bool SendAsync(std::string_view text) { return SendAsync(text.data(), text.size()); }
+    //! Send data to the client with the given priority (asynchronous)
+    /*!
+        High priority data is sent at the next write boundary ahead of all
+        pending normal priority data. Normal priority data is written to the
+        socket by slices of whole messages (SEND_SLICE bytes or one larger
+        message), so high priority data waits for one slice at most and
+        messages are never interleaved. Could be used for heartbeats and
+        control messages which should not wait behind bulk transfers.
+
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \param priority - Send priority lane
+        \return 'true' if the data was successfully sent, 'false' if the session is not connected
+    */
+    virtual bool SendAsync(const void* buffer, size_t size, SendPriority priority);
+    //! Send text to the client with the given priority (asynchronous)
+    /*!
+        \param text - Text to send
+        \param priority - Send priority lane
+        \return 'true' if the text was successfully sent, 'false' if the session is not connected
+    */
+    virtual bool SendAsync(std::string_view text, SendPriority priority) { return SendAsync(text.data(), text.size(), priority); }
+    //! Send data to the client conflated by the given key (asynchronous)
+    /*!
+        If the previous data with the same key is not yet flushed to the socket,
+        it is replaced in place with the given data instead of appending. So the
+        memory used by a slow client stays bounded by the number of keys and the
+        client always gets the freshest data for each key. Conflated data is sent
+        after pending high priority data and after each slice of normal priority
+        data, so it is not starved by normal priority traffic. Keys are sent in
+        order of the first update of each key.
+
+        \param key - Conflation key (e.g. topic or instrument)
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \return 'true' if the data was successfully sent, 'false' if the session is not connected
+    */
+    virtual bool SendConflatedAsync(std::string_view key, const void* buffer, size_t size);
+    //! Send text to the client conflated by the given key (asynchronous)
+    /*!
+        \param key - Conflation key (e.g. topic or instrument)
+        \param text - Text to send
+        \return 'true' if the text was successfully sent, 'false' if the session is not connected
+    */
+    virtual bool SendConflatedAsync(std::string_view key, std::string_view text) { return SendConflatedAsync(key, text.data(), text.size()); }
 
     //! Receive data from the client (synchronous)
     /*!
@@ -155,6 +257,74 @@ public:
     //! Receive data from the client (asynchronous)
     virtual void ReceiveAsync();
 
+    //! Is receiving of data paused?
+    bool IsReceivePaused() const noexcept { return _receive_paused; }
+    //! Pause receiving of data
+    /*!
+        The receive loop is stopped after the pending receive operation is
+        completed, so the client is pushed back by TCP flow control. Could be
+        used to apply backpressure when received data is forwarded to a slow
+        consumer.
+    */
+    void PauseReceive() noexcept { _receive_paused = true; }
+    //! Resume receiving of data paused with PauseReceive()
+    void ResumeReceive();
+
+#if defined(CPPSERVER_COROUTINES)
+    //! Send data to the client with timeout (C++20 coroutine)
+    /*!
+        Awaitable is resumed on the session executor when the whole buffer is
+        sent, the timeout is expired or the session is disconnected.
+
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \param timeout - Timeout (zero means wait without timeout)
+        \return Awaitable size of sent data
+    */
+    [[nodiscard]] SendAwaiter<TCPSession> SendAsync(const void* buffer, size_t size, const CppCommon::Timespan& timeout);
+    //! Send text to the client with timeout (C++20 coroutine)
+    /*!
+        \param text - Text to send
+        \param timeout - Timeout (zero means wait without timeout)
+        \return Awaitable size of sent text
+    */
+    [[nodiscard]] SendAwaiter<TCPSession> SendAsync(std::string_view text, const CppCommon::Timespan& timeout) { return SendAsync(text.data(), text.size(), timeout); }
+
+    //! Receive data from the client with timeout (C++20 coroutine)
+    /*!
+        Awaitable is resumed on the session executor with the next part of
+        received data. The first call starts the awaiting mode: from now on all
+        received data that is not consumed by the pending awaiter (including data
+        received between awaits, e.g. while the coroutine awaits SendAsync()) is
+        cached for the next await until StopReceiveAwaiting() is called.
+        The cache is bounded by the receive buffer limit (or 1 MiB if it is not
+        set), the session is disconnected if the limit is exceeded. The session
+        onReceived() handler is still called for all received data.
+
+        \param buffer - Buffer to receive
+        \param size - Buffer size to receive
+        \param timeout - Timeout (zero means wait without timeout)
+        \return Awaitable size of received data (zero on timeout or disconnect)
+    */
+    [[nodiscard]] ReceiveAwaiter<TCPSession> ReceiveAsync(void* buffer, size_t size, const CppCommon::Timespan& timeout);
+
+    //! Is the session in the receive awaiting mode?
+    bool IsReceiveAwaiting() const noexcept { return _receive_awaiting; }
+    //! Start the receive awaiting mode
+    /*!
+        Start caching received data for coroutine receive awaiters before the
+        first ReceiveAsync() call, e.g. in onConnected() handler, so the data
+        received before the first await is not missed.
+    */
+    void StartReceiveAwaiting() noexcept { _receive_awaiting = true; }
+    //! Stop the receive awaiting mode
+    /*!
+        Cached data is dropped. The pending receive awaiter is still resumed
+        with the next received data, but the rest of it is not cached.
+    */
+    void StopReceiveAwaiting();
+#endif
+
     //! Setup option: receive buffer limit
     /*!
         The session will be disconnected if the receive buffer limit is met.
@@ -185,6 +355,57 @@ public:
         \param size - Send buffer size
     */
     void SetupSendBufferSize(size_t size);
+    //! Setup option: priority
+    /*!
+        Sessions with the lowest priority are disconnected first when
+        the overloaded server sheds its sessions. Default is zero.
+
+        \param priority - Session priority
+    */
+    void SetupPriority(int priority) noexcept { _priority = priority; }
+    //! Setup option: receive rate limit
+    /*!
+        When the receive budget is exhausted the session stops receiving new
+        data until the budget is refilled, so TCP flow control pushes back on
+        the client. Each receive operation reads no more than the available
+        budget and waits until the budget allows to fill the receive buffer
+        (or the whole burst). Each completed receive operation is counted as
+        a message.
+        Only asynchronous receive is limited. Default is unlimited.
+
+        \param bytes_per_second - Limit of received bytes per second (zero means unlimited)
+        \param messages_per_second - Limit of received messages per second (zero means unlimited, default is 0)
+    */
+    void SetupReceiveRateLimit(uint64_t bytes_per_second, uint64_t messages_per_second = 0) noexcept { _receive_limiter.Setup(bytes_per_second, messages_per_second); }
+    //! Setup option: send rate limit
+    /*!
+        When the send budget is exhausted the session delays sending of pending
+        data until the budget is refilled. Each asynchronous send call is counted
+        as a message. Only asynchronous send is limited. Default is unlimited.
+
+        \param bytes_per_second - Limit of sent bytes per second (zero means unlimited)
+        \param messages_per_second - Limit of sent messages per second (zero means unlimited, default is 0)
+    */
+    void SetupSendRateLimit(uint64_t bytes_per_second, uint64_t messages_per_second = 0) noexcept { _send_limiter.Setup(bytes_per_second, messages_per_second); }
+    //! Setup option: fair scheduling quantum
+    /*!
+        Overrides the server fair scheduling quantum for the session. Sessions
+        with a bigger quantum process more received bytes per round. Option is
+        used only if the server fair scheduling is enabled. Default is zero
+        (the server quantum is used).
+
+        \param quantum - Quantum of received bytes per round (zero means the server quantum)
+    */
+    void SetupFairQuantum(size_t quantum) noexcept { _fair_quantum = quantum; }
+    //! Setup option: scheduling class
+    /*!
+        Received data of control sessions is processed before received data
+        of bulk sessions in every fair scheduling round. Option is used only if
+        the server fair scheduling is enabled. Default is bulk.
+
+        \param scheduling_class - Scheduling class
+    */
+    void SetupSchedulingClass(SchedulingClass scheduling_class) noexcept { _scheduling_class = scheduling_class; }
 
 protected:
     //! Handle session connected notification
@@ -223,6 +444,25 @@ protected:
     */
     virtual void onEmpty() {}
 
+    //! Handle multicast journal replayed notification
+    /*!
+        Notification is called when the replay caught up with the multicast
+        journal. All following multicast messages are delivered live.
+
+        \param sequence - Sequence number of the next multicast message
+    */
+    virtual void onReplayed(uint64_t sequence) {}
+    //! Handle multicast journal replay lost notification
+    /*!
+        Notification is called when requested messages were already evicted
+        from the multicast journal and cannot be replayed (e.g. the session
+        should request a snapshot).
+
+        \param sequence - Sequence number of the first lost message
+        \param count - Count of lost messages
+    */
+    virtual void onReplayLost(uint64_t sequence, uint64_t count) {}
+
     //! Handle error notification
     /*!
         \param error - Error code
@@ -244,13 +484,17 @@ private:
     // Session socket
     asio::ip::tcp::socket _socket;
     std::atomic<bool> _connected;
+    std::atomic<int> _priority{0};
     // Session statistic
     uint64_t _bytes_pending;
     uint64_t _bytes_sending;
     uint64_t _bytes_sent;
+    uint64_t _bytes_sent_main{0};
     uint64_t _bytes_received;
     // Receive buffer
     bool _receiving;
+    bool _receive_detached{false};
+    std::atomic<bool> _receive_paused{false};
     size_t _receive_buffer_limit{0};
     std::vector<uint8_t> _receive_buffer;
     HandlerStorage _receive_storage;
@@ -259,9 +503,71 @@ private:
     std::mutex _send_lock;
     size_t _send_buffer_limit{0};
     std::vector<uint8_t> _send_buffer_main;
+    std::deque<size_t> _send_buffer_main_marks;
+    size_t _send_buffer_main_offset{0};
+    std::vector<uint8_t> _send_buffer_high;
+    std::map<std::string, size_t, std::less<>> _send_conflated_index;
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> _send_conflated;
+    size_t _send_conflated_size{0};
+    bool _send_conflated_turn{false};
     std::vector<uint8_t> _send_buffer_flush;
     size_t _send_buffer_flush_offset;
+    bool _send_buffer_flush_main{false};
     HandlerStorage _send_storage;
+    // Session rate limits
+    RateLimiter _receive_limiter;
+    RateLimiter _send_limiter;
+    bool _receive_throttled;
+    bool _send_throttled;
+    // Session fair scheduling
+    class ReceiveEntry : public FairQueue::Entry
+    {
+    public:
+        explicit ReceiveEntry(TCPSession& session) noexcept : _session(session) {}
+
+    protected:
+        size_t onDispatch(size_t budget, bool& pending) override { return _session.DispatchReceived(budget, pending); }
+
+    private:
+        TCPSession& _session;
+    };
+    std::shared_ptr<FairQueue> _fair_queue;
+    ReceiveEntry _fair_entry;
+    size_t _fair_quantum{0};
+    SchedulingClass _scheduling_class{SchedulingClass::Bulk};
+    size_t _receive_pending_offset;
+    size_t _receive_pending_size;
+    // Session multicast journal replay
+    std::mutex _replay_lock;
+    std::shared_ptr<MulticastJournal> _replay_journal;
+    std::atomic<bool> _replaying{false};
+    uint64_t _replay_sequence{0};
+    // Session timeouts
+    class TimeoutEntry : public TimingWheel::Entry
+    {
+    public:
+        explicit TimeoutEntry(TCPSession& session) noexcept : _session(session) {}
+
+    protected:
+        void onExpired() override { _session.ExpireTimeouts(); }
+
+    private:
+        TCPSession& _session;
+    };
+    std::shared_ptr<TimingWheel> _timeout_wheel;
+    TimeoutEntry _timeout_entry;
+    uint64_t _timeout_idle;
+    uint64_t _timeout_read;
+    uint64_t _timeout_write;
+    uint64_t _timeout_receive_tick;
+    uint64_t _timeout_send_tick;
+#if defined(CPPSERVER_COROUTINES)
+    // Coroutine awaiters
+    std::atomic<bool> _receive_awaiting{false};
+    std::vector<uint8_t> _receive_awaiter_cache;
+    ReceiveAwaiter<TCPSession>* _receive_awaiter{nullptr};
+    SendAwaiter<TCPSession>* _send_awaiter{nullptr};
+#endif
 
     //! Connect the session
     void Connect();
@@ -277,6 +583,70 @@ private:
     //! Try to send pending data
     void TrySend();
 
+    //! Process the given part of received data
+    /*!
+        \param buffer - Received buffer
+        \param size - Received buffer size
+        \return 'true' if the received data was successfully processed, 'false' if the session was disconnected
+    */
+    bool ProcessReceived(const void* buffer, size_t size);
+    //! Increase the receive buffer size if it was filled by the last receive operation
+    /*!
+        \param size - Size of the last received data
+        \return 'true' if the receive buffer is valid, 'false' if the receive buffer limit is exceeded and the session was disconnected
+    */
+    bool ExpandReceiveBuffer(size_t size);
+    //! Dispatch pending received data with the fair queue
+    /*!
+        \param budget - Budget of bytes to process
+        \param pending - Pending data flag to fill
+        \return Number of processed bytes
+    */
+    size_t DispatchReceived(size_t budget, bool& pending);
+
+    //! Send the multicast journal message to the client (asynchronous)
+    /*!
+        Message is skipped if it is going to be delivered or was already
+        delivered by the multicast journal replay.
+
+        \param sequence - Sequence number of the message
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \return 'true' if the message was successfully sent or skipped, 'false' if the session is not connected
+    */
+    bool SendJournaled(uint64_t sequence, const void* buffer, size_t size);
+    //! Try to replay the next chunk of the multicast journal
+    void TryReplay();
+
+    //! Get the receive or send throttling delay of the session and the server
+    /*!
+        \param receive - Receive or send flag
+        \param size - Count of bytes required (default is 0)
+        \return Throttling delay in nanoseconds
+    */
+    uint64_t ThrottleDelay(bool receive, size_t size = 0) const;
+    //! Get the receive size limited by the receive budget of the session and the server
+    /*!
+        \param size - Receive buffer size
+        \return Receive size
+    */
+    size_t ReceiveBudget(size_t size) const;
+    //! Throttle receive or send operations for the given delay
+    /*!
+        \param receive - Receive or send flag
+        \param delay - Throttling delay in nanoseconds
+    */
+    void Throttle(bool receive, uint64_t delay);
+
+    //! Start tracking session timeouts
+    void StartTimeouts();
+    //! Stop tracking session timeouts
+    void StopTimeouts();
+    //! Handle session timeouts expired notification from the timing wheel
+    void ExpireTimeouts();
+    //! Check session timeouts and disconnect the stale session
+    void CheckTimeouts();
+
     //! Clear send/receive buffers
     void ClearBuffers();
     //! Reset server
@@ -284,6 +654,29 @@ private:
 
     //! Send error notification
     void SendError(std::error_code ec);
+
+#if defined(CPPSERVER_COROUTINES)
+    //! Start the receive awaiter
+    void StartReceiveAwaiter(ReceiveAwaiter<TCPSession>* awaiter);
+    //! Cancel the receive awaiter
+    void CancelReceiveAwaiter(ReceiveAwaiter<TCPSession>* awaiter);
+    //! Resume the receive awaiter with the received data
+    /*!
+        \param buffer - Received buffer
+        \param size - Received buffer size
+        \return 'true' if the received data was successfully processed, 'false' if the receive buffer limit is met
+    */
+    bool ResumeReceiveAwaiter(const void* buffer, size_t size);
+    //! Start the send awaiter
+    void StartSendAwaiter(SendAwaiter<TCPSession>* awaiter);
+    //! Cancel the send awaiter
+    /*!
+        \return Total number of bytes sent by the session
+    */
+    uint64_t CancelSendAwaiter(SendAwaiter<TCPSession>* awaiter);
+    //! Resume all pending awaiters on disconnect
+    void ResumeAwaiters();
+#endif
 };
 
 } // namespace Asio
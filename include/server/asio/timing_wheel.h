@@ -0,0 +1,181 @@
+/*!
+    \file timing_wheel.h
+    \brief Asio hierarchical timing wheel definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_TIMING_WHEEL_H
+#define CPPSERVER_ASIO_TIMING_WHEEL_H
+
+#include "asio.h"
+
+#include "time/timespan.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace CppServer {
+namespace Asio {
+
+//! Asio hierarchical timing wheel
+/*!
+    Timing wheel is used to track a huge number of coarse timeouts (e.g.
+    session idle timeouts) with a single Asio timer per IO service.
+
+    Wheel time is measured in ticks of the given resolution. Entries are
+    intrusive and are stored in hashed slots of four wheel levels with
+    64 slots each, so arm, re-arm and cancel operations are O(1) and do
+    not perform any heap allocations. Expired entries of higher levels
+    are cascaded to lower levels when the lower level wheel wraps.
+
+    The wheel timer is running only while there are armed entries.
+
+    Thread-safe.
+*/
+class TimingWheel : public std::enable_shared_from_this<TimingWheel>
+{
+public:
+    //! Timing wheel entry
+    /*!
+        Intrusive timing wheel entry which should be embedded into the
+        object with a timeout. The entry must be canceled before it is
+        destroyed.
+
+        Not thread-safe.
+    */
+    class Entry
+    {
+        friend class TimingWheel;
+
+    public:
+        Entry() noexcept = default;
+        Entry(const Entry&) = delete;
+        Entry(Entry&&) = delete;
+        virtual ~Entry() = default;
+
+        Entry& operator=(const Entry&) = delete;
+        Entry& operator=(Entry&&) = delete;
+
+        //! Get the expiry tick of the entry
+        uint64_t expire() const noexcept { return _expire; }
+
+        //! Is the entry armed?
+        bool IsArmed() const noexcept { return _pprev != nullptr; }
+
+    protected:
+        //! Handle entry expired notification
+        /*!
+            Notification is called from the timing wheel thread under the wheel
+            lock, so the handler must be short and must not arm or cancel any
+            entries of the same wheel. Usually it posts a handler which performs
+            the actual timeout processing to the owner executor.
+
+            The wheel lock guarantees the entry owner is alive during the call,
+            because the entry is canceled under the same lock before it is
+            destroyed. The handler must not take the owner ownership (e.g. lock
+            its weak pointer), otherwise releasing the last reference would
+            destroy the owner and cancel the entry under the held wheel lock.
+        */
+        virtual void onExpired() = 0;
+
+    private:
+        Entry** _pprev{nullptr};
+        Entry* _next{nullptr};
+        uint64_t _expire{0};
+    };
+
+    //! Initialize timing wheel with a given Asio IO service and tick resolution
+    /*!
+        \param io_service - Asio IO service
+        \param resolution - Tick resolution (default is 100 milliseconds)
+    */
+    explicit TimingWheel(const std::shared_ptr<asio::io_service>& io_service, const CppCommon::Timespan& resolution = CppCommon::Timespan::milliseconds(100));
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel(TimingWheel&&) = delete;
+    ~TimingWheel() = default;
+
+    TimingWheel& operator=(const TimingWheel&) = delete;
+    TimingWheel& operator=(TimingWheel&&) = delete;
+
+    //! Get the tick resolution
+    const CppCommon::Timespan& resolution() const noexcept { return _resolution; }
+    //! Get the current tick
+    uint64_t tick() const noexcept { return _tick.load(std::memory_order_relaxed); }
+    //! Get the number of armed entries
+    size_t size() const noexcept { return _size.load(std::memory_order_relaxed); }
+
+    //! Convert the given timespan to the number of ticks (rounded up)
+    /*!
+        \param timespan - Timespan
+        \return Number of ticks
+    */
+    uint64_t ticks(const CppCommon::Timespan& timespan) const noexcept;
+
+    //! Arm or re-arm the given entry to expire after the given timeout
+    /*!
+        \param entry - Timing wheel entry
+        \param timeout - Timeout (rounded up to the tick resolution)
+    */
+    void Arm(Entry& entry, const CppCommon::Timespan& timeout);
+    //! Arm or re-arm the given entry to expire at the given tick
+    /*!
+        Entry with the expiry tick in the past will be expired on the next tick.
+
+        \param entry - Timing wheel entry
+        \param tick - Expiry tick
+    */
+    void ArmAt(Entry& entry, uint64_t tick);
+    //! Cancel the given entry
+    /*!
+        \param entry - Timing wheel entry
+        \return 'true' if the entry was successfully canceled, 'false' if the entry is not armed
+    */
+    bool Cancel(Entry& entry);
+
+    //! Advance the wheel for the given number of ticks and expire all due entries
+    /*!
+        The wheel is advanced automatically with its timer. This method could be
+        used to drive the wheel manually.
+
+        \param ticks - Number of ticks to advance
+    */
+    void Advance(uint64_t ticks);
+
+private:
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 6;
+    static const uint64_t SLOTS = 1ull << SLOT_BITS;
+    static const uint64_t SLOT_MASK = SLOTS - 1;
+    static const uint64_t MAX_TICKS = (1ull << (LEVELS * SLOT_BITS)) - 1;
+
+    std::mutex _lock;
+    // Wheel slots
+    Entry* _slots[LEVELS][SLOTS]{};
+    std::atomic<uint64_t> _tick;
+    std::atomic<size_t> _size;
+    // Wheel timer
+    asio::steady_timer _timer;
+    CppCommon::Timespan _resolution;
+    std::chrono::steady_clock::time_point _tick_time;
+    bool _ticking;
+
+    //! Insert the entry into the wheel slot
+    void Insert(Entry& entry);
+    //! Unlink the entry from the wheel slot
+    void Unlink(Entry& entry);
+    //! Perform a single wheel tick
+    void Tick();
+    //! Advance the wheel without lock
+    void AdvanceInternal(uint64_t ticks);
+    //! Schedule the next wheel timer tick
+    void ScheduleTick();
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_TIMING_WHEEL_H
@@ -9,6 +9,7 @@
 #ifndef CPPSERVER_ASIO_UDP_RESOLVER_H
 #define CPPSERVER_ASIO_UDP_RESOLVER_H
 
+#include "resolver_cache.h"
 #include "service.h"
 
 namespace CppServer {
@@ -43,10 +44,39 @@ public:
     asio::io_service::strand& strand() noexcept { return _strand; }
     //! Get the UDP resolver
     asio::ip::udp::resolver& resolver() noexcept { return _resolver; }
+    //! Get the DNS resolver cache
+    std::shared_ptr<ResolverCache<asio::ip::udp>>& cache() noexcept { return _cache; }
+
+    //! Get the option: DNS resolver cache
+    bool option_cache() const noexcept { return _option_cache; }
+
+    //! Resolve the given host and service (asynchronous)
+    /*!
+        Resolution is served from the DNS resolver cache if the cache is enabled.
+        The handler is called on the resolver working thread.
+
+        \param host - Host name
+        \param service - Service name or port number
+        \param handler - Resolve handler
+    */
+    virtual void ResolveAsync(const std::string& host, const std::string& service, const ResolverCache<asio::ip::udp>::Handler& handler);
 
     //! Cancel any asynchronous operations that are waiting on the resolver
     virtual void Cancel() { _resolver.cancel(); }
 
+    //! Setup option: DNS resolver cache
+    /*!
+        Cached entries are kept for the given time to live, failed resolutions
+        are cached for the given negative time to live. Concurrent lookups of
+        the same host are coalesced and the cached entry used after 3/4 of its
+        time to live is refreshed in background. Default is disabled.
+
+        \param enable - Enable/disable option
+        \param ttl - Time to live of resolved entries (default is 60 seconds)
+        \param negative_ttl - Time to live of failed entries (default is 1 second)
+    */
+    void SetupCache(bool enable, const CppCommon::Timespan& ttl = CppCommon::Timespan::seconds(60), const CppCommon::Timespan& negative_ttl = CppCommon::Timespan::seconds(1)) { _option_cache = enable; _cache->SetupTTL(ttl, negative_ttl); }
+
 private:
     // Asio service
     std::shared_ptr<Service> _service;
@@ -57,6 +87,10 @@ private:
     bool _strand_required;
     // UDP resolver
     asio::ip::udp::resolver _resolver;
+    // DNS resolver cache
+    std::shared_ptr<ResolverCache<asio::ip::udp>> _cache;
+    // Options
+    bool _option_cache;
 };
 
 } // namespace Asio
@@ -9,10 +9,13 @@
 #ifndef CPPSERVER_ASIO_UDP_SERVER_H
 #define CPPSERVER_ASIO_UDP_SERVER_H
 
+#include "rate_limiter.h"
 #include "service.h"
 
 #include "system/uuid.h"
 
+#include <map>
+
 namespace CppServer {
 namespace Asio {
 
@@ -81,6 +84,8 @@ public:
     uint64_t datagrams_sent() const noexcept { return _datagrams_sent; }
     //! Get the number datagrams received by the server
     uint64_t datagrams_received() const noexcept { return _datagrams_received; }
+    //! Get the number datagrams dropped by the server receive rate limit
+    uint64_t datagrams_dropped() const noexcept { return _datagrams_dropped; }
 
     //! Get the option: reuse address
     bool option_reuse_address() const noexcept { return _option_reuse_address; }
@@ -94,6 +99,10 @@ public:
     size_t option_send_buffer_limit() const noexcept { return _send_buffer_limit; }
     //! Get the option: send buffer size
     size_t option_send_buffer_size() const;
+    //! Get the option: receive rate limit of bytes per second for each endpoint
+    uint64_t option_receive_rate_limit_bytes() const noexcept { return _receive_rate_bytes; }
+    //! Get the option: receive rate limit of messages per second for each endpoint
+    uint64_t option_receive_rate_limit_messages() const noexcept { return _receive_rate_messages; }
 
     //! Is the server started?
     bool IsStarted() const noexcept { return _started; }
@@ -304,6 +313,18 @@ public:
         \param size - Send buffer size
     */
     void SetupSendBufferSize(size_t size);
+    //! Setup option: receive rate limit
+    /*!
+        Receive budget is tracked for each client endpoint separately. UDP has
+        no flow control, so datagrams which do not fit into the remaining budget
+        of the endpoint are dropped without calling onReceived() handler and
+        the server continues receiving. Each datagram is counted as a message.
+        This option will be applied on the next server start. Default is unlimited.
+
+        \param bytes_per_second - Limit of received bytes per second for each endpoint (zero means unlimited)
+        \param messages_per_second - Limit of received datagrams per second for each endpoint (zero means unlimited, default is 0)
+    */
+    void SetupReceiveRateLimit(uint64_t bytes_per_second, uint64_t messages_per_second = 0) noexcept { _receive_rate_bytes = bytes_per_second; _receive_rate_messages = messages_per_second; }
 
 protected:
     //! Handle server started notification
@@ -364,6 +385,7 @@ private:
     uint64_t _bytes_received;
     uint64_t _datagrams_sent;
     uint64_t _datagrams_received;
+    uint64_t _datagrams_dropped;
     // Multicast, receive and send endpoints
     asio::ip::udp::endpoint _multicast_endpoint;
     asio::ip::udp::endpoint _receive_endpoint;
@@ -378,6 +400,11 @@ private:
     size_t _send_buffer_limit{0};
     std::vector<uint8_t> _send_buffer;
     HandlerStorage _send_storage;
+    // Receive rate limits of client endpoints
+    uint64_t _receive_rate_bytes{0};
+    uint64_t _receive_rate_messages{0};
+    std::map<asio::ip::udp::endpoint, RateLimiter> _receive_limiters;
+    size_t _receive_limiters_sweep{1024};
     // Options
     bool _option_reuse_address;
     bool _option_reuse_port;
@@ -385,6 +412,14 @@ private:
     //! Try to receive new datagram
     void TryReceive();
 
+    //! Check and consume the receive rate limit of the given endpoint
+    /*!
+        \param endpoint - Endpoint of received datagram
+        \param size - Size of received datagram
+        \return 'true' if the datagram is allowed, 'false' if the endpoint receive budget is exhausted
+    */
+    bool CheckReceiveRateLimit(const asio::ip::udp::endpoint& endpoint, size_t size);
+
     //! Clear send/receive buffers
     void ClearBuffers();
 
@@ -0,0 +1,397 @@
+/*!
+    \file uds_datagram_client.h
+    \brief Unix domain datagram socket client definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_UDS_DATAGRAM_CLIENT_H
+#define CPPSERVER_ASIO_UDS_DATAGRAM_CLIENT_H
+
+#include "service.h"
+
+#include "system/uuid.h"
+#include "time/timespan.h"
+
+#include <mutex>
+#include <vector>
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace Asio {
+
+//! Unix domain datagram socket client
+/*!
+    Unix domain datagram socket client is used to read/write datagrams from/into the connected Unix domain datagram socket server.
+    The client socket is bound to its own local path, so the server is able to reply to it.
+
+    Thread-safe.
+*/
+class UDSDatagramClient : public std::enable_shared_from_this<UDSDatagramClient>
+{
+public:
+    //! Initialize Unix domain datagram socket client with a given Asio service, server socket path and client socket path
+    /*!
+        Empty client socket path means autobind to the unique abstract
+        socket address (Linux only).
+
+        \param service - Asio service
+        \param path - Server socket path
+        \param local_path - Client socket path (default is "")
+    */
+    UDSDatagramClient(const std::shared_ptr<Service>& service, const std::string& path, const std::string& local_path = "");
+    //! Initialize Unix domain datagram socket client with a given Asio service, server endpoint and client socket path
+    /*!
+        \param service - Asio service
+        \param endpoint - Server Unix domain datagram socket endpoint
+        \param local_path - Client socket path (default is "")
+    */
+    UDSDatagramClient(const std::shared_ptr<Service>& service, const asio::local::datagram_protocol::endpoint& endpoint, const std::string& local_path = "");
+    UDSDatagramClient(const UDSDatagramClient&) = delete;
+    UDSDatagramClient(UDSDatagramClient&&) = delete;
+    virtual ~UDSDatagramClient() = default;
+
+    UDSDatagramClient& operator=(const UDSDatagramClient&) = delete;
+    UDSDatagramClient& operator=(UDSDatagramClient&&) = delete;
+
+    //! Get the client Id
+    const CppCommon::UUID& id() const noexcept { return _id; }
+
+    //! Get the Asio service
+    std::shared_ptr<Service>& service() noexcept { return _service; }
+    //! Get the Asio IO service
+    std::shared_ptr<asio::io_service>& io_service() noexcept { return _io_service; }
+    //! Get the Asio service strand for serialized handler execution
+    asio::io_service::strand& strand() noexcept { return _strand; }
+    //! Get the client endpoint
+    asio::local::datagram_protocol::endpoint& endpoint() noexcept { return _endpoint; }
+    //! Get the client socket
+    asio::local::datagram_protocol::socket& socket() noexcept { return _socket; }
+
+    //! Get the server socket path
+    const std::string& path() const noexcept { return _path; }
+    //! Get the client socket path
+    const std::string& local_path() const noexcept { return _local_path; }
+
+    //! Get the number of bytes pending sent by the client
+    uint64_t bytes_pending() const noexcept { return _bytes_sending; }
+    //! Get the number of bytes sent by the client
+    uint64_t bytes_sent() const noexcept { return _bytes_sent; }
+    //! Get the number of bytes received by the client
+    uint64_t bytes_received() const noexcept { return _bytes_received; }
+    //! Get the number datagrams sent by the client
+    uint64_t datagrams_sent() const noexcept { return _datagrams_sent; }
+    //! Get the number datagrams received by the client
+    uint64_t datagrams_received() const noexcept { return _datagrams_received; }
+
+    //! Get the option: unlink socket path
+    bool option_unlink_path() const noexcept { return _option_unlink_path; }
+    //! Get the option: receive buffer limit
+    size_t option_receive_buffer_limit() const noexcept { return _receive_buffer_limit; }
+    //! Get the option: receive buffer size
+    size_t option_receive_buffer_size() const;
+    //! Get the option: send buffer limit
+    size_t option_send_buffer_limit() const noexcept { return _send_buffer_limit; }
+    //! Get the option: send buffer size
+    size_t option_send_buffer_size() const;
+
+    //! Is the client connected?
+    bool IsConnected() const noexcept { return _connected; }
+
+    //! Connect the client (synchronous)
+    /*!
+        \return 'true' if the client was successfully connected, 'false' if the client failed to connect
+    */
+    virtual bool Connect();
+    //! Disconnect the client (synchronous)
+    /*!
+        \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
+    */
+    virtual bool Disconnect() { return DisconnectInternal(); }
+    //! Reconnect the client (synchronous)
+    /*!
+        \return 'true' if the client was successfully reconnected, 'false' if the client is already reconnected
+    */
+    virtual bool Reconnect();
+
+    //! Connect the client (asynchronous)
+    /*!
+        \return 'true' if the client was successfully connected, 'false' if the client failed to connect
+    */
+    virtual bool ConnectAsync();
+    //! Disconnect the client (asynchronous)
+    /*!
+        \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
+    */
+    virtual bool DisconnectAsync() { return DisconnectInternalAsync(false); }
+    //! Reconnect the client (asynchronous)
+    /*!
+        \return 'true' if the client was successfully reconnected, 'false' if the client is already reconnected
+    */
+    virtual bool ReconnectAsync();
+
+    //! Send datagram to the connected server (synchronous)
+    /*!
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const void* buffer, size_t size);
+    //! Send text to the connected server (synchronous)
+    /*!
+        \param text - Text to send
+        \return Size of sent datagram
+    */
+    virtual size_t Send(std::string_view text) { return Send(text.data(), text.size()); }
+    //! Send datagram to the given endpoint (synchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size);
+    //! Send text to the given endpoint (synchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param text - Text to send
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const asio::local::datagram_protocol::endpoint& endpoint, std::string_view text) { return Send(endpoint, text.data(), text.size()); }
+
+    //! Send datagram to the connected server with timeout (synchronous)
+    /*!
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \param timeout - Timeout
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const void* buffer, size_t size, const CppCommon::Timespan& timeout);
+    //! Send text to the connected server with timeout (synchronous)
+    /*!
+        \param text - Text to send
+        \param timeout - Timeout
+        \return Size of sent datagram
+    */
+    virtual size_t Send(std::string_view text, const CppCommon::Timespan& timeout) { return Send(text.data(), text.size(), timeout); }
+    //! Send datagram to the given endpoint with timeout (synchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \param timeout - Timeout
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size, const CppCommon::Timespan& timeout);
+    //! Send text to the given endpoint with timeout (synchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param text - Text to send
+        \param timeout - Timeout
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const asio::local::datagram_protocol::endpoint& endpoint, std::string_view text, const CppCommon::Timespan& timeout) { return Send(endpoint, text.data(), text.size(), timeout); }
+
+    //! Send datagram to the connected server (asynchronous)
+    /*!
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \return 'true' if the datagram was successfully sent, 'false' if the datagram was not sent
+    */
+    virtual bool SendAsync(const void* buffer, size_t size);
+    //! Send text to the connected server (asynchronous)
+    /*!
+        \param text - Text to send
+        \return 'true' if the text was successfully sent, 'false' if the text was not sent
+    */
+    virtual bool SendAsync(std::string_view text) { return SendAsync(text.data(), text.size()); }
+    //! Send datagram to the given endpoint (asynchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \return 'true' if the datagram was successfully sent, 'false' if the datagram was not sent
+    */
+    virtual bool SendAsync(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size);
+    //! Send text to the given endpoint (asynchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param text - Text to send
+        \return 'true' if the text was successfully sent, 'false' if the text was not sent
+    */
+    virtual bool SendAsync(const asio::local::datagram_protocol::endpoint& endpoint, std::string_view text) { return SendAsync(endpoint, text.data(), text.size()); }
+
+    //! Receive datagram from the given endpoint (synchronous)
+    /*!
+        \param endpoint - Endpoint to receive from
+        \param buffer - Datagram buffer to receive
+        \param size - Datagram buffer size to receive
+        \return Size of received datagram
+    */
+    virtual size_t Receive(asio::local::datagram_protocol::endpoint& endpoint, void* buffer, size_t size);
+    //! Receive text from the given endpoint (synchronous)
+    /*!
+        \param endpoint - Endpoint to receive from
+        \param size - Text size to receive
+        \return Received text
+    */
+    virtual std::string Receive(asio::local::datagram_protocol::endpoint& endpoint, size_t size);
+
+    //! Receive datagram from the given endpoint with timeout (synchronous)
+    /*!
+        \param endpoint - Endpoint to receive from
+        \param buffer - Datagram buffer to receive
+        \param size - Datagram buffer size to receive
+        \param timeout - Timeout
+        \return Size of received datagram
+    */
+    virtual size_t Receive(asio::local::datagram_protocol::endpoint& endpoint, void* buffer, size_t size, const CppCommon::Timespan& timeout);
+    //! Receive text from the given endpoint with timeout (synchronous)
+    /*!
+        \param endpoint - Endpoint to receive from
+        \param size - Text size to receive
+        \param timeout - Timeout
+        \return Received text
+    */
+    virtual std::string Receive(asio::local::datagram_protocol::endpoint& endpoint, size_t size, const CppCommon::Timespan& timeout);
+
+    //! Receive datagram from the server (asynchronous)
+    virtual void ReceiveAsync();
+
+    //! Setup option: unlink socket path
+    /*!
+        This option will remove the stale client socket file before the client
+        is connected and remove the client socket file after the client is disconnected.
+
+        \param enable - Enable/disable option
+    */
+    void SetupUnlinkPath(bool enable) noexcept { _option_unlink_path = enable; }
+    //! Setup option: receive buffer limit
+    /*!
+        The client will be disconnected if the receive buffer limit is met.
+        Default is unlimited.
+
+        \param limit - Receive buffer limit
+    */
+    void SetupReceiveBufferLimit(size_t limit) noexcept { _receive_buffer_limit = limit; }
+    //! Setup option: receive buffer size
+    /*!
+        This option will setup SO_RCVBUF if the OS support this feature.
+
+        \param size - Receive buffer size
+    */
+    void SetupReceiveBufferSize(size_t size);
+    //! Setup option: send buffer limit
+    /*!
+        The client will be disconnected if the send buffer limit is met.
+        Default is unlimited.
+
+        \param limit - Send buffer limit
+    */
+    void SetupSendBufferLimit(size_t limit) noexcept { _send_buffer_limit = limit; }
+    //! Setup option: send buffer size
+    /*!
+        This option will setup SO_SNDBUF if the OS support this feature.
+
+        \param size - Send buffer size
+    */
+    void SetupSendBufferSize(size_t size);
+
+protected:
+    //! Handle client connected notification
+    virtual void onConnected() {}
+    //! Handle client disconnected notification
+    virtual void onDisconnected() {}
+
+    //! Handle datagram received notification
+    /*!
+        Notification is called when another datagram was received
+        from some endpoint.
+
+        \param endpoint - Received endpoint
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    virtual void onReceived(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size) {}
+    //! Handle datagram sent notification
+    /*!
+        Notification is called when a datagram was sent to the server.
+
+        This handler could be used to send another datagram to the server
+        for instance when the pending size is zero.
+
+        \param endpoint - Endpoint of sent datagram
+        \param sent - Size of sent datagram buffer
+    */
+    virtual void onSent(const asio::local::datagram_protocol::endpoint& endpoint, size_t sent) {}
+
+    //! Handle error notification
+    /*!
+        \param error - Error code
+        \param category - Error category
+        \param message - Error message
+    */
+    virtual void onError(int error, const std::string& category, const std::string& message) {}
+
+private:
+    // Client Id
+    CppCommon::UUID _id;
+    // Asio service
+    std::shared_ptr<Service> _service;
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Asio service strand for serialized handler execution
+    asio::io_service::strand _strand;
+    bool _strand_required;
+    // Server & client socket paths
+    std::string _path;
+    std::string _local_path;
+    // Server endpoint & client socket
+    asio::local::datagram_protocol::endpoint _endpoint;
+    asio::local::datagram_protocol::socket _socket;
+    std::atomic<bool> _connected;
+    // Client statistic
+    uint64_t _bytes_sending;
+    uint64_t _bytes_sent;
+    uint64_t _bytes_received;
+    uint64_t _datagrams_sent;
+    uint64_t _datagrams_received;
+    // Receive and send endpoints
+    asio::local::datagram_protocol::endpoint _receive_endpoint;
+    asio::local::datagram_protocol::endpoint _send_endpoint;
+    // Receive buffer
+    bool _receiving;
+    size_t _receive_buffer_limit{0};
+    std::vector<uint8_t> _receive_buffer;
+    HandlerStorage _receive_storage;
+    // Send buffer
+    bool _sending;
+    size_t _send_buffer_limit{0};
+    std::vector<uint8_t> _send_buffer;
+    HandlerStorage _send_storage;
+    // Options
+    bool _option_unlink_path;
+
+    //! Disconnect the client (internal synchronous)
+    bool DisconnectInternal();
+    //! Disconnect the client (internal asynchronous)
+    bool DisconnectInternalAsync(bool dispatch);
+
+    //! Try to receive new datagram
+    void TryReceive();
+
+    //! Clear send/receive buffers
+    void ClearBuffers();
+
+    //! Send error notification
+    void SendError(std::error_code ec);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif
+
+#endif // CPPSERVER_ASIO_UDS_DATAGRAM_CLIENT_H
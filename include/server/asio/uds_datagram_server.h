@@ -0,0 +1,323 @@
+/*!
+    \file uds_datagram_server.h
+    \brief Unix domain datagram socket server definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_UDS_DATAGRAM_SERVER_H
+#define CPPSERVER_ASIO_UDS_DATAGRAM_SERVER_H
+
+#include "service.h"
+
+#include "system/uuid.h"
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace Asio {
+
+//! Unix domain datagram socket server
+/*!
+    Unix domain datagram socket server is used to send datagrams to Unix domain datagram socket
+    endpoints. It has the same callback API as UDP server, but uses AF_UNIX datagram sockets bound
+    to a filesystem path. Unix domain datagrams are reliable and never reordered.
+
+    Thread-safe.
+*/
+class UDSDatagramServer : public std::enable_shared_from_this<UDSDatagramServer>
+{
+public:
+    //! Initialize Unix domain datagram socket server with a given Asio service and socket path
+    /*!
+        \param service - Asio service
+        \param path - Socket path
+    */
+    UDSDatagramServer(const std::shared_ptr<Service>& service, const std::string& path);
+    //! Initialize Unix domain datagram socket server with a given Asio service and endpoint
+    /*!
+        \param service - Asio service
+        \param endpoint - Server Unix domain datagram socket endpoint
+    */
+    UDSDatagramServer(const std::shared_ptr<Service>& service, const asio::local::datagram_protocol::endpoint& endpoint);
+    UDSDatagramServer(const UDSDatagramServer&) = delete;
+    UDSDatagramServer(UDSDatagramServer&&) = delete;
+    virtual ~UDSDatagramServer() = default;
+
+    UDSDatagramServer& operator=(const UDSDatagramServer&) = delete;
+    UDSDatagramServer& operator=(UDSDatagramServer&&) = delete;
+
+    //! Get the server Id
+    const CppCommon::UUID& id() const noexcept { return _id; }
+
+    //! Get the Asio service
+    std::shared_ptr<Service>& service() noexcept { return _service; }
+    //! Get the Asio IO service
+    std::shared_ptr<asio::io_service>& io_service() noexcept { return _io_service; }
+    //! Get the Asio service strand for serialized handler execution
+    asio::io_service::strand& strand() noexcept { return _strand; }
+    //! Get the server endpoint
+    asio::local::datagram_protocol::endpoint& endpoint() noexcept { return _endpoint; }
+
+    //! Get the server socket path
+    const std::string& path() const noexcept { return _path; }
+
+    //! Get the number of bytes pending sent by the server
+    uint64_t bytes_pending() const noexcept { return _bytes_sending; }
+    //! Get the number of bytes sent by the server
+    uint64_t bytes_sent() const noexcept { return _bytes_sent; }
+    //! Get the number of bytes received by the server
+    uint64_t bytes_received() const noexcept { return _bytes_received; }
+    //! Get the number datagrams sent by the server
+    uint64_t datagrams_sent() const noexcept { return _datagrams_sent; }
+    //! Get the number datagrams received by the server
+    uint64_t datagrams_received() const noexcept { return _datagrams_received; }
+
+    //! Get the option: unlink socket path
+    bool option_unlink_path() const noexcept { return _option_unlink_path; }
+    //! Get the option: receive buffer limit
+    size_t option_receive_buffer_limit() const noexcept { return _receive_buffer_limit; }
+    //! Get the option: receive buffer size
+    size_t option_receive_buffer_size() const;
+    //! Get the option: send buffer limit
+    size_t option_send_buffer_limit() const noexcept { return _send_buffer_limit; }
+    //! Get the option: send buffer size
+    size_t option_send_buffer_size() const;
+
+    //! Is the server started?
+    bool IsStarted() const noexcept { return _started; }
+
+    //! Start the server
+    /*!
+        \return 'true' if the server was successfully started, 'false' if the server failed to start
+    */
+    virtual bool Start();
+    //! Stop the server
+    /*!
+        \return 'true' if the server was successfully stopped, 'false' if the server is already stopped
+    */
+    virtual bool Stop();
+    //! Restart the server
+    /*!
+        \return 'true' if the server was successfully restarted, 'false' if the server failed to restart
+    */
+    virtual bool Restart();
+
+    //! Send datagram into the given endpoint (synchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size);
+    //! Send text into the given endpoint (synchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param text - Text to send
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const asio::local::datagram_protocol::endpoint& endpoint, std::string_view text) { return Send(endpoint, text.data(), text.size()); }
+
+    //! Send datagram into the given endpoint with timeout (synchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \param timeout - Timeout
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size, const CppCommon::Timespan& timeout);
+    //! Send text into the given endpoint with timeout (synchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param text - Text to send
+        \param timeout - Timeout
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const asio::local::datagram_protocol::endpoint& endpoint, std::string_view text, const CppCommon::Timespan& timeout) { return Send(endpoint, text.data(), text.size(), timeout); }
+
+    //! Send datagram into the given endpoint (asynchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \return 'true' if the datagram was successfully sent, 'false' if the datagram was not sent
+    */
+    virtual bool SendAsync(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size);
+    //! Send text into the given endpoint (asynchronous)
+    /*!
+        \param endpoint - Endpoint to send
+        \param text - Text to send
+        \return 'true' if the text was successfully sent, 'false' if the text was not sent
+    */
+    virtual bool SendAsync(const asio::local::datagram_protocol::endpoint& endpoint, std::string_view text) { return SendAsync(endpoint, text.data(), text.size()); }
+
+    //! Receive datagram from the given endpoint (synchronous)
+    /*!
+        \param endpoint - Endpoint to receive from
+        \param buffer - Datagram buffer to receive
+        \param size - Datagram buffer size to receive
+        \return Size of received datagram
+    */
+    virtual size_t Receive(asio::local::datagram_protocol::endpoint& endpoint, void* buffer, size_t size);
+    //! Receive text from the given endpoint (synchronous)
+    /*!
+        \param endpoint - Endpoint to receive from
+        \param size - Text size to receive
+        \return Received text
+    */
+    virtual std::string Receive(asio::local::datagram_protocol::endpoint& endpoint, size_t size);
+
+    //! Receive datagram from the given endpoint with timeout (synchronous)
+    /*!
+        \param endpoint - Endpoint to receive from
+        \param buffer - Datagram buffer to receive
+        \param size - Datagram buffer size to receive
+        \param timeout - Timeout
+        \return Size of received datagram
+    */
+    virtual size_t Receive(asio::local::datagram_protocol::endpoint& endpoint, void* buffer, size_t size, const CppCommon::Timespan& timeout);
+    //! Receive text from the given endpoint with timeout (synchronous)
+    /*!
+        \param endpoint - Endpoint to receive from
+        \param size - Text size to receive
+        \param timeout - Timeout
+        \return Received text
+    */
+    virtual std::string Receive(asio::local::datagram_protocol::endpoint& endpoint, size_t size, const CppCommon::Timespan& timeout);
+
+    //! Receive datagram from the client (asynchronous)
+    virtual void ReceiveAsync();
+
+    //! Setup option: unlink socket path
+    /*!
+        This option will remove the stale socket file before the server
+        is started and remove the socket file after the server is stopped.
+        Unix domain socket bind fails if the socket file already exists.
+
+        \param enable - Enable/disable option
+    */
+    void SetupUnlinkPath(bool enable) noexcept { _option_unlink_path = enable; }
+    //! Setup option: receive buffer limit
+    /*!
+        The receive operation will fail if the receive buffer limit is met.
+        Default is unlimited.
+
+        \param limit - Receive buffer limit
+    */
+    void SetupReceiveBufferLimit(size_t limit) noexcept { _receive_buffer_limit = limit; }
+    //! Setup option: receive buffer size
+    /*!
+        This option will setup SO_RCVBUF if the OS support this feature.
+
+        \param size - Receive buffer size
+    */
+    void SetupReceiveBufferSize(size_t size);
+    //! Setup option: send buffer limit
+    /*!
+        The send operation will fail if the send buffer limit is met.
+        Default is unlimited.
+
+        \param limit - Send buffer limit
+    */
+    void SetupSendBufferLimit(size_t limit) noexcept { _send_buffer_limit = limit; }
+    //! Setup option: send buffer size
+    /*!
+        This option will setup SO_SNDBUF if the OS support this feature.
+
+        \param size - Send buffer size
+    */
+    void SetupSendBufferSize(size_t size);
+
+protected:
+    //! Handle server started notification
+    virtual void onStarted() {}
+    //! Handle server stopped notification
+    virtual void onStopped() {}
+
+    //! Handle datagram received notification
+    /*!
+        Notification is called when another datagram was received from
+        some endpoint.
+
+        \param endpoint - Received endpoint
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    virtual void onReceived(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size) {}
+    //! Handle datagram sent notification
+    /*!
+        Notification is called when a datagram was sent to the client.
+
+        This handler could be used to send another datagram to the client
+        for instance when the pending size is zero.
+
+        \param endpoint - Endpoint of sent datagram
+        \param sent - Size of sent datagram buffer
+    */
+    virtual void onSent(const asio::local::datagram_protocol::endpoint& endpoint, size_t sent) {}
+
+    //! Handle error notification
+    /*!
+        \param error - Error code
+        \param category - Error category
+        \param message - Error message
+    */
+    virtual void onError(int error, const std::string& category, const std::string& message) {}
+
+private:
+    // Server Id
+    CppCommon::UUID _id;
+    // Asio service
+    std::shared_ptr<Service> _service;
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Asio service strand for serialized handler execution
+    asio::io_service::strand _strand;
+    bool _strand_required;
+    // Server socket path
+    std::string _path;
+    // Server endpoint & socket
+    asio::local::datagram_protocol::endpoint _endpoint;
+    asio::local::datagram_protocol::socket _socket;
+    std::atomic<bool> _started;
+    // Server statistic
+    uint64_t _bytes_sending;
+    uint64_t _bytes_sent;
+    uint64_t _bytes_received;
+    uint64_t _datagrams_sent;
+    uint64_t _datagrams_received;
+    // Receive and send endpoints
+    asio::local::datagram_protocol::endpoint _receive_endpoint;
+    asio::local::datagram_protocol::endpoint _send_endpoint;
+    // Receive buffer
+    bool _receiving;
+    size_t _receive_buffer_limit{0};
+    std::vector<uint8_t> _receive_buffer;
+    HandlerStorage _receive_storage;
+    // Send buffer
+    bool _sending;
+    size_t _send_buffer_limit{0};
+    std::vector<uint8_t> _send_buffer;
+    HandlerStorage _send_storage;
+    // Options
+    bool _option_unlink_path;
+
+    //! Try to receive new datagram
+    void TryReceive();
+
+    //! Clear send/receive buffers
+    void ClearBuffers();
+
+    //! Send error notification
+    void SendError(std::error_code ec);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif
+
+#endif // CPPSERVER_ASIO_UDS_DATAGRAM_SERVER_H
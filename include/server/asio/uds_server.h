@@ -0,0 +1,231 @@
+/*!
+    \file uds_server.h
+    \brief Unix domain socket server definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_UDS_SERVER_H
+#define CPPSERVER_ASIO_UDS_SERVER_H
+
+#include "uds_session.h"
+
+#include "system/uuid.h"
+
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace Asio {
+
+//! Unix domain socket server
+/*!
+    Unix domain socket server is used to connect, disconnect and manage Unix domain socket sessions.
+    It has the same callback API as TCP server, but uses AF_UNIX stream sockets bound
+    to a filesystem path, so same-host peers avoid the TCP/IP loopback stack overhead.
+
+    Thread-safe.
+*/
+class UDSServer : public std::enable_shared_from_this<UDSServer>
+{
+    friend class UDSSession;
+
+public:
+    //! Initialize Unix domain socket server with a given Asio service and socket path
+    /*!
+        \param service - Asio service
+        \param path - Socket path
+    */
+    UDSServer(const std::shared_ptr<Service>& service, const std::string& path);
+    //! Initialize Unix domain socket server with a given Asio service and endpoint
+    /*!
+        \param service - Asio service
+        \param endpoint - Server Unix domain socket endpoint
+    */
+    UDSServer(const std::shared_ptr<Service>& service, const asio::local::stream_protocol::endpoint& endpoint);
+    UDSServer(const UDSServer&) = delete;
+    UDSServer(UDSServer&&) = delete;
+    virtual ~UDSServer() = default;
+
+    UDSServer& operator=(const UDSServer&) = delete;
+    UDSServer& operator=(UDSServer&&) = delete;
+
+    //! Get the server Id
+    const CppCommon::UUID& id() const noexcept { return _id; }
+
+    //! Get the Asio service
+    std::shared_ptr<Service>& service() noexcept { return _service; }
+    //! Get the Asio IO service
+    std::shared_ptr<asio::io_service>& io_service() noexcept { return _io_service; }
+    //! Get the Asio service strand for serialized handler execution
+    asio::io_service::strand& strand() noexcept { return _strand; }
+    //! Get the server endpoint
+    asio::local::stream_protocol::endpoint& endpoint() noexcept { return _endpoint; }
+    //! Get the server acceptor
+    asio::local::stream_protocol::acceptor& acceptor() noexcept { return _acceptor; }
+
+    //! Get the server socket path
+    const std::string& path() const noexcept { return _path; }
+
+    //! Get the number of sessions connected to the server
+    uint64_t connected_sessions() const noexcept { return _sessions.size(); }
+    //! Get the number of bytes pending sent by the server
+    uint64_t bytes_pending() const noexcept { return _bytes_pending; }
+    //! Get the number of bytes sent by the server
+    uint64_t bytes_sent() const noexcept { return _bytes_sent; }
+    //! Get the number of bytes received by the server
+    uint64_t bytes_received() const noexcept { return _bytes_received; }
+
+    //! Get the option: unlink socket path
+    bool option_unlink_path() const noexcept { return _option_unlink_path; }
+
+    //! Is the server started?
+    bool IsStarted() const noexcept { return _started; }
+
+    //! Start the server
+    /*!
+        \return 'true' if the server was successfully started, 'false' if the server failed to start
+    */
+    virtual bool Start();
+    //! Stop the server
+    /*!
+        \return 'true' if the server was successfully stopped, 'false' if the server is already stopped
+    */
+    virtual bool Stop();
+    //! Restart the server
+    /*!
+        \return 'true' if the server was successfully restarted, 'false' if the server failed to restart
+    */
+    virtual bool Restart();
+
+    //! Multicast data to all connected sessions
+    /*!
+        \param buffer - Buffer to multicast
+        \param size - Buffer size
+        \return 'true' if the data was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool Multicast(const void* buffer, size_t size);
+    //! Multicast text to all connected sessions
+    /*!
+        \param text - Text to multicast
+        \return 'true' if the text was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool Multicast(std::string_view text) { return Multicast(text.data(), text.size()); }
+
+    //! Disconnect all connected sessions
+    /*!
+        \return 'true' if all sessions were successfully disconnected, 'false' if the server is not started
+    */
+    virtual bool DisconnectAll();
+
+    //! Find a session with a given Id
+    /*!
+        \param id - Session Id
+        \return Session with a given Id or null if the session it not connected
+    */
+    std::shared_ptr<UDSSession> FindSession(const CppCommon::UUID& id);
+
+    //! Setup option: unlink socket path
+    /*!
+        This option will remove the stale socket file before the server
+        is started and remove the socket file after the server is stopped.
+        Unix domain socket bind fails if the socket file already exists.
+
+        \param enable - Enable/disable option
+    */
+    void SetupUnlinkPath(bool enable) noexcept { _option_unlink_path = enable; }
+
+protected:
+    //! Create Unix domain socket session factory method
+    /*!
+        \param server - Unix domain socket server
+        \return Unix domain socket session
+    */
+    virtual std::shared_ptr<UDSSession> CreateSession(const std::shared_ptr<UDSServer>& server) { return std::make_shared<UDSSession>(server); }
+
+protected:
+    //! Handle server started notification
+    virtual void onStarted() {}
+    //! Handle server stopped notification
+    virtual void onStopped() {}
+
+    //! Handle session connected notification
+    /*!
+        \param session - Connected session
+    */
+    virtual void onConnected(std::shared_ptr<UDSSession>& session) {}
+    //! Handle session disconnected notification
+    /*!
+        \param session - Disconnected session
+    */
+    virtual void onDisconnected(std::shared_ptr<UDSSession>& session) {}
+
+    //! Handle error notification
+    /*!
+        \param error - Error code
+        \param category - Error category
+        \param message - Error message
+    */
+    virtual void onError(int error, const std::string& category, const std::string& message) {}
+
+protected:
+    // Server sessions
+    std::shared_mutex _sessions_lock;
+    std::map<CppCommon::UUID, std::shared_ptr<UDSSession>> _sessions;
+
+private:
+    // Server Id
+    CppCommon::UUID _id;
+    // Asio service
+    std::shared_ptr<Service> _service;
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Asio service strand for serialized handler execution
+    asio::io_service::strand _strand;
+    bool _strand_required;
+    // Server socket path
+    std::string _path;
+    // Server endpoint, acceptor & socket
+    std::shared_ptr<UDSSession> _session;
+    asio::local::stream_protocol::endpoint _endpoint;
+    asio::local::stream_protocol::acceptor _acceptor;
+    std::atomic<bool> _started;
+    HandlerStorage _acceptor_storage;
+    // Server statistic
+    uint64_t _bytes_pending;
+    uint64_t _bytes_sent;
+    uint64_t _bytes_received;
+    // Options
+    bool _option_unlink_path;
+
+    //! Accept new connections
+    void Accept();
+
+    //! Register a new session
+    void RegisterSession();
+    //! Unregister the given session
+    /*!
+        \param id - Session Id
+    */
+    void UnregisterSession(const CppCommon::UUID& id);
+
+    //! Clear multicast buffer
+    void ClearBuffers();
+
+    //! Send error notification
+    void SendError(std::error_code ec);
+};
+
+/*! \example uds_chat_server.cpp Unix domain socket chat server example */
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif
+
+#endif // CPPSERVER_ASIO_UDS_SERVER_H
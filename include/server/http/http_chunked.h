@@ -0,0 +1,131 @@
+/*!
+    \file http_chunked.h
+    \brief HTTP chunked transfer encoding definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_HTTP_HTTP_CHUNKED_H
+#define CPPSERVER_HTTP_HTTP_CHUNKED_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace CppServer {
+namespace HTTP {
+
+//! HTTP chunked transfer encoding decoder
+/*!
+    HTTP chunked decoder is an incremental state machine which is used
+    to decode HTTP message body with the chunked transfer encoding.
+    Encoded body might be provided in arbitrary parts: each part is
+    decoded immediately and decoded data is passed to the handler
+    without buffering. Chunk extensions and trailer fields are skipped.
+
+    Not thread-safe.
+*/
+class HTTPChunkedDecoder
+{
+public:
+    HTTPChunkedDecoder() { Reset(); }
+    HTTPChunkedDecoder(const HTTPChunkedDecoder&) = default;
+    HTTPChunkedDecoder(HTTPChunkedDecoder&&) = default;
+    ~HTTPChunkedDecoder() = default;
+
+    HTTPChunkedDecoder& operator=(const HTTPChunkedDecoder&) = default;
+    HTTPChunkedDecoder& operator=(HTTPChunkedDecoder&&) = default;
+
+    //! Is the encoded body completed?
+    bool IsCompleted() const noexcept { return (_state == State::Done); }
+    //! Is the encoded body invalid?
+    bool IsError() const noexcept { return (_state == State::Error); }
+
+    //! Reset the decoder to decode a new encoded body
+    void Reset() noexcept;
+
+    //! Decode the next part of the encoded body
+    /*!
+        Decoding stops at the end of the encoded body, so the rest of the buffer
+        (e.g. the next pipelined HTTP message) is not consumed.
+
+        \param buffer - Encoded body buffer
+        \param size - Encoded body size
+        \param handler - Decoded data handler with the signature void(const char* data, size_t size)
+        \return Size of consumed encoded data
+    */
+    template <typename THandler>
+    size_t Decode(const void* buffer, size_t size, THandler&& handler);
+
+private:
+    // Decoder state
+    enum class State
+    {
+        Size,
+        Extension,
+        Data,
+        DataCR,
+        DataLF,
+        TrailerStart,
+        TrailerLine,
+        TrailerLF,
+        Done,
+        Error
+    };
+
+    State _state;
+    // Current chunk size or remaining chunk data size
+    uint64_t _chunk_size;
+    // Count of chunk size digits
+    size_t _chunk_digits;
+};
+
+//! HTTP chunked transfer encoding encoder
+/*!
+    HTTP chunked encoder is used to generate HTTP message body with
+    the chunked transfer encoding when its length is unknown in advance.
+
+    Thread-safe.
+*/
+class HTTPChunkedEncoder
+{
+public:
+    HTTPChunkedEncoder() = delete;
+    HTTPChunkedEncoder(const HTTPChunkedEncoder&) = delete;
+    HTTPChunkedEncoder(HTTPChunkedEncoder&&) = delete;
+    ~HTTPChunkedEncoder() = delete;
+
+    HTTPChunkedEncoder& operator=(const HTTPChunkedEncoder&) = delete;
+    HTTPChunkedEncoder& operator=(HTTPChunkedEncoder&&) = delete;
+
+    //! Encode the body chunk
+    /*!
+        Empty chunk is encoded into the empty string, because
+        the zero size chunk marks the end of the encoded body.
+
+        \param buffer - Chunk data buffer
+        \param size - Chunk data size
+        \return Encoded body chunk
+    */
+    static std::string Encode(const void* buffer, size_t size);
+    //! Encode the body chunk
+    /*!
+        \param chunk - Chunk data
+        \return Encoded body chunk
+    */
+    static std::string Encode(std::string_view chunk) { return Encode(chunk.data(), chunk.size()); }
+
+    //! Get the last chunk which completes the encoded body
+    static std::string_view LastChunk() noexcept { return "0\r\n\r\n"; }
+};
+
+/*! \example http_chunked_server.cpp HTTP chunked response server example */
+
+} // namespace HTTP
+} // namespace CppServer
+
+#include "http_chunked.inl"
+
+#endif // CPPSERVER_HTTP_HTTP_CHUNKED_H
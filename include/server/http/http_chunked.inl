@@ -0,0 +1,130 @@
+/*!
+    \file http_chunked.inl
+    \brief HTTP chunked transfer encoding inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include <algorithm>
+#include <cstring>
+
+namespace CppServer {
+namespace HTTP {
+
+inline void HTTPChunkedDecoder::Reset() noexcept
+{
+    _state = State::Size;
+    _chunk_size = 0;
+    _chunk_digits = 0;
+}
+
+template <typename THandler>
+inline size_t HTTPChunkedDecoder::Decode(const void* buffer, size_t size, THandler&& handler)
+{
+    const char* data = (const char*)buffer;
+
+    size_t i = 0;
+    while (i < size)
+    {
+        switch (_state)
+        {
+            case State::Size:
+            {
+                char ch = data[i];
+                int digit;
+                if ((ch >= '0') && (ch <= '9'))
+                    digit = ch - '0';
+                else if ((ch >= 'a') && (ch <= 'f'))
+                    digit = ch - 'a' + 10;
+                else if ((ch >= 'A') && (ch <= 'F'))
+                    digit = ch - 'A' + 10;
+                else if (_chunk_digits > 0)
+                {
+                    // Chunk extension or the end of the chunk size line
+                    _state = State::Extension;
+                    continue;
+                }
+                else
+                {
+                    // Chunk size must have at least one hex digit
+                    _state = State::Error;
+                    ++i;
+                    break;
+                }
+
+                // Chunk size must fit into 64-bit integer
+                if (++_chunk_digits > 15)
+                {
+                    _state = State::Error;
+                    ++i;
+                    break;
+                }
+
+                _chunk_size = _chunk_size * 16 + digit;
+                ++i;
+                break;
+            }
+            case State::Extension:
+            {
+                // Skip chunk extensions until the end of the chunk size line
+                const char* lf = (const char*)std::memchr(data + i, '\n', size - i);
+                if (lf == nullptr)
+                    return size;
+                i = lf - data + 1;
+                _chunk_digits = 0;
+                _state = (_chunk_size > 0) ? State::Data : State::TrailerStart;
+                break;
+            }
+            case State::Data:
+            {
+                // Pass the chunk data to the handler without buffering
+                size_t chunk = (size_t)std::min<uint64_t>(size - i, _chunk_size);
+                handler(data + i, chunk);
+                _chunk_size -= chunk;
+                i += chunk;
+                if (_chunk_size == 0)
+                    _state = State::DataCR;
+                break;
+            }
+            case State::DataCR:
+                _state = (data[i++] == '\r') ? State::DataLF : State::Error;
+                break;
+            case State::DataLF:
+                _state = (data[i++] == '\n') ? State::Size : State::Error;
+                break;
+            case State::TrailerStart:
+            {
+                // Empty line completes the encoded body
+                char ch = data[i++];
+                if (ch == '\r')
+                    _state = State::TrailerLF;
+                else if (ch == '\n')
+                    _state = State::Done;
+                else
+                    _state = State::TrailerLine;
+                break;
+            }
+            case State::TrailerLine:
+            {
+                // Skip the trailer field
+                const char* lf = (const char*)std::memchr(data + i, '\n', size - i);
+                if (lf == nullptr)
+                    return size;
+                i = lf - data + 1;
+                _state = State::TrailerStart;
+                break;
+            }
+            case State::TrailerLF:
+                _state = (data[i++] == '\n') ? State::Done : State::Error;
+                break;
+            case State::Done:
+            case State::Error:
+                return i;
+        }
+    }
+    return i;
+}
+
+} // namespace HTTP
+} // namespace CppServer
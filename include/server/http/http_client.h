@@ -44,6 +44,17 @@ public:
     HTTPRequest& request() noexcept { return _request; }
     const HTTPRequest& request() const noexcept { return _request; }
 
+    //! Setup option: preserve send buffer across auto-reconnects
+    /*!
+        HTTP and WebSocket clients refuse the option, because preserved data
+        would be sent to the new connection before the WebSocket handshake or
+        without the pending HTTP response being awaited.
+
+        \param enable - Enable/disable option
+        \return 'true' if the option was disabled, 'false' if it was requested to be enabled
+    */
+    bool SetupPreserveSendBuffer(bool enable) noexcept override { return !enable && TCPClient::SetupPreserveSendBuffer(false); }
+
     //! Send the current HTTP request (synchronous)
     /*!
         \return Size of sent data
@@ -165,6 +176,45 @@ protected:
     HTTPResponse _response;
 };
 
+#if defined(CPPSERVER_COROUTINES)
+
+class HTTPClientEx;
+
+//! HTTP response awaiter
+/*!
+    Awaits HTTP response for the HTTP request sent by HTTP extended client.
+    Resumed awaiter throws std::runtime_error on failure the same way as
+    HTTP request future does.
+
+    Not thread-safe.
+*/
+class HTTPResponseAwaiter : public Asio::Awaiter<HTTPResponse>
+{
+    friend class HTTPClientEx;
+
+public:
+    //! Initialize HTTP response awaiter
+    /*!
+        \param client - HTTP extended client
+        \param request - HTTP request
+        \param timeout - HTTP request timeout
+    */
+    HTTPResponseAwaiter(const std::shared_ptr<HTTPClientEx>& client, const HTTPRequest& request, const CppCommon::Timespan& timeout);
+
+    HTTPResponse await_resume();
+
+protected:
+    void onStart() override;
+    void onTimeout() override;
+
+private:
+    std::shared_ptr<HTTPClientEx> _client;
+    const HTTPRequest& _request;
+    std::string _error;
+};
+
+#endif
+
 //! HTTP extended client
 /*!
     HTTP extended client make requests to HTTP Web server with returning std::future
@@ -257,6 +307,21 @@ public:
     std::future<HTTPResponse> SendTraceRequest(std::string_view url, const CppCommon::Timespan& timeout = CppCommon::Timespan::minutes(1))
     { return SendRequest(_request.MakeTraceRequest(url), timeout); }
 
+#if defined(CPPSERVER_COROUTINES)
+    using HTTPClient::SendRequestAsync;
+
+    //! Send HTTP request with timeout (C++20 coroutine)
+    /*!
+        Awaitable is resumed on the client executor with the received HTTP
+        response. HTTP request should be valid until the awaitable is resumed.
+
+        \param request - HTTP request
+        \param timeout - HTTP request timeout (zero means wait without timeout)
+        \return Awaitable HTTP response (std::runtime_error is thrown on failure)
+    */
+    [[nodiscard]] HTTPResponseAwaiter SendRequestAsync(const HTTPRequest& request, const CppCommon::Timespan& timeout);
+#endif
+
 protected:
     void onConnected() override;
     void onDisconnected() override;
@@ -270,6 +335,15 @@ private:
 
     void SetPromiseValue(const HTTPResponse& response);
     void SetPromiseError(const std::string& error);
+
+#if defined(CPPSERVER_COROUTINES)
+    friend class HTTPResponseAwaiter;
+
+    HTTPResponseAwaiter* _response_awaiter{nullptr};
+
+    void StartResponseAwaiter(HTTPResponseAwaiter* awaiter);
+    void CancelResponseAwaiter(HTTPResponseAwaiter* awaiter);
+#endif
 };
 
 /*! \example http_client.cpp HTTP client example */
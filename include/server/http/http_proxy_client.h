@@ -0,0 +1,133 @@
+/*!
+    \file http_proxy_client.h
+    \brief HTTP proxy client definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_HTTP_HTTP_PROXY_CLIENT_H
+#define CPPSERVER_HTTP_HTTP_PROXY_CLIENT_H
+
+#include "http_client.h"
+
+#include "server/asio/client_pool.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace CppServer {
+namespace HTTP {
+
+class HTTPProxySession;
+class HTTPProxyUpstream;
+
+//! HTTP proxy client
+/*!
+    HTTP proxy client is a pooled connection to the upstream HTTP server.
+    While the client is bound to the proxy session it forwards the upstream
+    HTTP response to the session: the response header is forwarded without
+    hop-by-hop headers and the response body is streamed as it is received.
+
+    The end of the response body is detected with the 'Content-Length' header,
+    the chunked transfer encoding or the end of the upstream connection.
+    When the response is completed the client is returned to the pool or
+    discarded if the upstream connection could not be reused.
+
+    Receiving of the response is paused while the data pending to send to
+    the session exceeds the buffer limit of the proxy server.
+
+    Thread-safe.
+*/
+class HTTPProxyClient : public Asio::PooledClient<HTTPClient>
+{
+    friend class HTTPProxySession;
+
+public:
+    using Asio::PooledClient<HTTPClient>::PooledClient;
+
+    HTTPProxyClient(const HTTPProxyClient&) = delete;
+    HTTPProxyClient(HTTPProxyClient&&) = delete;
+    virtual ~HTTPProxyClient() = default;
+
+    HTTPProxyClient& operator=(const HTTPProxyClient&) = delete;
+    HTTPProxyClient& operator=(HTTPProxyClient&&) = delete;
+
+    //! Is the client forwarding the HTTP response?
+    bool IsActive() const noexcept { return _active; }
+
+protected:
+    void onReceived(const void* buffer, size_t size) override;
+    void onDisconnected() override;
+    void onSent(size_t sent, size_t pending) override;
+
+private:
+    // Bound proxy session, which is bound and aborted on the session thread
+    std::mutex _session_lock;
+    std::weak_ptr<HTTPProxySession> _session;
+    std::shared_ptr<HTTPProxyUpstream> _upstream;
+    std::weak_ptr<Asio::ClientPool<HTTPProxyClient>> _pool;
+    std::atomic<bool> _active{false};
+    uint64_t _timestamp{0};
+    bool _head{false};
+    size_t _buffer_limit{0};
+    // Response framing
+    bool _started{false};
+    bool _keep_alive{true};
+    bool _until_close{false};
+    bool _chunked{false};
+    size_t _body_remaining{0};
+    // Chunked body decoder to find the end of the chunked response body
+    HTTPChunkedDecoder _chunked_decoder;
+
+    //! Bind the client to the proxy session to forward the response of the given request
+    /*!
+        \param session - Proxy session
+        \param upstream - Upstream of the client
+        \param pool - Client pool
+        \param head - HEAD request flag
+        \param buffer_limit - Buffer limit of the response data pending to send to the session
+    */
+    void Bind(const std::shared_ptr<HTTPProxySession>& session, const std::shared_ptr<HTTPProxyUpstream>& upstream, const std::shared_ptr<Asio::ClientPool<HTTPProxyClient>>& pool, bool head, size_t buffer_limit);
+
+    //! Get the bound proxy session
+    std::shared_ptr<HTTPProxySession> session();
+    //! Unbind the proxy session
+    /*!
+        \return Unbound proxy session or nullptr if the session is already destroyed
+    */
+    std::shared_ptr<HTTPProxySession> Unbind();
+
+    //! Prepare the response body framing from the received response header
+    void PrepareFraming();
+    //! Forward the received response header to the session
+    void ForwardHeader(const std::shared_ptr<HTTPProxySession>& session);
+    //! Forward the received response body to the session
+    /*!
+        \param session - Proxy session
+        \param buffer - Response body buffer
+        \param size - Response body size
+        \return 'true' if the response is completed, 'false' if more body data is expected
+    */
+    bool ForwardBody(const std::shared_ptr<HTTPProxySession>& session, const char* buffer, size_t size);
+
+    //! Complete the forwarded response
+    void CompleteResponse();
+    //! Fail the forwarded response
+    void FailResponse();
+    //! Abort the forwarded response of the disconnected session
+    /*!
+        \return 'true' if the response was aborted, 'false' if the response is already completed
+    */
+    bool AbortResponse();
+    //! Release the client to the pool
+    /*!
+        \param reusable - Reusable connection flag
+    */
+    void Release(bool reusable);
+};
+
+} // namespace HTTP
+} // namespace CppServer
+
+#endif // CPPSERVER_HTTP_HTTP_PROXY_CLIENT_H
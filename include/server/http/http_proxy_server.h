@@ -0,0 +1,280 @@
+/*!
+    \file http_proxy_server.h
+    \brief HTTP proxy server definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_HTTP_HTTP_PROXY_SERVER_H
+#define CPPSERVER_HTTP_HTTP_PROXY_SERVER_H
+
+#include "http_proxy_client.h"
+#include "http_proxy_session.h"
+#include "http_server.h"
+
+#include "server/asio/client_pool.h"
+#include "server/asio/instrumentation.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace CppServer {
+namespace HTTP {
+
+//! HTTP proxy balancing strategy
+enum class HTTPProxyBalancing
+{
+    RoundRobin,         //!< Select upstreams one by one
+    LeastOutstanding    //!< Select the upstream with the least number of outstanding requests
+};
+
+//! HTTP proxy upstream
+/*!
+    HTTP proxy upstream describes a single upstream HTTP server of the proxy
+    server with its health state and request statistics.
+
+    Thread-safe.
+*/
+class HTTPProxyUpstream
+{
+    friend class HTTPProxyClient;
+    friend class HTTPProxyServer;
+    friend class HTTPProxySession;
+
+public:
+    //! Initialize the upstream with a given address and port number
+    /*!
+        \param address - Upstream server address
+        \param port - Upstream server port number
+    */
+    HTTPProxyUpstream(const std::string& address, int port) : _address(address), _port(port) {}
+    HTTPProxyUpstream(const HTTPProxyUpstream&) = delete;
+    HTTPProxyUpstream(HTTPProxyUpstream&&) = delete;
+    ~HTTPProxyUpstream() = default;
+
+    HTTPProxyUpstream& operator=(const HTTPProxyUpstream&) = delete;
+    HTTPProxyUpstream& operator=(HTTPProxyUpstream&&) = delete;
+
+    //! Get the upstream server address
+    const std::string& address() const noexcept { return _address; }
+    //! Get the upstream server port number
+    int port() const noexcept { return _port; }
+
+    //! Get the number of outstanding requests
+    size_t outstanding() const noexcept { return _outstanding; }
+    //! Get the number of completed requests
+    uint64_t requests() const noexcept { return _requests; }
+    //! Get the number of failed requests
+    uint64_t errors() const noexcept { return _errors; }
+    //! Get the average latency of completed requests
+    CppCommon::Timespan latency() const noexcept { return CppCommon::Timespan::nanoseconds((_requests > 0) ? (_latency / _requests) : 0); }
+    //! Get the maximal latency of completed requests
+    CppCommon::Timespan max_latency() const noexcept { return CppCommon::Timespan::nanoseconds(_latency_max); }
+
+    //! Make the latency histogram snapshot of completed requests
+    /*!
+        \param snapshot - Snapshot to fill
+    */
+    void LatencySnapshot(Asio::LatencyHistogramSnapshot& snapshot) const noexcept { _histogram.Snapshot(snapshot); }
+
+    //! Is the upstream healthy?
+    bool IsHealthy() const noexcept { return _healthy; }
+
+private:
+    std::string _address;
+    int _port;
+    std::atomic<bool> _healthy{true};
+    // Request statistic
+    std::atomic<size_t> _outstanding{0};
+    std::atomic<uint64_t> _requests{0};
+    std::atomic<uint64_t> _errors{0};
+    std::atomic<uint64_t> _latency{0};
+    std::atomic<uint64_t> _latency_max{0};
+    Asio::LatencyHistogram _histogram;
+    // Health check
+    std::shared_ptr<HTTPClient> _health_client;
+    std::atomic<uint64_t> _health_generation{0};
+    std::atomic<bool> _health_pending{false};
+
+    //! Record the completed request with the given latency
+    void RecordRequest(uint64_t latency) noexcept;
+};
+
+//! HTTP proxy server
+/*!
+    HTTP reverse proxy server forwards HTTP requests of connected clients
+    to the pool of upstream HTTP servers and sends their responses back.
+
+    Each request is forwarded to the upstream selected by the balancing
+    strategy. Only healthy upstreams are selected, 503 Service Unavailable
+    response is sent if there are no healthy upstreams. Upstream connections
+    are kept alive in the client connection pool and reused by subsequent
+    requests of any session.
+
+    Request and response bodies are streamed as soon as they are received
+    without buffering of the whole message, so the proxy memory usage does
+    not depend on the body size. If the receiving side is slower than the
+    sending one, the sending side is paused when the buffered data exceeds
+    the buffer limit and resumed when it is sent. Hop-by-hop headers (Connection, Keep-Alive,
+    etc.) are not forwarded and the 'X-Forwarded-For' header is extended
+    with the client address.
+
+    Requests and responses with the chunked transfer encoding are forwarded
+    as they are, chunked bodies are only scanned to find their end.
+
+    Thread-safe.
+*/
+class HTTPProxyServer : public HTTPServer
+{
+    friend class HTTPProxySession;
+
+public:
+    //! Initialize HTTP proxy server with a given Asio service and port number
+    /*!
+        \param service - Asio service
+        \param port - Server port number
+        \param protocol - Internet protocol type (default is IPv4)
+    */
+    HTTPProxyServer(const std::shared_ptr<Asio::Service>& service, int port, Asio::InternetProtocol protocol = Asio::InternetProtocol::IPv4);
+    //! Initialize HTTP proxy server with a given Asio service, server address and port number
+    /*!
+        \param service - Asio service
+        \param address - Server address
+        \param port - Server port number
+    */
+    HTTPProxyServer(const std::shared_ptr<Asio::Service>& service, const std::string& address, int port);
+    HTTPProxyServer(const HTTPProxyServer&) = delete;
+    HTTPProxyServer(HTTPProxyServer&&) = delete;
+    virtual ~HTTPProxyServer() = default;
+
+    HTTPProxyServer& operator=(const HTTPProxyServer&) = delete;
+    HTTPProxyServer& operator=(HTTPProxyServer&&) = delete;
+
+    //! Get the upstream connection pool
+    std::shared_ptr<Asio::ClientPool<HTTPProxyClient>>& pool() noexcept { return _pool; }
+    //! Get upstreams
+    const std::vector<std::shared_ptr<HTTPProxyUpstream>>& upstreams() const noexcept { return _upstreams; }
+
+    //! Get the option: balancing strategy
+    HTTPProxyBalancing option_balancing() const noexcept { return _option_balancing; }
+    //! Get the option: upstream checkout timeout
+    const CppCommon::Timespan& option_upstream_timeout() const noexcept { return _option_upstream_timeout; }
+    //! Get the option: health check path
+    const std::string& option_health_check_path() const noexcept { return _option_health_check_path; }
+    //! Get the option: health check interval
+    const CppCommon::Timespan& option_health_check_interval() const noexcept { return _option_health_check_interval; }
+    //! Get the option: buffer limit
+    size_t option_buffer_limit() const noexcept { return _option_buffer_limit; }
+
+    //! Add the upstream HTTP server
+    /*!
+        Upstreams should be added before the proxy server is started.
+
+        \param address - Upstream server address
+        \param port - Upstream server port number
+        \return Added upstream
+    */
+    std::shared_ptr<HTTPProxyUpstream> AddUpstream(const std::string& address, int port);
+
+    //! Start the server
+    /*!
+        \return 'true' if the server was successfully started, 'false' if the server failed to start
+    */
+    bool Start() override;
+    //! Stop the server
+    /*!
+        \return 'true' if the server was successfully stopped, 'false' if the server is already stopped
+    */
+    bool Stop() override;
+
+    //! Is the given HTTP header hop-by-hop?
+    /*!
+        Hop-by-hop headers are meaningful only for a single connection,
+        so they are never forwarded by the proxy server.
+
+        \param name - HTTP header name
+        \return 'true' if the given HTTP header is hop-by-hop, 'false' otherwise
+    */
+    static bool IsHopByHopHeader(std::string_view name) noexcept;
+
+    //! Setup option: balancing strategy
+    /*!
+        \param balancing - Balancing strategy
+    */
+    void SetupBalancing(HTTPProxyBalancing balancing) noexcept { _option_balancing = balancing; }
+    //! Setup option: upstream checkout timeout
+    /*!
+        502 Bad Gateway response is sent if the upstream connection
+        could not be checked out from the pool in time.
+
+        \param timeout - Upstream checkout timeout
+    */
+    void SetupUpstreamTimeout(const CppCommon::Timespan& timeout) noexcept { _option_upstream_timeout = timeout; }
+    //! Setup option: health check
+    /*!
+        Health check periodically sends GET request with the given path to
+        each upstream. The upstream is healthy if the response status is 2xx
+        or 3xx and it is received before the next health check. Upstreams
+        failed to connect are marked as unhealthy until the next successful
+        health check.
+
+        Health check is disabled if the path is empty or the interval is zero.
+
+        \param path - Health check path
+        \param interval - Health check interval
+    */
+    void SetupHealthCheck(const std::string& path, const CppCommon::Timespan& interval) { _option_health_check_path = path; _option_health_check_interval = interval; }
+    //! Setup option: buffer limit
+    /*!
+        Receiving of the response from the upstream is paused while the data
+        pending to send to the client exceeds the limit. Receiving of requests
+        from the client is paused while the data buffered for the upstream
+        exceeds the limit. Default is 256 KiB.
+
+        \param limit - Buffer limit in bytes
+    */
+    void SetupBufferLimit(size_t limit) noexcept { _option_buffer_limit = limit; }
+
+protected:
+    std::shared_ptr<Asio::TCPSession> CreateSession(const std::shared_ptr<Asio::TCPServer>& server) override { return std::make_shared<HTTPProxySession>(std::dynamic_pointer_cast<HTTPProxyServer>(server)); }
+
+    //! Select the upstream for the given HTTP request
+    /*!
+        Default implementation selects one of healthy upstreams with
+        the current balancing strategy.
+
+        \param request - HTTP request
+        \return Selected upstream or null if there are no healthy upstreams
+    */
+    virtual std::shared_ptr<HTTPProxyUpstream> SelectUpstream(const HTTPRequest& request);
+
+private:
+    // Upstreams
+    std::vector<std::shared_ptr<HTTPProxyUpstream>> _upstreams;
+    std::atomic<size_t> _next{0};
+    // Upstream connection pool
+    std::shared_ptr<Asio::ClientPool<HTTPProxyClient>> _pool;
+    // Health check
+    std::mutex _health_lock;
+    Asio::Scheduler::Token _health_token;
+    // Options
+    HTTPProxyBalancing _option_balancing{HTTPProxyBalancing::RoundRobin};
+    CppCommon::Timespan _option_upstream_timeout{CppCommon::Timespan::seconds(10)};
+    std::string _option_health_check_path;
+    CppCommon::Timespan _option_health_check_interval{CppCommon::Timespan::seconds(1)};
+    size_t _option_buffer_limit{256 * 1024};
+
+    //! Is the health check enabled?
+    bool IsHealthCheckEnabled() const noexcept { return !_option_health_check_path.empty() && (_option_health_check_interval.total() > 0); }
+    //! Check the health of all upstreams
+    void CheckHealth();
+};
+
+/*! \example http_proxy_server.cpp HTTP proxy server example */
+
+} // namespace HTTP
+} // namespace CppServer
+
+#endif // CPPSERVER_HTTP_HTTP_PROXY_SERVER_H
@@ -0,0 +1,141 @@
+/*!
+    \file http_proxy_session.h
+    \brief HTTP proxy session definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_HTTP_HTTP_PROXY_SESSION_H
+#define CPPSERVER_HTTP_HTTP_PROXY_SESSION_H
+
+#include "http_proxy_client.h"
+#include "http_session.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace CppServer {
+namespace HTTP {
+
+class HTTPProxyServer;
+class HTTPProxyUpstream;
+
+//! HTTP proxy session
+/*!
+    HTTP proxy session receives HTTP requests from the connected client
+    and forwards them one by one to upstreams of the proxy server. The next
+    request is processed only when the response of the previous one is
+    completed, so pipelined requests are answered in order.
+
+    Receiving of requests is paused while the data buffered for the upstream
+    exceeds the buffer limit of the proxy server, and the upstream response
+    is paused while the data pending to send to the client exceeds it.
+
+    Request handlers of the base HTTP session are not called for the proxy
+    session.
+
+    Thread-safe.
+*/
+class HTTPProxySession : public HTTPSession
+{
+    friend class HTTPProxyClient;
+
+public:
+    //! Initialize the session with a given proxy server
+    /*!
+        \param server - Connected proxy server
+    */
+    explicit HTTPProxySession(const std::shared_ptr<HTTPProxyServer>& server);
+    HTTPProxySession(const HTTPProxySession&) = delete;
+    HTTPProxySession(HTTPProxySession&&) = delete;
+    virtual ~HTTPProxySession() = default;
+
+    HTTPProxySession& operator=(const HTTPProxySession&) = delete;
+    HTTPProxySession& operator=(HTTPProxySession&&) = delete;
+
+    //! Get the number of forwarded requests
+    uint64_t requests() const noexcept { return _requests; }
+
+protected:
+    void onReceived(const void* buffer, size_t size) override;
+    void onDisconnected() override;
+    void onSent(size_t sent, size_t pending) override;
+    void onEmpty() override;
+
+private:
+    // Proxy server
+    std::weak_ptr<HTTPProxyServer> _proxy_server;
+    std::mutex _proxy_lock;
+    size_t _buffer_limit;
+    // Received data of subsequent requests
+    std::string _input;
+    // Forwarded data waiting for the upstream connection
+    std::string _pending;
+    // Upstream client of the current request
+    std::shared_ptr<HTTPProxyClient> _client;
+    bool _busy{false};
+    // Request body framing of the current request
+    size_t _body_remaining{0};
+    bool _body_chunked{false};
+    HTTPChunkedDecoder _body_decoder;
+    std::atomic<bool> _close_on_empty{false};
+    std::atomic<uint64_t> _requests{0};
+
+    //! Pause or resume receiving of requests by the buffered data size (must be called under the lock)
+    void UpdateReceive();
+    //! Handle the request data sent by the upstream client
+    void UpstreamSent();
+    //! Process received requests (must be called under the lock)
+    void ProcessRequests();
+    //! Start forwarding of the received request header (must be called under the lock)
+    /*!
+        \return 'true' if the request forwarding was successfully started, 'false' on error
+    */
+    bool StartRequest();
+    //! Is the rest of the current request body pending? (must be called under the lock)
+    bool IsBodyPending() const noexcept { return (_body_remaining > 0) || _body_chunked; }
+    //! Consume the received part of the current request body (must be called under the lock)
+    /*!
+        \param buffer - Received data buffer
+        \param size - Received data size
+        \return Size of the buffer which belongs to the current request body
+    */
+    size_t ConsumeBody(const char* buffer, size_t size);
+    //! Forward the request body (must be called under the lock)
+    /*!
+        \param buffer - Request body buffer
+        \param size - Request body size
+    */
+    void ForwardBody(const char* buffer, size_t size);
+    //! Handle the upstream client checkout
+    /*!
+        \param upstream - Selected upstream
+        \param client - Checked out upstream client (nullptr on timeout)
+        \param head - HEAD request flag
+    */
+    void CheckoutCompleted(const std::shared_ptr<HTTPProxyUpstream>& upstream, const std::shared_ptr<HTTPProxyClient>& client, bool head);
+    //! Complete the current request when its response is forwarded
+    /*!
+        \param close - Close the session connection after the response
+        \return 'true' if the whole request was forwarded to the upstream, 'false' if the rest of the request body is discarded
+    */
+    bool CompleteRequest(bool close);
+    //! Fail the current request when its response could not be forwarded
+    /*!
+        \param started - Response forwarding started flag
+    */
+    void FailRequest(bool started);
+    //! Send the preformatted error response and close the connection (must be called under the lock)
+    /*!
+        \param response - Preformatted error response
+    */
+    void SendErrorResponse(std::string_view response);
+    //! Close the connection when all pending data is sent
+    void DisconnectOnEmpty();
+};
+
+} // namespace HTTP
+} // namespace CppServer
+
+#endif // CPPSERVER_HTTP_HTTP_PROXY_SESSION_H
@@ -10,6 +10,7 @@
 #define CPPSERVER_HTTP_HTTP_REQUEST_H
 
 #include "http.h"
+#include "http_chunked.h"
 
 #include <sstream>
 #include <string>
@@ -31,6 +32,8 @@ class HTTPRequest
 {
     friend class HTTPSession;
     friend class HTTPSSession;
+    friend class HTTPUDSSession;
+    friend class HTTPProxySession;
 
 public:
     //! Initialize an empty HTTP request
@@ -193,6 +196,9 @@ private:
     size_t _body_size;
     size_t _body_length;
     bool _body_length_provided;
+    // HTTP request body with the chunked transfer encoding
+    bool _body_chunked;
+    HTTPChunkedDecoder _chunked_decoder;
 
     // HTTP request cache
     std::string _cache;
@@ -205,6 +211,12 @@ private:
     // Receive parts of HTTP response
     bool ReceiveHeader(const void* buffer, size_t size);
     bool ReceiveBody(const void* buffer, size_t size);
+    bool ReceiveChunked(const void* buffer, size_t size);
+
+    // Get the size of the received buffer part which belongs to pending parts of HTTP request,
+    // so bytes of the next pipelined HTTP request are not consumed by the current one
+    size_t PendingHeaderSize(const void* buffer, size_t size) const;
+    size_t PendingBodySize(const void* buffer, size_t size) const;
 
     // Fast convert integer value to the corresponding string representation
     std::string_view FastConvert(size_t value, char* buffer, size_t size);
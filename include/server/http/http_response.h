@@ -10,6 +10,7 @@
 #define CPPSERVER_HTTP_HTTP_RESPONSE_H
 
 #include "http.h"
+#include "http_chunked.h"
 
 #include "time/time.h"
 
@@ -34,6 +35,8 @@ class HTTPResponse
 {
     friend class HTTPClient;
     friend class HTTPSClient;
+    friend class HTTPUDSClient;
+    friend class HTTPProxyClient;
 
 public:
     //! Initialize an empty HTTP response
@@ -133,6 +136,13 @@ public:
         \param length - Body length
     */
     HTTPResponse& SetBodyLength(size_t length);
+    //! Set the HTTP response body with the chunked transfer encoding
+    /*!
+        Should be used when the body length is unknown in advance. Body chunks
+        are sent after the HTTP response header with HTTPSession::SendResponseChunk()
+        methods and the body is completed with HTTPSession::SendResponseChunkEnd().
+    */
+    HTTPResponse& SetBodyChunked();
 
     //! Make OK response
     /*!
@@ -205,6 +215,9 @@ private:
     size_t _body_size;
     size_t _body_length;
     bool _body_length_provided;
+    // HTTP response body with the chunked transfer encoding
+    bool _body_chunked;
+    HTTPChunkedDecoder _chunked_decoder;
 
     // HTTP response cache
     std::string _cache;
@@ -220,6 +233,10 @@ private:
     // Receive parts of HTTP response
     bool ReceiveHeader(const void* buffer, size_t size);
     bool ReceiveBody(const void* buffer, size_t size);
+    bool ReceiveChunked(const void* buffer, size_t size);
+
+    // Get the size of the received buffer part which belongs to pending HTTP response header
+    size_t PendingHeaderSize(const void* buffer, size_t size) const;
 
     // Fast convert integer value to the corresponding string representation
     std::string_view FastConvert(size_t value, char* buffer, size_t size);
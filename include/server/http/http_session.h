@@ -9,6 +9,7 @@
 #ifndef CPPSERVER_HTTP_HTTP_SESSION_H
 #define CPPSERVER_HTTP_HTTP_SESSION_H
 
+#include "http_chunked.h"
 #include "http_request.h"
 #include "http_response.h"
 
@@ -24,6 +25,13 @@ class HTTPServer;
 /*!
     HTTP session is used to receive/send HTTP requests/responses from the connected HTTP client.
 
+    Pipelined HTTP requests received in a single buffer are processed one by one
+    in order, so responses sent from request handlers are queued in the same order.
+
+    Request bodies with the chunked transfer encoding are decoded before the request
+    is handled. Responses of the unknown length might be streamed with the chunked
+    transfer encoding using HTTPResponse::SetBodyChunked() and SendResponseChunk() methods.
+
     Thread-safe.
 */
 class HTTPSession : public Asio::TCPSession
@@ -71,6 +79,27 @@ public:
     */
     size_t SendResponseBody(const void* buffer, size_t size) { return Send(buffer, size); }
 
+    //! Send the HTTP response body chunk with the chunked transfer encoding (synchronous)
+    /*!
+        Empty chunk is not sent, use SendResponseChunkEnd() to complete the response body.
+
+        \param chunk - HTTP response body chunk
+        \return Size of sent data
+    */
+    size_t SendResponseChunk(std::string_view chunk) { return Send(HTTPChunkedEncoder::Encode(chunk)); }
+    //! Send the HTTP response body chunk with the chunked transfer encoding (synchronous)
+    /*!
+        \param buffer - HTTP response body chunk buffer
+        \param size - HTTP response body chunk size
+        \return Size of sent data
+    */
+    size_t SendResponseChunk(const void* buffer, size_t size) { return Send(HTTPChunkedEncoder::Encode(buffer, size)); }
+    //! Send the last HTTP response body chunk which completes the response body (synchronous)
+    /*!
+        \return Size of sent data
+    */
+    size_t SendResponseChunkEnd() { return Send(HTTPChunkedEncoder::LastChunk()); }
+
     //! Send the current HTTP response with timeout (synchronous)
     /*!
         \param timeout - Timeout
@@ -127,6 +156,27 @@ public:
     */
     bool SendResponseBodyAsync(const void* buffer, size_t size) { return SendAsync(buffer, size); }
 
+    //! Send the HTTP response body chunk with the chunked transfer encoding (asynchronous)
+    /*!
+        Empty chunk is not sent, use SendResponseChunkEndAsync() to complete the response body.
+
+        \param chunk - HTTP response body chunk
+        \return 'true' if the HTTP response body chunk was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseChunkAsync(std::string_view chunk) { return SendAsync(HTTPChunkedEncoder::Encode(chunk)); }
+    //! Send the HTTP response body chunk with the chunked transfer encoding (asynchronous)
+    /*!
+        \param buffer - HTTP response body chunk buffer
+        \param size - HTTP response body chunk size
+        \return 'true' if the HTTP response body chunk was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseChunkAsync(const void* buffer, size_t size) { return SendAsync(HTTPChunkedEncoder::Encode(buffer, size)); }
+    //! Send the last HTTP response body chunk which completes the response body (asynchronous)
+    /*!
+        \return 'true' if the last HTTP response body chunk was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseChunkEndAsync() { return SendAsync(HTTPChunkedEncoder::LastChunk()); }
+
 protected:
     void onReceived(const void* buffer, size_t size) override;
     void onDisconnected() override;
@@ -162,6 +212,19 @@ protected:
     */
     virtual void onReceivedCachedRequest(const HTTPRequest& request, std::string_view content) { SendAsync(content); }
 
+    //! Handle HTTP request shed notification
+    /*!
+        Notification is called when HTTP request header was received
+        from the client while the server is overloaded.
+
+        Default behavior is just send preformatted 503 Service Unavailable
+        response to the client. The request body is discarded and
+        onReceivedRequest() handler is not called.
+
+        \param request - HTTP request
+    */
+    virtual void onReceivedRequestShed(const HTTPRequest& request);
+
     //! Handle HTTP request error notification
     /*!
         Notification is called when HTTP request error was received
@@ -181,6 +244,8 @@ protected:
 private:
     // Static content cache
     CppCommon::FileCache& _cache;
+    // Current HTTP request is shed by the overload control
+    bool _request_shed{false};
 
     void onReceivedRequestInternal(const HTTPRequest& request);
 };
@@ -0,0 +1,79 @@
+/*!
+    \file http_uds_uds_server.h
+    \brief HTTP over Unix domain socket server definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_HTTP_HTTP_UDS_SERVER_H
+#define CPPSERVER_HTTP_HTTP_UDS_SERVER_H
+
+#include "http_uds_session.h"
+
+#include "cache/filecache.h"
+#include "server/asio/uds_server.h"
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace HTTP {
+
+//! HTTP over Unix domain socket server
+/*!
+    HTTP over Unix domain socket server is used to create HTTP Web server
+    listening on the Unix domain socket path and
+    communicate with clients using HTTP protocol.
+    It allows to receive GET, POST, PUT, DELETE requests and
+    send HTTP responses.
+
+    Thread-safe.
+*/
+class HTTPUDSServer : public Asio::UDSServer
+{
+public:
+    using UDSServer::UDSServer;
+
+    HTTPUDSServer(const HTTPUDSServer&) = delete;
+    HTTPUDSServer(HTTPUDSServer&&) = delete;
+    virtual ~HTTPUDSServer() = default;
+
+    HTTPUDSServer& operator=(const HTTPUDSServer&) = delete;
+    HTTPUDSServer& operator=(HTTPUDSServer&&) = delete;
+
+    //! Get the static content cache
+    CppCommon::FileCache& cache() noexcept { return _cache; }
+    const CppCommon::FileCache& cache() const noexcept { return _cache; }
+
+    //! Add static content cache
+    /*!
+        \param path - Static content path
+        \param prefix - Cache prefix (default is "/")
+        \param timeout - Refresh cache timeout (default is 1 hour)
+    */
+    void AddStaticContent(const CppCommon::Path& path, const std::string& prefix = "/", const CppCommon::Timespan& timeout = CppCommon::Timespan::hours(1));
+    //! Remove static content cache
+    /*!
+        \param path - Static content path
+    */
+    void RemoveStaticContent(const CppCommon::Path& path) { _cache.remove_path(path); }
+    //! Clear static content cache
+    void ClearStaticContent() { _cache.clear(); }
+
+    //! Watchdog the static content cache
+    void Watchdog(const CppCommon::UtcTimestamp& utc = CppCommon::UtcTimestamp()) { _cache.watchdog(utc); }
+
+protected:
+    std::shared_ptr<Asio::UDSSession> CreateSession(const std::shared_ptr<Asio::UDSServer>& server) override { return std::make_shared<HTTPUDSSession>(std::dynamic_pointer_cast<HTTPUDSServer>(server)); }
+
+private:
+    // Static content cache
+    CppCommon::FileCache _cache;
+};
+
+} // namespace HTTP
+} // namespace CppServer
+
+#endif
+
+#endif // CPPSERVER_HTTP_HTTP_UDS_SERVER_H
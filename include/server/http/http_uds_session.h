@@ -0,0 +1,238 @@
+/*!
+    \file http_uds_uds_session.h
+    \brief HTTP over Unix domain socket session definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_HTTP_HTTP_UDS_SESSION_H
+#define CPPSERVER_HTTP_HTTP_UDS_SESSION_H
+
+#include "http_chunked.h"
+#include "http_request.h"
+#include "http_response.h"
+
+#include "cache/filecache.h"
+#include "server/asio/uds_session.h"
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace HTTP {
+
+class HTTPUDSServer;
+
+//! HTTP over Unix domain socket session
+/*!
+    HTTP over Unix domain socket session is used to receive/send HTTP requests/responses from the connected HTTP client.
+
+    Thread-safe.
+*/
+class HTTPUDSSession : public Asio::UDSSession
+{
+public:
+    explicit HTTPUDSSession(const std::shared_ptr<HTTPUDSServer>& server);
+    HTTPUDSSession(const HTTPUDSSession&) = delete;
+    HTTPUDSSession(HTTPUDSSession&&) = delete;
+    virtual ~HTTPUDSSession() = default;
+
+    HTTPUDSSession& operator=(const HTTPUDSSession&) = delete;
+    HTTPUDSSession& operator=(HTTPUDSSession&&) = delete;
+
+    //! Get the static content cache
+    CppCommon::FileCache& cache() noexcept { return _cache; }
+    const CppCommon::FileCache& cache() const noexcept { return _cache; }
+
+    //! Get the HTTP response
+    HTTPResponse& response() noexcept { return _response; }
+    const HTTPResponse& response() const noexcept { return _response; }
+
+    //! Send the current HTTP response (synchronous)
+    /*!
+        \return Size of sent data
+    */
+    size_t SendResponse() { return SendResponse(_response); }
+    //! Send the HTTP response (synchronous)
+    /*!
+        \param response - HTTP response
+        \return Size of sent data
+    */
+    size_t SendResponse(const HTTPResponse& response) { return Send(response.cache()); }
+
+    //! Send the HTTP response body (synchronous)
+    /*!
+        \param body - HTTP response body
+        \return Size of sent data
+    */
+    size_t SendResponseBody(std::string_view body) { return Send(body); }
+    //! Send the HTTP response body (synchronous)
+    /*!
+        \param buffer - HTTP response body buffer
+        \param size - HTTP response body size
+        \return Size of sent data
+    */
+    size_t SendResponseBody(const void* buffer, size_t size) { return Send(buffer, size); }
+
+    //! Send the HTTP response body chunk with the chunked transfer encoding (synchronous)
+    /*!
+        Empty chunk is not sent, use SendResponseChunkEnd() to complete the response body.
+
+        \param chunk - HTTP response body chunk
+        \return Size of sent data
+    */
+    size_t SendResponseChunk(std::string_view chunk) { return Send(HTTPChunkedEncoder::Encode(chunk)); }
+    //! Send the HTTP response body chunk with the chunked transfer encoding (synchronous)
+    /*!
+        \param buffer - HTTP response body chunk buffer
+        \param size - HTTP response body chunk size
+        \return Size of sent data
+    */
+    size_t SendResponseChunk(const void* buffer, size_t size) { return Send(HTTPChunkedEncoder::Encode(buffer, size)); }
+    //! Send the last HTTP response body chunk which completes the response body (synchronous)
+    /*!
+        \return Size of sent data
+    */
+    size_t SendResponseChunkEnd() { return Send(HTTPChunkedEncoder::LastChunk()); }
+
+    //! Send the current HTTP response with timeout (synchronous)
+    /*!
+        \param timeout - Timeout
+        \return Size of sent data
+    */
+    size_t SendResponse(const CppCommon::Timespan& timeout) { return SendResponse(_response, timeout); }
+    //! Send the HTTP response with timeout (synchronous)
+    /*!
+        \param response - HTTP response
+        \param timeout - Timeout
+        \return Size of sent data
+    */
+    size_t SendResponse(const HTTPResponse& response, const CppCommon::Timespan& timeout) { return Send(response.cache(), timeout); }
+
+    //! Send the HTTP response body with timeout (synchronous)
+    /*!
+        \param body - HTTP response body
+        \param timeout - Timeout
+        \return Size of sent data
+    */
+    size_t SendResponseBody(std::string_view body, const CppCommon::Timespan& timeout) { return Send(body, timeout); }
+    //! Send the HTTP response body with timeout (synchronous)
+    /*!
+        \param buffer - HTTP response body buffer
+        \param size - HTTP response body size
+        \param timeout - Timeout
+        \return Size of sent data
+    */
+    size_t SendResponseBody(const void* buffer, size_t size, const CppCommon::Timespan& timeout) { return Send(buffer, size, timeout); }
+
+    //! Send the current HTTP response (asynchronous)
+    /*!
+        \return 'true' if the current HTTP response was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseAsync() { return SendResponseAsync(_response); }
+    //! Send the HTTP response (asynchronous)
+    /*!
+        \param response - HTTP response
+        \return 'true' if the current HTTP response was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseAsync(const HTTPResponse& response) { return SendAsync(response.cache()); }
+
+    //! Send the HTTP response body (asynchronous)
+    /*!
+        \param body - HTTP response body
+        \return 'true' if the current HTTP response was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseBodyAsync(std::string_view body) { return SendAsync(body); }
+    //! Send the HTTP response body (asynchronous)
+    /*!
+        \param buffer - HTTP response body buffer
+        \param size - HTTP response body size
+        \return 'true' if the current HTTP response was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseBodyAsync(const void* buffer, size_t size) { return SendAsync(buffer, size); }
+
+    //! Send the HTTP response body chunk with the chunked transfer encoding (asynchronous)
+    /*!
+        Empty chunk is not sent, use SendResponseChunkEndAsync() to complete the response body.
+
+        \param chunk - HTTP response body chunk
+        \return 'true' if the HTTP response body chunk was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseChunkAsync(std::string_view chunk) { return SendAsync(HTTPChunkedEncoder::Encode(chunk)); }
+    //! Send the HTTP response body chunk with the chunked transfer encoding (asynchronous)
+    /*!
+        \param buffer - HTTP response body chunk buffer
+        \param size - HTTP response body chunk size
+        \return 'true' if the HTTP response body chunk was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseChunkAsync(const void* buffer, size_t size) { return SendAsync(HTTPChunkedEncoder::Encode(buffer, size)); }
+    //! Send the last HTTP response body chunk which completes the response body (asynchronous)
+    /*!
+        \return 'true' if the last HTTP response body chunk was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseChunkEndAsync() { return SendAsync(HTTPChunkedEncoder::LastChunk()); }
+
+protected:
+    void onReceived(const void* buffer, size_t size) override;
+    void onDisconnected() override;
+
+    //! Handle HTTP request header received notification
+    /*!
+        Notification is called when HTTP request header was received
+        from the client.
+
+        \param request - HTTP request
+    */
+    virtual void onReceivedRequestHeader(const HTTPRequest& request) {}
+
+    //! Handle HTTP request received notification
+    /*!
+        Notification is called when HTTP request was received
+        from the client.
+
+        \param request - HTTP request
+    */
+    virtual void onReceivedRequest(const HTTPRequest& request) {}
+    //! Handle HTTP cached request received notification
+    /*!
+        Notification is called when HTTP request was received
+        from the client and the corresponding cached content
+        was found.
+
+        Default behavior is just send cached response content
+        to the client.
+
+        \param request - HTTP request
+        \param content - Cached response content
+    */
+    virtual void onReceivedCachedRequest(const HTTPRequest& request, std::string_view content) { SendAsync(content); }
+
+    //! Handle HTTP request error notification
+    /*!
+        Notification is called when HTTP request error was received
+        from the client.
+
+        \param request - HTTP request
+        \param error - HTTP request error
+    */
+    virtual void onReceivedRequestError(const HTTPRequest& request, const std::string& error) {}
+
+protected:
+    //! HTTP request
+    HTTPRequest _request;
+    //! HTTP response
+    HTTPResponse _response;
+
+private:
+    // Static content cache
+    CppCommon::FileCache& _cache;
+
+    void onReceivedRequestInternal(const HTTPRequest& request);
+};
+
+} // namespace HTTP
+} // namespace CppServer
+
+#endif
+
+#endif // CPPSERVER_HTTP_HTTP_UDS_SESSION_H
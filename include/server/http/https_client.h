@@ -44,6 +44,17 @@ public:
     HTTPRequest& request() noexcept { return _request; }
     const HTTPRequest& request() const noexcept { return _request; }
 
+    //! Setup option: preserve send buffer across auto-reconnects
+    /*!
+        HTTP and WebSocket clients refuse the option, because preserved data
+        would be sent to the new connection before the WebSocket handshake or
+        without the pending HTTP response being awaited.
+
+        \param enable - Enable/disable option
+        \return 'true' if the option was disabled, 'false' if it was requested to be enabled
+    */
+    bool SetupPreserveSendBuffer(bool enable) noexcept override { return !enable && SSLClient::SetupPreserveSendBuffer(false); }
+
     //! Send the current HTTP request (synchronous)
     /*!
         \return Size of sent data
@@ -9,6 +9,7 @@
 #ifndef CPPSERVER_HTTP_HTTPS_SESSION_H
 #define CPPSERVER_HTTP_HTTPS_SESSION_H
 
+#include "http_chunked.h"
 #include "http_request.h"
 #include "http_response.h"
 
@@ -71,6 +72,27 @@ public:
     */
     size_t SendResponseBody(const void* buffer, size_t size) { return Send(buffer, size); }
 
+    //! Send the HTTP response body chunk with the chunked transfer encoding (synchronous)
+    /*!
+        Empty chunk is not sent, use SendResponseChunkEnd() to complete the response body.
+
+        \param chunk - HTTP response body chunk
+        \return Size of sent data
+    */
+    size_t SendResponseChunk(std::string_view chunk) { return Send(HTTPChunkedEncoder::Encode(chunk)); }
+    //! Send the HTTP response body chunk with the chunked transfer encoding (synchronous)
+    /*!
+        \param buffer - HTTP response body chunk buffer
+        \param size - HTTP response body chunk size
+        \return Size of sent data
+    */
+    size_t SendResponseChunk(const void* buffer, size_t size) { return Send(HTTPChunkedEncoder::Encode(buffer, size)); }
+    //! Send the last HTTP response body chunk which completes the response body (synchronous)
+    /*!
+        \return Size of sent data
+    */
+    size_t SendResponseChunkEnd() { return Send(HTTPChunkedEncoder::LastChunk()); }
+
     //! Send the current HTTP response with timeout (synchronous)
     /*!
         \param timeout - Timeout
@@ -127,6 +149,27 @@ public:
     */
     bool SendResponseBodyAsync(const void* buffer, size_t size) { return SendAsync(buffer, size); }
 
+    //! Send the HTTP response body chunk with the chunked transfer encoding (asynchronous)
+    /*!
+        Empty chunk is not sent, use SendResponseChunkEndAsync() to complete the response body.
+
+        \param chunk - HTTP response body chunk
+        \return 'true' if the HTTP response body chunk was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseChunkAsync(std::string_view chunk) { return SendAsync(HTTPChunkedEncoder::Encode(chunk)); }
+    //! Send the HTTP response body chunk with the chunked transfer encoding (asynchronous)
+    /*!
+        \param buffer - HTTP response body chunk buffer
+        \param size - HTTP response body chunk size
+        \return 'true' if the HTTP response body chunk was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseChunkAsync(const void* buffer, size_t size) { return SendAsync(HTTPChunkedEncoder::Encode(buffer, size)); }
+    //! Send the last HTTP response body chunk which completes the response body (asynchronous)
+    /*!
+        \return 'true' if the last HTTP response body chunk was successfully sent, 'false' if the session is not connected
+    */
+    bool SendResponseChunkEndAsync() { return SendAsync(HTTPChunkedEncoder::LastChunk()); }
+
 protected:
     void onReceived(const void* buffer, size_t size) override;
     void onDisconnected() override;
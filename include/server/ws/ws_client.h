@@ -40,6 +40,9 @@ public:
     bool Connect(const std::shared_ptr<Asio::TCPResolver>& resolver) override;
     bool ConnectAsync() override;
     bool ConnectAsync(const std::shared_ptr<Asio::TCPResolver>& resolver) override;
+#if defined(CPPSERVER_COROUTINES)
+    using HTTPClient::ConnectAsync;
+#endif
     virtual bool Close() { return Close(0, nullptr, 0); }
     virtual bool Close(int status) { return Close(status, nullptr, 0); }
     virtual bool Close(int status, const void* buffer, size_t size) { SendClose(status, buffer, size); HTTPClient::Disconnect(); return true; }
@@ -103,8 +106,13 @@ protected:
     void onReceivedResponse(const HTTP::HTTPResponse& response) override;
     void onReceivedResponseError(const HTTP::HTTPResponse& response, const std::string& error) override;
 
+#if defined(CPPSERVER_COROUTINES)
+    //! WebSocket connect awaiter is resumed when the WebSocket handshake is completed
+    bool IsConnectAwaiterResumedOnConnect() const noexcept override { return false; }
+#endif
+
     //! Handle WebSocket close notification
-    void onWSClose(const void* buffer, size_t size, int status = 1000) override { CloseAsync(); }
+    void onWSClose(const void* buffer, size_t size, int status = 1000) override { SendCloseAsync(0, nullptr, 0); HTTPClient::DisconnectInternalAsync(false); }
     //! Handle WebSocket ping notification
     void onWSPing(const void* buffer, size_t size) override { SendPongAsync(buffer, size); }
     //! Handle WebSocket error notification
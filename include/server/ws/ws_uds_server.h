@@ -0,0 +1,72 @@
+/*!
+    \file ws_uds_server.h
+    \brief WebSocket over Unix domain socket server definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_HTTP_WS_UDS_SERVER_H
+#define CPPSERVER_HTTP_WS_UDS_SERVER_H
+
+#include "ws_uds_session.h"
+
+#include "server/http/http_uds_server.h"
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace WS {
+
+//! WebSocket over Unix domain socket server
+/*!
+    WebSocket over Unix domain socket server is used to communicate with
+    clients using WebSocket protocol over the Unix domain socket path.
+
+    https://en.wikipedia.org/wiki/WebSocket
+
+    Thread-safe.
+*/
+class WSUDSServer : public HTTP::HTTPUDSServer, protected WebSocket
+{
+public:
+    using HTTPUDSServer::HTTPUDSServer;
+
+    WSUDSServer(const WSUDSServer&) = delete;
+    WSUDSServer(WSUDSServer&&) = delete;
+    virtual ~WSUDSServer() = default;
+
+    WSUDSServer& operator=(const WSUDSServer&) = delete;
+    WSUDSServer& operator=(WSUDSServer&&) = delete;
+
+    // WebSocket connection methods
+    virtual bool CloseAll() { return CloseAll(0, nullptr, 0); }
+    virtual bool CloseAll(int status) { return CloseAll(status, nullptr, 0); }
+    virtual bool CloseAll(int status, const void* buffer, size_t size);
+    virtual bool CloseAll(int status, std::string_view text);
+
+    //! Multicast data to all connected WebSocket sessions
+    bool Multicast(const void* buffer, size_t size) override;
+
+    // WebSocket multicast text methods
+    size_t MulticastText(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, buffer, size); return Multicast(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t MulticastText(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, text.data(), text.size()); return Multicast(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+
+    // WebSocket multicast binary methods
+    size_t MulticastBinary(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, buffer, size); return Multicast(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t MulticastBinary(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, text.data(), text.size()); return Multicast(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+
+    // WebSocket multicast ping methods
+    size_t MulticastPing(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PING, false, buffer, size); return Multicast(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t MulticastPing(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PING, false, text.data(), text.size()); return Multicast(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+
+protected:
+    std::shared_ptr<Asio::UDSSession> CreateSession(const std::shared_ptr<Asio::UDSServer>& server) override { return std::make_shared<WSUDSSession>(std::dynamic_pointer_cast<WSUDSServer>(server)); }
+};
+
+} // namespace WS
+} // namespace CppServer
+
+#endif
+
+#endif // CPPSERVER_HTTP_WS_UDS_SERVER_H
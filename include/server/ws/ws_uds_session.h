@@ -0,0 +1,117 @@
+/*!
+    \file ws_uds_session.h
+    \brief WebSocket over Unix domain socket session definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_HTTP_WS_UDS_SESSION_H
+#define CPPSERVER_HTTP_WS_UDS_SESSION_H
+
+#include "server/http/http_uds_session.h"
+#include "server/ws/ws.h"
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace WS {
+
+class WSUDSServer;
+
+//! WebSocket over Unix domain socket session
+/*!
+    WebSocket over Unix domain socket session is used to read and write data from the connected WebSocket client.
+
+    Thread-safe.
+*/
+class WSUDSSession : public HTTP::HTTPUDSSession, protected WebSocket
+{
+    friend class WSUDSServer;
+
+public:
+    explicit WSUDSSession(const std::shared_ptr<WSUDSServer>& server);
+    WSUDSSession(const WSUDSSession&) = delete;
+    WSUDSSession(WSUDSSession&&) = delete;
+    virtual ~WSUDSSession() = default;
+
+    WSUDSSession& operator=(const WSUDSSession&) = delete;
+    WSUDSSession& operator=(WSUDSSession&&) = delete;
+
+    // WebSocket connection methods
+    virtual bool Close() { return Close(0, nullptr, 0); }
+    virtual bool Close(int status) { return Close(status, nullptr, 0); }
+    virtual bool Close(int status, const void* buffer, size_t size) { SendCloseAsync(status, buffer, size); HTTPUDSSession::Disconnect(); return true; }
+    virtual bool Close(int status, std::string_view text) { SendCloseAsync(status, text); HTTPUDSSession::Disconnect(); return true; }
+
+    // WebSocket send text methods
+    size_t SendText(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, buffer, size); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t SendText(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, text.data(), text.size()); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t SendText(const void* buffer, size_t size, const CppCommon::Timespan& timeout) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, buffer, size); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size(), timeout); }
+    size_t SendText(std::string_view text, const CppCommon::Timespan& timeout) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, text.data(), text.size()); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size(), timeout); }
+    bool SendTextAsync(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, buffer, size); return HTTPUDSSession::SendAsync(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    bool SendTextAsync(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, text.data(), text.size()); return HTTPUDSSession::SendAsync(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+
+    // WebSocket send binary methods
+    size_t SendBinary(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, buffer, size); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t SendBinary(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, text.data(), text.size()); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t SendBinary(const void* buffer, size_t size, const CppCommon::Timespan& timeout) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, buffer, size); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size(), timeout); }
+    size_t SendBinary(std::string_view text, const CppCommon::Timespan& timeout) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, text.data(), text.size()); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size(), timeout); }
+    bool SendBinaryAsync(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, buffer, size); return HTTPUDSSession::SendAsync(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    bool SendBinaryAsync(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, text.data(), text.size()); return HTTPUDSSession::SendAsync(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+
+    // WebSocket close methods
+    size_t SendClose(int status, const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_CLOSE, false, buffer, size, status); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t SendClose(int status, std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_CLOSE, false, text.data(), text.size(), status); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t SendClose(int status, const void* buffer, size_t size, const CppCommon::Timespan& timeout) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_CLOSE, false, buffer, size, status); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size(), timeout); }
+    size_t SendClose(int status, std::string_view text, const CppCommon::Timespan& timeout) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_CLOSE, false, text.data(), text.size(), status); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size(), timeout); }
+    bool SendCloseAsync(int status, const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_CLOSE, false, buffer, size, status); return HTTPUDSSession::SendAsync(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    bool SendCloseAsync(int status, std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_CLOSE, false, text.data(), text.size(), status); return HTTPUDSSession::SendAsync(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+
+    // WebSocket ping methods
+    size_t SendPing(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PING, false, buffer, size); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t SendPing(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PING, false, text.data(), text.size()); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t SendPing(const void* buffer, size_t size, const CppCommon::Timespan& timeout) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PING, false, buffer, size); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size(), timeout); }
+    size_t SendPing(std::string_view text, const CppCommon::Timespan& timeout) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PING, false, text.data(), text.size()); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size(), timeout); }
+    bool SendPingAsync(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PING, false, buffer, size); return HTTPUDSSession::SendAsync(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    bool SendPingAsync(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PING, false, text.data(), text.size()); return HTTPUDSSession::SendAsync(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+
+    // WebSocket pong methods
+    size_t SendPong(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PONG, false, buffer, size); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t SendPong(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PONG, false, text.data(), text.size()); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t SendPong(const void* buffer, size_t size, const CppCommon::Timespan& timeout) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PONG, false, buffer, size); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size(), timeout); }
+    size_t SendPong(std::string_view text, const CppCommon::Timespan& timeout) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PONG, false, text.data(), text.size()); return HTTPUDSSession::Send(_ws_send_buffer.data(), _ws_send_buffer.size(), timeout); }
+    bool SendPongAsync(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PONG, false, buffer, size); return HTTPUDSSession::SendAsync(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    bool SendPongAsync(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PONG, false, text.data(), text.size()); return HTTPUDSSession::SendAsync(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+
+    // WebSocket receive methods
+    std::string ReceiveText();
+    std::string ReceiveText(const CppCommon::Timespan& timeout);
+    std::vector<uint8_t> ReceiveBinary();
+    std::vector<uint8_t> ReceiveBinary(const CppCommon::Timespan& timeout);
+
+protected:
+    void onDisconnected() override;
+    void onReceived(const void* buffer, size_t size) override;
+    void onReceivedRequestHeader(const HTTP::HTTPRequest& request) override;
+    void onReceivedRequest(const HTTP::HTTPRequest& request) override;
+    void onReceivedRequestError(const HTTP::HTTPRequest& request, const std::string& error) override;
+
+    //! Handle WebSocket close notification
+    void onWSClose(const void* buffer, size_t size, int status = 1000) override { Close(); }
+    //! Handle WebSocket ping notification
+    void onWSPing(const void* buffer, size_t size) override { SendPongAsync(buffer, size); }
+    //! Handle WebSocket error notification
+    void onWSError(const std::string& message) override { onError(asio::error::fault, "WebSocket error", message); }
+
+private:
+    // WebSocket send response
+    void SendResponse(const HTTP::HTTPResponse& response) override { SendResponseAsync(response); }
+};
+
+} // namespace WS
+} // namespace CppServer
+
+#endif
+
+#endif // CPPSERVER_HTTP_WS_UDS_SESSION_H
@@ -104,7 +104,7 @@ protected:
     void onReceivedResponseError(const HTTP::HTTPResponse& response, const std::string& error) override;
 
     //! Handle WebSocket close notification
-    void onWSClose(const void* buffer, size_t size, int status = 1000) override { CloseAsync(); }
+    void onWSClose(const void* buffer, size_t size, int status = 1000) override { SendCloseAsync(0, nullptr, 0); HTTPSClient::DisconnectInternalAsync(false); }
     //! Handle WebSocket ping notification
     void onWSPing(const void* buffer, size_t size) override { SendPongAsync(buffer, size); }
     //! Handle WebSocket error notification
@@ -45,14 +45,26 @@ public:
 
     //! Multicast data to all connected WebSocket sessions
     bool Multicast(const void* buffer, size_t size) override;
+    //! Multicast data to all connected WebSocket sessions conflated by the given key
+    bool MulticastConflated(std::string_view key, const void* buffer, size_t size) override;
 
     // WebSocket multicast text methods
     size_t MulticastText(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, buffer, size); return Multicast(_ws_send_buffer.data(), _ws_send_buffer.size()); }
     size_t MulticastText(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, text.data(), text.size()); return Multicast(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t MulticastTextConflated(std::string_view key, const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, buffer, size); return MulticastConflated(key, _ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t MulticastTextConflated(std::string_view key, std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, text.data(), text.size()); return MulticastConflated(key, _ws_send_buffer.data(), _ws_send_buffer.size()); }
 
     // WebSocket multicast binary methods
     size_t MulticastBinary(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, buffer, size); return Multicast(_ws_send_buffer.data(), _ws_send_buffer.size()); }
     size_t MulticastBinary(std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, text.data(), text.size()); return Multicast(_ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t MulticastBinaryConflated(std::string_view key, const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, buffer, size); return MulticastConflated(key, _ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t MulticastBinaryConflated(std::string_view key, std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, text.data(), text.size()); return MulticastConflated(key, _ws_send_buffer.data(), _ws_send_buffer.size()); }
+
+    // WebSocket publish to group methods
+    size_t PublishTextToGroup(std::string_view group, const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, buffer, size); return PublishToGroup(group, _ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t PublishTextToGroup(std::string_view group, std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_TEXT, false, text.data(), text.size()); return PublishToGroup(group, _ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t PublishBinaryToGroup(std::string_view group, const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, buffer, size); return PublishToGroup(group, _ws_send_buffer.data(), _ws_send_buffer.size()); }
+    size_t PublishBinaryToGroup(std::string_view group, std::string_view text) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_BINARY, false, text.data(), text.size()); return PublishToGroup(group, _ws_send_buffer.data(), _ws_send_buffer.size()); }
 
     // WebSocket multicast ping methods
     size_t MulticastPing(const void* buffer, size_t size) { std::scoped_lock locker(_ws_send_lock); PrepareSendFrame(WS_FIN | WS_PING, false, buffer, size); return Multicast(_ws_send_buffer.data(), _ws_send_buffer.size()); }
@@ -0,0 +1,245 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/tcp_client.h"
+#include "server/asio/tcp_server.h"
+
+#include "benchmark/reporter_console.h"
+#include "system/cpu.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+std::atomic<uint64_t> work_per_kilobyte(0);
+
+class EchoSession : public TCPSession
+{
+public:
+    using TCPSession::TCPSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Emulate the processing cost of received data
+        uint64_t deadline = Timestamp::nano() + work_per_kilobyte * size / 1024;
+        while (Timestamp::nano() < deadline);
+
+        // Resend the message back to the client
+        SendAsync(buffer, size);
+    }
+};
+
+class EchoServer : public TCPServer
+{
+public:
+    using TCPServer::TCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override
+    {
+        return std::make_shared<EchoSession>(server);
+    }
+};
+
+class HeavyClient : public TCPClient
+{
+public:
+    HeavyClient(const std::shared_ptr<Service>& service, const std::string& address, int port, size_t size)
+        : TCPClient(service, address, port),
+          _message(size, 0)
+    {
+    }
+
+    std::atomic<bool> running{true};
+
+protected:
+    void onConnected() override { SendMessage(); }
+
+    void onSent(size_t sent, size_t pending) override
+    {
+        // Keep the server busy with a firehose of data
+        if ((pending == 0) && running)
+            SendMessage();
+    }
+
+private:
+    std::vector<uint8_t> _message;
+
+    void SendMessage() { SendAsync(_message.data(), _message.size()); }
+};
+
+class LightClient : public TCPClient
+{
+public:
+    LightClient(const std::shared_ptr<Service>& service, const std::string& address, int port, size_t size)
+        : TCPClient(service, address, port),
+          _message(size, 0)
+    {
+    }
+
+    std::atomic<bool> running{true};
+    std::vector<uint64_t> latencies;
+
+protected:
+    void onConnected() override { SendMessage(); }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        _received += size;
+        if (_received < _message.size())
+            return;
+        _received = 0;
+
+        // Record the round-trip latency and send the next message
+        latencies.push_back(Timestamp::nano() - _timestamp);
+        if (running)
+            SendMessage();
+    }
+
+private:
+    std::vector<uint8_t> _message;
+    size_t _received{0};
+    uint64_t _timestamp{0};
+
+    void SendMessage() { _timestamp = Timestamp::nano(); SendAsync(_message.data(), _message.size()); }
+};
+
+uint64_t Percentile(const std::vector<uint64_t>& latencies, double percentile)
+{
+    if (latencies.empty())
+        return 0;
+
+    return latencies[std::min((size_t)(percentile * latencies.size()), latencies.size() - 1)];
+}
+
+void Benchmark(const std::string& name, const std::string& address, int port, size_t quantum, int threads, int heavy_count, int light_count, int heavy_size, int light_size, int seconds)
+{
+    // Create and start Asio services for the server and clients
+    auto server_service = std::make_shared<Service>(1);
+    auto client_service = std::make_shared<Service>(threads);
+    server_service->Start();
+    client_service->Start();
+
+    // Create and start the echo server
+    auto server = std::make_shared<EchoServer>(server_service, port);
+    server->SetupFairQuantum(quantum);
+    server->SetupReuseAddress(true);
+    server->Start();
+
+    // Connect heavy and light clients
+    std::vector<std::shared_ptr<HeavyClient>> heavy_clients;
+    for (int i = 0; i < heavy_count; ++i)
+        heavy_clients.emplace_back(std::make_shared<HeavyClient>(client_service, address, port, heavy_size));
+    std::vector<std::shared_ptr<LightClient>> light_clients;
+    for (int i = 0; i < light_count; ++i)
+        light_clients.emplace_back(std::make_shared<LightClient>(client_service, address, port, light_size));
+    for (auto& client : heavy_clients)
+        client->ConnectAsync();
+    for (auto& client : light_clients)
+        client->ConnectAsync();
+
+    // Wait for benchmarking
+    Thread::Sleep(seconds * 1000);
+
+    // Disconnect clients
+    for (auto& client : heavy_clients)
+        client->running = false;
+    for (auto& client : light_clients)
+        client->running = false;
+    for (auto& client : heavy_clients)
+        client->DisconnectAsync();
+    for (auto& client : light_clients)
+        client->DisconnectAsync();
+    for (const auto& client : heavy_clients)
+        while (client->IsConnected())
+            Thread::Yield();
+    for (const auto& client : light_clients)
+        while (client->IsConnected())
+            Thread::Yield();
+
+    // Stop the server and Asio services
+    server->Stop();
+    client_service->Stop();
+    server_service->Stop();
+
+    // Collect light clients latencies
+    std::vector<uint64_t> latencies;
+    for (const auto& client : light_clients)
+        latencies.insert(latencies.end(), client->latencies.begin(), client->latencies.end());
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << name << std::endl;
+    std::cout << "Heavy data received: " << CppBenchmark::ReporterConsole::GenerateDataSize(server->bytes_received()) << std::endl;
+    std::cout << "Light messages: " << latencies.size() << std::endl;
+    std::cout << "Light latency p50: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(Percentile(latencies, 0.50)) << std::endl;
+    std::cout << "Light latency p99: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(Percentile(latencies, 0.99)) << std::endl;
+    std::cout << "Light latency max: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(latencies.empty() ? 0 : latencies.back()) << std::endl;
+    std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-a", "--address").dest("address").set_default("127.0.0.1").help("Server address. Default: %default");
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(1111).help("Server port. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of client working threads. Default: %default");
+    parser.add_option("-q", "--quantum").dest("quantum").action("store").type("int").set_default(16384).help("Fair scheduling quantum. Default: %default");
+    parser.add_option("-w", "--work").dest("work").action("store").type("int").set_default(10000).help("Processing cost of received kilobyte in nanoseconds. Default: %default");
+    parser.add_option("-H", "--heavy").dest("heavy").action("store").type("int").set_default(1).help("Count of heavy clients. Default: %default");
+    parser.add_option("-l", "--light").dest("light").action("store").type("int").set_default(10).help("Count of light clients. Default: %default");
+    parser.add_option("-S", "--heavy-size").dest("heavy_size").action("store").type("int").set_default(1048576).help("Heavy client message size. Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Light client message size. Default: %default");
+    parser.add_option("-z", "--seconds").dest("seconds").action("store").type("int").set_default(10).help("Count of seconds to benchmarking. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    std::string address(options.get("address"));
+    int port = options.get("port");
+    int threads_count = options.get("threads");
+    int quantum = options.get("quantum");
+    int heavy_count = options.get("heavy");
+    int light_count = options.get("light");
+    int heavy_size = options.get("heavy_size");
+    int light_size = options.get("size");
+    int seconds_count = options.get("seconds");
+    work_per_kilobyte = (int)options.get("work");
+
+    std::cout << "Server address: " << address << std::endl;
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Working threads: " << threads_count << std::endl;
+    std::cout << "Fair scheduling quantum: " << quantum << std::endl;
+    std::cout << "Processing cost per kilobyte: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(work_per_kilobyte) << std::endl;
+    std::cout << "Heavy clients: " << heavy_count << std::endl;
+    std::cout << "Light clients: " << light_count << std::endl;
+    std::cout << "Heavy message size: " << heavy_size << std::endl;
+    std::cout << "Light message size: " << light_size << std::endl;
+    std::cout << "Seconds to benchmarking: " << seconds_count << std::endl;
+
+    std::cout << std::endl;
+
+    // Benchmark light clients latency under heavy neighbours with and without the fair scheduling
+    Benchmark("FIFO scheduling", address, port, 0, threads_count, heavy_count, light_count, heavy_size, light_size, seconds_count);
+    Benchmark("Fair scheduling", address, port, quantum, threads_count, heavy_count, light_count, heavy_size, light_size, seconds_count);
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "server/http/http_chunked.h"
+
+#include "benchmark/reporter_console.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::HTTP;
+
+template <class TDecode>
+uint64_t Benchmark(const std::string& name, const std::string& encoded, size_t body, size_t part, int seconds, TDecode decode)
+{
+    uint64_t decoded = 0;
+    uint64_t messages = 0;
+
+    uint64_t timestamp_start = Timestamp::nano();
+    uint64_t timestamp_stop = timestamp_start + seconds * 1000000000ull;
+
+    // Decode the encoded body received in parts of the given size
+    while (Timestamp::nano() < timestamp_stop)
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            size_t size = decode(encoded, part);
+            if (size != body)
+            {
+                std::cerr << name << " failed: decoded " << size << " bytes instead of " << body << std::endl;
+                return 0;
+            }
+            decoded += size;
+            ++messages;
+        }
+    }
+
+    uint64_t timestamp = Timestamp::nano();
+    uint64_t throughput = decoded * 1000000000 / (timestamp - timestamp_start);
+
+    std::cout << name << std::endl;
+    std::cout << "Total time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp - timestamp_start) << std::endl;
+    std::cout << "Total data: " << CppBenchmark::ReporterConsole::GenerateDataSize(decoded) << std::endl;
+    std::cout << "Total messages: " << messages << std::endl;
+    std::cout << "Data throughput: " << CppBenchmark::ReporterConsole::GenerateDataSize(throughput) << "/s" << std::endl;
+    std::cout << "Message throughput: " << messages * 1000000000 / (timestamp - timestamp_start) << " msg/s" << std::endl;
+    std::cout << std::endl;
+
+    return throughput;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-b", "--body").dest("body").action("store").type("int").set_default(1048576).help("HTTP message body size. Default: %default");
+    parser.add_option("-c", "--chunk").dest("chunk").action("store").type("int").set_default(4096).help("Single body chunk size. Default: %default");
+    parser.add_option("-p", "--part").dest("part").action("store").type("int").set_default(8192).help("Size of received parts of the encoded body. Default: %default");
+    parser.add_option("-z", "--seconds").dest("seconds").action("store").type("int").set_default(10).help("Count of seconds to benchmarking. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    size_t body_size = std::max(1, (int)options.get("body"));
+    size_t chunk_size = std::max(1, (int)options.get("chunk"));
+    size_t part_size = std::max(1, (int)options.get("part"));
+    int seconds_count = options.get("seconds");
+
+    std::cout << "Body size: " << body_size << std::endl;
+    std::cout << "Chunk size: " << chunk_size << std::endl;
+    std::cout << "Part size: " << part_size << std::endl;
+    std::cout << "Seconds to benchmarking: " << seconds_count << std::endl;
+
+    std::cout << std::endl;
+
+    // Prepare the encoded body
+    std::string body(body_size, 'x');
+    std::string encoded;
+    for (size_t offset = 0; offset < body.size(); offset += chunk_size)
+        encoded += HTTPChunkedEncoder::Encode(body.data() + offset, std::min(chunk_size, body.size() - offset));
+    encoded += HTTPChunkedEncoder::LastChunk();
+
+    std::cout << "Encoded size: " << encoded.size() << std::endl;
+    std::cout << std::endl;
+
+    // Benchmark the plain body copy as it is done for the body with the known length
+    std::string cache;
+    uint64_t plain = Benchmark("Content-Length body copy", body, body_size, part_size, seconds_count, [&cache](const std::string& input, size_t part)
+    {
+        cache.clear();
+        for (size_t offset = 0; offset < input.size(); offset += part)
+            cache.append(input.data() + offset, std::min(part, input.size() - offset));
+        return cache.size();
+    });
+
+    // Benchmark the chunked body scan to find its end as it is done by the proxy
+    Benchmark("Chunked body scan", encoded, body_size, part_size, seconds_count, [](const std::string& input, size_t part)
+    {
+        HTTPChunkedDecoder decoder;
+        size_t size = 0;
+        for (size_t offset = 0; (offset < input.size()) && !decoder.IsCompleted(); offset += part)
+            decoder.Decode(input.data() + offset, std::min(part, input.size() - offset), [&size](const char* data, size_t length) { size += length; });
+        return decoder.IsCompleted() ? size : 0;
+    });
+
+    // Benchmark the chunked body decode into the cache as it is done by HTTP request/response parsers
+    uint64_t chunked = Benchmark("Chunked body decode", encoded, body_size, part_size, seconds_count, [&cache](const std::string& input, size_t part)
+    {
+        HTTPChunkedDecoder decoder;
+        cache.clear();
+        for (size_t offset = 0; (offset < input.size()) && !decoder.IsCompleted(); offset += part)
+            decoder.Decode(input.data() + offset, std::min(part, input.size() - offset), [&cache](const char* data, size_t length) { cache.append(data, length); });
+        return decoder.IsCompleted() ? cache.size() : 0;
+    });
+
+    if (plain > 0)
+    {
+        std::cout << "Chunked decode to plain copy ratio: " << (double)chunked / (double)plain << std::endl;
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,222 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/shm_client.h"
+#include "server/asio/shm_server.h"
+#include "server/asio/tcp_client.h"
+#include "server/asio/tcp_server.h"
+#include "threads/thread.h"
+
+#include "benchmark/reporter_console.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+template <class TSession>
+class EchoSession : public TSession
+{
+public:
+    using TSession::TSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { TSession::SendAsync(buffer, size); }
+};
+
+template <class TClient>
+class PingClient : public TClient
+{
+public:
+    template <typename... Args>
+    PingClient(const std::string& message, Args&&... args)
+        : TClient(std::forward<Args>(args)...),
+          _message(message),
+          _received(0)
+    {
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<bool> completed{false};
+    std::atomic<uint64_t> round_trips{0};
+
+protected:
+    void onConnected() override
+    {
+        // Send the first ping message
+        TClient::SendAsync(_message);
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Send the next ping message when the whole pong message is received
+        _received += size;
+        if (_received < _message.size())
+            return;
+
+        _received = 0;
+        ++round_trips;
+
+        if (stop)
+            completed = true;
+        else
+            TClient::SendAsync(_message);
+    }
+
+private:
+    std::string _message;
+    size_t _received;
+};
+
+class TCPEchoServer : public TCPServer
+{
+public:
+    using TCPServer::TCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<EchoSession<TCPSession>>(server); }
+};
+
+#if defined(CPPSERVER_SHM)
+class SHMEchoServer : public SHMServer
+{
+public:
+    using SHMServer::SHMServer;
+
+protected:
+    std::shared_ptr<SHMSession> CreateSession(const std::shared_ptr<SHMServer>& server) override { return std::make_shared<EchoSession<SHMSession>>(server); }
+};
+#endif
+
+template <class TClient>
+void Benchmark(const std::string& name, const std::shared_ptr<TClient>& client, int seconds)
+{
+    // Connect the client and start the ping-pong exchange
+    client->ConnectAsync();
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    uint64_t timestamp_start = Timestamp::nano();
+
+    // Wait for a while...
+    Thread::Sleep(seconds * 1000);
+
+    // Stop the ping-pong exchange
+    client->stop = true;
+    while (!client->completed)
+        Thread::Yield();
+
+    uint64_t timestamp = Timestamp::nano();
+    uint64_t round_trips = client->round_trips;
+
+    std::cout << name << std::endl;
+    std::cout << "Total time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp - timestamp_start) << std::endl;
+    std::cout << "Total round trips: " << round_trips << std::endl;
+    if (round_trips > 0)
+    {
+        std::cout << "Round trip latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp - timestamp_start) / round_trips) << std::endl;
+        std::cout << "Round trip throughput: " << round_trips * 1000000000 / (timestamp - timestamp_start) << " round trips/s" << std::endl;
+    }
+    std::cout << std::endl;
+
+    // Disconnect the client
+    client->DisconnectAsync();
+    while (client->IsConnected())
+        Thread::Yield();
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(1111).help("TCP server port. Default: %default");
+    parser.add_option("-f", "--path").dest("path").set_default("/tmp/cppserver-shm-latency.sock").help("Shared memory server socket path. Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single message size. Default: %default");
+    parser.add_option("-b", "--busy").dest("busy").action("store").type("int").set_default(0).help("Shared memory busy polling spins. Default: %default");
+    parser.add_option("-z", "--seconds").dest("seconds").action("store").type("int").set_default(10).help("Count of seconds to benchmarking. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    int port = options.get("port");
+    std::string path(options.get("path"));
+    int message_size = options.get("size");
+    int busy_polling = options.get("busy");
+    int seconds_count = options.get("seconds");
+
+    std::cout << "TCP server port: " << port << std::endl;
+    std::cout << "Shared memory server socket path: " << path << std::endl;
+    std::cout << "Message size: " << message_size << std::endl;
+    std::cout << "Busy polling spins: " << busy_polling << std::endl;
+    std::cout << "Seconds to benchmarking: " << seconds_count << std::endl;
+    std::cout << "Shared memory supported: " << (SHMChannel::IsSupported() ? "yes" : "no") << std::endl;
+
+    std::cout << std::endl;
+
+    // Create and start separate Asio services for the server and the client
+    // to emulate two co-located processes with their own working threads
+    auto server_service = std::make_shared<Service>();
+    auto client_service = std::make_shared<Service>();
+    server_service->Start();
+    client_service->Start();
+
+    std::string message(message_size, 'x');
+
+    // Benchmark TCP round trip latency
+    {
+        auto server = std::make_shared<TCPEchoServer>(server_service, port);
+        server->SetupNoDelay(true);
+        server->SetupReuseAddress(true);
+        server->Start();
+        while (!server->IsStarted())
+            Thread::Yield();
+
+        auto client = std::make_shared<PingClient<TCPClient>>(message, client_service, "127.0.0.1", port);
+        client->SetupNoDelay(true);
+        Benchmark("TCP loopback", client, seconds_count);
+
+        server->Stop();
+        while (server->IsStarted())
+            Thread::Yield();
+    }
+
+#if defined(CPPSERVER_SHM)
+    // Benchmark shared memory round trip latency
+    {
+        auto server = std::make_shared<SHMEchoServer>(server_service, path);
+        server->SetupBusyPolling(busy_polling);
+        server->Start();
+        while (!server->IsStarted())
+            Thread::Yield();
+
+        auto client = std::make_shared<PingClient<SHMClient>>(message, client_service, path);
+        client->SetupBusyPolling(busy_polling);
+        Benchmark("Shared memory", client, seconds_count);
+
+        server->Stop();
+        while (server->IsStarted())
+            Thread::Yield();
+    }
+#endif
+
+    // Stop Asio services
+    client_service->Stop();
+    server_service->Stop();
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "server/asio/statistics.h"
+
+#include "benchmark/reporter_console.h"
+#include "system/cpu.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+template <class TUpdate>
+uint64_t Benchmark(const std::string& name, int threads, int seconds, TUpdate update)
+{
+    std::atomic<uint64_t> operations(0);
+
+    uint64_t timestamp_start = Timestamp::nano();
+    uint64_t timestamp_stop = timestamp_start + seconds * 1000000000ull;
+
+    // Update counters from all working threads
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; ++i)
+    {
+        workers.emplace_back([&]()
+        {
+            uint64_t count = 0;
+            while (Timestamp::nano() < timestamp_stop)
+            {
+                for (int j = 0; j < 1000; ++j)
+                    update();
+                count += 1000;
+            }
+            operations += count;
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    uint64_t timestamp = Timestamp::nano();
+    uint64_t throughput = operations * 1000000000 / (timestamp - timestamp_start);
+
+    std::cout << name << std::endl;
+    std::cout << "Total time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp - timestamp_start) << std::endl;
+    std::cout << "Total operations: " << operations << std::endl;
+    if (operations > 0)
+        std::cout << "Operation throughput: " << throughput << " ops/s" << std::endl;
+    std::cout << std::endl;
+
+    return throughput;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+    parser.add_option("-z", "--seconds").dest("seconds").action("store").type("int").set_default(10).help("Count of seconds to benchmarking. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    int threads = options.get("threads");
+    int seconds_count = options.get("seconds");
+
+    std::cout << "Working threads: " << threads << std::endl;
+    std::cout << "Seconds to benchmarking: " << seconds_count << std::endl;
+
+    std::cout << std::endl;
+
+    // Benchmark shared server-wide atomic counters
+    std::atomic<uint64_t> bytes_sent(0);
+    std::atomic<uint64_t> bytes_received(0);
+    uint64_t shared = Benchmark("Shared atomic counters", threads, seconds_count, [&]()
+    {
+        bytes_received.fetch_add(1, std::memory_order_relaxed);
+        bytes_sent.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    // Benchmark per-thread sharded counters
+    ServerStatistics statistics;
+    uint64_t sharded = Benchmark("Sharded server statistics", threads, seconds_count, [&]()
+    {
+        statistics.AddBytesReceived(1);
+        statistics.AddBytesSent(1);
+    });
+
+    if (shared > 0)
+    {
+        std::cout << "Sharded statistics speedup: " << (double)sharded / (double)shared << "x" << std::endl;
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
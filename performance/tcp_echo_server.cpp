@@ -112,6 +112,11 @@ int main(int argc, char** argv)
         }
     }
 
+    // Print the server statistics
+    auto statistics = server->statistics();
+    std::cout << "Server bytes sent: " << statistics.bytes_sent << std::endl;
+    std::cout << "Server bytes received: " << statistics.bytes_received << std::endl;
+
     // Stop the server
     std::cout << "Server stopping...";
     server->Stop();
@@ -0,0 +1,168 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/tcp_client.h"
+#include "server/asio/tcp_server.h"
+#include "threads/thread.h"
+
+#include "benchmark/reporter_console.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+class EchoSession : public TCPSession
+{
+public:
+    using TCPSession::TCPSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { SendAsync(buffer, size); }
+};
+
+class EchoServer : public TCPServer
+{
+public:
+    using TCPServer::TCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<EchoSession>(server); }
+};
+
+class RequestClient : public TCPClient
+{
+public:
+    RequestClient(const std::shared_ptr<Service>& service, const std::string& address, int port, const std::string& request)
+        : TCPClient(service, address, port),
+          _request(request)
+    {
+    }
+
+    std::atomic<bool> completed{false};
+
+protected:
+    void onConnected() override
+    {
+        // Send the request right after connect, so it could be carried with the SYN packet
+        SendAsync(_request);
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Complete the request when the whole response is received
+        if (bytes_received() >= _request.size())
+            DisconnectAsync();
+    }
+
+    void onDisconnected() override { completed = true; }
+
+private:
+    std::string _request;
+};
+
+void Benchmark(const std::shared_ptr<Service>& service, const std::string& address, int port, const std::string& request, int seconds, bool fast_open)
+{
+    // Create and start the server
+    auto server = std::make_shared<EchoServer>(service, port);
+    server->SetupReuseAddress(true);
+    server->SetupFastOpen(fast_open ? 1024 : 0);
+    server->Start();
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    uint64_t requests = 0;
+    uint64_t fast_open_connects = 0;
+
+    uint64_t timestamp_start = Timestamp::nano();
+    uint64_t timestamp_stop = timestamp_start + seconds * 1000000000ull;
+
+    // Perform sequential short-lived request/response exchanges
+    while (Timestamp::nano() < timestamp_stop)
+    {
+        auto client = std::make_shared<RequestClient>(service, address, port, request);
+        client->SetupFastOpen(fast_open);
+        client->SetupNoDelay(true);
+        client->ConnectAsync();
+        while (!client->completed)
+            Thread::Yield();
+
+        ++requests;
+        fast_open_connects += client->fast_open_connects();
+    }
+
+    uint64_t timestamp = Timestamp::nano();
+
+    std::cout << (fast_open ? "TCP Fast Open" : "Regular TCP handshake") << std::endl;
+    std::cout << "Total time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp - timestamp_start) << std::endl;
+    std::cout << "Total requests: " << requests << std::endl;
+    if (requests > 0)
+    {
+        std::cout << "Request latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp - timestamp_start) / requests) << std::endl;
+        std::cout << "Request throughput: " << requests * 1000000000 / (timestamp - timestamp_start) << " requests/s" << std::endl;
+    }
+    std::cout << "Client TCP Fast Open connects: " << fast_open_connects << std::endl;
+    std::cout << "Server TCP Fast Open sessions: " << server->fast_open_sessions() << std::endl;
+    std::cout << std::endl;
+
+    // Stop the server
+    server->Stop();
+    while (server->IsStarted())
+        Thread::Yield();
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-a", "--address").dest("address").set_default("127.0.0.1").help("Server address. Default: %default");
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(1111).help("Server port. Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single request size. Default: %default");
+    parser.add_option("-z", "--seconds").dest("seconds").action("store").type("int").set_default(10).help("Count of seconds to benchmarking. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    std::string address(options.get("address"));
+    int port = options.get("port");
+    int request_size = options.get("size");
+    int seconds_count = options.get("seconds");
+
+    std::cout << "Server address: " << address << std::endl;
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Request size: " << request_size << std::endl;
+    std::cout << "Seconds to benchmarking: " << seconds_count << std::endl;
+    std::cout << "TCP Fast Open supported: " << (FastOpen::IsSupported() ? "yes" : "no") << std::endl;
+
+    std::cout << std::endl;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    service->Start();
+
+    std::string request(request_size, 'x');
+
+    // Benchmark regular connects and TCP Fast Open connects
+    Benchmark(service, address, port, request, seconds_count, false);
+    Benchmark(service, address, port, request, seconds_count, true);
+
+    // Stop Asio service
+    service->Stop();
+
+    return 0;
+}
@@ -4,12 +4,15 @@
 
 #include "server/asio/service.h"
 #include "server/asio/tcp_server.h"
+
+#include "benchmark/reporter_console.h"
 #include "system/cpu.h"
 #include "threads/thread.h"
 #include "time/timestamp.h"
 
 #include <atomic>
 #include <iostream>
+#include <shared_mutex>
 #include <thread>
 #include <vector>
 
@@ -48,6 +51,17 @@ class MulticastServer : public TCPServer
 public:
     using TCPServer::TCPServer;
 
+    //! Multicast data with a send handler dispatched for each session
+    bool MulticastPerSession(const void* buffer, size_t size)
+    {
+        std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+        for (auto& session : _sessions)
+            session.second->SendAsync(buffer, size);
+
+        return true;
+    }
+
 protected:
     std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override
     {
@@ -69,6 +83,7 @@ int main(int argc, char** argv)
     parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
     parser.add_option("-m", "--messages").dest("messages").action("store").type("int").set_default(1000000).help("Rate of messages per second to send. Default: %default");
     parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single message size. Default: %default");
+    parser.add_option("-u", "--unbatched").dest("unbatched").action("store_true").help("Multicast with a send handler dispatched for each session instead of a single task per working thread");
 
     optparse::Values options = parser.parse_args(argc, argv);
 
@@ -84,11 +99,13 @@ int main(int argc, char** argv)
     int threads = options.get("threads");
     int messages_rate = options.get("messages");
     int message_size = options.get("size");
+    bool unbatched = options.get("unbatched");
 
     std::cout << "Server port: " << port << std::endl;
     std::cout << "Working threads: " << threads << std::endl;
     std::cout << "Messages rate: " << messages_rate << std::endl;
     std::cout << "Message size: " << message_size << std::endl;
+    std::cout << "Multicast mode: " << (unbatched ? "per session" : "batched per working thread") << std::endl;
 
     std::cout << std::endl;
 
@@ -113,7 +130,9 @@ int main(int argc, char** argv)
 
     // Start the multicasting thread
     std::atomic<bool> multicasting(true);
-    auto multicaster = std::thread([&server, &multicasting, messages_rate, message_size]()
+    std::atomic<uint64_t> multicast_calls(0);
+    std::atomic<uint64_t> multicast_time(0);
+    auto multicaster = std::thread([&server, &multicasting, &multicast_calls, &multicast_time, messages_rate, message_size, unbatched]()
     {
         // Prepare message to multicast
         std::vector<uint8_t> message_to_send(message_size);
@@ -123,9 +142,18 @@ int main(int argc, char** argv)
         {
             auto start = UtcTimestamp();
             for (int i = 0; i < messages_rate; ++i)
-                server->Multicast(message_to_send.data(), message_to_send.size());
+            {
+                if (unbatched)
+                    server->MulticastPerSession(message_to_send.data(), message_to_send.size());
+                else
+                    server->Multicast(message_to_send.data(), message_to_send.size());
+            }
             auto end = UtcTimestamp();
 
+            // Update multicast statistic
+            multicast_calls += messages_rate;
+            multicast_time += (end - start).nanoseconds();
+
             // Sleep for remaining time or yield
             auto milliseconds = (end - start).milliseconds();
             if (milliseconds < 1000)
@@ -158,6 +186,12 @@ int main(int argc, char** argv)
     multicasting = false;
     multicaster.join();
 
+    // Print multicast statistic (e.g. run tcp_multicast_client with 10000 clients)
+    std::cout << "Connected sessions: " << server->connected_sessions() << std::endl;
+    std::cout << "Multicast calls: " << multicast_calls << std::endl;
+    if (multicast_calls > 0)
+        std::cout << "Multicast call latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(multicast_time / multicast_calls) << std::endl;
+
     // Stop the server
     std::cout << "Server stopping...";
     server->Stop();
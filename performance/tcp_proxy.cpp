@@ -0,0 +1,207 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/tcp_client.h"
+#include "server/asio/tcp_proxy_server.h"
+#include "server/asio/tcp_server.h"
+#include "threads/thread.h"
+
+#include "benchmark/reporter_console.h"
+#include "system/cpu.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+class EchoSession : public TCPSession
+{
+public:
+    using TCPSession::TCPSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { SendAsync(buffer, size); }
+};
+
+class EchoServer : public TCPServer
+{
+public:
+    using TCPServer::TCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<EchoSession>(server); }
+};
+
+class StreamClient : public TCPClient
+{
+public:
+    StreamClient(const std::shared_ptr<Service>& service, const std::string& address, int port, const std::string& message, int messages)
+        : TCPClient(service, address, port),
+          _message(message),
+          _messages(messages),
+          _received(0)
+    {
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> in_flight{0};
+    std::atomic<uint64_t> echoed{0};
+
+protected:
+    void onConnected() override
+    {
+        // Keep the given count of messages in flight
+        for (int i = 0; i < _messages; ++i)
+        {
+            ++in_flight;
+            SendAsync(_message);
+        }
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Send the next message when the whole message is echoed
+        _received += size;
+        echoed += size;
+        while (_received >= _message.size())
+        {
+            _received -= _message.size();
+            if (stop)
+                --in_flight;
+            else
+                SendAsync(_message);
+        }
+    }
+
+private:
+    std::string _message;
+    int _messages;
+    size_t _received;
+};
+
+void Benchmark(const std::string& name, const std::shared_ptr<Service>& service, int port, const std::string& message, int messages, int seconds)
+{
+    // Connect the client and start the echo stream
+    auto client = std::make_shared<StreamClient>(service, "127.0.0.1", port, message, messages);
+    client->ConnectAsync();
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    uint64_t timestamp_start = Timestamp::nano();
+
+    // Wait for a while...
+    Thread::Sleep(seconds * 1000);
+
+    // Stop the echo stream and wait for all messages in flight
+    client->stop = true;
+    while (client->in_flight > 0)
+        Thread::Yield();
+
+    uint64_t timestamp = Timestamp::nano();
+    uint64_t echoed = client->echoed;
+
+    std::cout << name << std::endl;
+    std::cout << "Total time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp - timestamp_start) << std::endl;
+    std::cout << "Total data: " << CppBenchmark::ReporterConsole::GenerateDataSize(echoed) << std::endl;
+    std::cout << "Data throughput: " << CppBenchmark::ReporterConsole::GenerateDataSize(echoed * 1000000000 / (timestamp - timestamp_start)) << "/s" << std::endl;
+    std::cout << std::endl;
+
+    // Disconnect the client
+    client->DisconnectAsync();
+    while (client->IsConnected())
+        Thread::Yield();
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(1111).help("Echo server port. Default: %default");
+    parser.add_option("-x", "--proxy").dest("proxy").action("store").type("int").set_default(1112).help("Proxy server port. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+    parser.add_option("-m", "--messages").dest("messages").action("store").type("int").set_default(16).help("Count of messages in flight. Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(65536).help("Single message size. Default: %default");
+    parser.add_option("-k", "--pipe").dest("pipe").action("store").type("int").set_default(65536).help("Proxy pipe size. Default: %default");
+    parser.add_option("-z", "--seconds").dest("seconds").action("store").type("int").set_default(10).help("Count of seconds to benchmarking. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    int port = options.get("port");
+    int proxy_port = options.get("proxy");
+    int threads_count = options.get("threads");
+    int messages_count = options.get("messages");
+    int message_size = options.get("size");
+    int pipe_size = options.get("pipe");
+    int seconds_count = options.get("seconds");
+
+    std::cout << "Echo server port: " << port << std::endl;
+    std::cout << "Proxy server port: " << proxy_port << std::endl;
+    std::cout << "Working threads: " << threads_count << std::endl;
+    std::cout << "Messages in flight: " << messages_count << std::endl;
+    std::cout << "Message size: " << message_size << std::endl;
+    std::cout << "Pipe size: " << pipe_size << std::endl;
+    std::cout << "Seconds to benchmarking: " << seconds_count << std::endl;
+    std::cout << "Zero-copy supported: " << (TCPProxyServer::IsZeroCopySupported() ? "yes" : "no") << std::endl;
+
+    std::cout << std::endl;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>(threads_count);
+    service->Start();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoServer>(service, port);
+    server->SetupReuseAddress(true);
+    server->Start();
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    std::string message(message_size, 'x');
+
+    // Benchmark the copy and zero-copy proxy paths
+    for (bool zero_copy : { false, true })
+    {
+        if (zero_copy && !TCPProxyServer::IsZeroCopySupported())
+            continue;
+
+        auto proxy = std::make_shared<TCPProxyServer>(service, proxy_port, "127.0.0.1", port);
+        proxy->SetupReuseAddress(true);
+        proxy->SetupZeroCopy(zero_copy);
+        proxy->SetupPipeSize(pipe_size);
+        proxy->Start();
+        while (!proxy->IsStarted())
+            Thread::Yield();
+
+        Benchmark(zero_copy ? "Proxy (zero-copy)" : "Proxy (copy)", service, proxy_port, message, messages_count, seconds_count);
+
+        proxy->Stop();
+        while (proxy->IsStarted())
+            Thread::Yield();
+    }
+
+    // Stop Echo server
+    server->Stop();
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop Asio service
+    service->Stop();
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/tcp_client.h"
+
+#include "benchmark/reporter_console.h"
+#include "time/timestamp.h"
+
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+class SyncClient : public TCPClient
+{
+public:
+    using TCPClient::TCPClient;
+
+    // Legacy timed send implementation with the timer, mutex and condition variable per call
+    size_t LegacySend(const void* buffer, size_t size, const Timespan& timeout)
+    {
+        return LegacyWait([&](auto handler) { socket().async_write_some(asio::buffer(buffer, size), handler); }, timeout);
+    }
+
+    // Legacy timed receive implementation with the timer, mutex and condition variable per call
+    size_t LegacyReceive(void* buffer, size_t size, const Timespan& timeout)
+    {
+        return LegacyWait([&](auto handler) { socket().async_read_some(asio::buffer(buffer, size), handler); }, timeout);
+    }
+
+protected:
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "TCP client caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+
+private:
+    template <class TOperation>
+    size_t LegacyWait(TOperation operation, const Timespan& timeout)
+    {
+        int done = 0;
+        std::mutex mtx;
+        std::condition_variable cv;
+        asio::system_timer timer(socket().get_executor());
+
+        // Prepare done handler
+        auto async_done_handler = [&](asio::error_code ec)
+        {
+            std::unique_lock<std::mutex> lck(mtx);
+            if (done++ == 0)
+            {
+                socket().cancel();
+                timer.cancel();
+            }
+            cv.notify_one();
+        };
+
+        // Async wait for timeout
+        timer.expires_from_now(timeout.chrono());
+        timer.async_wait([&](const asio::error_code& ec) { async_done_handler(ec ? ec : asio::error::timed_out); });
+
+        // Async perform the operation
+        size_t result = 0;
+        operation([&](std::error_code ec, size_t size) { result = size; async_done_handler(ec); });
+
+        // Wait for complete or timeout
+        std::unique_lock<std::mutex> lck(mtx);
+        cv.wait(lck, [&]() { return done == 2; });
+
+        return result;
+    }
+};
+
+template <class TRoundtrip>
+uint64_t Benchmark(const std::string& name, int seconds, TRoundtrip roundtrip)
+{
+    uint64_t calls = 0;
+    uint64_t errors = 0;
+
+    uint64_t timestamp_start = Timestamp::nano();
+    uint64_t timestamp_stop = timestamp_start + seconds * 1000000000ull;
+    uint64_t timestamp = timestamp_start;
+    while (timestamp < timestamp_stop)
+    {
+        if (roundtrip())
+            calls += 2;
+        else
+            ++errors;
+        timestamp = Timestamp::nano();
+    }
+
+    uint64_t throughput = calls * 1000000000 / (timestamp - timestamp_start);
+
+    std::cout << name << std::endl;
+    std::cout << "Errors: " << errors << std::endl;
+    std::cout << "Total time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp - timestamp_start) << std::endl;
+    std::cout << "Total calls: " << calls << std::endl;
+    if (calls > 0)
+    {
+        std::cout << "Call latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp - timestamp_start) / calls) << std::endl;
+        std::cout << "Call throughput: " << throughput << " calls/s" << std::endl;
+    }
+    std::cout << std::endl;
+
+    return throughput;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-a", "--address").dest("address").set_default("127.0.0.1").help("Server address. Default: %default");
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(1111).help("Server port. Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single message size. Default: %default");
+    parser.add_option("-o", "--timeout").dest("timeout").action("store").type("int").set_default(1000).help("Send/Receive timeout in milliseconds. Default: %default");
+    parser.add_option("-z", "--seconds").dest("seconds").action("store").type("int").set_default(10).help("Count of seconds to benchmarking. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Client parameters
+    std::string address(options.get("address"));
+    int port = options.get("port");
+    int message_size = options.get("size");
+    int timeout_ms = options.get("timeout");
+    int seconds_count = options.get("seconds");
+
+    std::cout << "Server address: " << address << std::endl;
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Message size: " << message_size << std::endl;
+    std::cout << "Timeout: " << timeout_ms << " ms" << std::endl;
+    std::cout << "Seconds to benchmarking: " << seconds_count << std::endl;
+
+    std::cout << std::endl;
+
+    // Prepare messages to send and receive
+    std::vector<uint8_t> message_to_send(message_size, 0);
+    std::vector<uint8_t> message_to_receive(message_size, 0);
+    Timespan timeout = Timespan::milliseconds(timeout_ms);
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>();
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create and synchronously connect the client
+    auto client = std::make_shared<SyncClient>(service, address, port);
+    std::cout << "Client connecting...";
+    if (!client->Connect())
+    {
+        std::cout << "Failed!" << std::endl;
+        return -1;
+    }
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    // Benchmark timed Send/Receive calls with poll() and the deadline
+    uint64_t poll = Benchmark("Timed Send/Receive (poll with deadline)", seconds_count, [&]()
+    {
+        if (client->Send(message_to_send.data(), message_to_send.size(), timeout) != message_to_send.size())
+            return false;
+        size_t received = 0;
+        while (received < message_to_receive.size())
+        {
+            size_t size = client->Receive(message_to_receive.data() + received, message_to_receive.size() - received, timeout);
+            if (size == 0)
+                return false;
+            received += size;
+        }
+        return true;
+    });
+
+    // Benchmark legacy timed Send/Receive calls with the timer, mutex and condition variable
+    uint64_t legacy = Benchmark("Timed Send/Receive (legacy timer, mutex and condition variable)", seconds_count, [&]()
+    {
+        if (client->LegacySend(message_to_send.data(), message_to_send.size(), timeout) != message_to_send.size())
+            return false;
+        size_t received = 0;
+        while (received < message_to_receive.size())
+        {
+            size_t size = client->LegacyReceive(message_to_receive.data() + received, message_to_receive.size() - received, timeout);
+            if (size == 0)
+                return false;
+            received += size;
+        }
+        return true;
+    });
+
+    if (legacy > 0)
+        std::cout << "Speedup: " << (double)poll / (double)legacy << "x" << std::endl << std::endl;
+
+    // Disconnect the client
+    std::cout << "Client disconnecting...";
+    client->Disconnect();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/timer.h"
+
+#include "benchmark/reporter_console.h"
+#include "time/timestamp.h"
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+class WheelEntry : public TimingWheel::Entry
+{
+protected:
+    void onExpired() override {}
+};
+
+template <class TArmCancel>
+uint64_t Benchmark(const std::string& name, int seconds, int batch, TArmCancel arm_cancel)
+{
+    uint64_t operations = 0;
+
+    uint64_t timestamp_start = Timestamp::nano();
+    uint64_t timestamp_stop = timestamp_start + seconds * 1000000000ull;
+    uint64_t timestamp = timestamp_start;
+    while (timestamp < timestamp_stop)
+    {
+        // Arm and cancel the batch of timers
+        arm_cancel();
+        operations += 2 * batch;
+        timestamp = Timestamp::nano();
+    }
+
+    uint64_t throughput = operations * 1000000000 / (timestamp - timestamp_start);
+
+    std::cout << name << std::endl;
+    std::cout << "Total time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp - timestamp_start) << std::endl;
+    std::cout << "Total operations: " << operations << std::endl;
+    if (operations > 0)
+    {
+        std::cout << "Operation latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp - timestamp_start) / operations) << std::endl;
+        std::cout << "Operation throughput: " << throughput << " ops/s" << std::endl;
+    }
+    std::cout << std::endl;
+
+    return throughput;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-b", "--batch").dest("batch").action("store").type("int").set_default(1000).help("Count of timers armed before cancel. Default: %default");
+    parser.add_option("-o", "--timeout").dest("timeout").action("store").type("int").set_default(1000).help("Timer timeout in milliseconds. Default: %default");
+    parser.add_option("-z", "--seconds").dest("seconds").action("store").type("int").set_default(10).help("Count of seconds to benchmarking. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    int batch = options.get("batch");
+    int timeout_ms = options.get("timeout");
+    int seconds_count = options.get("seconds");
+
+    std::cout << "Timers batch: " << batch << std::endl;
+    std::cout << "Timeout: " << timeout_ms << " ms" << std::endl;
+    std::cout << "Seconds to benchmarking: " << seconds_count << std::endl;
+
+    std::cout << std::endl;
+
+    Timespan timeout = Timespan::milliseconds(timeout_ms);
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>();
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    // Benchmark Asio timer objects
+    std::vector<std::shared_ptr<Timer>> timers(batch);
+    uint64_t timer = Benchmark("Asio::Timer arm/cancel", seconds_count, batch, [&]()
+    {
+        for (auto& t : timers)
+        {
+            t = std::make_shared<Timer>(service, [](bool canceled) {}, timeout);
+            t->WaitAsync();
+        }
+        for (auto& t : timers)
+        {
+            t->Cancel();
+            t.reset();
+        }
+    });
+
+    // Benchmark scheduled tasks
+    std::vector<Scheduler::Token> tokens(batch);
+    uint64_t scheduler = Benchmark("Service::ScheduleAfter arm/cancel", seconds_count, batch, [&]()
+    {
+        for (auto& token : tokens)
+            token = service->ScheduleAfter(timeout, []() {});
+        for (auto& token : tokens)
+            token.Cancel();
+    });
+
+    // Benchmark timing wheel entries
+    auto wheel = service->GetTimingWheel(service->GetAsioService());
+    std::vector<WheelEntry> entries(batch);
+    uint64_t timing_wheel = Benchmark("TimingWheel arm/cancel", seconds_count, batch, [&]()
+    {
+        for (auto& entry : entries)
+            wheel->Arm(entry, timeout);
+        for (auto& entry : entries)
+            wheel->Cancel(entry);
+    });
+
+    if (timer > 0)
+    {
+        std::cout << "Scheduler speedup: " << (double)scheduler / (double)timer << "x" << std::endl;
+        std::cout << "Timing wheel speedup: " << (double)timing_wheel / (double)timer << "x" << std::endl;
+        std::cout << std::endl;
+    }
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/uds_server.h"
+#include "filesystem/path.h"
+#include "system/cpu.h"
+
+#include <iostream>
+
+#include <OptionParser.h>
+
+#if defined(CPPSERVER_UDS)
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+class EchoSession : public UDSSession
+{
+public:
+    using UDSSession::UDSSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Resend the message back to the client
+        SendAsync(buffer, size);
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Unix domain socket session caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+};
+
+class EchoServer : public UDSServer
+{
+public:
+    using UDSServer::UDSServer;
+
+protected:
+    std::shared_ptr<UDSSession> CreateSession(const std::shared_ptr<UDSServer>& server) override
+    {
+        return std::make_shared<EchoSession>(server);
+    }
+
+protected:
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Unix domain socket server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-p", "--path").dest("path").set_default((Path::temp() / "cppserver-uds-echo.sock").string()).help("Server socket path. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Server socket path
+    std::string path(options.get("path"));
+    int threads = options.get("threads");
+
+    std::cout << "Server socket path: " << path << std::endl;
+    std::cout << "Working threads: " << threads << std::endl;
+
+    std::cout << std::endl;
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>(threads);
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create a new echo server
+    auto server = std::make_shared<EchoServer>(service, path);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << "Press Enter to stop the server or '!' to restart the server..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.empty())
+            break;
+
+        // Restart the server
+        if (line == "!")
+        {
+            std::cout << "Server restarting...";
+            server->Restart();
+            std::cout << "Done!" << std::endl;
+            continue;
+        }
+    }
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::cout << "Unix domain sockets are not supported on this platform!" << std::endl;
+    return -1;
+}
+
+#endif
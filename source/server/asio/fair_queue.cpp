@@ -0,0 +1,92 @@
+/*!
+    \file fair_queue.cpp
+    \brief Asio fair queue implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/fair_queue.h"
+
+#include "errors/exceptions.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace CppServer {
+namespace Asio {
+
+FairQueue::FairQueue(const std::shared_ptr<asio::io_service>& io_service)
+    : _io_service(io_service),
+      _dispatching(false)
+{
+    assert((io_service != nullptr) && "Asio IO service is invalid!");
+    if (io_service == nullptr)
+        throw CppCommon::ArgumentException("Asio IO service is invalid!");
+}
+
+void FairQueue::Enqueue(const std::shared_ptr<Entry>& entry)
+{
+    if (entry->_queued)
+        return;
+
+    entry->_queued = true;
+    if (entry->_class == SchedulingClass::Control)
+        _control.push_back(entry);
+    else
+        _bulk.push_back(entry);
+
+    Post();
+}
+
+void FairQueue::Post()
+{
+    if (_dispatching)
+        return;
+
+    // Post the next round handler
+    _dispatching = true;
+    auto self(this->shared_from_this());
+    _io_service->post(make_alloc_handler(_dispatch_storage, [this, self]() { Dispatch(); }));
+}
+
+void FairQueue::Dispatch()
+{
+    _dispatching = false;
+
+    // Serve control entries before bulk entries
+    DispatchRound(_control);
+    DispatchRound(_bulk);
+
+    // Yield to other handlers before the next round
+    if (!_control.empty() || !_bulk.empty())
+        Post();
+}
+
+void FairQueue::DispatchRound(std::deque<std::shared_ptr<Entry>>& entries)
+{
+    // Entries enqueued during the round will be served in the next round
+    for (size_t count = entries.size(); count > 0; --count)
+    {
+        std::shared_ptr<Entry> entry = std::move(entries.front());
+        entries.pop_front();
+
+        // Dispatch the entry with its accumulated deficit
+        entry->_deficit += entry->_quantum;
+        bool pending = false;
+        size_t processed = entry->onDispatch(entry->_deficit, pending);
+        entry->_deficit -= std::min(processed, entry->_deficit);
+
+        // Requeue the entry with pending data or reset its deficit
+        if (pending)
+            entries.push_back(std::move(entry));
+        else
+        {
+            entry->_deficit = 0;
+            entry->_queued = false;
+        }
+    }
+}
+
+} // namespace Asio
+} // namespace CppServer
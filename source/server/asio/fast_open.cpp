@@ -0,0 +1,66 @@
+/*!
+    \file fast_open.cpp
+    \brief TCP Fast Open implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/fast_open.h"
+
+#if defined(__linux__)
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
+
+namespace CppServer {
+namespace Asio {
+
+bool FastOpen::IsSupported() noexcept
+{
+#if defined(__linux__) && defined(TCP_FASTOPEN) && defined(TCP_FASTOPEN_CONNECT)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool FastOpen::EnableServer(asio::ip::tcp::acceptor& acceptor, size_t queue)
+{
+#if defined(__linux__) && defined(TCP_FASTOPEN)
+    typedef asio::detail::socket_option::integer<IPPROTO_TCP, TCP_FASTOPEN> fast_open;
+    asio::error_code ec;
+    acceptor.set_option(fast_open((int)queue), ec);
+    return !ec;
+#else
+    return false;
+#endif
+}
+
+bool FastOpen::EnableClient(asio::ip::tcp::socket& socket)
+{
+#if defined(__linux__) && defined(TCP_FASTOPEN_CONNECT)
+    typedef asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_FASTOPEN_CONNECT> fast_open_connect;
+    asio::error_code ec;
+    socket.set_option(fast_open_connect(true), ec);
+    return !ec;
+#else
+    return false;
+#endif
+}
+
+bool FastOpen::IsUsed(asio::ip::tcp::socket& socket)
+{
+#if defined(__linux__) && defined(TCPI_OPT_SYN_DATA)
+    struct tcp_info info;
+    socklen_t size = sizeof(info);
+    if (getsockopt(socket.native_handle(), IPPROTO_TCP, TCP_INFO, &info, &size) != 0)
+        return false;
+    return (info.tcpi_options & TCPI_OPT_SYN_DATA) != 0;
+#else
+    return false;
+#endif
+}
+
+} // namespace Asio
+} // namespace CppServer
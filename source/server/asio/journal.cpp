@@ -0,0 +1,103 @@
+/*!
+    \file journal.cpp
+    \brief Asio multicast journal implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/journal.h"
+
+namespace CppServer {
+namespace Asio {
+
+MulticastJournal::MulticastJournal(size_t messages, size_t bytes)
+    : _first_sequence(1),
+      _bytes(0),
+      _limit_messages(messages),
+      _limit_bytes(bytes)
+{
+}
+
+size_t MulticastJournal::size() const
+{
+    std::scoped_lock locker(_lock);
+
+    return _messages.size();
+}
+
+size_t MulticastJournal::bytes() const
+{
+    std::scoped_lock locker(_lock);
+
+    return _bytes;
+}
+
+uint64_t MulticastJournal::first_sequence() const
+{
+    std::scoped_lock locker(_lock);
+
+    return _first_sequence;
+}
+
+uint64_t MulticastJournal::next_sequence() const
+{
+    std::scoped_lock locker(_lock);
+
+    return _first_sequence + _messages.size();
+}
+
+uint64_t MulticastJournal::Append(const Message& message)
+{
+    std::scoped_lock locker(_lock);
+
+    // Append the message
+    _messages.push_back(message);
+    _bytes += message->size();
+    uint64_t sequence = _first_sequence + _messages.size() - 1;
+
+    // Evict the oldest messages over the limits, but keep the latest one
+    while ((_messages.size() > 1) && (((_limit_messages > 0) && (_messages.size() > _limit_messages)) || ((_limit_bytes > 0) && (_bytes > _limit_bytes))))
+    {
+        _bytes -= _messages.front()->size();
+        _messages.pop_front();
+        ++_first_sequence;
+    }
+
+    return sequence;
+}
+
+uint64_t MulticastJournal::Read(uint64_t sequence, size_t budget, std::vector<Message>& messages) const
+{
+    std::scoped_lock locker(_lock);
+
+    // Start from the oldest message if requested messages were evicted
+    if (sequence < _first_sequence)
+        sequence = _first_sequence;
+
+    // Read messages until the bytes budget is exhausted
+    size_t read = 0;
+    for (size_t index = (size_t)(sequence - _first_sequence); index < _messages.size(); ++index)
+    {
+        const auto& message = _messages[index];
+        if ((read > 0) && ((read + message->size()) > budget))
+            break;
+
+        messages.push_back(message);
+        read += message->size();
+    }
+
+    return sequence;
+}
+
+void MulticastJournal::Clear()
+{
+    std::scoped_lock locker(_lock);
+
+    _first_sequence += _messages.size();
+    _messages.clear();
+    _bytes = 0;
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,60 @@
+/*!
+    \file poll.cpp
+    \brief Asio poll-based synchronous I/O with timeout implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/poll.h"
+
+#if defined(CPPSERVER_POLL)
+#include <poll.h>
+#endif
+
+#include <algorithm>
+#include <climits>
+
+namespace CppServer {
+namespace Asio {
+
+#if defined(CPPSERVER_POLL)
+
+bool Poll::Wait(int socket, bool write, const std::chrono::steady_clock::time_point& deadline, asio::error_code& ec)
+{
+    pollfd fds;
+    fds.fd = socket;
+    fds.events = write ? POLLOUT : POLLIN;
+
+    for (;;)
+    {
+        // Check the deadline
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            ec = asio::error::timed_out;
+            return false;
+        }
+
+        // Poll the socket for the rest of the timeout (rounded up to milliseconds)
+        auto milliseconds = std::chrono::ceil<std::chrono::milliseconds>(deadline - now).count();
+        fds.revents = 0;
+        int result = ::poll(&fds, 1, (int)std::min<int64_t>(milliseconds, INT_MAX));
+        if (result > 0)
+        {
+            // Socket errors will be reported by the next socket operation
+            ec.clear();
+            return true;
+        }
+        if ((result < 0) && (errno != EINTR))
+        {
+            ec = asio::error_code(errno, asio::error::get_system_category());
+            return false;
+        }
+    }
+}
+
+#endif
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,242 @@
+/*!
+    \file scheduler.cpp
+    \brief Asio scheduler implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/scheduler.h"
+
+#include "errors/exceptions.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace CppServer {
+namespace Asio {
+
+bool Scheduler::Token::IsPending() const
+{
+    auto scheduler = _scheduler.lock();
+    return scheduler ? scheduler->IsPending(_index, _generation) : false;
+}
+
+bool Scheduler::Token::Cancel()
+{
+    auto scheduler = _scheduler.lock();
+    return scheduler ? scheduler->Cancel(*this) : false;
+}
+
+Scheduler::Scheduler(const std::shared_ptr<asio::io_service>& io_service)
+    : _size(0),
+      _timer(*io_service),
+      _timer_armed(false)
+{
+    assert((io_service != nullptr) && "Asio IO service is invalid!");
+    if (io_service == nullptr)
+        throw CppCommon::ArgumentException("Asio IO service is invalid!");
+}
+
+Scheduler::Token Scheduler::ScheduleAfter(const CppCommon::Timespan& timeout, std::function<void()> action)
+{
+    auto time = std::chrono::steady_clock::now() + std::chrono::duration_cast<Duration>(timeout.chrono());
+    return Schedule(time, Duration::zero(), std::move(action));
+}
+
+Scheduler::Token Scheduler::ScheduleAt(const CppCommon::UtcTime& time, std::function<void()> action)
+{
+    // Convert the absolute time to the steady clock
+    auto timeout = time.chrono() - std::chrono::system_clock::now();
+    auto steady_time = std::chrono::steady_clock::now() + std::chrono::duration_cast<Duration>(timeout);
+    return Schedule(steady_time, Duration::zero(), std::move(action));
+}
+
+Scheduler::Token Scheduler::SchedulePeriodic(const CppCommon::Timespan& period, std::function<void()> action)
+{
+    assert((period.total() > 0) && "Scheduler period must be positive!");
+    if (period.total() <= 0)
+        return Token();
+
+    auto duration = std::chrono::duration_cast<Duration>(period.chrono());
+    return Schedule(std::chrono::steady_clock::now() + duration, duration, std::move(action));
+}
+
+bool Scheduler::Cancel(const Token& token)
+{
+    std::scoped_lock locker(_lock);
+
+    if (!IsPending(token._index, token._generation))
+        return false;
+
+    // Canceled task will be lazily removed from the heap
+    Release(token._index);
+
+    // Remove canceled tasks if the heap contains too many of them
+    if (_heap.size() > (2 * _size + 64))
+        Compact();
+
+    return true;
+}
+
+Scheduler::Token Scheduler::Schedule(const TimePoint& time, const Duration& period, std::function<void()>&& action)
+{
+    std::scoped_lock locker(_lock);
+
+    // Acquire the task slot
+    uint32_t index;
+    if (_free.empty())
+    {
+        assert((_tasks.size() < std::numeric_limits<uint32_t>::max()) && "Too many scheduled tasks!");
+        index = (uint32_t)_tasks.size();
+        _tasks.emplace_back();
+    }
+    else
+    {
+        index = _free.back();
+        _free.pop_back();
+    }
+
+    Task& task = _tasks[index];
+    task.action = std::move(action);
+    task.period = period;
+    task.pending = true;
+    ++_size;
+
+    // Push the task into the heap
+    _heap.push_back(Item{ time, index, task.generation });
+    std::push_heap(_heap.begin(), _heap.end(), std::greater<Item>());
+
+    // Arm the scheduler timer for the nearest task
+    Arm();
+
+    return Token(this->shared_from_this(), index, task.generation);
+}
+
+bool Scheduler::IsPending(uint32_t index, uint32_t generation)
+{
+    if (index >= _tasks.size())
+        return false;
+
+    const Task& task = _tasks[index];
+    return task.pending && (task.generation == generation);
+}
+
+void Scheduler::Release(uint32_t index)
+{
+    Task& task = _tasks[index];
+    task.action = nullptr;
+    task.pending = false;
+    ++task.generation;
+    _free.push_back(index);
+    --_size;
+}
+
+void Scheduler::Compact()
+{
+    _heap.erase(std::remove_if(_heap.begin(), _heap.end(), [this](const Item& item) { return !IsPending(item.index, item.generation); }), _heap.end());
+    std::make_heap(_heap.begin(), _heap.end(), std::greater<Item>());
+}
+
+void Scheduler::Arm()
+{
+    if (_heap.empty())
+        return;
+
+    // Skip if the timer is already armed for the earlier time
+    TimePoint time = _heap.front().time;
+    if (_timer_armed && (_timer_time <= time))
+        return;
+
+    _timer_armed = true;
+    _timer_time = time;
+
+    // Async wait for the nearest task. The timer is armed by any thread while
+    // the previous handler is released by the IO thread, so the handler memory
+    // is not reused from the not thread-safe handler storage.
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const asio::error_code& ec)
+    {
+        // Timer was re-armed for the earlier time or destroyed
+        if (ec == asio::error::operation_aborted)
+            return;
+
+        {
+            std::scoped_lock locker(_lock);
+            _timer_armed = false;
+        }
+
+        // Run all expired tasks
+        Run();
+    };
+    _timer.expires_at(time);
+    _timer.async_wait(async_wait_handler);
+}
+
+void Scheduler::Run()
+{
+    TimePoint now = std::chrono::steady_clock::now();
+
+    for (;;)
+    {
+        Item item;
+        Duration period;
+        std::function<void()> action;
+
+        {
+            std::scoped_lock locker(_lock);
+
+            // Arm the scheduler timer if there are no more expired tasks
+            if (_heap.empty() || (_heap.front().time > now))
+            {
+                Arm();
+                return;
+            }
+
+            // Pop the nearest task from the heap
+            std::pop_heap(_heap.begin(), _heap.end(), std::greater<Item>());
+            item = _heap.back();
+            _heap.pop_back();
+
+            // Skip canceled tasks
+            if (!IsPending(item.index, item.generation))
+                continue;
+
+            // One-shot task is completed, periodic task is still pending while running
+            Task& task = _tasks[item.index];
+            period = task.period;
+            action = std::move(task.action);
+            if (period == Duration::zero())
+                Release(item.index);
+        }
+
+        // Run the task action
+        if (action)
+        {
+            _deadline = item.time;
+            action();
+        }
+
+        // Re-schedule the periodic task if it was not canceled while running
+        if (period != Duration::zero())
+        {
+            std::scoped_lock locker(_lock);
+
+            if (!IsPending(item.index, item.generation))
+                continue;
+
+            // Next expiry time is calculated without drift, missed periods are skipped
+            item.time += period;
+            if (item.time <= now)
+                item.time += period * ((now - item.time) / period + 1);
+
+            _tasks[item.index].action = std::move(action);
+            _heap.push_back(item);
+            std::push_heap(_heap.begin(), _heap.end(), std::greater<Item>());
+        }
+    }
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -9,6 +9,9 @@
 #include "server/asio/service.h"
 
 #include "errors/fatal.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
 
 namespace CppServer {
 namespace Asio {
@@ -17,7 +20,9 @@ Service::Service(int threads, bool pool)
     : _strand_required(false),
       _polling(false),
       _started(false),
-      _round_robin_index(0)
+      _round_robin_index(0),
+      _option_statistics(false),
+      _option_statistics_interval(CppCommon::Timespan::seconds(1))
 {
     assert((threads >= 0) && "Working threads counter must not be negative!");
 
@@ -44,13 +49,23 @@ Service::Service(int threads, bool pool)
         _strand = std::make_shared<asio::io_service::strand>(*_services[0]);
         _strand_required = true;
     }
+
+    // Create schedulers for all Asio IO services
+    for (auto& io_service : _services)
+        _schedulers.emplace_back(std::make_shared<Scheduler>(io_service));
+
+    // Create statistics for all working threads
+    for (size_t thread = 0; thread < _threads.size(); ++thread)
+        _statistics.emplace_back(std::make_unique<ServiceThreadStatistics>());
 }
 
 Service::Service(const std::shared_ptr<asio::io_service>& service, bool strands)
     : _strand_required(strands),
       _polling(false),
       _started(false),
-      _round_robin_index(0)
+      _round_robin_index(0),
+      _option_statistics(false),
+      _option_statistics_interval(CppCommon::Timespan::seconds(1))
 {
     assert((service != nullptr) && "Asio IO service is invalid!");
     if (service == nullptr)
@@ -59,6 +74,9 @@ Service::Service(const std::shared_ptr<asio::io_service>& service, bool strands)
     _services.emplace_back(service);
     if (_strand_required)
         _strand = std::make_shared<asio::io_service::strand>(*_services[0]);
+
+    // Create the scheduler for the Asio IO service
+    _schedulers.emplace_back(std::make_shared<Scheduler>(service));
 }
 
 bool Service::Start(bool polling)
@@ -73,6 +91,10 @@ bool Service::Start(bool polling)
     // Reset round robin index
     _round_robin_index = 0;
 
+    // Start the statistics instrumentation
+    if (_option_statistics)
+        StartStatistics();
+
     // Post the started handler
     auto self(this->shared_from_this());
     auto start_handler = [this, self]()
@@ -93,7 +115,10 @@ bool Service::Start(bool polling)
 
     // Start service working threads
     for (size_t thread = 0; thread < _threads.size(); ++thread)
-        _threads[thread] = CppCommon::Thread::Start([this, self, thread]() { ServiceThread(self, _services[thread % _services.size()]); });
+    {
+        ServiceThreadStatistics* statistics = _option_statistics ? _statistics[thread].get() : nullptr;
+        _threads[thread] = CppCommon::Thread::Start([this, self, thread, statistics]() { ServiceThread(self, _services[thread % _services.size()], statistics); });
+    }
 
     // Wait for service is started
     while (!IsStarted())
@@ -108,6 +133,9 @@ bool Service::Stop()
     if (!IsStarted())
         return false;
 
+    // Stop the statistics instrumentation
+    StopStatistics();
+
     // Post the stop routine
     auto self(this->shared_from_this());
     auto stop_handler = [this, self]()
@@ -151,22 +179,183 @@ bool Service::Restart()
     if (!Stop())
         return false;
 
+    // Release timing wheels of the previous Asio IO services
+    {
+        std::scoped_lock locker(_timing_wheels_lock);
+        _timing_wheels.clear();
+    }
+
+    // Release fair queues of the previous Asio IO services
+    {
+        std::scoped_lock locker(_fair_queues_lock);
+        _fair_queues.clear();
+    }
+
     // Reinitialize new Asio IO services
     for (size_t service = 0; service < _services.size(); ++service)
+    {
         _services[service] = std::make_shared<asio::io_service>();
+        _schedulers[service] = std::make_shared<Scheduler>(_services[service]);
+    }
     if (_strand_required)
         _strand = std::make_shared<asio::io_service::strand>(*_services[0]);
 
     return Start(polling);
 }
 
-void Service::ServiceThread(const std::shared_ptr<Service>& service, const std::shared_ptr<asio::io_service>& io_service)
+std::shared_ptr<TimingWheel> Service::GetTimingWheel(const std::shared_ptr<asio::io_service>& io_service)
+{
+    std::scoped_lock locker(_timing_wheels_lock);
+
+    // Find the timing wheel of the given Asio IO service
+    for (auto& timing_wheel : _timing_wheels)
+        if (timing_wheel.first == io_service)
+            return timing_wheel.second;
+
+    // Create a new timing wheel
+    auto timing_wheel = std::make_shared<TimingWheel>(io_service);
+    _timing_wheels.emplace_back(io_service, timing_wheel);
+    return timing_wheel;
+}
+
+std::shared_ptr<FairQueue> Service::GetFairQueue(const std::shared_ptr<asio::io_service>& io_service)
+{
+    std::scoped_lock locker(_fair_queues_lock);
+
+    // Find the fair queue of the given Asio IO service
+    for (auto& fair_queue : _fair_queues)
+        if (fair_queue.first == io_service)
+            return fair_queue.second;
+
+    // Create a new fair queue
+    auto fair_queue = std::make_shared<FairQueue>(io_service);
+    _fair_queues.emplace_back(io_service, fair_queue);
+    return fair_queue;
+}
+
+std::shared_ptr<Scheduler> Service::GetScheduler(const std::shared_ptr<asio::io_service>& io_service) noexcept
+{
+    for (size_t service = 0; service < _services.size(); ++service)
+        if (_services[service] == io_service)
+            return _schedulers[service];
+
+    return nullptr;
+}
+
+std::shared_ptr<Scheduler>& Service::GetSchedulerChecked(const std::shared_ptr<asio::io_service>& io_service)
+{
+    for (size_t service = 0; service < _services.size(); ++service)
+        if (_services[service] == io_service)
+            return _schedulers[service];
+
+    throw CppCommon::ArgumentException("Asio IO service is not hosted by the service!");
+}
+
+ServiceStatisticsSnapshot Service::statistics() const
+{
+    ServiceStatisticsSnapshot snapshot;
+
+    if (!_option_statistics)
+        return snapshot;
+
+    snapshot.threads.resize(_statistics.size());
+    for (size_t thread = 0; thread < _statistics.size(); ++thread)
+        _statistics[thread]->Snapshot(snapshot.threads[thread]);
+
+    return snapshot;
+}
+
+uint64_t Service::loop_lag() const noexcept
+{
+    uint64_t result = 0;
+
+    if (!_option_statistics)
+        return result;
+
+    for (auto& statistics : _statistics)
+        result = std::max(result, statistics->loop_lag());
+
+    return result;
+}
+
+void Service::StartStatistics()
+{
+    // Statistics are collected only for service working threads
+    if (_statistics.empty())
+        return;
+
+    // Reset working threads statistics
+    for (auto& statistics : _statistics)
+        statistics->Reset();
+
+    // Event loop lag is probed ten times per statistics interval
+    CppCommon::Timespan interval = _option_statistics_interval;
+    CppCommon::Timespan probe = CppCommon::Timespan::nanoseconds(std::max<int64_t>(interval.total() / 10, 1000000));
+
+    // Schedule event loop lag probes for all Asio IO services
+    for (size_t service = 0; service < _services.size(); ++service)
+    {
+        asio::io_service* io_service = _services[service].get();
+        _statistics_tokens.emplace_back(_schedulers[service]->SchedulePeriodic(probe, [io_service]()
+        {
+            // Post the probe handler and measure its execution delay from the
+            // scheduled probe time, so the delay of the probe timer itself is
+            // also measured when the event loop is blocked
+            auto deadline = Scheduler::deadline();
+            io_service->post([deadline]()
+            {
+                ServiceThreadStatistics* statistics = ServiceThreadStatistics::current();
+                if (statistics != nullptr)
+                    statistics->RecordLoopLag((uint64_t)std::max<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - deadline).count(), 0));
+            });
+        }));
+    }
+
+    // Schedule the statistics notification
+    _statistics_tokens.emplace_back(_schedulers[0]->SchedulePeriodic(interval, [this]()
+    {
+        // Update statistics intervals of all working threads
+        uint64_t timestamp = CppCommon::Timestamp::nano();
+        for (auto& statistics : _statistics)
+            statistics->Update(timestamp);
+
+        // Call the service statistics handler
+        onStatistics(statistics());
+    }));
+}
+
+void Service::StopStatistics()
+{
+    for (auto& token : _statistics_tokens)
+        token.Cancel();
+    _statistics_tokens.clear();
+}
+
+Scheduler::Token Service::ScheduleAfter(const std::shared_ptr<asio::io_service>& io_service, const CppCommon::Timespan& timeout, std::function<void()> action)
+{
+    return GetSchedulerChecked(io_service)->ScheduleAfter(timeout, std::move(action));
+}
+
+Scheduler::Token Service::ScheduleAt(const std::shared_ptr<asio::io_service>& io_service, const CppCommon::UtcTime& time, std::function<void()> action)
+{
+    return GetSchedulerChecked(io_service)->ScheduleAt(time, std::move(action));
+}
+
+Scheduler::Token Service::SchedulePeriodic(const std::shared_ptr<asio::io_service>& io_service, const CppCommon::Timespan& period, std::function<void()> action)
+{
+    return GetSchedulerChecked(io_service)->SchedulePeriodic(period, std::move(action));
+}
+
+void Service::ServiceThread(const std::shared_ptr<Service>& service, const std::shared_ptr<asio::io_service>& io_service, ServiceThreadStatistics* statistics)
 {
     bool polling = service->IsPolling();
 
     // Call the initialize thread handler
     service->onThreadInitialize();
 
+    // Bind the working thread statistics
+    ServiceThreadStatistics::Bind(statistics);
+
     try
     {
         // Attach the current working thread to the Asio service
@@ -181,7 +370,13 @@ void Service::ServiceThread(const std::shared_ptr<Service>& service, const std::
                 if (polling)
                 {
                     // Poll all pending handlers
-                    io_service->poll();
+                    if (statistics != nullptr)
+                    {
+                        while (io_service->poll_one() > 0)
+                            statistics->RecordCompletion();
+                    }
+                    else
+                        io_service->poll();
 
                     // Call the idle handler
                     service->onIdle();
@@ -189,7 +384,13 @@ void Service::ServiceThread(const std::shared_ptr<Service>& service, const std::
                 else
                 {
                     // Run all pending handlers
-                    io_service->run();
+                    if (statistics != nullptr)
+                    {
+                        while (io_service->run_one() > 0)
+                            statistics->RecordCompletion();
+                    }
+                    else
+                        io_service->run();
                     break;
                 }
             }
@@ -218,6 +419,9 @@ void Service::ServiceThread(const std::shared_ptr<Service>& service, const std::
         fatality("Asio service thread terminated!");
     }
 
+    // Unbind the working thread statistics
+    ServiceThreadStatistics::Bind(nullptr);
+
     // Call the cleanup thread handler
     service->onThreadCleanup();
 
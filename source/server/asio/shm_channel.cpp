@@ -0,0 +1,362 @@
+/*!
+    \file shm_channel.cpp
+    \brief Shared memory channel implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/shm_channel.h"
+
+#if defined(CPPSERVER_SHM)
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+namespace CppServer {
+namespace Asio {
+
+struct SHMChannel::Header
+{
+    uint64_t magic;
+    uint64_t capacity;
+    // Wakeup flags of the server and the client sides
+    struct alignas(64) Flag { std::atomic<uint32_t> armed; } flags[2];
+};
+
+namespace {
+
+const uint64_t SHM_MAGIC = 0x4D48535245565253ull;
+
+#if defined(CPPSERVER_SHM)
+
+asio::error_code LastError()
+{
+    return asio::error_code(errno, asio::error::get_system_category());
+}
+
+int CreateMemory(size_t size)
+{
+#if defined(SYS_memfd_create)
+    // Create the anonymous shared memory file
+    int handle = (int)syscall(SYS_memfd_create, "cppserver-shm", MFD_CLOEXEC);
+#else
+    errno = ENOSYS;
+    int handle = -1;
+#endif
+    if (handle < 0)
+        return -1;
+
+    if (ftruncate(handle, (off_t)size) != 0)
+    {
+        int error = errno;
+        close(handle);
+        errno = error;
+        return -1;
+    }
+
+    return handle;
+}
+
+#endif
+
+} // namespace
+
+SHMChannel::SHMChannel() noexcept
+    : _header(nullptr),
+      _memory(nullptr),
+      _size(0),
+      _side(0),
+      _memory_handle(-1),
+      _local_event(-1),
+      _remote_event(-1)
+{
+}
+
+bool SHMChannel::IsSupported() noexcept
+{
+#if defined(CPPSERVER_SHM) && defined(SYS_memfd_create)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool SHMChannel::Create(size_t capacity, asio::error_code& ec)
+{
+    Close();
+
+#if defined(CPPSERVER_SHM)
+    // Round up the ring capacity to a power of two
+    size_t ring = 4096;
+    while (ring < capacity)
+        ring <<= 1;
+
+    size_t size = sizeof(Header) + 2 * SHMRing::Size(ring);
+
+    // Create the shared memory and wakeup events
+    _memory_handle = CreateMemory(size);
+    _local_event = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    _remote_event = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if ((_memory_handle < 0) || (_local_event < 0) || (_remote_event < 0))
+    {
+        ec = LastError();
+        Close();
+        return false;
+    }
+
+    // The server side owns the first ring for output
+    _side = 0;
+    if (!Map(size, true, ec))
+    {
+        Close();
+        return false;
+    }
+
+    // Initialize the shared memory header
+    _header->magic = SHM_MAGIC;
+    _header->capacity = ring;
+    _header->flags[0].armed.store(0, std::memory_order_relaxed);
+    _header->flags[1].armed.store(0, std::memory_order_release);
+
+    ec.clear();
+    return true;
+#else
+    ec = asio::error::operation_not_supported;
+    return false;
+#endif
+}
+
+bool SHMChannel::SendHandles(int socket, asio::error_code& ec)
+{
+#if defined(CPPSERVER_SHM)
+    if (!IsOpened())
+    {
+        ec = asio::error::bad_descriptor;
+        return false;
+    }
+
+    int handles[3] = { _memory_handle, _local_event, _remote_event };
+    char control[CMSG_SPACE(sizeof(handles))];
+    std::memset(control, 0, sizeof(control));
+
+    // Prepare the message with the channel handles
+    char payload = 0;
+    iovec iov = { &payload, sizeof(payload) };
+    msghdr message = {};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(handles));
+    std::memcpy(CMSG_DATA(header), handles, sizeof(handles));
+
+    // Send the message
+    ssize_t result;
+    do
+    {
+        result = sendmsg(socket, &message, MSG_NOSIGNAL);
+    } while ((result < 0) && (errno == EINTR));
+
+    if (result < 0)
+    {
+        ec = LastError();
+        return false;
+    }
+
+    ec.clear();
+    return true;
+#else
+    ec = asio::error::operation_not_supported;
+    return false;
+#endif
+}
+
+bool SHMChannel::ReceiveHandles(int socket, asio::error_code& ec)
+{
+    Close();
+
+#if defined(CPPSERVER_SHM)
+    int handles[3] = { -1, -1, -1 };
+    char control[CMSG_SPACE(sizeof(handles))];
+    std::memset(control, 0, sizeof(control));
+
+    // Prepare the message to receive the channel handles
+    char payload = 0;
+    iovec iov = { &payload, sizeof(payload) };
+    msghdr message = {};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    // Receive the message
+    ssize_t result;
+    do
+    {
+        result = recvmsg(socket, &message, MSG_CMSG_CLOEXEC);
+    } while ((result < 0) && (errno == EINTR));
+
+    if (result <= 0)
+    {
+        ec = (result == 0) ? asio::error::eof : LastError();
+        return false;
+    }
+
+    // Extract the channel handles
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    if ((header == nullptr) || (header->cmsg_level != SOL_SOCKET) || (header->cmsg_type != SCM_RIGHTS) || (header->cmsg_len != CMSG_LEN(sizeof(handles))))
+    {
+        ec = asio::error::invalid_argument;
+        return false;
+    }
+    std::memcpy(handles, CMSG_DATA(header), sizeof(handles));
+
+    // The client side uses the server events in the opposite way
+    _side = 1;
+    _memory_handle = handles[0];
+    _local_event = handles[2];
+    _remote_event = handles[1];
+
+    struct stat info;
+    if (fstat(_memory_handle, &info) != 0)
+    {
+        ec = LastError();
+        Close();
+        return false;
+    }
+
+    if (!Map((size_t)info.st_size, false, ec))
+    {
+        Close();
+        return false;
+    }
+
+    ec.clear();
+    return true;
+#else
+    ec = asio::error::operation_not_supported;
+    return false;
+#endif
+}
+
+bool SHMChannel::Map(size_t size, bool initialize, asio::error_code& ec)
+{
+#if defined(CPPSERVER_SHM)
+    // Map the shared memory segment
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _memory_handle, 0);
+    if (memory == MAP_FAILED)
+    {
+        ec = LastError();
+        return false;
+    }
+
+    _memory = memory;
+    _size = size;
+    _header = initialize ? new (memory) Header() : (Header*)memory;
+
+    // Validate the shared memory header
+    size_t capacity = initialize ? (size - sizeof(Header)) / 2 - SHMRing::Size(0) : (size_t)_header->capacity;
+    if (!initialize && ((_header->magic != SHM_MAGIC) || (capacity == 0) || ((capacity & (capacity - 1)) != 0) || ((sizeof(Header) + 2 * SHMRing::Size(capacity)) != size)))
+    {
+        ec = asio::error::invalid_argument;
+        return false;
+    }
+
+    // Attach ring buffers: the first ring is the server output
+    uint8_t* rings[2] = { (uint8_t*)memory + sizeof(Header), (uint8_t*)memory + sizeof(Header) + SHMRing::Size(capacity) };
+    _output.Attach(rings[_side], capacity, initialize);
+    _input.Attach(rings[1 - _side], capacity, initialize);
+
+    return true;
+#else
+    ec = asio::error::operation_not_supported;
+    return false;
+#endif
+}
+
+void SHMChannel::Close()
+{
+    // Detach ring buffers
+    _input.Detach();
+    _output.Detach();
+
+#if defined(CPPSERVER_SHM)
+    // Unmap the shared memory segment
+    if (_memory != nullptr)
+        munmap(_memory, _size);
+
+    // Close the channel handles
+    if (_memory_handle >= 0)
+        close(_memory_handle);
+    if (_local_event >= 0)
+        close(_local_event);
+    if (_remote_event >= 0)
+        close(_remote_event);
+#endif
+
+    _header = nullptr;
+    _memory = nullptr;
+    _size = 0;
+    _memory_handle = -1;
+    _local_event = -1;
+    _remote_event = -1;
+}
+
+void SHMChannel::Arm() noexcept
+{
+    if (_header == nullptr)
+        return;
+
+    _header->flags[_side].armed.store(1, std::memory_order_relaxed);
+
+    // Order the flag store before the next check of the rings
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void SHMChannel::Disarm() noexcept
+{
+    if (_header == nullptr)
+        return;
+
+    _header->flags[_side].armed.store(0, std::memory_order_relaxed);
+}
+
+void SHMChannel::Notify() noexcept
+{
+    if (_header == nullptr)
+        return;
+
+    // Order the previous ring update before the check of the other side flag
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    auto& flag = _header->flags[1 - _side].armed;
+    if ((flag.load(std::memory_order_relaxed) == 0) || (flag.exchange(0, std::memory_order_acq_rel) == 0))
+        return;
+
+#if defined(CPPSERVER_SHM)
+    // Signal the wakeup event of the other side
+    uint64_t value = 1;
+    ssize_t result;
+    do
+    {
+        result = write(_remote_event, &value, sizeof(value));
+    } while ((result < 0) && (errno == EINTR));
+#endif
+}
+
+} // namespace Asio
+} // namespace CppServer
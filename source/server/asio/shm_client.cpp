@@ -0,0 +1,566 @@
+/*!
+    \file shm_client.cpp
+    \brief Shared memory client implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/shm_client.h"
+
+#if defined(CPPSERVER_SHM)
+
+#include <unistd.h>
+
+namespace CppServer {
+namespace Asio {
+
+SHMClient::SHMClient(const std::shared_ptr<Service>& service, const std::string& path)
+    : _id(CppCommon::UUID::Sequential()),
+      _service(service),
+      _io_service(_service->GetAsioService()),
+      _strand(*_io_service),
+      _strand_required(_service->IsStrandRequired()),
+      _path(path),
+      _endpoint(path),
+      _socket(*_io_service),
+      _connecting(false),
+      _connected(false),
+      _control_buffer(0),
+      _event(*_io_service),
+      _event_buffer(0),
+      _receiving(false),
+      _busy_polling(0),
+      _bytes_pending(0),
+      _bytes_sent(0),
+      _bytes_received(0),
+      _send_buffer_offset(0)
+{
+    assert((service != nullptr) && "Asio service is invalid!");
+    if (service == nullptr)
+        throw CppCommon::ArgumentException("Asio service is invalid!");
+}
+
+SHMClient::SHMClient(const std::shared_ptr<Service>& service, const asio::local::stream_protocol::endpoint& endpoint)
+    : _id(CppCommon::UUID::Sequential()),
+      _service(service),
+      _io_service(_service->GetAsioService()),
+      _strand(*_io_service),
+      _strand_required(_service->IsStrandRequired()),
+      _path(endpoint.path()),
+      _endpoint(endpoint),
+      _socket(*_io_service),
+      _connecting(false),
+      _connected(false),
+      _control_buffer(0),
+      _event(*_io_service),
+      _event_buffer(0),
+      _receiving(false),
+      _busy_polling(0),
+      _bytes_pending(0),
+      _bytes_sent(0),
+      _bytes_received(0),
+      _send_buffer_offset(0)
+{
+    assert((service != nullptr) && "Asio service is invalid!");
+    if (service == nullptr)
+        throw CppCommon::ArgumentException("Asio service is invalid!");
+}
+
+bool SHMClient::Connect()
+{
+    if (IsConnected())
+        return false;
+
+    asio::error_code ec;
+
+    // Connect to the server and open the shared memory channel
+    _socket.connect(_endpoint, ec);
+    if (!ec)
+        _socket.wait(asio::local::stream_protocol::socket::wait_read, ec);
+    if (!ec)
+        OpenChannel(ec);
+
+    // Disconnect on error
+    if (ec)
+    {
+        SendError(ec);
+
+        asio::error_code ignore;
+        _socket.close(ignore);
+
+        // Call the client disconnected handler
+        onDisconnected();
+
+        return false;
+    }
+
+    // Complete the client connection
+    Connected();
+
+    return true;
+}
+
+bool SHMClient::DisconnectInternal()
+{
+    if (!IsConnected())
+        return false;
+
+    asio::error_code ec;
+
+    // Close the client control socket and the wakeup event
+    _socket.close(ec);
+    _event.close(ec);
+
+    // Update the connected flag
+    _connecting = false;
+    _connected = false;
+
+    // Clear send/receive buffers
+    ClearBuffers();
+
+    // Call the client disconnected handler
+    onDisconnected();
+
+    return true;
+}
+
+bool SHMClient::Reconnect()
+{
+    if (!Disconnect())
+        return false;
+
+    return Connect();
+}
+
+bool SHMClient::ConnectAsync()
+{
+    if (IsConnected() || _connecting)
+        return false;
+
+    // Post the connect handler
+    auto self(this->shared_from_this());
+    auto connect_handler = [this, self]()
+    {
+        if (IsConnected() || _connecting)
+            return;
+
+        // Async connect with the connect handler
+        _connecting = true;
+        auto async_connect_handler = [this, self](std::error_code ec)
+        {
+            if (IsConnected())
+                return;
+
+            // Async wait for the shared memory channel with the wait handler
+            auto async_wait_handler = [this, self](std::error_code ec)
+            {
+                _connecting = false;
+
+                if (IsConnected())
+                    return;
+
+                // Open the shared memory channel
+                if (!ec)
+                    OpenChannel(ec);
+
+                if (!ec)
+                {
+                    // Complete the client connection
+                    Connected();
+                }
+                else
+                {
+                    SendError(ec);
+
+                    asio::error_code ignore;
+                    _socket.close(ignore);
+
+                    // Call the client disconnected handler
+                    onDisconnected();
+                }
+            };
+
+            if (ec)
+                async_wait_handler(ec);
+            else if (_strand_required)
+                _socket.async_wait(asio::local::stream_protocol::socket::wait_read, bind_executor(_strand, async_wait_handler));
+            else
+                _socket.async_wait(asio::local::stream_protocol::socket::wait_read, async_wait_handler);
+        };
+
+        if (_strand_required)
+            _socket.async_connect(_endpoint, bind_executor(_strand, async_connect_handler));
+        else
+            _socket.async_connect(_endpoint, async_connect_handler);
+    };
+    if (_strand_required)
+        _strand.post(connect_handler);
+    else
+        _io_service->post(connect_handler);
+
+    return true;
+}
+
+bool SHMClient::DisconnectInternalAsync(bool dispatch)
+{
+    if (!IsConnected() || _connecting)
+        return false;
+
+    asio::error_code ec;
+
+    // Cancel the client control socket
+    _socket.cancel(ec);
+
+    // Dispatch or post the disconnect handler
+    auto self(this->shared_from_this());
+    auto disconnect_handler = [this, self]() { DisconnectInternal(); };
+    if (_strand_required)
+    {
+        if (dispatch)
+            _strand.dispatch(disconnect_handler);
+        else
+            _strand.post(disconnect_handler);
+    }
+    else
+    {
+        if (dispatch)
+            _io_service->dispatch(disconnect_handler);
+        else
+            _io_service->post(disconnect_handler);
+    }
+
+    return true;
+}
+
+bool SHMClient::ReconnectAsync()
+{
+    if (!DisconnectAsync())
+        return false;
+
+    while (IsConnected())
+        CppCommon::Thread::Yield();
+
+    return ConnectAsync();
+}
+
+bool SHMClient::OpenChannel(asio::error_code& ec)
+{
+    // Receive the shared memory channel from the server
+    if (!_channel.ReceiveHandles((int)_socket.native_handle(), ec))
+        return false;
+
+    // Wait for the wakeup events of the channel
+    _event.assign(dup(_channel.event()), ec);
+    if (ec)
+    {
+        _channel.Close();
+        return false;
+    }
+
+    return true;
+}
+
+void SHMClient::Connected()
+{
+    // Reset statistic
+    _bytes_pending = 0;
+    _bytes_sent = 0;
+    _bytes_received = 0;
+
+    // Update the connected flag
+    _connected = true;
+
+    // Wait for the server disconnect
+    TryControl();
+
+    // Call the client connected handler
+    onConnected();
+
+    // Call the empty send buffer handler
+    if (_send_buffer.empty())
+        onEmpty();
+
+    // Post the process handler
+    auto self(this->shared_from_this());
+    auto process_handler = [this, self]() { TryProcess(); };
+    if (_strand_required)
+        _strand.post(process_handler);
+    else
+        _io_service->post(process_handler);
+}
+
+bool SHMClient::SendAsync(const void* buffer, size_t size)
+{
+    if (!IsConnected())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    {
+        std::scoped_lock locker(_send_lock);
+
+        // Detect multiple send handlers
+        bool send_required = _send_buffer.empty();
+
+        // Check the send buffer limit
+        if ((((_send_buffer.size() - _send_buffer_offset) + size) > _send_buffer_limit) && (_send_buffer_limit > 0))
+        {
+            SendError(asio::error::no_buffer_space);
+            return false;
+        }
+
+        // Fill the send buffer
+        const uint8_t* bytes = (const uint8_t*)buffer;
+        _send_buffer.insert(_send_buffer.end(), bytes, bytes + size);
+
+        // Update statistic
+        _bytes_pending += size;
+
+        // Avoid multiple send handlers
+        if (!send_required)
+            return true;
+    }
+
+    // Dispatch the send handler
+    auto self(this->shared_from_this());
+    auto send_handler = [this, self]()
+    {
+        // Try to send the send buffer
+        TrySend();
+    };
+    if (_strand_required)
+        _strand.dispatch(send_handler);
+    else
+        _io_service->dispatch(send_handler);
+
+    return true;
+}
+
+void SHMClient::TryControl()
+{
+    if (!IsConnected())
+        return;
+
+    // Async receive with the control handler
+    auto self(this->shared_from_this());
+    auto async_control_handler = make_alloc_handler(_control_storage, [this, self](std::error_code ec, size_t size)
+    {
+        if (!IsConnected())
+            return;
+
+        // Receive the rest of data left by the server in the input ring buffer
+        TryReceive();
+
+        // The server never writes into the control socket, so any result means disconnect
+        if (ec)
+            SendError(ec);
+        DisconnectInternalAsync(true);
+    });
+    if (_strand_required)
+        _socket.async_read_some(asio::buffer(&_control_buffer, sizeof(_control_buffer)), bind_executor(_strand, async_control_handler));
+    else
+        _socket.async_read_some(asio::buffer(&_control_buffer, sizeof(_control_buffer)), async_control_handler);
+}
+
+void SHMClient::TryProcess()
+{
+    // Do not starve other handlers of the Asio service
+    const size_t rounds_limit = 64;
+
+    size_t rounds = 0;
+    size_t spins = 0;
+
+    _channel.Disarm();
+
+    while (IsConnected())
+    {
+        // Receive and send everything possible
+        bool received = TryReceive();
+        bool sent = TrySend();
+        if (received || sent)
+        {
+            spins = 0;
+            if (++rounds < rounds_limit)
+                continue;
+
+            // Post the process handler to continue later
+            auto self(this->shared_from_this());
+            auto process_handler = [this, self]() { TryProcess(); };
+            if (_strand_required)
+                _strand.post(process_handler);
+            else
+                _io_service->post(process_handler);
+            return;
+        }
+
+        // Busy poll the channel for a while
+        if (spins++ < _busy_polling)
+            continue;
+
+        // Arm the wakeup and check the channel once again to avoid the lost wakeup
+        _channel.Arm();
+        if (IsReady())
+        {
+            _channel.Disarm();
+            continue;
+        }
+
+        // Wait for the wakeup event from the server
+        TryWait();
+        return;
+    }
+}
+
+void SHMClient::TryWait()
+{
+    if (!IsConnected())
+        return;
+
+    // Async read the wakeup event with the wait handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_event_storage, [this, self](std::error_code ec, size_t size)
+    {
+        if (!IsConnected())
+            return;
+
+        // Process the channel if the client is valid
+        if (!ec)
+            TryProcess();
+        else
+        {
+            SendError(ec);
+            DisconnectInternalAsync(true);
+        }
+    });
+    if (_strand_required)
+        _event.async_read_some(asio::buffer(&_event_buffer, sizeof(_event_buffer)), bind_executor(_strand, async_wait_handler));
+    else
+        _event.async_read_some(asio::buffer(&_event_buffer, sizeof(_event_buffer)), async_wait_handler);
+}
+
+bool SHMClient::TryReceive()
+{
+    // Only one consumer of the input ring buffer is allowed
+    if (_receiving.exchange(true))
+        return false;
+
+    bool received = false;
+
+    const void* buffer;
+    size_t size;
+    while (IsConnected() && ((size = _channel.input().Peek(buffer)) > 0))
+    {
+        // Update statistic
+        _bytes_received += size;
+
+        // Call the buffer received handler
+        onReceived(buffer, size);
+
+        // Release the received data in the input ring buffer
+        _channel.input().Consume(size);
+        received = true;
+    }
+
+    // Wake up the server waiting for the free space in the ring buffer
+    if (received)
+        _channel.Notify();
+
+    _receiving = false;
+
+    return received;
+}
+
+bool SHMClient::TrySend()
+{
+    if (!IsConnected())
+        return false;
+
+    size_t sent;
+    size_t pending;
+
+    {
+        std::scoped_lock locker(_send_lock);
+
+        if (_send_buffer.empty())
+            return false;
+
+        // Write pending data into the output ring buffer
+        sent = _channel.output().Write(_send_buffer.data() + _send_buffer_offset, _send_buffer.size() - _send_buffer_offset);
+        if (sent == 0)
+            return false;
+
+        // Successfully send the whole send buffer
+        _send_buffer_offset += sent;
+        if (_send_buffer_offset == _send_buffer.size())
+        {
+            _send_buffer.clear();
+            _send_buffer_offset = 0;
+        }
+
+        // Update statistic
+        _bytes_pending -= sent;
+        _bytes_sent += sent;
+
+        pending = _bytes_pending;
+    }
+
+    // Wake up the server waiting for new data
+    _channel.Notify();
+
+    // Call the buffer sent handler
+    onSent(sent, pending);
+
+    // Call the empty send buffer handler
+    if (pending == 0)
+        onEmpty();
+
+    return true;
+}
+
+bool SHMClient::IsReady()
+{
+    if (!_channel.input().empty())
+        return true;
+
+    std::scoped_lock locker(_send_lock);
+
+    return !_send_buffer.empty() && (_channel.output().free() > 0);
+}
+
+void SHMClient::ClearBuffers()
+{
+    {
+        std::scoped_lock locker(_send_lock);
+
+        // Clear send buffer
+        _send_buffer.clear();
+        _send_buffer_offset = 0;
+
+        // Update statistic
+        _bytes_pending = 0;
+    }
+}
+
+void SHMClient::SendError(std::error_code ec)
+{
+    // Skip Asio disconnect errors
+    if ((ec == asio::error::connection_aborted) ||
+        (ec == asio::error::connection_refused) ||
+        (ec == asio::error::connection_reset) ||
+        (ec == asio::error::eof) ||
+        (ec == asio::error::operation_aborted))
+        return;
+
+    onError(ec.value(), ec.category().name(), ec.message());
+}
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_SHM
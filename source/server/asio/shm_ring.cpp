@@ -0,0 +1,135 @@
+/*!
+    \file shm_ring.cpp
+    \brief Shared memory ring buffer implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/shm_ring.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <new>
+
+namespace CppServer {
+namespace Asio {
+
+SHMRing::SHMRing(void* memory, size_t capacity, bool initialize) noexcept
+    : SHMRing()
+{
+    Attach(memory, capacity, initialize);
+}
+
+void SHMRing::Attach(void* memory, size_t capacity, bool initialize) noexcept
+{
+    assert((memory != nullptr) && "Ring buffer memory should not be null!");
+    assert((capacity > 0) && ((capacity & (capacity - 1)) == 0) && "Ring buffer capacity must be a power of two!");
+
+    _header = initialize ? new (memory) Header() : (Header*)memory;
+    _buffer = (uint8_t*)memory + sizeof(Header);
+    _capacity = capacity;
+    _mask = capacity - 1;
+
+    // Initialize the ring header
+    if (initialize)
+    {
+        _header->head.store(0, std::memory_order_relaxed);
+        _header->tail.store(0, std::memory_order_relaxed);
+    }
+
+    // Initialize cached indexes
+    _tail_cache = _header->tail.load(std::memory_order_acquire);
+    _head_cache = _header->head.load(std::memory_order_acquire);
+}
+
+void SHMRing::Detach() noexcept
+{
+    _header = nullptr;
+    _buffer = nullptr;
+    _capacity = 0;
+    _mask = 0;
+    _tail_cache = 0;
+    _head_cache = 0;
+}
+
+size_t SHMRing::size() const noexcept
+{
+    if (_header == nullptr)
+        return 0;
+
+    uint64_t head = _header->head.load(std::memory_order_acquire);
+    uint64_t tail = _header->tail.load(std::memory_order_acquire);
+    return (size_t)(head - tail);
+}
+
+size_t SHMRing::Write(const void* buffer, size_t size) noexcept
+{
+    if ((_header == nullptr) || (size == 0))
+        return 0;
+
+    uint64_t head = _header->head.load(std::memory_order_relaxed);
+
+    // Reload the consumer index only when the ring buffer looks full
+    size_t available = _capacity - (size_t)(head - _tail_cache);
+    if (available < size)
+    {
+        _tail_cache = _header->tail.load(std::memory_order_acquire);
+        available = _capacity - (size_t)(head - _tail_cache);
+    }
+
+    size = std::min(size, available);
+    if (size == 0)
+        return 0;
+
+    // Copy data with the wrap around the end of the ring buffer
+    size_t offset = (size_t)(head & _mask);
+    size_t first = std::min(size, _capacity - offset);
+    std::memcpy(_buffer + offset, buffer, first);
+    if (first < size)
+        std::memcpy(_buffer, (const uint8_t*)buffer + first, size - first);
+
+    // Publish written data to the consumer
+    _header->head.store(head + size, std::memory_order_release);
+
+    return size;
+}
+
+size_t SHMRing::Peek(const void*& buffer) noexcept
+{
+    buffer = nullptr;
+
+    if (_header == nullptr)
+        return 0;
+
+    uint64_t tail = _header->tail.load(std::memory_order_relaxed);
+
+    // Reload the producer index only when the ring buffer looks empty
+    if (_head_cache == tail)
+    {
+        _head_cache = _header->head.load(std::memory_order_acquire);
+        if (_head_cache == tail)
+            return 0;
+    }
+
+    // Return the continuous block up to the end of the ring buffer
+    size_t offset = (size_t)(tail & _mask);
+    buffer = _buffer + offset;
+    return std::min((size_t)(_head_cache - tail), _capacity - offset);
+}
+
+void SHMRing::Consume(size_t size) noexcept
+{
+    if ((_header == nullptr) || (size == 0))
+        return;
+
+    uint64_t tail = _header->tail.load(std::memory_order_relaxed);
+    assert((size <= (size_t)(_head_cache - tail)) && "Consumed size should not exceed the peeked size!");
+
+    // Release consumed space to the producer
+    _header->tail.store(tail + size, std::memory_order_release);
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -8,6 +8,11 @@
 
 #include "server/asio/ssl_client.h"
 
+#include "time/timestamp.h"
+
+#include <random>
+#include <utility>
+
 namespace CppServer {
 namespace Asio {
 
@@ -338,6 +343,9 @@ bool SSLClient::DisconnectInternal()
     // Call the client disconnected handler
     onDisconnected();
 
+    // Schedule the next auto-reconnect attempt
+    ScheduleReconnect();
+
     return true;
 }
 
@@ -354,6 +362,9 @@ bool SSLClient::ConnectAsync()
     if (IsConnected() || IsHandshaked() || _resolving || _connecting || _handshaking)
         return false;
 
+    // Arm auto-reconnect
+    StartReconnect(nullptr);
+
     // Post the connect handler
     auto self(this->shared_from_this());
     auto connect_handler = make_alloc_handler(_connect_storage, [this, self]()
@@ -396,6 +407,7 @@ bool SSLClient::ConnectAsync()
 
                 // Update the connected flag
                 _connected = true;
+                _fast_open_pending = option_fast_open();
 
                 // Call the client connected handler
                 onConnected();
@@ -420,9 +432,14 @@ bool SSLClient::ConnectAsync()
                         // Call the client handshaked handler
                         onHandshaked();
 
-                        // Call the empty send buffer handler
+                        // Complete auto-reconnect
+                        CompleteReconnect();
+
+                        // Call the empty send buffer handler or send data preserved across reconnects
                         if (_send_buffer_main.empty())
                             onEmpty();
+                        else
+                            TrySend();
                     }
                     else
                     {
@@ -442,12 +459,24 @@ bool SSLClient::ConnectAsync()
 
                 // Call the client disconnected handler
                 onDisconnected();
+
+                // Schedule the next auto-reconnect attempt
+                ScheduleReconnect();
             }
         });
 
         // Create the server endpoint
         _endpoint = asio::ip::tcp::endpoint(asio::ip::make_address(_address), (unsigned short)_port);
 
+        // Apply the option: TCP Fast Open
+        if (option_fast_open())
+        {
+            asio::error_code ignored;
+            if (!socket().is_open())
+                socket().open(_endpoint.protocol(), ignored);
+            FastOpen::EnableClient(socket());
+        }
+
         if (_strand_required)
             socket().async_connect(_endpoint, bind_executor(_strand, async_connect_handler));
         else
@@ -466,6 +495,9 @@ bool SSLClient::ConnectAsync(const std::shared_ptr<TCPResolver>& resolver)
     if (IsConnected() || IsHandshaked() || _resolving || _connecting || _handshaking)
         return false;
 
+    // Arm auto-reconnect
+    StartReconnect(resolver);
+
     // Post the connect handler
     auto self(this->shared_from_this());
     auto connect_handler = make_alloc_handler(_connect_storage, [this, self, resolver]()
@@ -522,6 +554,7 @@ bool SSLClient::ConnectAsync(const std::shared_ptr<TCPResolver>& resolver)
 
                         // Update the connected flag
                         _connected = true;
+                        _fast_open_pending = option_fast_open();
 
                         // Call the client connected handler
                         onConnected();
@@ -546,9 +579,14 @@ bool SSLClient::ConnectAsync(const std::shared_ptr<TCPResolver>& resolver)
                                 // Call the client handshaked handler
                                 onHandshaked();
 
-                                // Call the empty send buffer handler
+                                // Complete auto-reconnect
+                                CompleteReconnect();
+
+                                // Call the empty send buffer handler or send data preserved across reconnects
                                 if (_send_buffer_main.empty())
                                     onEmpty();
+                                else
+                                    TrySend();
                             }
                             else
                             {
@@ -568,9 +606,21 @@ bool SSLClient::ConnectAsync(const std::shared_ptr<TCPResolver>& resolver)
 
                         // Call the client disconnected handler
                         onDisconnected();
+
+                        // Schedule the next auto-reconnect attempt
+                        ScheduleReconnect();
                     }
                 });
-                if (_strand_required)
+                if (option_connect_stagger().total() > 0)
+                {
+                    // Happy Eyeballs parallel connect to the fastest reachable endpoint
+                    auto connector = std::make_shared<TCPConnector>(_io_service, option_connect_stagger(), option_connect_attempt_timeout(), option_fast_open());
+                    if (_strand_required)
+                        connector->ConnectAsync(socket(), endpoints, [this, self, async_connect_handler](std::error_code ec2, const asio::ip::tcp::endpoint& endpoint) { _strand.dispatch([async_connect_handler, ec2, endpoint]() mutable { async_connect_handler(ec2, endpoint); }); });
+                    else
+                        connector->ConnectAsync(socket(), endpoints, async_connect_handler);
+                }
+                else if (_strand_required)
                     asio::async_connect(socket(), endpoints, bind_executor(_strand, async_connect_handler));
                 else
                     asio::async_connect(socket(), endpoints, async_connect_handler);
@@ -581,15 +631,21 @@ bool SSLClient::ConnectAsync(const std::shared_ptr<TCPResolver>& resolver)
 
                 // Call the client disconnected handler
                 onDisconnected();
+
+                // Schedule the next auto-reconnect attempt
+                ScheduleReconnect();
             }
         });
 
         // Resolve the server endpoint
-        asio::ip::tcp::resolver::query query(_address, (_scheme.empty() ? std::to_string(_port) : _scheme));
-        if (_strand_required)
-            resolver->resolver().async_resolve(query, bind_executor(_strand, async_resolve_handler));
-        else
-            resolver->resolver().async_resolve(query, async_resolve_handler);
+        auto resolve_handler = [this, self, async_resolve_handler](std::error_code ec1, const asio::ip::tcp::resolver::results_type& endpoints) mutable
+        {
+            if (_strand_required)
+                _strand.dispatch([async_resolve_handler, ec1, endpoints]() mutable { async_resolve_handler(ec1, endpoints); });
+            else
+                async_resolve_handler(ec1, endpoints);
+        };
+        resolver->ResolveAsync(_address, (_scheme.empty() ? std::to_string(_port) : _scheme), resolve_handler);
     });
     if (_strand_required)
         _strand.post(connect_handler);
@@ -752,7 +808,7 @@ size_t SSLClient::Send(const void* buffer, size_t size, const CppCommon::Timespa
 
 bool SSLClient::SendAsync(const void* buffer, size_t size)
 {
-    if (!IsHandshaked())
+    if (!IsHandshaked() && !IsSendBufferPreserved())
         return false;
 
     if (size == 0)
@@ -941,6 +997,14 @@ void SSLClient::TryReceive()
         // Received some data from the server
         if (size > 0)
         {
+            // Update TCP Fast Open statistic after the first received data
+            if (_fast_open_pending)
+            {
+                _fast_open_pending = false;
+                if (FastOpen::IsUsed(socket()))
+                    ++_fast_open_connects;
+            }
+
             // Update statistic
             _bytes_received += size;
 
@@ -1054,18 +1118,127 @@ void SSLClient::TrySend()
         _stream.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), async_write_handler);
 }
 
+void SSLClient::StartReconnect(const std::shared_ptr<TCPResolver>& resolver)
+{
+    std::scoped_lock locker(_reconnect_lock);
+
+    _reconnect_resolver = resolver;
+    _reconnect_armed = true;
+}
+
+void SSLClient::StopReconnect()
+{
+    std::scoped_lock locker(_reconnect_lock);
+
+    _reconnect_armed = false;
+    _reconnect_token.Cancel();
+    _reconnect_attempt = 0;
+}
+
+void SSLClient::ScheduleReconnect()
+{
+    if (!_option_auto_reconnect || !_reconnect_armed)
+        return;
+
+    uint64_t attempt;
+    uint64_t delay;
+
+    {
+        std::scoped_lock locker(_reconnect_lock);
+
+        // Start tracking the connection recovery time
+        if (_reconnect_attempt++ == 0)
+            _reconnect_timestamp = CppCommon::Timestamp::nano();
+        attempt = _reconnect_attempt;
+        ++_reconnect_attempts;
+
+        // Calculate the exponential backoff delay
+        uint64_t delay_min = (uint64_t)std::max<int64_t>(_option_reconnect_delay_min.total(), 0);
+        uint64_t delay_max = std::max((uint64_t)std::max<int64_t>(_option_reconnect_delay_max.total(), 0), delay_min);
+        delay = delay_min;
+        for (uint64_t i = 1; (i < attempt) && (delay > 0) && (delay < delay_max); ++i)
+            delay *= 2;
+        delay = std::min(delay, delay_max);
+
+        // Reduce the delay by a random jitter
+        if (_option_reconnect_jitter > 0)
+        {
+            thread_local std::minstd_rand generator(std::random_device{}());
+            std::uniform_real_distribution<double> distribution(0.0, _option_reconnect_jitter);
+            delay -= (uint64_t)(delay * distribution(generator));
+        }
+
+        // Schedule the reconnect attempt
+        std::weak_ptr<SSLClient> weak(this->shared_from_this());
+        _reconnect_token = _service->ScheduleAfter(_io_service, CppCommon::Timespan::nanoseconds(delay), [weak]()
+        {
+            auto self = weak.lock();
+            if (!self || !self->_reconnect_armed)
+                return;
+
+            std::shared_ptr<TCPResolver> resolver;
+            {
+                std::scoped_lock locker(self->_reconnect_lock);
+                resolver = self->_reconnect_resolver;
+            }
+
+            // Reconnect with the same DNS resolver
+            if (resolver)
+                self->ConnectAsync(resolver);
+            else
+                self->ConnectAsync();
+        });
+    }
+
+    // Call the client reconnecting handler
+    onReconnecting(attempt, CppCommon::Timespan::nanoseconds(delay));
+}
+
+void SSLClient::CompleteReconnect()
+{
+    uint64_t attempts;
+    uint64_t recovery;
+
+    {
+        std::scoped_lock locker(_reconnect_lock);
+
+        if (_reconnect_attempt == 0)
+            return;
+
+        // Update reconnect statistic
+        attempts = std::exchange(_reconnect_attempt, 0);
+        recovery = CppCommon::Timestamp::nano() - _reconnect_timestamp;
+        _reconnect_recovery = recovery;
+        ++_reconnects;
+    }
+
+    // Call the client reconnected handler
+    onReconnected(attempts, CppCommon::Timespan::nanoseconds(recovery));
+}
+
 void SSLClient::ClearBuffers()
 {
     {
         std::scoped_lock locker(_send_lock);
 
-        // Clear send buffers
-        _send_buffer_main.clear();
+        if (IsSendBufferPreserved())
+        {
+            // Keep unsent data for the next connection. Partially written flush buffer is dropped to keep messages intact.
+            if (_send_buffer_flush_offset == 0)
+                _send_buffer_main.insert(_send_buffer_main.begin(), _send_buffer_flush.begin(), _send_buffer_flush.end());
+        }
+        else
+        {
+            // Clear the main send buffer
+            _send_buffer_main.clear();
+        }
+
+        // Clear the flush send buffer
         _send_buffer_flush.clear();
         _send_buffer_flush_offset = 0;
 
         // Update statistic
-        _bytes_pending = 0;
+        _bytes_pending = _send_buffer_main.size();
         _bytes_sending = 0;
     }
 }
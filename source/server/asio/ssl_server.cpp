@@ -22,12 +22,12 @@ SSLServer::SSLServer(const std::shared_ptr<Service>& service, const std::shared_
       _acceptor(*_io_service),
       _started(false),
       _bytes_pending(0),
-      _bytes_sent(0),
-      _bytes_received(0),
+      _fast_open_sessions(0),
       _option_keep_alive(false),
       _option_no_delay(false),
       _option_reuse_address(false),
-      _option_reuse_port(false)
+      _option_reuse_port(false),
+      _option_fast_open(0)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -61,12 +61,12 @@ SSLServer::SSLServer(const std::shared_ptr<Service>& service, const std::shared_
       _acceptor(*_io_service),
       _started(false),
       _bytes_pending(0),
-      _bytes_sent(0),
-      _bytes_received(0),
+      _fast_open_sessions(0),
       _option_keep_alive(false),
       _option_no_delay(false),
       _option_reuse_address(false),
-      _option_reuse_port(false)
+      _option_reuse_port(false),
+      _option_fast_open(0)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -93,12 +93,12 @@ SSLServer::SSLServer(const std::shared_ptr<Service>& service, const std::shared_
       _acceptor(*_io_service),
       _started(false),
       _bytes_pending(0),
-      _bytes_sent(0),
-      _bytes_received(0),
+      _fast_open_sessions(0),
       _option_keep_alive(false),
       _option_no_delay(false),
       _option_reuse_address(false),
-      _option_reuse_port(false)
+      _option_reuse_port(false),
+      _option_fast_open(0)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -134,13 +134,19 @@ bool SSLServer::Start()
             _acceptor.set_option(reuse_port(true));
         }
 #endif
+        if (option_fast_open() > 0)
+            FastOpen::EnableServer(_acceptor, option_fast_open());
         _acceptor.bind(_endpoint);
         _acceptor.listen();
 
         // Reset statistic
         _bytes_pending = 0;
-        _bytes_sent = 0;
-        _bytes_received = 0;
+        _statistics.Reset();
+        _fast_open_sessions = 0;
+
+        // Reset rate limits
+        _receive_limiter.Reset();
+        _send_limiter.Reset();
 
         // Update the started flag
         _started = true;
@@ -262,11 +268,62 @@ bool SSLServer::Multicast(const void* buffer, size_t size)
     if (buffer == nullptr)
         return false;
 
+    // Copy the multicast data once for all working threads
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    auto data = std::make_shared<const std::vector<uint8_t>>(bytes, bytes + size);
+
     std::shared_lock<std::shared_mutex> locker(_sessions_lock);
 
-    // Multicast all sessions
-    for (auto& session : _sessions)
-        session.second->SendAsync(buffer, size);
+    // Multicast all sessions with a single task per working thread
+    MulticastBatched(service(), _sessions, [data](const std::shared_ptr<SSLSession>& session)
+    {
+        session->SendAsync(data->data(), data->size());
+    });
+
+    return true;
+}
+
+bool SSLServer::MulticastConflated(std::string_view key, const void* buffer, size_t size)
+{
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    // Copy the multicast key and data once for all working threads
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    auto data = std::make_shared<const std::pair<std::string, std::vector<uint8_t>>>(std::string(key), std::vector<uint8_t>(bytes, bytes + size));
+
+    std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+    // Multicast all sessions with conflation with a single task per working thread
+    MulticastBatched(service(), _sessions, [data](const std::shared_ptr<SSLSession>& session)
+    {
+        session->SendConflatedAsync(data->first, data->second.data(), data->second.size());
+    });
+
+    return true;
+}
+
+bool SSLServer::PublishToGroup(std::string_view group, const void* buffer, size_t size)
+{
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    // Publish to group members only
+    _groups.Publish(group, buffer, size);
 
     return true;
 }
@@ -297,6 +354,20 @@ bool SSLServer::DisconnectAll()
     return true;
 }
 
+ServerStatisticsSnapshot SSLServer::statistics()
+{
+    ServerStatisticsSnapshot snapshot;
+
+    {
+        std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+        snapshot.connected_sessions = _sessions.size();
+    }
+
+    _statistics.Snapshot(snapshot);
+
+    return snapshot;
+}
+
 std::shared_ptr<SSLSession> SSLServer::FindSession(const CppCommon::UUID& id)
 {
     std::shared_lock<std::shared_mutex> locker(_sessions_lock);
@@ -322,6 +393,9 @@ void SSLServer::UnregisterSession(const CppCommon::UUID& id)
     auto it = _sessions.find(id);
     if (it != _sessions.end())
     {
+        // Leave all subscription groups
+        _groups.LeaveAll(it->second);
+
         // Erase the session
         _sessions.erase(it);
     }
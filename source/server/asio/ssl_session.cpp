@@ -9,6 +9,8 @@
 #include "server/asio/ssl_session.h"
 #include "server/asio/ssl_server.h"
 
+#include "time/timestamp.h"
+
 namespace CppServer {
 namespace Asio {
 
@@ -27,7 +29,9 @@ SSLSession::SSLSession(const std::shared_ptr<SSLServer>& server)
       _bytes_received(0),
       _receiving(false),
       _sending(false),
-      _send_buffer_flush_offset(0)
+      _send_buffer_flush_offset(0),
+      _receive_throttled(false),
+      _send_throttled(false)
 {
 }
 
@@ -66,6 +70,10 @@ void SSLSession::Connect()
     if (_server->option_no_delay())
         socket().set_option(asio::ip::tcp::no_delay(true));
 
+    // Update TCP Fast Open statistic
+    if ((_server->option_fast_open() > 0) && FastOpen::IsUsed(socket()))
+        ++_server->_fast_open_sessions;
+
     // Prepare receive & send buffers
     _receive_buffer.resize(option_receive_buffer_size());
     _send_buffer_main.reserve(option_send_buffer_size());
@@ -75,8 +83,13 @@ void SSLSession::Connect()
     _bytes_pending = 0;
     _bytes_sending = 0;
     _bytes_sent = 0;
+    _bytes_sent_main = 0;
     _bytes_received = 0;
 
+    // Reset throttling flags
+    _receive_throttled = false;
+    _send_throttled = false;
+
     // Update the connected flag
     _connected = true;
 
@@ -208,6 +221,16 @@ bool SSLSession::DisconnectAsync(bool dispatch)
     return true;
 }
 
+bool SSLSession::JoinGroup(std::string_view group)
+{
+    return _server->JoinGroup(group, this->shared_from_this());
+}
+
+bool SSLSession::LeaveGroup(std::string_view group)
+{
+    return _server->LeaveGroup(group, this->shared_from_this());
+}
+
 size_t SSLSession::Send(const void* buffer, size_t size)
 {
     if (!IsHandshaked())
@@ -228,7 +251,7 @@ size_t SSLSession::Send(const void* buffer, size_t size)
     {
         // Update statistic
         _bytes_sent += sent;
-        _server->_bytes_sent += sent;
+        _server->_statistics.AddBytesSent(sent);
 
         // Call the buffer sent handler
         onSent(sent, bytes_pending());
@@ -292,7 +315,7 @@ size_t SSLSession::Send(const void* buffer, size_t size, const CppCommon::Timesp
     {
         // Update statistic
         _bytes_sent += sent;
-        _server->_bytes_sent += sent;
+        _server->_statistics.AddBytesSent(sent);
 
         // Call the buffer sent handler
         onSent(sent, bytes_pending());
@@ -308,7 +331,7 @@ size_t SSLSession::Send(const void* buffer, size_t size, const CppCommon::Timesp
     return sent;
 }
 
-bool SSLSession::SendAsync(const void* buffer, size_t size)
+bool SSLSession::SendAsync(const void* buffer, size_t size, SendPriority priority)
 {
     if (!IsHandshaked())
         return false;
@@ -324,21 +347,38 @@ bool SSLSession::SendAsync(const void* buffer, size_t size)
         std::scoped_lock locker(_send_lock);
 
         // Detect multiple send handlers
-        bool send_required = _send_buffer_main.empty() || _send_buffer_flush.empty();
+        bool send_required = (_send_buffer_main.empty() && _send_buffer_high.empty() && _send_conflated.empty()) || _send_buffer_flush.empty();
 
         // Check the send buffer limit
-        if (((_send_buffer_main.size() + size) > _send_buffer_limit) && (_send_buffer_limit > 0))
+        if (((_send_buffer_main.size() - _send_buffer_main_offset + _send_buffer_high.size() + _send_conflated_size + size) > _send_buffer_limit) && (_send_buffer_limit > 0))
         {
             SendError(asio::error::no_buffer_space);
             return false;
         }
 
-        // Fill the main send buffer
+        // Fill the send buffer of the given priority lane
         const uint8_t* bytes = (const uint8_t*)buffer;
-        _send_buffer_main.insert(_send_buffer_main.end(), bytes, bytes + size);
+        std::vector<uint8_t>& send_buffer = (priority == SendPriority::High) ? _send_buffer_high : _send_buffer_main;
+        send_buffer.insert(send_buffer.end(), bytes, bytes + size);
+
+        // Mark the message boundary at the end of each main buffer slice
+        if (priority != SendPriority::High)
+        {
+            size_t slice = _send_buffer_main_marks.empty() ? _send_buffer_main_offset : _send_buffer_main_marks.back();
+            if ((_send_buffer_main.size() - slice) >= SEND_SLICE)
+                _send_buffer_main_marks.push_back(_send_buffer_main.size());
+        }
 
         // Update statistic
-        _bytes_pending = _send_buffer_main.size();
+        _bytes_pending = _send_buffer_main.size() - _send_buffer_main_offset + _send_buffer_high.size() + _send_conflated_size;
+
+        // Consume the send messages rate limits
+        if (_send_limiter.IsLimited() || _server->_send_limiter.IsLimited())
+        {
+            uint64_t timestamp = CppCommon::Timestamp::nano();
+            _send_limiter.Consume(0, 1, timestamp);
+            _server->_send_limiter.Consume(0, 1, timestamp);
+        }
 
         // Avoid multiple send handlers
         if (!send_required)
@@ -360,6 +400,77 @@ bool SSLSession::SendAsync(const void* buffer, size_t size)
     return true;
 }
 
+bool SSLSession::SendConflatedAsync(std::string_view key, const void* buffer, size_t size)
+{
+    if (!IsHandshaked())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    {
+        std::scoped_lock locker(_send_lock);
+
+        // Detect multiple send handlers
+        bool send_required = (_send_buffer_main.empty() && _send_buffer_high.empty() && _send_conflated.empty()) || _send_buffer_flush.empty();
+
+        // Find the previous conflated data with the same key
+        auto it = _send_conflated_index.find(key);
+        size_t previous = (it != _send_conflated_index.end()) ? _send_conflated[it->second].second.size() : 0;
+
+        // Check the send buffer limit
+        if (((_send_buffer_main.size() - _send_buffer_main_offset + _send_buffer_high.size() + _send_conflated_size - previous + size) > _send_buffer_limit) && (_send_buffer_limit > 0))
+        {
+            SendError(asio::error::no_buffer_space);
+            return false;
+        }
+
+        // Replace the previous conflated data in place or append a new key
+        const uint8_t* bytes = (const uint8_t*)buffer;
+        if (it != _send_conflated_index.end())
+            _send_conflated[it->second].second.assign(bytes, bytes + size);
+        else
+        {
+            _send_conflated_index.emplace(key, _send_conflated.size());
+            _send_conflated.emplace_back(std::string(key), std::vector<uint8_t>(bytes, bytes + size));
+        }
+        _send_conflated_size = _send_conflated_size - previous + size;
+
+        // Update statistic
+        _bytes_pending = _send_buffer_main.size() - _send_buffer_main_offset + _send_buffer_high.size() + _send_conflated_size;
+
+        // Consume the send messages rate limits
+        if (_send_limiter.IsLimited() || _server->_send_limiter.IsLimited())
+        {
+            uint64_t timestamp = CppCommon::Timestamp::nano();
+            _send_limiter.Consume(0, 1, timestamp);
+            _server->_send_limiter.Consume(0, 1, timestamp);
+        }
+
+        // Avoid multiple send handlers
+        if (!send_required)
+            return true;
+    }
+
+    // Dispatch the send handler
+    auto self(this->shared_from_this());
+    auto send_handler = [this, self]()
+    {
+        // Try to send the conflated data
+        TrySend();
+    };
+    if (_strand_required)
+        _strand.dispatch(send_handler);
+    else
+        _io_service->dispatch(send_handler);
+
+    return true;
+}
+
 size_t SSLSession::Receive(void* buffer, size_t size)
 {
     if (!IsHandshaked())
@@ -380,7 +491,7 @@ size_t SSLSession::Receive(void* buffer, size_t size)
     {
         // Update statistic
         _bytes_received += received;
-        _server->_bytes_received += received;
+        _server->_statistics.AddBytesReceived(received);
 
         // Call the buffer received handler
         onReceived(buffer, received);
@@ -451,7 +562,7 @@ size_t SSLSession::Receive(void* buffer, size_t size, const CppCommon::Timespan&
     {
         // Update statistic
         _bytes_received += received;
-        _server->_bytes_received += received;
+        _server->_statistics.AddBytesReceived(received);
 
         // Call the buffer received handler
         onReceived(buffer, received);
@@ -482,12 +593,23 @@ void SSLSession::ReceiveAsync()
 
 void SSLSession::TryReceive()
 {
-    if (_receiving)
+    if (_receiving || _receive_throttled)
         return;
 
     if (!IsHandshaked())
         return;
 
+    // Stop receiving until the receive budget is refilled for the whole receive buffer
+    uint64_t delay = ThrottleDelay(true, _receive_buffer.size());
+    if (delay > 0)
+    {
+        Throttle(true, delay);
+        return;
+    }
+
+    // Limit the receive size with the receive budget
+    size_t receive = ReceiveBudget(_receive_buffer.size());
+
     // Async receive with the receive handler
     _receiving = true;
     auto self(this->shared_from_this());
@@ -503,7 +625,15 @@ void SSLSession::TryReceive()
         {
             // Update statistic
             _bytes_received += size;
-            _server->_bytes_received += size;
+            _server->_statistics.AddBytesReceived(size);
+
+            // Consume the receive rate limits
+            if (_receive_limiter.IsLimited() || _server->_receive_limiter.IsLimited())
+            {
+                uint64_t timestamp = CppCommon::Timestamp::nano();
+                _receive_limiter.Consume(size, 1, timestamp);
+                _server->_receive_limiter.Consume(size, 1, timestamp);
+            }
 
             // Call the buffer received handler
             onReceived(_receive_buffer.data(), size);
@@ -533,14 +663,14 @@ void SSLSession::TryReceive()
         }
     });
     if (_strand_required)
-        _stream.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), bind_executor(_strand, async_receive_handler));
+        _stream.async_read_some(asio::buffer(_receive_buffer.data(), receive), bind_executor(_strand, async_receive_handler));
     else
-        _stream.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), async_receive_handler);
+        _stream.async_read_some(asio::buffer(_receive_buffer.data(), receive), async_receive_handler);
 }
 
 void SSLSession::TrySend()
 {
-    if (_sending)
+    if (_sending || _send_throttled)
         return;
 
     if (!IsHandshaked())
@@ -551,12 +681,55 @@ void SSLSession::TrySend()
     {
         std::scoped_lock locker(_send_lock);
 
-        // Swap flush and main buffers
-        _send_buffer_flush.swap(_send_buffer_main);
+        // Swap flush buffer with the high priority buffer first, then interleave
+        // slices of the main buffer with the latest conflated data of all keys
+        _send_buffer_flush_main = false;
+        if (!_send_buffer_high.empty())
+            _send_buffer_flush.swap(_send_buffer_high);
+        else if (!_send_conflated.empty() && (_send_conflated_turn || _send_buffer_main.empty()))
+        {
+            // Flush the latest conflated data of all keys
+            for (const auto& conflated : _send_conflated)
+                _send_buffer_flush.insert(_send_buffer_flush.end(), conflated.second.begin(), conflated.second.end());
+            _send_conflated_index.clear();
+            _send_conflated.clear();
+            _send_conflated_size = 0;
+            _send_conflated_turn = false;
+        }
+        else if (!_send_buffer_main.empty())
+        {
+            // Flush the main buffer by slices of whole messages, so high priority data waits for one slice at most
+            size_t slice = _send_buffer_main_marks.empty() ? _send_buffer_main.size() : _send_buffer_main_marks.front();
+            if ((_send_buffer_main_offset == 0) && (slice == _send_buffer_main.size()))
+            {
+                _send_buffer_flush.swap(_send_buffer_main);
+                _send_buffer_main_marks.clear();
+            }
+            else
+            {
+                _send_buffer_flush.assign(_send_buffer_main.begin() + _send_buffer_main_offset, _send_buffer_main.begin() + slice);
+                _send_buffer_main_offset = slice;
+                if (!_send_buffer_main_marks.empty())
+                    _send_buffer_main_marks.pop_front();
+
+                // Compact the main buffer when at least half of it is flushed
+                if ((2 * _send_buffer_main_offset) >= _send_buffer_main.size())
+                {
+                    _send_buffer_main.erase(_send_buffer_main.begin(), _send_buffer_main.begin() + _send_buffer_main_offset);
+                    for (auto& mark : _send_buffer_main_marks)
+                        mark -= _send_buffer_main_offset;
+                    _send_buffer_main_offset = 0;
+                }
+            }
+
+            // Flush conflated data after this slice
+            _send_conflated_turn = true;
+            _send_buffer_flush_main = true;
+        }
         _send_buffer_flush_offset = 0;
 
         // Update statistic
-        _bytes_pending = 0;
+        _bytes_pending = _send_buffer_main.size() - _send_buffer_main_offset + _send_buffer_high.size() + _send_conflated_size;
         _bytes_sending += _send_buffer_flush.size();
     }
 
@@ -568,6 +741,14 @@ void SSLSession::TrySend()
         return;
     }
 
+    // Delay sending until the send budget is refilled
+    uint64_t delay = ThrottleDelay(false);
+    if (delay > 0)
+    {
+        Throttle(false, delay);
+        return;
+    }
+
     // Async write with the write handler
     _sending = true;
     auto self(this->shared_from_this());
@@ -584,10 +765,20 @@ void SSLSession::TrySend()
             // Update statistic
             _bytes_sending -= size;
             _bytes_sent += size;
-            _server->_bytes_sent += size;
+            _server->_statistics.AddBytesSent(size);
+
+            // Consume the send bytes rate limits
+            if (_send_limiter.IsLimited() || _server->_send_limiter.IsLimited())
+            {
+                uint64_t timestamp = CppCommon::Timestamp::nano();
+                _send_limiter.Consume(size, 0, timestamp);
+                _server->_send_limiter.Consume(size, 0, timestamp);
+            }
 
             // Increase the flush buffer offset
             _send_buffer_flush_offset += size;
+            if (_send_buffer_flush_main)
+                _bytes_sent_main += size;
 
             // Successfully send the whole flush buffer
             if (_send_buffer_flush_offset == _send_buffer_flush.size())
@@ -616,6 +807,64 @@ void SSLSession::TrySend()
         _stream.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), async_write_handler);
 }
 
+uint64_t SSLSession::ThrottleDelay(bool receive, size_t size) const
+{
+    const RateLimiter& session_limiter = receive ? _receive_limiter : _send_limiter;
+    const RateLimiter& server_limiter = receive ? _server->_receive_limiter : _server->_send_limiter;
+    if (!session_limiter.IsLimited() && !server_limiter.IsLimited())
+        return 0;
+
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+    return std::max(session_limiter.Delay(timestamp, size), server_limiter.Delay(timestamp, size));
+}
+
+size_t SSLSession::ReceiveBudget(size_t size) const
+{
+    if (!_receive_limiter.IsLimited() && !_server->_receive_limiter.IsLimited())
+        return size;
+
+    // Read at least one byte if the budget is rounded down
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+    uint64_t budget = std::min(_receive_limiter.Available(timestamp), _server->_receive_limiter.Available(timestamp));
+    return (size_t)std::max<uint64_t>(std::min<uint64_t>(size, budget), 1);
+}
+
+void SSLSession::Throttle(bool receive, uint64_t delay)
+{
+    // Update the throttling flag
+    if (receive)
+        _receive_throttled = true;
+    else
+        _send_throttled = true;
+
+    // Schedule the throttled operation to resume
+    std::weak_ptr<SSLSession> weak(this->shared_from_this());
+    _server->service()->ScheduleAfter(_io_service, CppCommon::Timespan::nanoseconds(delay), [weak, receive]()
+    {
+        auto self = weak.lock();
+        if (!self)
+            return;
+
+        auto resume_handler = [self, receive]()
+        {
+            if (receive)
+            {
+                self->_receive_throttled = false;
+                self->TryReceive();
+            }
+            else
+            {
+                self->_send_throttled = false;
+                self->TrySend();
+            }
+        };
+        if (self->_strand_required)
+            self->_strand.dispatch(resume_handler);
+        else
+            self->_io_service->dispatch(resume_handler);
+    });
+}
+
 void SSLSession::ClearBuffers()
 {
     {
@@ -623,8 +872,16 @@ void SSLSession::ClearBuffers()
 
         // Clear send buffers
         _send_buffer_main.clear();
+        _send_buffer_main_marks.clear();
+        _send_buffer_main_offset = 0;
+        _send_buffer_high.clear();
+        _send_conflated_index.clear();
+        _send_conflated.clear();
+        _send_conflated_size = 0;
+        _send_conflated_turn = false;
         _send_buffer_flush.clear();
         _send_buffer_flush_offset = 0;
+        _send_buffer_flush_main = false;
 
         // Update statistic
         _bytes_pending = 0;
@@ -7,6 +7,12 @@
 */
 
 #include "server/asio/tcp_client.h"
+#include "server/asio/poll.h"
+
+#include "time/timestamp.h"
+
+#include <random>
+#include <utility>
 
 namespace CppServer {
 namespace Asio {
@@ -94,6 +100,36 @@ TCPClient::TCPClient(const std::shared_ptr<Service>& service, const asio::ip::tc
         throw CppCommon::ArgumentException("Asio service is invalid!");
 }
 
+TCPClient::TCPClient(const std::shared_ptr<Service>& service, const std::shared_ptr<asio::io_service>& io_service, const asio::io_service::strand& strand, const std::string& address, int port)
+    : _id(CppCommon::UUID::Sequential()),
+      _service(service),
+      _io_service(io_service),
+      _strand(strand),
+      _strand_required(_service->IsStrandRequired()),
+      _address(address),
+      _port(port),
+      _socket(*_io_service),
+      _resolving(false),
+      _connecting(false),
+      _connected(false),
+      _bytes_pending(0),
+      _bytes_sending(0),
+      _bytes_sent(0),
+      _bytes_received(0),
+      _receiving(false),
+      _sending(false),
+      _send_buffer_flush_offset(0),
+      _option_keep_alive(false),
+      _option_no_delay(false)
+{
+    assert((service != nullptr) && "Asio service is invalid!");
+    if (service == nullptr)
+        throw CppCommon::ArgumentException("Asio service is invalid!");
+    assert((io_service != nullptr) && "Asio IO service is invalid!");
+    if (io_service == nullptr)
+        throw CppCommon::ArgumentException("Asio IO service is invalid!");
+}
+
 size_t TCPClient::option_receive_buffer_size() const
 {
     asio::socket_base::receive_buffer_size option;
@@ -265,6 +301,19 @@ bool TCPClient::DisconnectInternal()
     // Call the client disconnected handler
     onDisconnected();
 
+    // Schedule the next auto-reconnect attempt
+    ScheduleReconnect();
+
+#if defined(CPPSERVER_COROUTINES)
+    // Dispatch the resume awaiters handler
+    auto self(this->shared_from_this());
+    auto resume_handler = [this, self]() { ResumeAwaiters(); };
+    if (_strand_required)
+        _strand.dispatch(resume_handler);
+    else
+        _io_service->dispatch(resume_handler);
+#endif
+
     return true;
 }
 
@@ -281,6 +330,9 @@ bool TCPClient::ConnectAsync()
     if (IsConnected() || _resolving || _connecting)
         return false;
 
+    // Arm auto-reconnect
+    StartReconnect(nullptr);
+
     // Post the connect handler
     auto self(this->shared_from_this());
     auto connect_handler = [this, self]()
@@ -319,6 +371,7 @@ bool TCPClient::ConnectAsync()
 
                 // Update the connected flag
                 _connected = true;
+                _fast_open_pending = option_fast_open();
 
                 // Try to receive something from the server
                 TryReceive();
@@ -326,9 +379,20 @@ bool TCPClient::ConnectAsync()
                 // Call the client connected handler
                 onConnected();
 
-                // Call the empty send buffer handler
+                // Complete auto-reconnect
+                CompleteReconnect();
+
+                // Call the empty send buffer handler or send data preserved across reconnects
                 if (_send_buffer_main.empty())
                     onEmpty();
+                else
+                    TrySend();
+
+#if defined(CPPSERVER_COROUTINES)
+                // Resume the connect awaiter
+                if (IsConnectAwaiterResumedOnConnect())
+                    ResumeConnectAwaiter(true);
+#endif
             }
             else
             {
@@ -336,12 +400,29 @@ bool TCPClient::ConnectAsync()
 
                 // Call the client disconnected handler
                 onDisconnected();
+
+                // Schedule the next auto-reconnect attempt
+                ScheduleReconnect();
+
+#if defined(CPPSERVER_COROUTINES)
+                // Resume the connect awaiter
+                ResumeConnectAwaiter(false);
+#endif
             }
         };
 
         // Create the server endpoint
         _endpoint = asio::ip::tcp::endpoint(asio::ip::make_address(_address), (unsigned short)_port);
 
+        // Apply the option: TCP Fast Open
+        if (option_fast_open())
+        {
+            asio::error_code ignored;
+            if (!_socket.is_open())
+                _socket.open(_endpoint.protocol(), ignored);
+            FastOpen::EnableClient(_socket);
+        }
+
         if (_strand_required)
             _socket.async_connect(_endpoint, bind_executor(_strand, async_connect_handler));
         else
@@ -360,6 +441,9 @@ bool TCPClient::ConnectAsync(const std::shared_ptr<TCPResolver>& resolver)
     if (IsConnected() || _resolving || _connecting)
         return false;
 
+    // Arm auto-reconnect
+    StartReconnect(resolver);
+
     // Post the connect handler
     auto self(this->shared_from_this());
     auto connect_handler = [this, self, resolver]()
@@ -412,6 +496,7 @@ bool TCPClient::ConnectAsync(const std::shared_ptr<TCPResolver>& resolver)
 
                         // Update the connected flag
                         _connected = true;
+                        _fast_open_pending = option_fast_open();
 
                         // Try to receive something from the server
                         TryReceive();
@@ -419,9 +504,20 @@ bool TCPClient::ConnectAsync(const std::shared_ptr<TCPResolver>& resolver)
                         // Call the client connected handler
                         onConnected();
 
-                        // Call the empty send buffer handler
+                        // Complete auto-reconnect
+                        CompleteReconnect();
+
+                        // Call the empty send buffer handler or send data preserved across reconnects
                         if (_send_buffer_main.empty())
                             onEmpty();
+                        else
+                            TrySend();
+
+#if defined(CPPSERVER_COROUTINES)
+                        // Resume the connect awaiter
+                        if (IsConnectAwaiterResumedOnConnect())
+                            ResumeConnectAwaiter(true);
+#endif
                     }
                     else
                     {
@@ -429,9 +525,26 @@ bool TCPClient::ConnectAsync(const std::shared_ptr<TCPResolver>& resolver)
 
                         // Call the client disconnected handler
                         onDisconnected();
+
+                        // Schedule the next auto-reconnect attempt
+                        ScheduleReconnect();
+
+#if defined(CPPSERVER_COROUTINES)
+                        // Resume the connect awaiter
+                        ResumeConnectAwaiter(false);
+#endif
                     }
                 };
-                if (_strand_required)
+                if (option_connect_stagger().total() > 0)
+                {
+                    // Happy Eyeballs parallel connect to the fastest reachable endpoint
+                    auto connector = std::make_shared<TCPConnector>(_io_service, option_connect_stagger(), option_connect_attempt_timeout(), option_fast_open());
+                    if (_strand_required)
+                        connector->ConnectAsync(_socket, endpoints, [this, self, async_connect_handler](std::error_code ec2, const asio::ip::tcp::endpoint& endpoint) { _strand.dispatch([async_connect_handler, ec2, endpoint]() mutable { async_connect_handler(ec2, endpoint); }); });
+                    else
+                        connector->ConnectAsync(_socket, endpoints, async_connect_handler);
+                }
+                else if (_strand_required)
                     asio::async_connect(_socket, endpoints, bind_executor(_strand, async_connect_handler));
                 else
                     asio::async_connect(_socket, endpoints, async_connect_handler);
@@ -442,15 +555,26 @@ bool TCPClient::ConnectAsync(const std::shared_ptr<TCPResolver>& resolver)
 
                 // Call the client disconnected handler
                 onDisconnected();
+
+                // Schedule the next auto-reconnect attempt
+                ScheduleReconnect();
+
+#if defined(CPPSERVER_COROUTINES)
+                // Resume the connect awaiter
+                ResumeConnectAwaiter(false);
+#endif
             }
         };
 
         // Resolve the server endpoint
-        asio::ip::tcp::resolver::query query(_address, (_scheme.empty() ? std::to_string(_port) : _scheme));
-        if (_strand_required)
-            resolver->resolver().async_resolve(query, bind_executor(_strand, async_resolve_handler));
-        else
-            resolver->resolver().async_resolve(query, async_resolve_handler);
+        auto resolve_handler = [this, self, async_resolve_handler](std::error_code ec1, const asio::ip::tcp::resolver::results_type& endpoints) mutable
+        {
+            if (_strand_required)
+                _strand.dispatch([async_resolve_handler, ec1, endpoints]() mutable { async_resolve_handler(ec1, endpoints); });
+            else
+                async_resolve_handler(ec1, endpoints);
+        };
+        resolver->ResolveAsync(_address, (_scheme.empty() ? std::to_string(_port) : _scheme), resolve_handler);
     };
     if (_strand_required)
         _strand.post(connect_handler);
@@ -549,36 +673,10 @@ size_t TCPClient::Send(const void* buffer, size_t size, const CppCommon::Timespa
     if (buffer == nullptr)
         return 0;
 
-    int done = 0;
-    std::mutex mtx;
-    std::condition_variable cv;
     asio::error_code error;
-    asio::system_timer timer(_socket.get_executor());
-
-    // Prepare done handler
-    auto async_done_handler = [&](asio::error_code ec)
-    {
-        std::unique_lock<std::mutex> lck(mtx);
-        if (done++ == 0)
-        {
-            error = ec;
-            _socket.cancel();
-            timer.cancel();
-        }
-        cv.notify_one();
-    };
-
-    // Async wait for timeout
-    timer.expires_from_now(timeout.chrono());
-    timer.async_wait([&](const asio::error_code& ec) { async_done_handler(ec ? ec : asio::error::timed_out); });
-
-    // Async write some data to the server
-    size_t sent = 0;
-    _socket.async_write_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
 
-    // Wait for complete or timeout
-    std::unique_lock<std::mutex> lck(mtx);
-    cv.wait(lck, [&]() { return done == 2; });
+    // Write some data to the server with timeout
+    size_t sent = Poll::Send(_socket, buffer, size, timeout, error);
 
     // Send data to the server
     if (sent > 0)
@@ -602,7 +700,7 @@ size_t TCPClient::Send(const void* buffer, size_t size, const CppCommon::Timespa
 
 bool TCPClient::SendAsync(const void* buffer, size_t size)
 {
-    if (!IsConnected())
+    if (!IsConnected() && !IsSendBufferPreserved())
         return false;
 
     if (size == 0)
@@ -706,36 +804,10 @@ size_t TCPClient::Receive(void* buffer, size_t size, const CppCommon::Timespan&
     if (buffer == nullptr)
         return 0;
 
-    int done = 0;
-    std::mutex mtx;
-    std::condition_variable cv;
     asio::error_code error;
-    asio::system_timer timer(_socket.get_executor());
-
-    // Prepare done handler
-    auto async_done_handler = [&](asio::error_code ec)
-    {
-        std::unique_lock<std::mutex> lck(mtx);
-        if (done++ == 0)
-        {
-            error = ec;
-            _socket.cancel();
-            timer.cancel();
-        }
-        cv.notify_one();
-    };
-
-    // Async wait for timeout
-    timer.expires_from_now(timeout.chrono());
-    timer.async_wait([&](const asio::error_code& ec) { async_done_handler(ec ? ec : asio::error::timed_out); });
-
-    // Async read some data from the server
-    size_t received = 0;
-    _socket.async_read_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
 
-    // Wait for complete or timeout
-    std::unique_lock<std::mutex> lck(mtx);
-    cv.wait(lck, [&]() { return done == 2; });
+    // Read some data from the server with timeout
+    size_t received = Poll::Receive(_socket, buffer, size, timeout, error);
 
     // Received some data from the server
     if (received > 0)
@@ -770,9 +842,234 @@ void TCPClient::ReceiveAsync()
     TryReceive();
 }
 
+void TCPClient::ResumeReceive()
+{
+    if (!_receive_paused.exchange(false))
+        return;
+
+    // Dispatch the receive handler
+    auto self(this->shared_from_this());
+    auto receive_handler = [this, self]()
+    {
+        // Try to receive data from the server
+        TryReceive();
+    };
+    if (_strand_required)
+        _strand.dispatch(receive_handler);
+    else
+        _io_service->dispatch(receive_handler);
+}
+
+#if defined(CPPSERVER_COROUTINES)
+
+ConnectAwaiter<TCPClient, TCPResolver> TCPClient::ConnectAsync(const CppCommon::Timespan& timeout)
+{
+    return ConnectAwaiter<TCPClient, TCPResolver>(this->shared_from_this(), _strand_required, nullptr, timeout);
+}
+
+ConnectAwaiter<TCPClient, TCPResolver> TCPClient::ConnectAsync(const std::shared_ptr<TCPResolver>& resolver, const CppCommon::Timespan& timeout)
+{
+    return ConnectAwaiter<TCPClient, TCPResolver>(this->shared_from_this(), _strand_required, resolver, timeout);
+}
+
+SendAwaiter<TCPClient> TCPClient::SendAsync(const void* buffer, size_t size, const CppCommon::Timespan& timeout)
+{
+    return SendAwaiter<TCPClient>(this->shared_from_this(), _strand_required, buffer, size, timeout);
+}
+
+ReceiveAwaiter<TCPClient> TCPClient::ReceiveAsync(void* buffer, size_t size, const CppCommon::Timespan& timeout)
+{
+    // Start the awaiting mode to cache received data between awaits
+    _receive_awaiting = true;
+
+    return ReceiveAwaiter<TCPClient>(this->shared_from_this(), _strand_required, buffer, size, timeout);
+}
+
+void TCPClient::StopReceiveAwaiting()
+{
+    _receive_awaiting = false;
+
+    // Drop cached data on the client executor
+    auto self(this->shared_from_this());
+    auto stop_handler = [this, self]()
+    {
+        if (!_receive_awaiting)
+            _receive_awaiter_cache.clear();
+    };
+    if (_strand_required)
+        _strand.dispatch(stop_handler);
+    else
+        _io_service->dispatch(stop_handler);
+}
+
+void TCPClient::ResumeConnectAwaiter(bool connected)
+{
+    if (_connect_awaiter != nullptr)
+        std::exchange(_connect_awaiter, nullptr)->Complete(connected);
+}
+
+void TCPClient::StartConnectAwaiter(ConnectAwaiter<TCPClient, TCPResolver>* awaiter)
+{
+    // Only one connect awaiter could be pending
+    if (_connect_awaiter != nullptr)
+    {
+        awaiter->Complete(false);
+        return;
+    }
+
+    // Connect the client with the virtual connect method
+    _connect_awaiter = awaiter;
+    bool connecting = awaiter->resolver() ? ConnectAsync(awaiter->resolver()) : ConnectAsync();
+    if (!connecting)
+    {
+        _connect_awaiter = nullptr;
+        awaiter->Complete(false);
+    }
+}
+
+void TCPClient::CancelConnectAwaiter(ConnectAwaiter<TCPClient, TCPResolver>* awaiter)
+{
+    if (_connect_awaiter != awaiter)
+        return;
+
+    _connect_awaiter = nullptr;
+
+    // Cancel pending resolve
+    if (_resolving && awaiter->resolver())
+        awaiter->resolver()->resolver().cancel();
+
+    // Abort the connection in progress
+    if (IsConnected())
+        DisconnectInternalAsync(true);
+    else
+    {
+        asio::error_code ec;
+        _socket.close(ec);
+    }
+}
+
+void TCPClient::StartReceiveAwaiter(ReceiveAwaiter<TCPClient>* awaiter)
+{
+    // Complete the awaiter with cached data
+    if (!_receive_awaiter_cache.empty())
+    {
+        size_t size = std::min(awaiter->size(), _receive_awaiter_cache.size());
+        std::memcpy(awaiter->buffer(), _receive_awaiter_cache.data(), size);
+        _receive_awaiter_cache.erase(_receive_awaiter_cache.begin(), _receive_awaiter_cache.begin() + size);
+        awaiter->Complete(size);
+        return;
+    }
+
+    // Only one receive awaiter could be pending
+    if (_receive_awaiter != nullptr)
+    {
+        awaiter->Complete(0);
+        return;
+    }
+
+    if (!IsConnected() || (awaiter->size() == 0))
+    {
+        awaiter->Complete(0);
+        return;
+    }
+
+    _receive_awaiter = awaiter;
+}
+
+void TCPClient::CancelReceiveAwaiter(ReceiveAwaiter<TCPClient>* awaiter)
+{
+    // The awaiting mode is kept, so data received after the timeout is cached for the next await
+    if (_receive_awaiter == awaiter)
+        _receive_awaiter = nullptr;
+}
+
+bool TCPClient::ResumeReceiveAwaiter(const void* buffer, size_t size)
+{
+    if (!_receive_awaiting && (_receive_awaiter == nullptr))
+        return true;
+
+    const uint8_t* bytes = (const uint8_t*)buffer;
+
+    // Fill the pending awaiter buffer
+    size_t part = 0;
+    ReceiveAwaiter<TCPClient>* awaiter = std::exchange(_receive_awaiter, nullptr);
+    if (awaiter != nullptr)
+    {
+        part = std::min(awaiter->size(), size);
+        std::memcpy(awaiter->buffer(), bytes, part);
+    }
+
+    // Cache the rest of received data for the next await in the awaiting mode
+    if ((part < size) && _receive_awaiting)
+    {
+        // Check the receive buffer limit or the default awaiter cache limit
+        size_t limit = (_receive_buffer_limit > 0) ? _receive_buffer_limit : ReceiveAwaiter<TCPClient>::CACHE_LIMIT;
+        if ((_receive_awaiter_cache.size() + size - part) > limit)
+            return false;
+
+        _receive_awaiter_cache.insert(_receive_awaiter_cache.end(), bytes + part, bytes + size);
+    }
+
+    // Complete the pending awaiter
+    if (awaiter != nullptr)
+        awaiter->Complete(part);
+
+    return true;
+}
+
+void TCPClient::StartSendAwaiter(SendAwaiter<TCPClient>* awaiter)
+{
+    // Only one send awaiter could be pending
+    if ((_send_awaiter != nullptr) || !SendAsync(awaiter->buffer(), awaiter->size()))
+    {
+        awaiter->Complete(0);
+        return;
+    }
+
+    // Data is sent in order, so the awaiter is completed when all bytes enqueued so far are sent
+    {
+        std::scoped_lock locker(_send_lock);
+        awaiter->SetupTarget(_bytes_sent + _bytes_sending + _bytes_pending);
+    }
+
+    if (_bytes_sent >= awaiter->target())
+    {
+        awaiter->Complete(awaiter->size());
+        return;
+    }
+
+    _send_awaiter = awaiter;
+}
+
+uint64_t TCPClient::CancelSendAwaiter(SendAwaiter<TCPClient>* awaiter)
+{
+    if (_send_awaiter == awaiter)
+        _send_awaiter = nullptr;
+
+    return _bytes_sent;
+}
+
+void TCPClient::ResumeAwaiters()
+{
+    _receive_awaiter_cache.clear();
+
+    if (_receive_awaiter != nullptr)
+        std::exchange(_receive_awaiter, nullptr)->Complete(0);
+
+    if (_send_awaiter != nullptr)
+    {
+        auto awaiter = std::exchange(_send_awaiter, nullptr);
+        awaiter->Complete(awaiter->Sent(_bytes_sent));
+    }
+
+    ResumeConnectAwaiter(false);
+}
+
+#endif
+
 void TCPClient::TryReceive()
 {
-    if (_receiving)
+    if (_receiving || _receive_detached || _receive_paused)
         return;
 
     if (!IsConnected())
@@ -791,12 +1088,30 @@ void TCPClient::TryReceive()
         // Received some data from the server
         if (size > 0)
         {
+            // Update TCP Fast Open statistic after the first received data
+            if (_fast_open_pending)
+            {
+                _fast_open_pending = false;
+                if (FastOpen::IsUsed(_socket))
+                    ++_fast_open_connects;
+            }
+
             // Update statistic
             _bytes_received += size;
 
             // Call the buffer received handler
             onReceived(_receive_buffer.data(), size);
 
+#if defined(CPPSERVER_COROUTINES)
+            // Resume the receive awaiter
+            if (!ResumeReceiveAwaiter(_receive_buffer.data(), size))
+            {
+                SendError(asio::error::no_buffer_space);
+                DisconnectInternalAsync(true);
+                return;
+            }
+#endif
+
             // If the receive buffer is full increase its size
             if (_receive_buffer.size() == size)
             {
@@ -887,6 +1202,15 @@ void TCPClient::TrySend()
 
             // Call the buffer sent handler
             onSent(size, bytes_pending());
+
+#if defined(CPPSERVER_COROUTINES)
+            // Resume the send awaiter if its buffer was completely sent
+            if ((_send_awaiter != nullptr) && (_bytes_sent >= _send_awaiter->target()))
+            {
+                auto awaiter = std::exchange(_send_awaiter, nullptr);
+                awaiter->Complete(awaiter->size());
+            }
+#endif
         }
 
         // Try to send again if the session is valid
@@ -904,18 +1228,127 @@ void TCPClient::TrySend()
         _socket.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), async_write_handler);
 }
 
+void TCPClient::StartReconnect(const std::shared_ptr<TCPResolver>& resolver)
+{
+    std::scoped_lock locker(_reconnect_lock);
+
+    _reconnect_resolver = resolver;
+    _reconnect_armed = true;
+}
+
+void TCPClient::StopReconnect()
+{
+    std::scoped_lock locker(_reconnect_lock);
+
+    _reconnect_armed = false;
+    _reconnect_token.Cancel();
+    _reconnect_attempt = 0;
+}
+
+void TCPClient::ScheduleReconnect()
+{
+    if (!_option_auto_reconnect || !_reconnect_armed)
+        return;
+
+    uint64_t attempt;
+    uint64_t delay;
+
+    {
+        std::scoped_lock locker(_reconnect_lock);
+
+        // Start tracking the connection recovery time
+        if (_reconnect_attempt++ == 0)
+            _reconnect_timestamp = CppCommon::Timestamp::nano();
+        attempt = _reconnect_attempt;
+        ++_reconnect_attempts;
+
+        // Calculate the exponential backoff delay
+        uint64_t delay_min = (uint64_t)std::max<int64_t>(_option_reconnect_delay_min.total(), 0);
+        uint64_t delay_max = std::max((uint64_t)std::max<int64_t>(_option_reconnect_delay_max.total(), 0), delay_min);
+        delay = delay_min;
+        for (uint64_t i = 1; (i < attempt) && (delay > 0) && (delay < delay_max); ++i)
+            delay *= 2;
+        delay = std::min(delay, delay_max);
+
+        // Reduce the delay by a random jitter
+        if (_option_reconnect_jitter > 0)
+        {
+            thread_local std::minstd_rand generator(std::random_device{}());
+            std::uniform_real_distribution<double> distribution(0.0, _option_reconnect_jitter);
+            delay -= (uint64_t)(delay * distribution(generator));
+        }
+
+        // Schedule the reconnect attempt
+        std::weak_ptr<TCPClient> weak(this->shared_from_this());
+        _reconnect_token = _service->ScheduleAfter(_io_service, CppCommon::Timespan::nanoseconds(delay), [weak]()
+        {
+            auto self = weak.lock();
+            if (!self || !self->_reconnect_armed)
+                return;
+
+            std::shared_ptr<TCPResolver> resolver;
+            {
+                std::scoped_lock locker(self->_reconnect_lock);
+                resolver = self->_reconnect_resolver;
+            }
+
+            // Reconnect with the same DNS resolver
+            if (resolver)
+                self->ConnectAsync(resolver);
+            else
+                self->ConnectAsync();
+        });
+    }
+
+    // Call the client reconnecting handler
+    onReconnecting(attempt, CppCommon::Timespan::nanoseconds(delay));
+}
+
+void TCPClient::CompleteReconnect()
+{
+    uint64_t attempts;
+    uint64_t recovery;
+
+    {
+        std::scoped_lock locker(_reconnect_lock);
+
+        if (_reconnect_attempt == 0)
+            return;
+
+        // Update reconnect statistic
+        attempts = std::exchange(_reconnect_attempt, 0);
+        recovery = CppCommon::Timestamp::nano() - _reconnect_timestamp;
+        _reconnect_recovery = recovery;
+        ++_reconnects;
+    }
+
+    // Call the client reconnected handler
+    onReconnected(attempts, CppCommon::Timespan::nanoseconds(recovery));
+}
+
 void TCPClient::ClearBuffers()
 {
     {
         std::scoped_lock locker(_send_lock);
 
-        // Clear send buffers
-        _send_buffer_main.clear();
+        if (IsSendBufferPreserved())
+        {
+            // Keep unsent data for the next connection. Partially written flush buffer is dropped to keep messages intact.
+            if (_send_buffer_flush_offset == 0)
+                _send_buffer_main.insert(_send_buffer_main.begin(), _send_buffer_flush.begin(), _send_buffer_flush.end());
+        }
+        else
+        {
+            // Clear the main send buffer
+            _send_buffer_main.clear();
+        }
+
+        // Clear the flush send buffer
         _send_buffer_flush.clear();
         _send_buffer_flush_offset = 0;
 
         // Update statistic
-        _bytes_pending = 0;
+        _bytes_pending = _send_buffer_main.size();
         _bytes_sending = 0;
     }
 }
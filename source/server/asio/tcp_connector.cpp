@@ -0,0 +1,185 @@
+/*!
+    \file tcp_connector.cpp
+    \brief TCP parallel connector implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/tcp_connector.h"
+
+namespace CppServer {
+namespace Asio {
+
+TCPConnector::TCPConnector(const std::shared_ptr<asio::io_service>& io_service, const CppCommon::Timespan& stagger, const CppCommon::Timespan& timeout, bool fast_open)
+    : _io_service(io_service),
+      _strand(*_io_service),
+      _timer(*_io_service),
+      _stagger(stagger),
+      _timeout(timeout),
+      _fast_open(fast_open),
+      _socket(nullptr),
+      _pending(0),
+      _completed(false)
+{
+}
+
+std::vector<asio::ip::tcp::endpoint> TCPConnector::SortEndpoints(const asio::ip::tcp::resolver::results_type& endpoints)
+{
+    // Split endpoints by their address family
+    std::vector<asio::ip::tcp::endpoint> ipv6;
+    std::vector<asio::ip::tcp::endpoint> ipv4;
+    for (const auto& entry : endpoints)
+    {
+        if (entry.endpoint().address().is_v6())
+            ipv6.push_back(entry.endpoint());
+        else
+            ipv4.push_back(entry.endpoint());
+    }
+
+    // Interleave address families starting from IPv6
+    std::vector<asio::ip::tcp::endpoint> result;
+    result.reserve(ipv6.size() + ipv4.size());
+    for (size_t i = 0; (i < ipv6.size()) || (i < ipv4.size()); ++i)
+    {
+        if (i < ipv6.size())
+            result.push_back(ipv6[i]);
+        if (i < ipv4.size())
+            result.push_back(ipv4[i]);
+    }
+    return result;
+}
+
+void TCPConnector::ConnectAsync(asio::ip::tcp::socket& socket, const asio::ip::tcp::resolver::results_type& endpoints, const Handler& handler)
+{
+    auto self(this->shared_from_this());
+    auto endpoints_sorted = SortEndpoints(endpoints);
+    _strand.dispatch([this, self, &socket, endpoints_sorted, handler]()
+    {
+        _socket = &socket;
+        _handler = handler;
+        _endpoints = endpoints_sorted;
+        _error = asio::error::host_not_found;
+
+        // Start the first connection attempt
+        StartAttempt();
+    });
+}
+
+void TCPConnector::StartAttempt()
+{
+    if (_completed)
+        return;
+
+    // Complete the connect operation if all attempts failed
+    if (_attempts.size() == _endpoints.size())
+    {
+        if (_pending == 0)
+            Complete(_error, asio::ip::tcp::endpoint());
+        return;
+    }
+
+    auto self(this->shared_from_this());
+
+    // Create a new connection attempt
+    _attempts.emplace_back(std::make_unique<Attempt>(*_io_service));
+    auto& attempt = *_attempts.back();
+    attempt.endpoint = _endpoints[_attempts.size() - 1];
+    ++_pending;
+
+    // Apply the option: TCP Fast Open
+    if (_fast_open)
+    {
+        asio::error_code ignored;
+        attempt.socket.open(attempt.endpoint.protocol(), ignored);
+        FastOpen::EnableClient(attempt.socket);
+    }
+
+    // Async connect with the attempt handler
+    auto async_connect_handler = [this, self, &attempt](std::error_code ec)
+    {
+        // Connection attempt could be already finished by its timeout
+        if (attempt.finished)
+            return;
+
+        if (!ec && !_completed)
+        {
+            attempt.finished = true;
+            --_pending;
+
+            // Move the winning connection into the target socket
+            *_socket = std::move(attempt.socket);
+            Complete(ec, attempt.endpoint);
+        }
+        else
+            FinishAttempt(attempt, ec);
+    };
+    attempt.socket.async_connect(attempt.endpoint, bind_executor(_strand, async_connect_handler));
+
+    // Setup the attempt timeout
+    if (_timeout.total() > 0)
+    {
+        auto async_timeout_handler = [this, self, &attempt](std::error_code ec)
+        {
+            if (!ec && !attempt.finished)
+                FinishAttempt(attempt, asio::error::timed_out);
+        };
+        attempt.timer.expires_from_now(_timeout.chrono());
+        attempt.timer.async_wait(bind_executor(_strand, async_timeout_handler));
+    }
+
+    // Start the next attempt after the stagger delay
+    if (_attempts.size() < _endpoints.size())
+    {
+        auto async_stagger_handler = [this, self](std::error_code ec)
+        {
+            if (!ec)
+                StartAttempt();
+        };
+        _timer.expires_from_now(_stagger.chrono());
+        _timer.async_wait(bind_executor(_strand, async_stagger_handler));
+    }
+}
+
+void TCPConnector::FinishAttempt(Attempt& attempt, std::error_code ec)
+{
+    attempt.finished = true;
+    --_pending;
+
+    // Close the failed connection attempt
+    asio::error_code ignored;
+    attempt.socket.close(ignored);
+    attempt.timer.cancel(ignored);
+
+    if (_completed)
+        return;
+
+    _error = ec;
+
+    // Start the next attempt immediately without waiting for the stagger delay
+    asio::error_code ignored_timer;
+    _timer.cancel(ignored_timer);
+    StartAttempt();
+}
+
+void TCPConnector::Complete(std::error_code ec, const asio::ip::tcp::endpoint& endpoint)
+{
+    _completed = true;
+
+    // Cancel the stagger timer and all other connection attempts
+    asio::error_code ignored;
+    _timer.cancel(ignored);
+    for (auto& attempt : _attempts)
+    {
+        attempt->timer.cancel(ignored);
+        if (!attempt->finished)
+            attempt->socket.close(ignored);
+    }
+
+    // Call the connect handler
+    auto handler = std::move(_handler);
+    handler(ec, endpoint);
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,42 @@
+/*!
+    \file tcp_proxy_client.cpp
+    \brief TCP proxy upstream client implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/tcp_proxy_client.h"
+#include "server/asio/tcp_proxy_session.h"
+
+namespace CppServer {
+namespace Asio {
+
+TCPProxyClient::TCPProxyClient(const std::shared_ptr<TCPProxySession>& session, const std::shared_ptr<Service>& service, const std::string& address, int port)
+    : TCPClient(service, session->io_service(), session->strand(), address, port),
+      _session(session)
+{
+    // Data is forwarded by the proxy session instead of the usual receive loop
+    _receive_detached = true;
+}
+
+void TCPProxyClient::onConnected()
+{
+    // Start forwarding data in the proxy session
+    auto session = _session.lock();
+    if (session)
+        session->StartForwarding();
+    else
+        DisconnectAsync();
+}
+
+void TCPProxyClient::onDisconnected()
+{
+    // Disconnect the proxy session
+    auto session = _session.lock();
+    if (session)
+        session->Disconnect();
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,38 @@
+/*!
+    \file tcp_proxy_server.cpp
+    \brief TCP proxy server implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/tcp_proxy_server.h"
+
+namespace CppServer {
+namespace Asio {
+
+TCPProxyServer::TCPProxyServer(const std::shared_ptr<Service>& service, int port, const std::string& upstream_address, int upstream_port, InternetProtocol protocol)
+    : TCPServer(service, port, protocol),
+      _upstream_address(upstream_address),
+      _upstream_port(upstream_port)
+{
+}
+
+TCPProxyServer::TCPProxyServer(const std::shared_ptr<Service>& service, const std::string& address, int port, const std::string& upstream_address, int upstream_port)
+    : TCPServer(service, address, port),
+      _upstream_address(upstream_address),
+      _upstream_port(upstream_port)
+{
+}
+
+bool TCPProxyServer::IsZeroCopySupported() noexcept
+{
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,396 @@
+/*!
+    \file tcp_proxy_session.cpp
+    \brief TCP proxy session implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/tcp_proxy_session.h"
+#include "server/asio/tcp_proxy_server.h"
+
+#include <algorithm>
+#include <cerrno>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace CppServer {
+namespace Asio {
+
+#if defined(__linux__)
+
+namespace {
+
+//! Move data from the pipe into the socket without raising SIGPIPE
+/*!
+    splice() could not be called with MSG_NOSIGNAL, so SIGPIPE is blocked
+    for the calling thread during the call and the signal raised for the
+    closed peer (EPIPE) is consumed before it is unblocked.
+
+    \param pipe - Pipe read end
+    \param socket - Socket to write
+    \param size - Size to move
+    \return Result of the splice() call (errno is preserved)
+*/
+ssize_t SpliceToSocket(int pipe, int socket, size_t size)
+{
+    sigset_t sigpipe;
+    sigemptyset(&sigpipe);
+    sigaddset(&sigpipe, SIGPIPE);
+
+    // SIGPIPE which is already pending must not be consumed
+    sigset_t pending;
+    sigemptyset(&pending);
+    sigpending(&pending);
+    bool was_pending = (sigismember(&pending, SIGPIPE) == 1);
+
+    sigset_t mask;
+    pthread_sigmask(SIG_BLOCK, &sigpipe, &mask);
+
+    ssize_t result = splice(pipe, nullptr, socket, nullptr, size, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    int error = errno;
+
+    // Consume SIGPIPE raised by the splice() call
+    if ((result < 0) && (error == EPIPE) && !was_pending)
+    {
+        struct timespec timeout = { 0, 0 };
+        while ((sigtimedwait(&sigpipe, nullptr, &timeout) < 0) && (errno == EINTR));
+    }
+
+    pthread_sigmask(SIG_SETMASK, &mask, nullptr);
+
+    errno = error;
+    return result;
+}
+
+} // namespace
+
+#endif
+
+TCPProxySession::TCPProxySession(const std::shared_ptr<TCPProxyServer>& server)
+    : TCPSession(server),
+      _proxy_server(server),
+      _forwarding(false),
+      _zero_copy(false),
+      _chunk_size(0)
+{
+    // Data is forwarded by the proxy session instead of the usual receive loop
+    _receive_detached = true;
+}
+
+TCPProxySession::~TCPProxySession()
+{
+    ClosePipes();
+}
+
+void TCPProxySession::onConnected()
+{
+    auto server = _proxy_server.lock();
+    if (!server)
+    {
+        Disconnect();
+        return;
+    }
+
+    // Apply the proxy server options
+    _zero_copy = server->option_zero_copy() && TCPProxyServer::IsZeroCopySupported();
+    _chunk_size = std::max(server->option_pipe_size(), (size_t)4096);
+
+    // Create and connect the upstream client
+    _upstream = server->CreateUpstream(std::static_pointer_cast<TCPProxySession>(this->shared_from_this()));
+    _upstream->SetupKeepAlive(server->option_keep_alive());
+    _upstream->SetupNoDelay(server->option_no_delay());
+    if (!_upstream->ConnectAsync())
+        Disconnect();
+}
+
+void TCPProxySession::onDisconnected()
+{
+    _forwarding = false;
+
+    // Disconnect the upstream client
+    if (_upstream)
+        _upstream->DisconnectAsync();
+}
+
+void TCPProxySession::StartForwarding()
+{
+    // Dispatch the start handler into the session executor
+    auto self(this->shared_from_this());
+    auto start_handler = [this, self]()
+    {
+        // Disconnect the upstream client if the session is already disconnected
+        if (!IsConnected())
+        {
+            _upstream->DisconnectAsync();
+            return;
+        }
+
+        // Prepare both directions
+        _pumps[0].source = &socket();
+        _pumps[0].destination = &_upstream->socket();
+        _pumps[1].source = &_upstream->socket();
+        _pumps[1].destination = &socket();
+
+        std::error_code ec;
+        if (!Prepare(_pumps[0], ec) || !Prepare(_pumps[1], ec))
+        {
+            SendError(ec);
+            Disconnect(true);
+            return;
+        }
+
+        _forwarding = true;
+
+        // Start forwarding in both directions
+        Forward(0);
+        Forward(1);
+    };
+    if (_strand_required)
+        _strand.post(start_handler);
+    else
+        _io_service->post(start_handler);
+}
+
+bool TCPProxySession::Prepare(Pump& pump, std::error_code& ec)
+{
+    // Both sockets are polled by the proxy session, so they must never block
+    pump.source->non_blocking(true, ec);
+    if (ec)
+        return false;
+
+#if defined(__linux__)
+    if (_zero_copy)
+    {
+        if (pipe2(pump.pipe, O_NONBLOCK | O_CLOEXEC) != 0)
+        {
+            ec = asio::error_code(errno, asio::error::get_system_category());
+            return false;
+        }
+
+        // Resize the pipe, the system default size is kept on failure
+        fcntl(pump.pipe[1], F_SETPIPE_SZ, (int)_chunk_size);
+        int size = fcntl(pump.pipe[1], F_GETPIPE_SZ);
+        if (size > 0)
+            pump.capacity = (size_t)size;
+        else
+            pump.capacity = _chunk_size;
+        return true;
+    }
+#endif
+
+    // Prepare the user space buffer
+    pump.buffer.resize(_chunk_size);
+    pump.capacity = _chunk_size;
+    return true;
+}
+
+void TCPProxySession::Forward(size_t index)
+{
+    // Do not starve other handlers of the Asio service
+    const size_t rounds_limit = 16;
+
+    Pump& pump = _pumps[index];
+
+    for (size_t rounds = 0; IsConnected() && !pump.finished; ++rounds)
+    {
+        if (rounds == rounds_limit)
+        {
+            Continue(index);
+            return;
+        }
+
+        std::error_code ec;
+
+        // Send pending data into the destination socket
+        if (pump.pending > 0)
+        {
+            size_t sent = Flush(pump, ec);
+            if (sent > 0)
+            {
+                // Update statistic
+                pump.bytes += sent;
+                auto server = _proxy_server.lock();
+                if (server)
+                {
+                    if (index == 0)
+                        server->_bytes_upstream += sent;
+                    else
+                        server->_bytes_downstream += sent;
+                }
+                continue;
+            }
+
+            // Wait until the destination socket is ready to send more data
+            if (ec == asio::error::would_block)
+                Wait(index, *pump.destination, asio::socket_base::wait_write);
+            else
+            {
+                // Closed destination peer is the usual disconnect
+                if (ec != asio::error::broken_pipe)
+                    SendError(ec);
+                Disconnect(true);
+            }
+            return;
+        }
+
+        // Forward the end of stream to the destination socket
+        if (pump.eof)
+        {
+            pump.finished = true;
+            pump.destination->shutdown(asio::socket_base::shutdown_send, ec);
+
+            // Disconnect the session when both directions are finished
+            if (ec)
+                SendError(ec);
+            if (ec || (_pumps[0].finished && _pumps[1].finished))
+                Disconnect(true);
+            return;
+        }
+
+        // Receive new data from the source socket
+        size_t received = Fill(pump, ec);
+        if (received > 0)
+        {
+            pump.pending = received;
+            continue;
+        }
+        if (ec == asio::error::eof)
+        {
+            pump.eof = true;
+            continue;
+        }
+
+        // Wait until the source socket has more data to receive
+        if (ec == asio::error::would_block)
+            Wait(index, *pump.source, asio::socket_base::wait_read);
+        else
+        {
+            SendError(ec);
+            Disconnect(true);
+        }
+        return;
+    }
+}
+
+void TCPProxySession::Wait(size_t index, asio::ip::tcp::socket& socket, asio::socket_base::wait_type type)
+{
+    // Async wait with the forward handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self, index](std::error_code ec)
+    {
+        if (!IsConnected())
+            return;
+
+        // Continue forwarding if the wait was successful
+        if (!ec)
+            Forward(index);
+        else
+        {
+            SendError(ec);
+            Disconnect(true);
+        }
+    };
+    if (_strand_required)
+        socket.async_wait(type, bind_executor(_strand, async_wait_handler));
+    else
+        socket.async_wait(type, bind_executor(*_io_service, async_wait_handler));
+}
+
+void TCPProxySession::Continue(size_t index)
+{
+    // Post the forward handler
+    auto self(this->shared_from_this());
+    auto forward_handler = [this, self, index]() { Forward(index); };
+    if (_strand_required)
+        _strand.post(forward_handler);
+    else
+        _io_service->post(forward_handler);
+}
+
+size_t TCPProxySession::Fill(Pump& pump, std::error_code& ec)
+{
+#if defined(__linux__)
+    if (_zero_copy)
+    {
+        // Move data from the source socket into the empty pipe
+        for (;;)
+        {
+            ssize_t result = splice((int)pump.source->native_handle(), nullptr, pump.pipe[1], nullptr, pump.capacity, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+            if (result > 0)
+                return (size_t)result;
+            if (result == 0)
+                ec = asio::error::eof;
+            else if (errno == EINTR)
+                continue;
+            else if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+                ec = asio::error::would_block;
+            else
+                ec = asio::error_code(errno, asio::error::get_system_category());
+            return 0;
+        }
+    }
+#endif
+
+    // Copy data from the source socket into the user space buffer
+    pump.offset = 0;
+    return pump.source->read_some(asio::buffer(pump.buffer.data(), pump.capacity), ec);
+}
+
+size_t TCPProxySession::Flush(Pump& pump, std::error_code& ec)
+{
+#if defined(__linux__)
+    if (_zero_copy)
+    {
+        // Move data from the pipe into the destination socket
+        for (;;)
+        {
+            ssize_t result = SpliceToSocket(pump.pipe[0], (int)pump.destination->native_handle(), pump.pending);
+            if (result > 0)
+            {
+                pump.pending -= (size_t)result;
+                return (size_t)result;
+            }
+            if ((result < 0) && (errno == EINTR))
+                continue;
+            if ((result == 0) || (errno == EAGAIN) || (errno == EWOULDBLOCK))
+                ec = asio::error::would_block;
+            else
+                ec = asio::error_code(errno, asio::error::get_system_category());
+            return 0;
+        }
+    }
+#endif
+
+    // Copy data from the user space buffer into the destination socket
+    size_t sent = pump.destination->write_some(asio::buffer(pump.buffer.data() + pump.offset, pump.pending), ec);
+    pump.offset += sent;
+    pump.pending -= sent;
+    return sent;
+}
+
+void TCPProxySession::ClosePipes()
+{
+#if defined(__linux__)
+    for (auto& pump : _pumps)
+    {
+        for (auto& fd : pump.pipe)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+                fd = -1;
+            }
+        }
+    }
+#endif
+}
+
+} // namespace Asio
+} // namespace CppServer
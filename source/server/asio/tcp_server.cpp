@@ -8,6 +8,8 @@
 
 #include "server/asio/tcp_server.h"
 
+#include <algorithm>
+
 namespace CppServer {
 namespace Asio {
 
@@ -21,12 +23,20 @@ TCPServer::TCPServer(const std::shared_ptr<Service>& service, int port, Internet
       _acceptor(*_io_service),
       _started(false),
       _bytes_pending(0),
-      _bytes_sent(0),
-      _bytes_received(0),
+      _fast_open_sessions(0),
+      _overloaded(false),
+      _accept_paused(false),
+      _shed_connections(0),
+      _shed_requests(0),
       _option_keep_alive(false),
       _option_no_delay(false),
       _option_reuse_address(false),
-      _option_reuse_port(false)
+      _option_reuse_port(false),
+      _option_fast_open(0),
+      _option_overload_pending_bytes(0),
+      _option_overload_shed_sessions(0),
+      _option_fair_quantum(0),
+      _option_replay_chunk(65536)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -55,12 +65,20 @@ TCPServer::TCPServer(const std::shared_ptr<Service>& service, const std::string&
       _acceptor(*_io_service),
       _started(false),
       _bytes_pending(0),
-      _bytes_sent(0),
-      _bytes_received(0),
+      _fast_open_sessions(0),
+      _overloaded(false),
+      _accept_paused(false),
+      _shed_connections(0),
+      _shed_requests(0),
       _option_keep_alive(false),
       _option_no_delay(false),
       _option_reuse_address(false),
-      _option_reuse_port(false)
+      _option_reuse_port(false),
+      _option_fast_open(0),
+      _option_overload_pending_bytes(0),
+      _option_overload_shed_sessions(0),
+      _option_fair_quantum(0),
+      _option_replay_chunk(65536)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -82,12 +100,20 @@ TCPServer::TCPServer(const std::shared_ptr<Service>& service, const asio::ip::tc
       _acceptor(*_io_service),
       _started(false),
       _bytes_pending(0),
-      _bytes_sent(0),
-      _bytes_received(0),
+      _fast_open_sessions(0),
+      _overloaded(false),
+      _accept_paused(false),
+      _shed_connections(0),
+      _shed_requests(0),
       _option_keep_alive(false),
       _option_no_delay(false),
       _option_reuse_address(false),
-      _option_reuse_port(false)
+      _option_reuse_port(false),
+      _option_fast_open(0),
+      _option_overload_pending_bytes(0),
+      _option_overload_shed_sessions(0),
+      _option_fair_quantum(0),
+      _option_replay_chunk(65536)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -119,17 +145,41 @@ bool TCPServer::Start()
             _acceptor.set_option(reuse_port(true));
         }
 #endif
+        if (option_fast_open() > 0)
+            FastOpen::EnableServer(_acceptor, option_fast_open());
         _acceptor.bind(_endpoint);
         _acceptor.listen();
 
         // Reset statistic
         _bytes_pending = 0;
-        _bytes_sent = 0;
-        _bytes_received = 0;
+        _statistics.Reset();
+        _fast_open_sessions = 0;
+        _shed_connections = 0;
+        _shed_requests = 0;
+
+        // Reset the overload state
+        _overloaded = false;
+        _accept_paused = false;
+
+        // Reset rate limits
+        _receive_limiter.Reset();
+        _send_limiter.Reset();
 
         // Update the started flag
         _started = true;
 
+        // Schedule the overload check
+        if ((_option_overload_loop_lag.total() > 0) || (_option_overload_pending_bytes > 0))
+        {
+            std::weak_ptr<TCPServer> weak(self);
+            _overload_token = _service->SchedulePeriodic(_io_service, CppCommon::Timespan::milliseconds(100), [weak]()
+            {
+                auto server = weak.lock();
+                if (server)
+                    server->CheckOverload();
+            });
+        }
+
         // Call the server started handler
         onStarted();
 
@@ -160,6 +210,11 @@ bool TCPServer::Stop()
         // Close the server acceptor
         _acceptor.close();
 
+        // Cancel the overload check
+        _overload_token.Cancel();
+        _overloaded = false;
+        _accept_paused = false;
+
         // Reset the session
         _session->ResetServer();
 
@@ -209,6 +264,16 @@ void TCPServer::Accept()
         // Create a new session to accept
         _session = CreateSession(self);
 
+        // Pause accepting new connections while the server is overloaded
+        if (_overloaded)
+        {
+            _accept_paused = true;
+
+            // Overload check could have resumed accepting in between
+            if (_overloaded || !_accept_paused.exchange(false))
+                return;
+        }
+
         auto async_accept_handler = make_alloc_handler(_acceptor_storage, [this, self](std::error_code ec)
         {
             if (!ec)
@@ -247,11 +312,65 @@ bool TCPServer::Multicast(const void* buffer, size_t size)
     if (buffer == nullptr)
         return false;
 
+    // Copy the multicast data once for all working threads
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    auto data = std::make_shared<const std::vector<uint8_t>>(bytes, bytes + size);
+
     std::shared_lock<std::shared_mutex> locker(_sessions_lock);
 
-    // Multicast all sessions
-    for (auto& session : _sessions)
-        session.second->SendAsync(buffer, size);
+    // Append the multicast data to the journal
+    uint64_t sequence = Journal(data);
+
+    // Multicast all sessions with a single task per working thread
+    MulticastBatched(service(), _sessions, [data, sequence](const std::shared_ptr<TCPSession>& session)
+    {
+        SendJournaled(session, sequence, data);
+    });
+
+    return true;
+}
+
+bool TCPServer::MulticastConflated(std::string_view key, const void* buffer, size_t size)
+{
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    // Copy the multicast key and data once for all working threads
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    auto data = std::make_shared<const std::pair<std::string, std::vector<uint8_t>>>(std::string(key), std::vector<uint8_t>(bytes, bytes + size));
+
+    std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+    // Multicast all sessions with conflation with a single task per working thread
+    MulticastBatched(service(), _sessions, [data](const std::shared_ptr<TCPSession>& session)
+    {
+        session->SendConflatedAsync(data->first, data->second.data(), data->second.size());
+    });
+
+    return true;
+}
+
+bool TCPServer::PublishToGroup(std::string_view group, const void* buffer, size_t size)
+{
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    // Publish to group members only
+    _groups.Publish(group, buffer, size);
 
     return true;
 }
@@ -282,6 +401,100 @@ bool TCPServer::DisconnectAll()
     return true;
 }
 
+ServerStatisticsSnapshot TCPServer::statistics()
+{
+    ServerStatisticsSnapshot snapshot;
+
+    {
+        std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+        snapshot.connected_sessions = _sessions.size();
+    }
+
+    _statistics.Snapshot(snapshot);
+    snapshot.shed_connections = _shed_connections;
+    snapshot.shed_requests = _shed_requests;
+
+    return snapshot;
+}
+
+void TCPServer::CheckOverload()
+{
+    if (!IsStarted())
+        return;
+
+    uint64_t loop_lag_threshold = (uint64_t)std::max<int64_t>(_option_overload_loop_lag.total(), 0);
+    uint64_t pending_bytes_threshold = _option_overload_pending_bytes;
+
+    // Measure the event loop lag
+    uint64_t loop_lag = (loop_lag_threshold > 0) ? _service->loop_lag() : 0;
+
+    // Measure the number of bytes pending sent by all sessions
+    uint64_t pending_bytes = 0;
+    if (pending_bytes_threshold > 0)
+    {
+        std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+        for (auto& session : _sessions)
+            pending_bytes += session.second->bytes_pending();
+    }
+
+    bool overloaded = _overloaded;
+    if (!overloaded)
+    {
+        // Enter the overload state when any threshold is met
+        overloaded = ((loop_lag_threshold > 0) && (loop_lag >= loop_lag_threshold)) ||
+                     ((pending_bytes_threshold > 0) && (pending_bytes >= pending_bytes_threshold));
+    }
+    else
+    {
+        // Leave the overload state when all values drop below a half of their thresholds
+        overloaded = ((loop_lag_threshold > 0) && (loop_lag >= loop_lag_threshold / 2)) ||
+                     ((pending_bytes_threshold > 0) && (pending_bytes >= pending_bytes_threshold / 2));
+    }
+
+    if (overloaded != _overloaded)
+    {
+        // Update the overload state
+        _overloaded = overloaded;
+
+        // Call the server overload state changed handler
+        onOverloaded(overloaded);
+
+        // Resume accepting new connections
+        if (!overloaded && _accept_paused.exchange(false))
+            Accept();
+    }
+
+    // Shed sessions with the lowest priority
+    if (overloaded && (_option_overload_shed_sessions > 0))
+        ShedSessions();
+}
+
+void TCPServer::ShedSessions()
+{
+    std::vector<std::shared_ptr<TCPSession>> sessions;
+
+    {
+        std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+        sessions.reserve(_sessions.size());
+        for (auto& session : _sessions)
+            sessions.emplace_back(session.second);
+    }
+
+    // Select sessions with the lowest priority and the most pending bytes
+    size_t count = std::min(_option_overload_shed_sessions, sessions.size());
+    std::partial_sort(sessions.begin(), sessions.begin() + count, sessions.end(), [](const std::shared_ptr<TCPSession>& s1, const std::shared_ptr<TCPSession>& s2)
+    {
+        if (s1->option_priority() != s2->option_priority())
+            return s1->option_priority() < s2->option_priority();
+        return s1->bytes_pending() > s2->bytes_pending();
+    });
+
+    // Disconnect selected sessions
+    for (size_t i = 0; i < count; ++i)
+        if (sessions[i]->Disconnect())
+            ++_shed_connections;
+}
+
 std::shared_ptr<TCPSession> TCPServer::FindSession(const CppCommon::UUID& id)
 {
     std::shared_lock<std::shared_mutex> locker(_sessions_lock);
@@ -307,6 +520,9 @@ void TCPServer::UnregisterSession(const CppCommon::UUID& id)
     auto it = _sessions.find(id);
     if (it != _sessions.end())
     {
+        // Leave all subscription groups
+        _groups.LeaveAll(it->second);
+
         // Erase the session
         _sessions.erase(it);
     }
@@ -7,8 +7,14 @@
 */
 
 #include "server/asio/tcp_session.h"
+#include "server/asio/poll.h"
 #include "server/asio/tcp_server.h"
 
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <limits>
+
 namespace CppServer {
 namespace Asio {
 
@@ -26,8 +32,26 @@ TCPSession::TCPSession(const std::shared_ptr<TCPServer>& server)
       _bytes_received(0),
       _receiving(false),
       _sending(false),
-      _send_buffer_flush_offset(0)
+      _send_buffer_flush_offset(0),
+      _receive_throttled(false),
+      _send_throttled(false),
+      _fair_entry(*this),
+      _receive_pending_offset(0),
+      _receive_pending_size(0),
+      _timeout_entry(*this),
+      _timeout_idle(0),
+      _timeout_read(0),
+      _timeout_write(0),
+      _timeout_receive_tick(0),
+      _timeout_send_tick(0)
+{
+}
+
+TCPSession::~TCPSession()
 {
+    // Cancel the session timeouts entry
+    if (_timeout_wheel)
+        _timeout_wheel->Cancel(_timeout_entry);
 }
 
 size_t TCPSession::option_receive_buffer_size() const
@@ -65,6 +89,10 @@ void TCPSession::Connect()
     if (_server->option_no_delay())
         _socket.set_option(asio::ip::tcp::no_delay(true));
 
+    // Update TCP Fast Open statistic
+    if ((_server->option_fast_open() > 0) && FastOpen::IsUsed(_socket))
+        ++_server->_fast_open_sessions;
+
     // Prepare receive & send buffers
     _receive_buffer.resize(option_receive_buffer_size());
     _send_buffer_main.reserve(option_send_buffer_size());
@@ -74,11 +102,25 @@ void TCPSession::Connect()
     _bytes_pending = 0;
     _bytes_sending = 0;
     _bytes_sent = 0;
+    _bytes_sent_main = 0;
     _bytes_received = 0;
 
+    // Reset throttling flags
+    _receive_throttled = false;
+    _send_throttled = false;
+
+    // Prepare the fair queue of the session Asio IO service
+    _receive_pending_offset = 0;
+    _receive_pending_size = 0;
+    if ((_server->option_fair_quantum() > 0) && !_strand_required && !_fair_queue)
+        _fair_queue = _server->service()->GetFairQueue(_io_service);
+
     // Update the connected flag
     _connected = true;
 
+    // Start tracking session timeouts
+    StartTimeouts();
+
     // Try to receive something from the client
     TryReceive();
 
@@ -112,6 +154,9 @@ bool TCPSession::Disconnect(bool dispatch)
         // Update the connected flag
         _connected = false;
 
+        // Stop tracking session timeouts
+        StopTimeouts();
+
         // Update sending/receiving flags
         _receiving = false;
         _sending = false;
@@ -126,6 +171,11 @@ bool TCPSession::Disconnect(bool dispatch)
         auto disconnected_session(this->shared_from_this());
         _server->onDisconnected(disconnected_session);
 
+#if defined(CPPSERVER_COROUTINES)
+        // Resume pending awaiters
+        ResumeAwaiters();
+#endif
+
         // Dispatch the unregister session handler
         auto unregister_session_handler = [this, self]()
         {
@@ -154,6 +204,119 @@ bool TCPSession::Disconnect(bool dispatch)
     return true;
 }
 
+bool TCPSession::JoinGroup(std::string_view group)
+{
+    return _server->JoinGroup(group, this->shared_from_this());
+}
+
+bool TCPSession::LeaveGroup(std::string_view group)
+{
+    return _server->LeaveGroup(group, this->shared_from_this());
+}
+
+bool TCPSession::ReplayAsync(uint64_t sequence)
+{
+    if (!IsConnected())
+        return false;
+
+    {
+        std::scoped_lock locker(_replay_lock);
+
+        if (!_server->_journal || _replaying)
+            return false;
+
+        // Start replaying from the given sequence number
+        _replay_journal = _server->_journal;
+        _replay_sequence = std::max<uint64_t>(sequence, 1);
+        _replaying = true;
+    }
+
+    // Dispatch the replay handler
+    auto self(this->shared_from_this());
+    auto replay_handler = [this, self]()
+    {
+        // Try to replay the first chunk of the journal
+        TryReplay();
+    };
+    if (_strand_required)
+        _strand.dispatch(replay_handler);
+    else
+        _io_service->dispatch(replay_handler);
+
+    return true;
+}
+
+bool TCPSession::SendJournaled(uint64_t sequence, const void* buffer, size_t size)
+{
+    {
+        std::scoped_lock locker(_replay_lock);
+
+        // Skip messages delivered by the journal replay
+        if (_replaying || (sequence < _replay_sequence))
+            return IsConnected();
+    }
+
+    return SendAsync(buffer, size);
+}
+
+void TCPSession::TryReplay()
+{
+    uint64_t lost_sequence = 0;
+    uint64_t lost_count = 0;
+    uint64_t replayed_sequence = 0;
+
+    {
+        std::scoped_lock locker(_replay_lock);
+
+        if (!_replaying || !IsConnected())
+            return;
+
+        // Wait until pending data falls below the replay chunk
+        size_t pending = bytes_pending();
+        size_t chunk = _server->option_replay_chunk();
+        if (pending >= chunk)
+            return;
+
+        // Read the next chunk of the journal
+        std::vector<MulticastJournal::Message> messages;
+        uint64_t sequence = _replay_journal->Read(_replay_sequence, chunk - pending, messages);
+
+        // Check for messages evicted from the journal
+        if (sequence > _replay_sequence)
+        {
+            lost_sequence = _replay_sequence;
+            lost_count = sequence - _replay_sequence;
+        }
+        _replay_sequence = sequence;
+
+        if (messages.empty())
+        {
+            // Replay caught up with the journal
+            _replaying = false;
+            _replay_journal.reset();
+            replayed_sequence = _replay_sequence;
+        }
+        else
+        {
+            // Send the chunk of journal messages
+            for (const auto& message : messages)
+            {
+                if (!SendAsync(message->data(), message->size()))
+                    return;
+                ++_replay_sequence;
+            }
+        }
+    }
+
+    // Call the replay lost handler
+    if (lost_count > 0)
+        onReplayLost(lost_sequence, lost_count);
+
+    // Call the replayed handler
+    if (replayed_sequence > 0)
+        onReplayed(replayed_sequence);
+}
+
 size_t TCPSession::Send(const void* buffer, size_t size)
 {
     if (!IsConnected())
@@ -174,7 +337,7 @@ size_t TCPSession::Send(const void* buffer, size_t size)
     {
         // Update statistic
         _bytes_sent += sent;
-        _server->_bytes_sent += sent;
+        _server->_statistics.AddBytesSent(sent);
 
         // Call the buffer sent handler
         onSent(sent, bytes_pending());
@@ -202,43 +365,17 @@ size_t TCPSession::Send(const void* buffer, size_t size, const CppCommon::Timesp
     if (buffer == nullptr)
         return 0;
 
-    int done = 0;
-    std::mutex mtx;
-    std::condition_variable cv;
     asio::error_code error;
-    asio::system_timer timer(_socket.get_executor());
-
-    // Prepare done handler
-    auto async_done_handler = [&](asio::error_code ec)
-    {
-        std::unique_lock<std::mutex> lck(mtx);
-        if (done++ == 0)
-        {
-            error = ec;
-            _socket.cancel();
-            timer.cancel();
-        }
-        cv.notify_one();
-    };
-
-    // Async wait for timeout
-    timer.expires_from_now(timeout.chrono());
-    timer.async_wait([&](const asio::error_code& ec) { async_done_handler(ec ? ec : asio::error::timed_out); });
-
-    // Async write some data to the client
-    size_t sent = 0;
-    _socket.async_write_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
 
-    // Wait for complete or timeout
-    std::unique_lock<std::mutex> lck(mtx);
-    cv.wait(lck, [&]() { return done == 2; });
+    // Write some data to the client with timeout
+    size_t sent = Poll::Send(_socket, buffer, size, timeout, error);
 
     // Send data to the client
     if (sent > 0)
     {
         // Update statistic
         _bytes_sent += sent;
-        _server->_bytes_sent += sent;
+        _server->_statistics.AddBytesSent(sent);
 
         // Call the buffer sent handler
         onSent(sent, bytes_pending());
@@ -254,7 +391,7 @@ size_t TCPSession::Send(const void* buffer, size_t size, const CppCommon::Timesp
     return sent;
 }
 
-bool TCPSession::SendAsync(const void* buffer, size_t size)
+bool TCPSession::SendAsync(const void* buffer, size_t size, SendPriority priority)
 {
     if (!IsConnected())
         return false;
@@ -270,21 +407,38 @@ bool TCPSession::SendAsync(const void* buffer, size_t size)
         std::scoped_lock locker(_send_lock);
 
         // Detect multiple send handlers
-        bool send_required = _send_buffer_main.empty() || _send_buffer_flush.empty();
+        bool send_required = (_send_buffer_main.empty() && _send_buffer_high.empty() && _send_conflated.empty()) || _send_buffer_flush.empty();
 
         // Check the send buffer limit
-        if (((_send_buffer_main.size() + size) > _send_buffer_limit) && (_send_buffer_limit > 0))
+        if (((_send_buffer_main.size() - _send_buffer_main_offset + _send_buffer_high.size() + _send_conflated_size + size) > _send_buffer_limit) && (_send_buffer_limit > 0))
         {
             SendError(asio::error::no_buffer_space);
             return false;
         }
 
-        // Fill the main send buffer
+        // Fill the send buffer of the given priority lane
         const uint8_t* bytes = (const uint8_t*)buffer;
-        _send_buffer_main.insert(_send_buffer_main.end(), bytes, bytes + size);
+        std::vector<uint8_t>& send_buffer = (priority == SendPriority::High) ? _send_buffer_high : _send_buffer_main;
+        send_buffer.insert(send_buffer.end(), bytes, bytes + size);
+
+        // Mark the message boundary at the end of each main buffer slice
+        if (priority != SendPriority::High)
+        {
+            size_t slice = _send_buffer_main_marks.empty() ? _send_buffer_main_offset : _send_buffer_main_marks.back();
+            if ((_send_buffer_main.size() - slice) >= SEND_SLICE)
+                _send_buffer_main_marks.push_back(_send_buffer_main.size());
+        }
 
         // Update statistic
-        _bytes_pending = _send_buffer_main.size();
+        _bytes_pending = _send_buffer_main.size() - _send_buffer_main_offset + _send_buffer_high.size() + _send_conflated_size;
+
+        // Consume the send messages rate limits
+        if (_send_limiter.IsLimited() || _server->_send_limiter.IsLimited())
+        {
+            uint64_t timestamp = CppCommon::Timestamp::nano();
+            _send_limiter.Consume(0, 1, timestamp);
+            _server->_send_limiter.Consume(0, 1, timestamp);
+        }
 
         // Avoid multiple send handlers
         if (!send_required)
@@ -306,6 +460,77 @@ bool TCPSession::SendAsync(const void* buffer, size_t size)
     return true;
 }
 
+bool TCPSession::SendConflatedAsync(std::string_view key, const void* buffer, size_t size)
+{
+    if (!IsConnected())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    {
+        std::scoped_lock locker(_send_lock);
+
+        // Detect multiple send handlers
+        bool send_required = (_send_buffer_main.empty() && _send_buffer_high.empty() && _send_conflated.empty()) || _send_buffer_flush.empty();
+
+        // Find the previous conflated data with the same key
+        auto it = _send_conflated_index.find(key);
+        size_t previous = (it != _send_conflated_index.end()) ? _send_conflated[it->second].second.size() : 0;
+
+        // Check the send buffer limit
+        if (((_send_buffer_main.size() - _send_buffer_main_offset + _send_buffer_high.size() + _send_conflated_size - previous + size) > _send_buffer_limit) && (_send_buffer_limit > 0))
+        {
+            SendError(asio::error::no_buffer_space);
+            return false;
+        }
+
+        // Replace the previous conflated data in place or append a new key
+        const uint8_t* bytes = (const uint8_t*)buffer;
+        if (it != _send_conflated_index.end())
+            _send_conflated[it->second].second.assign(bytes, bytes + size);
+        else
+        {
+            _send_conflated_index.emplace(key, _send_conflated.size());
+            _send_conflated.emplace_back(std::string(key), std::vector<uint8_t>(bytes, bytes + size));
+        }
+        _send_conflated_size = _send_conflated_size - previous + size;
+
+        // Update statistic
+        _bytes_pending = _send_buffer_main.size() - _send_buffer_main_offset + _send_buffer_high.size() + _send_conflated_size;
+
+        // Consume the send messages rate limits
+        if (_send_limiter.IsLimited() || _server->_send_limiter.IsLimited())
+        {
+            uint64_t timestamp = CppCommon::Timestamp::nano();
+            _send_limiter.Consume(0, 1, timestamp);
+            _server->_send_limiter.Consume(0, 1, timestamp);
+        }
+
+        // Avoid multiple send handlers
+        if (!send_required)
+            return true;
+    }
+
+    // Dispatch the send handler
+    auto self(this->shared_from_this());
+    auto send_handler = [this, self]()
+    {
+        // Try to send the conflated data
+        TrySend();
+    };
+    if (_strand_required)
+        _strand.dispatch(send_handler);
+    else
+        _io_service->dispatch(send_handler);
+
+    return true;
+}
+
 size_t TCPSession::Receive(void* buffer, size_t size)
 {
     if (!IsConnected())
@@ -326,7 +551,7 @@ size_t TCPSession::Receive(void* buffer, size_t size)
     {
         // Update statistic
         _bytes_received += received;
-        _server->_bytes_received += received;
+        _server->_statistics.AddBytesReceived(received);
 
         // Call the buffer received handler
         onReceived(buffer, received);
@@ -361,43 +586,17 @@ size_t TCPSession::Receive(void* buffer, size_t size, const CppCommon::Timespan&
     if (buffer == nullptr)
         return 0;
 
-    int done = 0;
-    std::mutex mtx;
-    std::condition_variable cv;
     asio::error_code error;
-    asio::system_timer timer(_socket.get_executor());
-
-    // Prepare done handler
-    auto async_done_handler = [&](asio::error_code ec)
-    {
-        std::unique_lock<std::mutex> lck(mtx);
-        if (done++ == 0)
-        {
-            error = ec;
-            _socket.cancel();
-            timer.cancel();
-        }
-        cv.notify_one();
-    };
 
-    // Async wait for timeout
-    timer.expires_from_now(timeout.chrono());
-    timer.async_wait([&](const asio::error_code& ec) { async_done_handler(ec ? ec : asio::error::timed_out); });
-
-    // Async read some data from the client
-    size_t received = 0;
-    _socket.async_read_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
-
-    // Wait for complete or timeout
-    std::unique_lock<std::mutex> lck(mtx);
-    cv.wait(lck, [&]() { return done == 2; });
+    // Read some data from the client with timeout
+    size_t received = Poll::Receive(_socket, buffer, size, timeout, error);
 
     // Received some data from the client
     if (received > 0)
     {
         // Update statistic
         _bytes_received += received;
-        _server->_bytes_received += received;
+        _server->_statistics.AddBytesReceived(received);
 
         // Call the buffer received handler
         onReceived(buffer, received);
@@ -426,14 +625,194 @@ void TCPSession::ReceiveAsync()
     TryReceive();
 }
 
+void TCPSession::ResumeReceive()
+{
+    if (!_receive_paused.exchange(false))
+        return;
+
+    // Dispatch the receive handler
+    auto self(this->shared_from_this());
+    auto receive_handler = [this, self]()
+    {
+        // Try to receive data from the client
+        TryReceive();
+    };
+    if (_strand_required)
+        _strand.dispatch(receive_handler);
+    else
+        _io_service->dispatch(receive_handler);
+}
+
+#if defined(CPPSERVER_COROUTINES)
+
+SendAwaiter<TCPSession> TCPSession::SendAsync(const void* buffer, size_t size, const CppCommon::Timespan& timeout)
+{
+    return SendAwaiter<TCPSession>(this->shared_from_this(), _strand_required, buffer, size, timeout);
+}
+
+ReceiveAwaiter<TCPSession> TCPSession::ReceiveAsync(void* buffer, size_t size, const CppCommon::Timespan& timeout)
+{
+    // Start the awaiting mode to cache received data between awaits
+    _receive_awaiting = true;
+
+    return ReceiveAwaiter<TCPSession>(this->shared_from_this(), _strand_required, buffer, size, timeout);
+}
+
+void TCPSession::StopReceiveAwaiting()
+{
+    _receive_awaiting = false;
+
+    // Drop cached data on the session executor
+    auto self(this->shared_from_this());
+    auto stop_handler = [this, self]()
+    {
+        if (!_receive_awaiting)
+            _receive_awaiter_cache.clear();
+    };
+    if (_strand_required)
+        _strand.dispatch(stop_handler);
+    else
+        _io_service->dispatch(stop_handler);
+}
+
+void TCPSession::StartReceiveAwaiter(ReceiveAwaiter<TCPSession>* awaiter)
+{
+    // Complete the awaiter with cached data
+    if (!_receive_awaiter_cache.empty())
+    {
+        size_t size = std::min(awaiter->size(), _receive_awaiter_cache.size());
+        std::memcpy(awaiter->buffer(), _receive_awaiter_cache.data(), size);
+        _receive_awaiter_cache.erase(_receive_awaiter_cache.begin(), _receive_awaiter_cache.begin() + size);
+        awaiter->Complete(size);
+        return;
+    }
+
+    // Only one receive awaiter could be pending
+    if (_receive_awaiter != nullptr)
+    {
+        awaiter->Complete(0);
+        return;
+    }
+
+    if (!IsConnected() || (awaiter->size() == 0))
+    {
+        awaiter->Complete(0);
+        return;
+    }
+
+    _receive_awaiter = awaiter;
+}
+
+void TCPSession::CancelReceiveAwaiter(ReceiveAwaiter<TCPSession>* awaiter)
+{
+    // The awaiting mode is kept, so data received after the timeout is cached for the next await
+    if (_receive_awaiter == awaiter)
+        _receive_awaiter = nullptr;
+}
+
+bool TCPSession::ResumeReceiveAwaiter(const void* buffer, size_t size)
+{
+    if (!_receive_awaiting && (_receive_awaiter == nullptr))
+        return true;
+
+    const uint8_t* bytes = (const uint8_t*)buffer;
+
+    // Fill the pending awaiter buffer
+    size_t part = 0;
+    ReceiveAwaiter<TCPSession>* awaiter = std::exchange(_receive_awaiter, nullptr);
+    if (awaiter != nullptr)
+    {
+        part = std::min(awaiter->size(), size);
+        std::memcpy(awaiter->buffer(), bytes, part);
+    }
+
+    // Cache the rest of received data for the next await in the awaiting mode
+    if ((part < size) && _receive_awaiting)
+    {
+        // Check the receive buffer limit or the default awaiter cache limit
+        size_t limit = (_receive_buffer_limit > 0) ? _receive_buffer_limit : ReceiveAwaiter<TCPSession>::CACHE_LIMIT;
+        if ((_receive_awaiter_cache.size() + size - part) > limit)
+            return false;
+
+        _receive_awaiter_cache.insert(_receive_awaiter_cache.end(), bytes + part, bytes + size);
+    }
+
+    // Complete the pending awaiter
+    if (awaiter != nullptr)
+        awaiter->Complete(part);
+
+    return true;
+}
+
+void TCPSession::StartSendAwaiter(SendAwaiter<TCPSession>* awaiter)
+{
+    // Only one send awaiter could be pending
+    if ((_send_awaiter != nullptr) || !SendAsync(awaiter->buffer(), awaiter->size()))
+    {
+        awaiter->Complete(0);
+        return;
+    }
+
+    // Main buffer data is sent in order, so the awaiter is completed when all main buffer bytes enqueued so far
+    // are sent. High priority and conflated data could be sent ahead of them and is not counted.
+    {
+        std::scoped_lock locker(_send_lock);
+        uint64_t flushing = _send_buffer_flush_main ? (_send_buffer_flush.size() - _send_buffer_flush_offset) : 0;
+        awaiter->SetupTarget(_bytes_sent_main + flushing + _send_buffer_main.size() - _send_buffer_main_offset);
+    }
+
+    if (_bytes_sent_main >= awaiter->target())
+    {
+        awaiter->Complete(awaiter->size());
+        return;
+    }
+
+    _send_awaiter = awaiter;
+}
+
+uint64_t TCPSession::CancelSendAwaiter(SendAwaiter<TCPSession>* awaiter)
+{
+    if (_send_awaiter == awaiter)
+        _send_awaiter = nullptr;
+
+    return _bytes_sent_main;
+}
+
+void TCPSession::ResumeAwaiters()
+{
+    _receive_awaiter_cache.clear();
+
+    if (_receive_awaiter != nullptr)
+        std::exchange(_receive_awaiter, nullptr)->Complete(0);
+
+    if (_send_awaiter != nullptr)
+    {
+        auto awaiter = std::exchange(_send_awaiter, nullptr);
+        awaiter->Complete(awaiter->Sent(_bytes_sent_main));
+    }
+}
+
+#endif
+
 void TCPSession::TryReceive()
 {
-    if (_receiving)
+    if (_receiving || _receive_detached || _receive_paused || _receive_throttled || (_receive_pending_size > 0))
         return;
 
     if (!IsConnected())
         return;
 
+    // Stop receiving until the receive budget is refilled for the whole receive buffer
+    uint64_t delay = ThrottleDelay(true, _receive_buffer.size());
+    if (delay > 0)
+    {
+        Throttle(true, delay);
+        return;
+    }
+
+    // Limit the receive size with the receive budget
+    size_t receive = ReceiveBudget(_receive_buffer.size());
+
     // Async receive with the receive handler
     _receiving = true;
     auto self(this->shared_from_this());
@@ -449,24 +828,38 @@ void TCPSession::TryReceive()
         {
             // Update statistic
             _bytes_received += size;
-            _server->_bytes_received += size;
-
-            // Call the buffer received handler
-            onReceived(_receive_buffer.data(), size);
+            _server->_statistics.AddBytesReceived(size);
 
-            // If the receive buffer is full increase its size
-            if (_receive_buffer.size() == size)
+            // Consume the receive rate limits
+            if (_receive_limiter.IsLimited() || _server->_receive_limiter.IsLimited())
             {
-                // Check the receive buffer limit
-                if (((2 * size) > _receive_buffer_limit) && (_receive_buffer_limit > 0))
-                {
-                    SendError(asio::error::no_buffer_space);
-                    Disconnect(true);
-                    return;
-                }
+                uint64_t timestamp = CppCommon::Timestamp::nano();
+                _receive_limiter.Consume(size, 1, timestamp);
+                _server->_receive_limiter.Consume(size, 1, timestamp);
+            }
+
+            // Update the receive activity tick
+            if (_timeout_wheel)
+                _timeout_receive_tick = _timeout_wheel->tick();
 
-                _receive_buffer.resize(2 * size);
+            // Deliver received data with the fair queue and receive again when it is processed
+            if (_fair_queue && !ec)
+            {
+                _receive_pending_offset = 0;
+                _receive_pending_size = size;
+                _fair_entry.SetupQuantum((_fair_quantum > 0) ? _fair_quantum : _server->option_fair_quantum());
+                _fair_entry.SetupSchedulingClass(_scheduling_class);
+                _fair_queue->Enqueue(std::shared_ptr<FairQueue::Entry>(self, &_fair_entry));
+                return;
             }
+
+            // Call the buffer received handler
+            if (!ProcessReceived(_receive_buffer.data(), size))
+                return;
+
+            // If the receive buffer is full increase its size
+            if (!ExpandReceiveBuffer(size))
+                return;
         }
 
         // Try to receive again if the session is valid
@@ -479,14 +872,14 @@ void TCPSession::TryReceive()
         }
     });
     if (_strand_required)
-        _socket.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), bind_executor(_strand, async_receive_handler));
+        _socket.async_read_some(asio::buffer(_receive_buffer.data(), receive), bind_executor(_strand, async_receive_handler));
     else
-        _socket.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), async_receive_handler);
+        _socket.async_read_some(asio::buffer(_receive_buffer.data(), receive), async_receive_handler);
 }
 
 void TCPSession::TrySend()
 {
-    if (_sending)
+    if (_sending || _send_throttled)
         return;
 
     if (!IsConnected())
@@ -497,12 +890,55 @@ void TCPSession::TrySend()
     {
         std::scoped_lock locker(_send_lock);
 
-        // Swap flush and main buffers
-        _send_buffer_flush.swap(_send_buffer_main);
+        // Swap flush buffer with the high priority buffer first, then interleave
+        // slices of the main buffer with the latest conflated data of all keys
+        _send_buffer_flush_main = false;
+        if (!_send_buffer_high.empty())
+            _send_buffer_flush.swap(_send_buffer_high);
+        else if (!_send_conflated.empty() && (_send_conflated_turn || _send_buffer_main.empty()))
+        {
+            // Flush the latest conflated data of all keys
+            for (const auto& conflated : _send_conflated)
+                _send_buffer_flush.insert(_send_buffer_flush.end(), conflated.second.begin(), conflated.second.end());
+            _send_conflated_index.clear();
+            _send_conflated.clear();
+            _send_conflated_size = 0;
+            _send_conflated_turn = false;
+        }
+        else if (!_send_buffer_main.empty())
+        {
+            // Flush the main buffer by slices of whole messages, so high priority data waits for one slice at most
+            size_t slice = _send_buffer_main_marks.empty() ? _send_buffer_main.size() : _send_buffer_main_marks.front();
+            if ((_send_buffer_main_offset == 0) && (slice == _send_buffer_main.size()))
+            {
+                _send_buffer_flush.swap(_send_buffer_main);
+                _send_buffer_main_marks.clear();
+            }
+            else
+            {
+                _send_buffer_flush.assign(_send_buffer_main.begin() + _send_buffer_main_offset, _send_buffer_main.begin() + slice);
+                _send_buffer_main_offset = slice;
+                if (!_send_buffer_main_marks.empty())
+                    _send_buffer_main_marks.pop_front();
+
+                // Compact the main buffer when at least half of it is flushed
+                if ((2 * _send_buffer_main_offset) >= _send_buffer_main.size())
+                {
+                    _send_buffer_main.erase(_send_buffer_main.begin(), _send_buffer_main.begin() + _send_buffer_main_offset);
+                    for (auto& mark : _send_buffer_main_marks)
+                        mark -= _send_buffer_main_offset;
+                    _send_buffer_main_offset = 0;
+                }
+            }
+
+            // Flush conflated data after this slice
+            _send_conflated_turn = true;
+            _send_buffer_flush_main = true;
+        }
         _send_buffer_flush_offset = 0;
 
         // Update statistic
-        _bytes_pending = 0;
+        _bytes_pending = _send_buffer_main.size() - _send_buffer_main_offset + _send_buffer_high.size() + _send_conflated_size;
         _bytes_sending += _send_buffer_flush.size();
     }
 
@@ -514,6 +950,18 @@ void TCPSession::TrySend()
         return;
     }
 
+    // Delay sending until the send budget is refilled
+    uint64_t delay = ThrottleDelay(false);
+    if (delay > 0)
+    {
+        Throttle(false, delay);
+        return;
+    }
+
+    // Update the send activity tick
+    if (_timeout_wheel)
+        _timeout_send_tick = _timeout_wheel->tick();
+
     // Async write with the write handler
     _sending = true;
     auto self(this->shared_from_this());
@@ -530,10 +978,24 @@ void TCPSession::TrySend()
             // Update statistic
             _bytes_sending -= size;
             _bytes_sent += size;
-            _server->_bytes_sent += size;
+            _server->_statistics.AddBytesSent(size);
+
+            // Consume the send bytes rate limits
+            if (_send_limiter.IsLimited() || _server->_send_limiter.IsLimited())
+            {
+                uint64_t timestamp = CppCommon::Timestamp::nano();
+                _send_limiter.Consume(size, 0, timestamp);
+                _server->_send_limiter.Consume(size, 0, timestamp);
+            }
+
+            // Update the send activity tick
+            if (_timeout_wheel)
+                _timeout_send_tick = _timeout_wheel->tick();
 
             // Increase the flush buffer offset
             _send_buffer_flush_offset += size;
+            if (_send_buffer_flush_main)
+                _bytes_sent_main += size;
 
             // Successfully send the whole flush buffer
             if (_send_buffer_flush_offset == _send_buffer_flush.size())
@@ -545,6 +1007,19 @@ void TCPSession::TrySend()
 
             // Call the buffer sent handler
             onSent(size, bytes_pending());
+
+#if defined(CPPSERVER_COROUTINES)
+            // Resume the send awaiter if its buffer was completely sent
+            if ((_send_awaiter != nullptr) && (_bytes_sent_main >= _send_awaiter->target()))
+            {
+                auto awaiter = std::exchange(_send_awaiter, nullptr);
+                awaiter->Complete(awaiter->size());
+            }
+#endif
+
+            // Replay the next chunk of the multicast journal
+            if (_replaying)
+                TryReplay();
         }
 
         // Try to send again if the session is valid
@@ -562,6 +1037,218 @@ void TCPSession::TrySend()
         _socket.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), async_write_handler);
 }
 
+bool TCPSession::ProcessReceived(const void* buffer, size_t size)
+{
+    // Call the buffer received handler
+    onReceived(buffer, size);
+
+#if defined(CPPSERVER_COROUTINES)
+    // Resume the receive awaiter
+    if (!ResumeReceiveAwaiter(buffer, size))
+    {
+        SendError(asio::error::no_buffer_space);
+        Disconnect(true);
+        return false;
+    }
+#endif
+
+    return true;
+}
+
+bool TCPSession::ExpandReceiveBuffer(size_t size)
+{
+    if (_receive_buffer.size() != size)
+        return true;
+
+    // Check the receive buffer limit
+    if (((2 * size) > _receive_buffer_limit) && (_receive_buffer_limit > 0))
+    {
+        SendError(asio::error::no_buffer_space);
+        Disconnect(true);
+        return false;
+    }
+
+    _receive_buffer.resize(2 * size);
+    return true;
+}
+
+size_t TCPSession::DispatchReceived(size_t budget, bool& pending)
+{
+    pending = false;
+
+    if (!IsConnected() || (_receive_pending_size == 0))
+        return 0;
+
+    // Process the next part of received data within the given budget
+    size_t size = std::min(budget, _receive_pending_size - _receive_pending_offset);
+    if (!ProcessReceived(_receive_buffer.data() + _receive_pending_offset, size))
+        return size;
+    _receive_pending_offset += size;
+
+    // Wait for the next round if some received data is still pending
+    if ((_receive_pending_offset < _receive_pending_size) && IsConnected())
+    {
+        pending = true;
+        return size;
+    }
+
+    // All received data is processed
+    size_t received = _receive_pending_size;
+    _receive_pending_offset = 0;
+    _receive_pending_size = 0;
+
+    // If the receive buffer is full increase its size
+    if (!ExpandReceiveBuffer(received))
+        return size;
+
+    // Try to receive again
+    TryReceive();
+
+    return size;
+}
+
+uint64_t TCPSession::ThrottleDelay(bool receive, size_t size) const
+{
+    const RateLimiter& session_limiter = receive ? _receive_limiter : _send_limiter;
+    const RateLimiter& server_limiter = receive ? _server->_receive_limiter : _server->_send_limiter;
+    if (!session_limiter.IsLimited() && !server_limiter.IsLimited())
+        return 0;
+
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+    return std::max(session_limiter.Delay(timestamp, size), server_limiter.Delay(timestamp, size));
+}
+
+size_t TCPSession::ReceiveBudget(size_t size) const
+{
+    if (!_receive_limiter.IsLimited() && !_server->_receive_limiter.IsLimited())
+        return size;
+
+    // Read at least one byte if the budget is rounded down
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+    uint64_t budget = std::min(_receive_limiter.Available(timestamp), _server->_receive_limiter.Available(timestamp));
+    return (size_t)std::max<uint64_t>(std::min<uint64_t>(size, budget), 1);
+}
+
+void TCPSession::Throttle(bool receive, uint64_t delay)
+{
+    // Update the throttling flag
+    if (receive)
+        _receive_throttled = true;
+    else
+        _send_throttled = true;
+
+    // Schedule the throttled operation to resume
+    std::weak_ptr<TCPSession> weak(this->shared_from_this());
+    _server->service()->ScheduleAfter(_io_service, CppCommon::Timespan::nanoseconds(delay), [weak, receive]()
+    {
+        auto self = weak.lock();
+        if (!self)
+            return;
+
+        auto resume_handler = [self, receive]()
+        {
+            if (receive)
+            {
+                self->_receive_throttled = false;
+                self->TryReceive();
+            }
+            else
+            {
+                self->_send_throttled = false;
+                self->TrySend();
+            }
+        };
+        if (self->_strand_required)
+            self->_strand.dispatch(resume_handler);
+        else
+            self->_io_service->dispatch(resume_handler);
+    });
+}
+
+void TCPSession::StartTimeouts()
+{
+    const CppCommon::Timespan& idle = _server->option_idle_timeout();
+    const CppCommon::Timespan& read = _server->option_read_timeout();
+    const CppCommon::Timespan& write = _server->option_write_timeout();
+    if ((idle.total() <= 0) && (read.total() <= 0) && (write.total() <= 0))
+        return;
+
+    // Get the timing wheel of the session Asio IO service
+    if (!_timeout_wheel)
+        _timeout_wheel = _server->service()->GetTimingWheel(_io_service);
+
+    // Prepare timeouts in timing wheel ticks
+    _timeout_idle = _timeout_wheel->ticks(idle);
+    _timeout_read = _timeout_wheel->ticks(read);
+    _timeout_write = _timeout_wheel->ticks(write);
+
+    // Reset activity ticks
+    _timeout_receive_tick = _timeout_send_tick = _timeout_wheel->tick();
+
+    // Check session timeouts for the first time
+    CheckTimeouts();
+}
+
+void TCPSession::StopTimeouts()
+{
+    if (_timeout_wheel)
+        _timeout_wheel->Cancel(_timeout_entry);
+}
+
+void TCPSession::ExpireTimeouts()
+{
+    // Do not take the session ownership under the timing wheel lock: the last
+    // reference released here would destroy the session on the wheel thread
+    // and its destructor would cancel the entry under the same wheel lock.
+    // The session itself is alive here, because its destructor waits for
+    // the wheel lock to cancel the timeouts entry.
+    std::weak_ptr<TCPSession> weak(this->weak_from_this());
+
+    // Post the check timeouts handler
+    auto check_timeouts_handler = [weak]()
+    {
+        auto self = weak.lock();
+        if (self)
+            self->CheckTimeouts();
+    };
+    if (_strand_required)
+        _strand.post(check_timeouts_handler);
+    else
+        _io_service->post(check_timeouts_handler);
+}
+
+void TCPSession::CheckTimeouts()
+{
+    if (!IsConnected())
+        return;
+
+    uint64_t tick = _timeout_wheel->tick();
+
+    // Find the nearest session deadline
+    uint64_t deadline = std::numeric_limits<uint64_t>::max();
+    if (_timeout_idle > 0)
+        deadline = std::min(deadline, std::max(_timeout_receive_tick, _timeout_send_tick) + _timeout_idle);
+    if (_timeout_read > 0)
+        deadline = std::min(deadline, _timeout_receive_tick + _timeout_read);
+    if ((_timeout_write > 0) && _sending)
+        deadline = std::min(deadline, _timeout_send_tick + _timeout_write);
+
+    // Disconnect the stale session
+    if (tick >= deadline)
+    {
+        SendError(asio::error::timed_out);
+        Disconnect(true);
+        return;
+    }
+
+    // Check the write timeout later if the session is not sending
+    if (deadline == std::numeric_limits<uint64_t>::max())
+        deadline = tick + _timeout_write;
+
+    // Re-arm the session timeouts entry
+    _timeout_wheel->ArmAt(_timeout_entry, deadline);
+}
+
 void TCPSession::ClearBuffers()
 {
     {
@@ -569,13 +1256,30 @@ void TCPSession::ClearBuffers()
 
         // Clear send buffers
         _send_buffer_main.clear();
+        _send_buffer_main_marks.clear();
+        _send_buffer_main_offset = 0;
+        _send_buffer_high.clear();
+        _send_conflated_index.clear();
+        _send_conflated.clear();
+        _send_conflated_size = 0;
+        _send_conflated_turn = false;
         _send_buffer_flush.clear();
         _send_buffer_flush_offset = 0;
+        _send_buffer_flush_main = false;
 
         // Update statistic
         _bytes_pending = 0;
         _bytes_sending = 0;
     }
+
+    {
+        std::scoped_lock locker(_replay_lock);
+
+        // Stop the multicast journal replay
+        _replaying = false;
+        _replay_journal.reset();
+        _replay_sequence = 0;
+    }
 }
 
 void TCPSession::ResetServer()
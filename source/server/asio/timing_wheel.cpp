@@ -0,0 +1,221 @@
+/*!
+    \file timing_wheel.cpp
+    \brief Asio hierarchical timing wheel implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/timing_wheel.h"
+
+#include "errors/exceptions.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace CppServer {
+namespace Asio {
+
+TimingWheel::TimingWheel(const std::shared_ptr<asio::io_service>& io_service, const CppCommon::Timespan& resolution)
+    : _tick(0),
+      _size(0),
+      _timer(*io_service),
+      _resolution(resolution),
+      _ticking(false)
+{
+    assert((io_service != nullptr) && "Asio IO service is invalid!");
+    if (io_service == nullptr)
+        throw CppCommon::ArgumentException("Asio IO service is invalid!");
+
+    assert((resolution.total() > 0) && "Timing wheel resolution must be positive!");
+    if (resolution.total() <= 0)
+        throw CppCommon::ArgumentException("Timing wheel resolution must be positive!");
+}
+
+uint64_t TimingWheel::ticks(const CppCommon::Timespan& timespan) const noexcept
+{
+    if (timespan.total() <= 0)
+        return 0;
+
+    return (uint64_t)((timespan.total() + _resolution.total() - 1) / _resolution.total());
+}
+
+void TimingWheel::Arm(Entry& entry, const CppCommon::Timespan& timeout)
+{
+    uint64_t timeout_ticks = ticks(timeout);
+
+    std::scoped_lock locker(_lock);
+
+    // Entry with zero timeout will be expired on the next tick
+    uint64_t tick = _tick + std::max(timeout_ticks, (uint64_t)1);
+
+    if (entry.IsArmed())
+        Unlink(entry);
+    else
+        ++_size;
+
+    entry._expire = tick;
+    Insert(entry);
+
+    // Start the wheel timer
+    if (!_ticking)
+    {
+        _ticking = true;
+        _tick_time = std::chrono::steady_clock::now();
+        ScheduleTick();
+    }
+}
+
+void TimingWheel::ArmAt(Entry& entry, uint64_t tick)
+{
+    std::scoped_lock locker(_lock);
+
+    if (entry.IsArmed())
+        Unlink(entry);
+    else
+        ++_size;
+
+    entry._expire = std::max(tick, _tick + 1);
+    Insert(entry);
+
+    // Start the wheel timer
+    if (!_ticking)
+    {
+        _ticking = true;
+        _tick_time = std::chrono::steady_clock::now();
+        ScheduleTick();
+    }
+}
+
+bool TimingWheel::Cancel(Entry& entry)
+{
+    std::scoped_lock locker(_lock);
+
+    if (!entry.IsArmed())
+        return false;
+
+    Unlink(entry);
+    --_size;
+
+    return true;
+}
+
+void TimingWheel::Advance(uint64_t ticks)
+{
+    std::scoped_lock locker(_lock);
+
+    AdvanceInternal(ticks);
+}
+
+void TimingWheel::Insert(Entry& entry)
+{
+    uint64_t tick = _tick;
+
+    // Clamp too long timeouts to the wheel range
+    if ((entry._expire - tick) > MAX_TICKS)
+        entry._expire = tick + MAX_TICKS;
+
+    // Find the wheel level which covers the entry timeout
+    uint64_t delta = entry._expire - tick;
+    int level = 0;
+    while ((level < (LEVELS - 1)) && (delta >= (SLOTS << (level * SLOT_BITS))))
+        ++level;
+
+    // Link the entry to the head of the wheel slot
+    Entry*& head = _slots[level][(entry._expire >> (level * SLOT_BITS)) & SLOT_MASK];
+    entry._next = head;
+    entry._pprev = &head;
+    if (head != nullptr)
+        head->_pprev = &entry._next;
+    head = &entry;
+}
+
+void TimingWheel::Unlink(Entry& entry)
+{
+    *entry._pprev = entry._next;
+    if (entry._next != nullptr)
+        entry._next->_pprev = entry._pprev;
+    entry._pprev = nullptr;
+    entry._next = nullptr;
+}
+
+void TimingWheel::Tick()
+{
+    uint64_t tick = ++_tick;
+
+    // Cascade entries of higher levels when the lower level wraps
+    for (int level = 1; (level < LEVELS) && ((tick & ((1ull << (level * SLOT_BITS)) - 1)) == 0); ++level)
+    {
+        Entry* entry = std::exchange(_slots[level][(tick >> (level * SLOT_BITS)) & SLOT_MASK], nullptr);
+        while (entry != nullptr)
+        {
+            Entry* next = entry->_next;
+            Insert(*entry);
+            entry = next;
+        }
+    }
+
+    // Expire all entries of the current slot
+    Entry*& head = _slots[0][tick & SLOT_MASK];
+    while (head != nullptr)
+    {
+        Entry* entry = head;
+        Unlink(*entry);
+        --_size;
+
+        // Call the entry expired handler
+        entry->onExpired();
+    }
+}
+
+void TimingWheel::AdvanceInternal(uint64_t ticks)
+{
+    for (uint64_t i = 0; i < ticks; ++i)
+    {
+        // Skip the rest of ticks of the empty wheel
+        if (_size == 0)
+        {
+            _tick += ticks - i;
+            break;
+        }
+
+        Tick();
+    }
+}
+
+void TimingWheel::ScheduleTick()
+{
+    // Async wait for the next tick. The tick is scheduled by any thread while
+    // the previous handler is released by the IO thread, so the handler memory
+    // is not reused from the not thread-safe handler storage.
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const asio::error_code& ec)
+    {
+        std::scoped_lock locker(_lock);
+
+        // Stop ticking on timer errors
+        if (ec)
+        {
+            _ticking = false;
+            return;
+        }
+
+        // Advance the wheel for all elapsed ticks
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _tick_time);
+        uint64_t ticks = (uint64_t)(elapsed.count() / _resolution.total());
+        _tick_time += std::chrono::duration_cast<std::chrono::steady_clock::duration>(_resolution.chrono() * ticks);
+        AdvanceInternal(ticks);
+
+        // Continue ticking while there are armed entries
+        if (_size > 0)
+            ScheduleTick();
+        else
+            _ticking = false;
+    };
+    _timer.expires_at(_tick_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(_resolution.chrono()));
+    _timer.async_wait(async_wait_handler);
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -7,6 +7,7 @@
 */
 
 #include "server/asio/udp_client.h"
+#include "server/asio/poll.h"
 
 namespace CppServer {
 namespace Asio {
@@ -360,11 +361,14 @@ bool UDPClient::ConnectAsync(const std::shared_ptr<UDPResolver>& resolver)
         };
 
         // Resolve the server endpoint
-        asio::ip::udp::resolver::query query(_address, (_scheme.empty() ? std::to_string(_port) : _scheme));
-        if (_strand_required)
-            resolver->resolver().async_resolve(query, bind_executor(_strand, async_resolve_handler));
-        else
-            resolver->resolver().async_resolve(query, async_resolve_handler);
+        auto resolve_handler = [this, self, async_resolve_handler](std::error_code ec, const asio::ip::udp::resolver::results_type& endpoints) mutable
+        {
+            if (_strand_required)
+                _strand.dispatch([async_resolve_handler, ec, endpoints]() mutable { async_resolve_handler(ec, endpoints); });
+            else
+                async_resolve_handler(ec, endpoints);
+        };
+        resolver->ResolveAsync(_address, (_scheme.empty() ? std::to_string(_port) : _scheme), resolve_handler);
     };
     if (_strand_required)
         _strand.post(connect_handler);
@@ -532,36 +536,10 @@ size_t UDPClient::Send(const asio::ip::udp::endpoint& endpoint, const void* buff
     if (buffer == nullptr)
         return 0;
 
-    int done = 0;
-    std::mutex mtx;
-    std::condition_variable cv;
     asio::error_code error;
-    asio::system_timer timer(_socket.get_executor());
-
-    // Prepare done handler
-    auto async_done_handler = [&](asio::error_code ec)
-    {
-        std::unique_lock<std::mutex> lck(mtx);
-        if (done++ == 0)
-        {
-            error = ec;
-            _socket.cancel();
-            timer.cancel();
-        }
-        cv.notify_one();
-    };
 
-    // Async wait for timeout
-    timer.expires_from_now(timeout.chrono());
-    timer.async_wait([&](const asio::error_code& ec) { async_done_handler(ec ? ec : asio::error::timed_out); });
-
-    // Async send datagram to the server
-    size_t sent = 0;
-    _socket.async_send_to(asio::buffer(buffer, size), endpoint, [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
-
-    // Wait for complete or timeout
-    std::unique_lock<std::mutex> lck(mtx);
-    cv.wait(lck, [&]() { return done == 2; });
+    // Send datagram to the server with timeout
+    size_t sent = Poll::SendTo(_socket, endpoint, buffer, size, timeout, error);
 
     // Send datagram to the server
     if (sent > 0)
@@ -715,36 +693,10 @@ size_t UDPClient::Receive(asio::ip::udp::endpoint& endpoint, void* buffer, size_
     if (buffer == nullptr)
         return 0;
 
-    int done = 0;
-    std::mutex mtx;
-    std::condition_variable cv;
     asio::error_code error;
-    asio::system_timer timer(_socket.get_executor());
-
-    // Prepare done handler
-    auto async_done_handler = [&](asio::error_code ec)
-    {
-        std::unique_lock<std::mutex> lck(mtx);
-        if (done++ == 0)
-        {
-            error = ec;
-            _socket.cancel();
-            timer.cancel();
-        }
-        cv.notify_one();
-    };
-
-    // Async wait for timeout
-    timer.expires_from_now(timeout.chrono());
-    timer.async_wait([&](const asio::error_code& ec) { async_done_handler(ec ? ec : asio::error::timed_out); });
-
-    // Async receive datagram from the server
-    size_t received = 0;
-    _socket.async_receive_from(asio::buffer(buffer, size), endpoint, [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
 
-    // Wait for complete or timeout
-    std::unique_lock<std::mutex> lck(mtx);
-    cv.wait(lck, [&]() { return done == 2; });
+    // Receive datagram from the server with timeout
+    size_t received = Poll::ReceiveFrom(_socket, endpoint, buffer, size, timeout, error);
 
     // Update statistic
     ++_datagrams_received;
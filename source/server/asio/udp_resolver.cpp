@@ -16,12 +16,28 @@ UDPResolver::UDPResolver(const std::shared_ptr<Service>& service)
       _io_service(_service->GetAsioService()),
       _strand(*_io_service),
       _strand_required(_service->IsStrandRequired()),
-      _resolver(*_io_service)
+      _resolver(*_io_service),
+      _cache(std::make_shared<ResolverCache<asio::ip::udp>>(_io_service)),
+      _option_cache(false)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
         throw CppCommon::ArgumentException("Asio service is invalid!");
 }
 
+void UDPResolver::ResolveAsync(const std::string& host, const std::string& service, const ResolverCache<asio::ip::udp>::Handler& handler)
+{
+    // Resolve with the DNS resolver cache
+    if (_option_cache)
+    {
+        _cache->ResolveAsync(_resolver, host, service, handler);
+        return;
+    }
+
+    // Resolve without the DNS resolver cache
+    asio::ip::udp::resolver::query query(host, service);
+    _resolver.async_resolve(query, [handler](std::error_code ec, asio::ip::udp::resolver::results_type results) { handler(ec, results); });
+}
+
 } // namespace Asio
 } // namespace CppServer
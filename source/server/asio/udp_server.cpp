@@ -7,6 +7,9 @@
 */
 
 #include "server/asio/udp_server.h"
+#include "server/asio/poll.h"
+
+#include "time/timestamp.h"
 
 namespace CppServer {
 namespace Asio {
@@ -25,6 +28,7 @@ UDPServer::UDPServer(const std::shared_ptr<Service>& service, int port, Internet
       _bytes_received(0),
       _datagrams_sent(0),
       _datagrams_received(0),
+      _datagrams_dropped(0),
       _receiving(false),
       _sending(false),
       _option_reuse_address(false),
@@ -61,6 +65,7 @@ UDPServer::UDPServer(const std::shared_ptr<Service>& service, const std::string&
       _bytes_received(0),
       _datagrams_sent(0),
       _datagrams_received(0),
+      _datagrams_dropped(0),
       _receiving(false),
       _sending(false),
       _option_reuse_address(false),
@@ -90,6 +95,7 @@ UDPServer::UDPServer(const std::shared_ptr<Service>& service, const asio::ip::ud
       _bytes_received(0),
       _datagrams_sent(0),
       _datagrams_received(0),
+      _datagrams_dropped(0),
       _receiving(false),
       _sending(false)
 {
@@ -159,6 +165,11 @@ bool UDPServer::Start()
         _bytes_received = 0;
         _datagrams_sent = 0;
         _datagrams_received = 0;
+        _datagrams_dropped = 0;
+
+        // Reset receive rate limits
+        _receive_limiters.clear();
+        _receive_limiters_sweep = 1024;
 
          // Update the started flag
         _started = true;
@@ -297,36 +308,10 @@ size_t UDPServer::Send(const asio::ip::udp::endpoint& endpoint, const void* buff
     if (buffer == nullptr)
         return 0;
 
-    int done = 0;
-    std::mutex mtx;
-    std::condition_variable cv;
     asio::error_code error;
-    asio::system_timer timer(_socket.get_executor());
-
-    // Prepare done handler
-    auto async_done_handler = [&](asio::error_code ec)
-    {
-        std::unique_lock<std::mutex> lck(mtx);
-        if (done++ == 0)
-        {
-            error = ec;
-            _socket.cancel();
-            timer.cancel();
-        }
-        cv.notify_one();
-    };
-
-    // Async wait for timeout
-    timer.expires_from_now(timeout.chrono());
-    timer.async_wait([&](const asio::error_code& ec) { async_done_handler(ec ? ec : asio::error::timed_out); });
 
-    // Async send datagram to the client
-    size_t sent = 0;
-    _socket.async_send_to(asio::buffer(buffer, size), endpoint, [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
-
-    // Wait for complete or timeout
-    std::unique_lock<std::mutex> lck(mtx);
-    cv.wait(lck, [&]() { return done == 2; });
+    // Send datagram to the client with timeout
+    size_t sent = Poll::SendTo(_socket, endpoint, buffer, size, timeout, error);
 
     // Send datagram to the client
     if (sent > 0)
@@ -475,36 +460,10 @@ size_t UDPServer::Receive(asio::ip::udp::endpoint& endpoint, void* buffer, size_
     if (buffer == nullptr)
         return 0;
 
-    int done = 0;
-    std::mutex mtx;
-    std::condition_variable cv;
     asio::error_code error;
-    asio::system_timer timer(_socket.get_executor());
 
-    // Prepare done handler
-    auto async_done_handler = [&](asio::error_code ec)
-    {
-        std::unique_lock<std::mutex> lck(mtx);
-        if (done++ == 0)
-        {
-            error = ec;
-            _socket.cancel();
-            timer.cancel();
-        }
-        cv.notify_one();
-    };
-
-    // Async wait for timeout
-    timer.expires_from_now(timeout.chrono());
-    timer.async_wait([&](const asio::error_code& ec) { async_done_handler(ec ? ec : asio::error::timed_out); });
-
-    // Async receive datagram from the client
-    size_t received = 0;
-    _socket.async_receive_from(asio::buffer(buffer, size), endpoint, [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
-
-    // Wait for complete or timeout
-    std::unique_lock<std::mutex> lck(mtx);
-    cv.wait(lck, [&]() { return done == 2; });
+    // Receive datagram from the client with timeout
+    size_t received = Poll::ReceiveFrom(_socket, endpoint, buffer, size, timeout, error);
 
     // Update statistic
     ++_datagrams_received;
@@ -566,6 +525,15 @@ void UDPServer::TryReceive()
         ++_datagrams_received;
         _bytes_received += size;
 
+        // Check the receive rate limit of the client endpoint
+        if (!CheckReceiveRateLimit(_receive_endpoint, size))
+        {
+            // Drop the datagram and receive the next one
+            ++_datagrams_dropped;
+            TryReceive();
+            return;
+        }
+
         // Call the datagram received handler
         onReceived(_receive_endpoint, _receive_buffer.data(), size);
 
@@ -592,6 +560,42 @@ void UDPServer::TryReceive()
         _socket.async_receive_from(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), _receive_endpoint, async_receive_handler);
 }
 
+bool UDPServer::CheckReceiveRateLimit(const asio::ip::udp::endpoint& endpoint, size_t size)
+{
+    if ((_receive_rate_bytes == 0) && (_receive_rate_messages == 0))
+        return true;
+
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+
+    // Find or create the rate limiter of the given endpoint
+    auto it = _receive_limiters.find(endpoint);
+    if (it == _receive_limiters.end())
+    {
+        // Remove rate limiters of idle endpoints
+        if (_receive_limiters.size() >= _receive_limiters_sweep)
+        {
+            for (auto limiter = _receive_limiters.begin(); limiter != _receive_limiters.end();)
+            {
+                if (limiter->second.IsFull(timestamp))
+                    limiter = _receive_limiters.erase(limiter);
+                else
+                    ++limiter;
+            }
+            _receive_limiters_sweep = std::max<size_t>(2 * _receive_limiters.size(), 1024);
+        }
+
+        it = _receive_limiters.try_emplace(endpoint).first;
+        it->second.Setup(_receive_rate_bytes, _receive_rate_messages);
+    }
+
+    // Check the endpoint receive budget is enough for the whole datagram
+    if (it->second.Delay(timestamp, size) > 0)
+        return false;
+
+    it->second.Consume(size, 1, timestamp);
+    return true;
+}
+
 void UDPServer::ClearBuffers()
 {
     // Clear send buffers
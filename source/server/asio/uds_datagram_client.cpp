@@ -0,0 +1,551 @@
+/*!
+    \file uds_datagram_client.cpp
+    \brief Unix domain datagram socket client implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/uds_datagram_client.h"
+#include "server/asio/poll.h"
+
+#include <cstdio>
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace Asio {
+
+UDSDatagramClient::UDSDatagramClient(const std::shared_ptr<Service>& service, const std::string& path, const std::string& local_path)
+    : _id(CppCommon::UUID::Sequential()),
+      _service(service),
+      _io_service(_service->GetAsioService()),
+      _strand(*_io_service),
+      _strand_required(_service->IsStrandRequired()),
+      _path(path),
+      _local_path(local_path),
+      _endpoint(path),
+      _socket(*_io_service),
+      _connected(false),
+      _bytes_sending(0),
+      _bytes_sent(0),
+      _bytes_received(0),
+      _datagrams_sent(0),
+      _datagrams_received(0),
+      _receiving(false),
+      _sending(false),
+      _option_unlink_path(true)
+{
+    assert((service != nullptr) && "Asio service is invalid!");
+    if (service == nullptr)
+        throw CppCommon::ArgumentException("Asio service is invalid!");
+}
+
+UDSDatagramClient::UDSDatagramClient(const std::shared_ptr<Service>& service, const asio::local::datagram_protocol::endpoint& endpoint, const std::string& local_path)
+    : _id(CppCommon::UUID::Sequential()),
+      _service(service),
+      _io_service(_service->GetAsioService()),
+      _strand(*_io_service),
+      _strand_required(_service->IsStrandRequired()),
+      _path(endpoint.path()),
+      _local_path(local_path),
+      _endpoint(endpoint),
+      _socket(*_io_service),
+      _connected(false),
+      _bytes_sending(0),
+      _bytes_sent(0),
+      _bytes_received(0),
+      _datagrams_sent(0),
+      _datagrams_received(0),
+      _receiving(false),
+      _sending(false),
+      _option_unlink_path(true)
+{
+    assert((service != nullptr) && "Asio service is invalid!");
+    if (service == nullptr)
+        throw CppCommon::ArgumentException("Asio service is invalid!");
+}
+
+size_t UDSDatagramClient::option_receive_buffer_size() const
+{
+    asio::socket_base::receive_buffer_size option;
+    _socket.get_option(option);
+    return option.value();
+}
+
+size_t UDSDatagramClient::option_send_buffer_size() const
+{
+    asio::socket_base::send_buffer_size option;
+    _socket.get_option(option);
+    return option.value();
+}
+
+void UDSDatagramClient::SetupReceiveBufferSize(size_t size)
+{
+    asio::socket_base::receive_buffer_size option((int)size);
+    _socket.set_option(option);
+}
+
+void UDSDatagramClient::SetupSendBufferSize(size_t size)
+{
+    asio::socket_base::send_buffer_size option((int)size);
+    _socket.set_option(option);
+}
+
+bool UDSDatagramClient::Connect()
+{
+    if (IsConnected())
+        return false;
+
+    // Remove the stale client socket file left by the previous client instance
+    if (option_unlink_path() && !_local_path.empty())
+        std::remove(_local_path.c_str());
+
+    // Open a client socket and bind it to the client socket path
+    _socket.open(_endpoint.protocol());
+    _socket.bind(asio::local::datagram_protocol::endpoint(_local_path));
+
+    // Prepare receive buffer
+    _receive_buffer.resize(option_receive_buffer_size());
+
+    // Reset statistic
+    _bytes_sending = 0;
+    _bytes_sent = 0;
+    _bytes_received = 0;
+    _datagrams_sent = 0;
+    _datagrams_received = 0;
+
+    // Update the connected flag
+    _connected = true;
+
+    // Call the client connected handler
+    onConnected();
+
+    return true;
+}
+
+bool UDSDatagramClient::DisconnectInternal()
+{
+    if (!IsConnected())
+        return false;
+
+    // Close the client socket
+    _socket.close();
+
+    // Remove the client socket file
+    if (option_unlink_path() && !_local_path.empty())
+        std::remove(_local_path.c_str());
+
+    // Update the connected flag
+    _connected = false;
+
+    // Update sending/receiving flags
+    _receiving = false;
+    _sending = false;
+
+    // Clear send/receive buffers
+    ClearBuffers();
+
+    // Call the client disconnected handler
+    onDisconnected();
+
+    return true;
+}
+
+bool UDSDatagramClient::Reconnect()
+{
+    if (!Disconnect())
+        return false;
+
+    return Connect();
+}
+
+bool UDSDatagramClient::ConnectAsync()
+{
+    if (IsConnected())
+        return false;
+
+    // Post the connect handler
+    auto self(this->shared_from_this());
+    auto connect_handler = [this, self]() { Connect(); };
+    if (_strand_required)
+        _strand.post(connect_handler);
+    else
+        _io_service->post(connect_handler);
+
+    return true;
+}
+
+bool UDSDatagramClient::DisconnectInternalAsync(bool dispatch)
+{
+    if (!IsConnected())
+        return false;
+
+    asio::error_code ec;
+
+    // Cancel the client socket
+    _socket.cancel(ec);
+
+    // Dispatch or post the disconnect handler
+    auto self(this->shared_from_this());
+    auto disconnect_handler = [this, self]() { DisconnectInternal(); };
+    if (_strand_required)
+    {
+        if (dispatch)
+            _strand.dispatch(disconnect_handler);
+        else
+            _strand.post(disconnect_handler);
+    }
+    else
+    {
+        if (dispatch)
+            _io_service->dispatch(disconnect_handler);
+        else
+            _io_service->post(disconnect_handler);
+    }
+
+    return true;
+}
+
+bool UDSDatagramClient::ReconnectAsync()
+{
+    if (!DisconnectAsync())
+        return false;
+
+    while (IsConnected())
+        CppCommon::Thread::Yield();
+
+    return ConnectAsync();
+}
+
+size_t UDSDatagramClient::Send(const void* buffer, size_t size)
+{
+    // Send the datagram to the server endpoint
+    return Send(_endpoint, buffer, size);
+}
+
+size_t UDSDatagramClient::Send(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size)
+{
+    if (!IsConnected())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    asio::error_code ec;
+
+    // Sent datagram to the server
+    size_t sent = _socket.send_to(asio::const_buffer(buffer, size), endpoint, 0, ec);
+    if (sent > 0)
+    {
+        // Update statistic
+        ++_datagrams_sent;
+        _bytes_sent += sent;
+
+        // Call the datagram sent handler
+        onSent(endpoint, sent);
+    }
+
+    // Disconnect on error
+    if (ec)
+    {
+        SendError(ec);
+        Disconnect();
+    }
+
+    return sent;
+}
+
+size_t UDSDatagramClient::Send(const void* buffer, size_t size, const CppCommon::Timespan& timeout)
+{
+    // Send the datagram to the server endpoint
+    return Send(_endpoint, buffer, size, timeout);
+}
+
+size_t UDSDatagramClient::Send(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size, const CppCommon::Timespan& timeout)
+{
+    if (!IsConnected())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    asio::error_code error;
+
+    // Send datagram to the server with timeout
+    size_t sent = Poll::SendTo(_socket, endpoint, buffer, size, timeout, error);
+
+    // Send datagram to the server
+    if (sent > 0)
+    {
+        // Update statistic
+        ++_datagrams_sent;
+        _bytes_sent += sent;
+
+        // Call the datagram sent handler
+        onSent(endpoint, sent);
+    }
+
+    // Disconnect on error
+    if (error && (error != asio::error::timed_out))
+    {
+        SendError(error);
+        Disconnect();
+    }
+
+    return sent;
+}
+
+bool UDSDatagramClient::SendAsync(const void* buffer, size_t size)
+{
+    // Send the datagram to the server endpoint
+    return SendAsync(_endpoint, buffer, size);
+}
+
+bool UDSDatagramClient::SendAsync(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size)
+{
+    if (_sending)
+        return false;
+
+    if (!IsConnected())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    // Check the send buffer limit
+    if ((size > _send_buffer_limit) && (_send_buffer_limit > 0))
+    {
+        SendError(asio::error::no_buffer_space);
+        return false;
+    }
+
+    // Fill the main send buffer
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    _send_buffer.assign(bytes, bytes + size);
+
+    // Update statistic
+    _bytes_sending = _send_buffer.size();
+
+    // Update send endpoint
+    _send_endpoint = endpoint;
+
+    // Async send-to with the send-to handler
+    _sending = true;
+    auto self(this->shared_from_this());
+    auto async_send_to_handler = make_alloc_handler(_send_storage, [this, self](std::error_code ec, size_t sent)
+    {
+        _sending = false;
+
+        if (!IsConnected())
+            return;
+
+        // Disconnect on error
+        if (ec)
+        {
+            SendError(ec);
+            DisconnectInternalAsync(true);
+            return;
+        }
+
+        // Send some data to the server
+        if (sent > 0)
+        {
+            // Update statistic
+            _bytes_sending = 0;
+            _bytes_sent += sent;
+
+            // Clear the send buffer
+            _send_buffer.clear();
+
+            // Call the buffer sent handler
+            onSent(_send_endpoint, sent);
+        }
+    });
+    if (_strand_required)
+        _socket.async_send_to(asio::buffer(_send_buffer.data(), _send_buffer.size()), _send_endpoint, bind_executor(_strand, async_send_to_handler));
+    else
+        _socket.async_send_to(asio::buffer(_send_buffer.data(), _send_buffer.size()), _send_endpoint, async_send_to_handler);
+
+    return true;
+}
+
+size_t UDSDatagramClient::Receive(asio::local::datagram_protocol::endpoint& endpoint, void* buffer, size_t size)
+{
+    if (!IsConnected())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    asio::error_code ec;
+
+    // Receive datagram from the server
+    size_t received = _socket.receive_from(asio::buffer(buffer, size), endpoint, 0, ec);
+
+    // Update statistic
+    ++_datagrams_received;
+    _bytes_received += received;
+
+    // Call the datagram received handler
+    onReceived(endpoint, buffer, received);
+
+    // Disconnect on error
+    if (ec)
+    {
+        SendError(ec);
+        Disconnect();
+    }
+
+    return received;
+}
+
+std::string UDSDatagramClient::Receive(asio::local::datagram_protocol::endpoint& endpoint, size_t size)
+{
+    std::string text(size, 0);
+    text.resize(Receive(endpoint, text.data(), text.size()));
+    return text;
+}
+
+size_t UDSDatagramClient::Receive(asio::local::datagram_protocol::endpoint& endpoint, void* buffer, size_t size, const CppCommon::Timespan& timeout)
+{
+    if (!IsConnected())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    asio::error_code error;
+
+    // Receive datagram from the server with timeout
+    size_t received = Poll::ReceiveFrom(_socket, endpoint, buffer, size, timeout, error);
+
+    // Update statistic
+    ++_datagrams_received;
+    _bytes_received += received;
+
+    // Call the datagram received handler
+    onReceived(endpoint, buffer, received);
+
+    // Disconnect on error
+    if (error && (error != asio::error::timed_out))
+    {
+        SendError(error);
+        Disconnect();
+    }
+
+    return received;
+}
+
+std::string UDSDatagramClient::Receive(asio::local::datagram_protocol::endpoint& endpoint, size_t size, const CppCommon::Timespan& timeout)
+{
+    std::string text(size, 0);
+    text.resize(Receive(endpoint, text.data(), text.size(), timeout));
+    return text;
+}
+
+void UDSDatagramClient::ReceiveAsync()
+{
+    // Try to receive datagrams from the server
+    TryReceive();
+}
+
+void UDSDatagramClient::TryReceive()
+{
+    if (_receiving)
+        return;
+
+    if (!IsConnected())
+        return;
+
+    // Async receive with the receive handler
+    _receiving = true;
+    auto self(this->shared_from_this());
+    auto async_receive_handler = make_alloc_handler(_receive_storage, [this, self](std::error_code ec, size_t size)
+    {
+        _receiving = false;
+
+        if (!IsConnected())
+            return;
+
+        // Disconnect on error
+        if (ec)
+        {
+            SendError(ec);
+            DisconnectInternalAsync(true);
+            return;
+        }
+
+        // Update statistic
+        ++_datagrams_received;
+        _bytes_received += size;
+
+        // Call the datagram received handler
+        onReceived(_receive_endpoint, _receive_buffer.data(), size);
+
+        // If the receive buffer is full increase its size
+        if (_receive_buffer.size() == size)
+        {
+            // Check the receive buffer limit
+            if (((2 * size) > _receive_buffer_limit) && (_receive_buffer_limit > 0))
+            {
+                SendError(asio::error::no_buffer_space);
+                DisconnectInternalAsync(true);
+                return;
+            }
+
+            _receive_buffer.resize(2 * size);
+        }
+    });
+    if (_strand_required)
+        _socket.async_receive_from(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), _receive_endpoint, bind_executor(_strand, async_receive_handler));
+    else
+        _socket.async_receive_from(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), _receive_endpoint, async_receive_handler);
+}
+
+void UDSDatagramClient::ClearBuffers()
+{
+    // Clear send buffers
+    _send_buffer.clear();
+
+    // Update statistic
+    _bytes_sending = 0;
+}
+
+void UDSDatagramClient::SendError(std::error_code ec)
+{
+    // Skip Asio disconnect errors
+    if ((ec == asio::error::connection_aborted) ||
+        (ec == asio::error::connection_refused) ||
+        (ec == asio::error::connection_reset) ||
+        (ec == asio::error::eof) ||
+        (ec == asio::error::operation_aborted))
+        return;
+
+    onError(ec.value(), ec.category().name(), ec.message());
+}
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif
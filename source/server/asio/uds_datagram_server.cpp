@@ -0,0 +1,503 @@
+/*!
+    \file uds_datagram_server.cpp
+    \brief Unix domain datagram socket server implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/uds_datagram_server.h"
+#include "server/asio/poll.h"
+
+#include <cstdio>
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace Asio {
+
+UDSDatagramServer::UDSDatagramServer(const std::shared_ptr<Service>& service, const std::string& path)
+    : _id(CppCommon::UUID::Sequential()),
+      _service(service),
+      _io_service(_service->GetAsioService()),
+      _strand(*_io_service),
+      _strand_required(_service->IsStrandRequired()),
+      _path(path),
+      _endpoint(path),
+      _socket(*_io_service),
+      _started(false),
+      _bytes_sending(0),
+      _bytes_sent(0),
+      _bytes_received(0),
+      _datagrams_sent(0),
+      _datagrams_received(0),
+      _receiving(false),
+      _sending(false),
+      _option_unlink_path(true)
+{
+    assert((service != nullptr) && "Asio service is invalid!");
+    if (service == nullptr)
+        throw CppCommon::ArgumentException("Asio service is invalid!");
+}
+
+UDSDatagramServer::UDSDatagramServer(const std::shared_ptr<Service>& service, const asio::local::datagram_protocol::endpoint& endpoint)
+    : _id(CppCommon::UUID::Sequential()),
+      _service(service),
+      _io_service(_service->GetAsioService()),
+      _strand(*_io_service),
+      _strand_required(_service->IsStrandRequired()),
+      _path(endpoint.path()),
+      _endpoint(endpoint),
+      _socket(*_io_service),
+      _started(false),
+      _bytes_sending(0),
+      _bytes_sent(0),
+      _bytes_received(0),
+      _datagrams_sent(0),
+      _datagrams_received(0),
+      _receiving(false),
+      _sending(false),
+      _option_unlink_path(true)
+{
+    assert((service != nullptr) && "Asio service is invalid!");
+    if (service == nullptr)
+        throw CppCommon::ArgumentException("Asio service is invalid!");
+}
+
+size_t UDSDatagramServer::option_receive_buffer_size() const
+{
+    asio::socket_base::receive_buffer_size option;
+    _socket.get_option(option);
+    return option.value();
+}
+
+size_t UDSDatagramServer::option_send_buffer_size() const
+{
+    asio::socket_base::send_buffer_size option;
+    _socket.get_option(option);
+    return option.value();
+}
+
+void UDSDatagramServer::SetupReceiveBufferSize(size_t size)
+{
+    asio::socket_base::receive_buffer_size option((int)size);
+    _socket.set_option(option);
+}
+
+void UDSDatagramServer::SetupSendBufferSize(size_t size)
+{
+    asio::socket_base::send_buffer_size option((int)size);
+    _socket.set_option(option);
+}
+
+bool UDSDatagramServer::Start()
+{
+    assert(!IsStarted() && "Unix domain datagram socket server is already started!");
+    if (IsStarted())
+        return false;
+
+    // Post the start handler
+    auto self(this->shared_from_this());
+    auto start_handler = [this, self]()
+    {
+        if (IsStarted())
+            return;
+
+        // Remove the stale socket file left by the previous server instance
+        if (option_unlink_path())
+            std::remove(_path.c_str());
+
+        // Open a server socket
+        _socket.open(_endpoint.protocol());
+        _socket.bind(_endpoint);
+
+        // Prepare receive buffer
+        _receive_buffer.resize(option_receive_buffer_size());
+
+        // Reset statistic
+        _bytes_sending = 0;
+        _bytes_sent = 0;
+        _bytes_received = 0;
+        _datagrams_sent = 0;
+        _datagrams_received = 0;
+
+         // Update the started flag
+        _started = true;
+
+        // Call the server started handler
+        onStarted();
+    };
+    if (_strand_required)
+        _strand.post(start_handler);
+    else
+        _io_service->post(start_handler);
+
+    return true;
+}
+
+bool UDSDatagramServer::Stop()
+{
+    assert(IsStarted() && "Unix domain datagram socket server is not started!");
+    if (!IsStarted())
+        return false;
+
+    // Post the stop handler
+    auto self(this->shared_from_this());
+    auto stop_handler = [this, self]()
+    {
+        if (!IsStarted())
+            return;
+
+        // Close the server socket
+        _socket.close();
+
+        // Remove the socket file
+        if (option_unlink_path())
+            std::remove(_path.c_str());
+
+        // Update the started flag
+        _started = false;
+
+        // Update sending/receiving flags
+        _receiving = false;
+        _sending = false;
+
+        // Clear send/receive buffers
+        ClearBuffers();
+
+        // Call the server stopped handler
+        onStopped();
+    };
+    if (_strand_required)
+        _strand.post(stop_handler);
+    else
+        _io_service->post(stop_handler);
+
+    return true;
+}
+
+bool UDSDatagramServer::Restart()
+{
+    if (!Stop())
+        return false;
+
+    while (IsStarted())
+        CppCommon::Thread::Yield();
+
+    return Start();
+}
+
+size_t UDSDatagramServer::Send(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size)
+{
+    if (!IsStarted())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    asio::error_code ec;
+
+    // Sent datagram to the client
+    size_t sent = _socket.send_to(asio::const_buffer(buffer, size), endpoint, 0, ec);
+    if (sent > 0)
+    {
+        // Update statistic
+        ++_datagrams_sent;
+        _bytes_sent += sent;
+
+        // Call the datagram sent handler
+        onSent(endpoint, sent);
+    }
+
+    // Check for error
+    if (ec)
+        SendError(ec);
+
+    return sent;
+}
+
+size_t UDSDatagramServer::Send(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size, const CppCommon::Timespan& timeout)
+{
+    if (!IsStarted())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    asio::error_code error;
+
+    // Send datagram to the client with timeout
+    size_t sent = Poll::SendTo(_socket, endpoint, buffer, size, timeout, error);
+
+    // Send datagram to the client
+    if (sent > 0)
+    {
+        // Update statistic
+        ++_datagrams_sent;
+        _bytes_sent += sent;
+
+        // Call the datagram sent handler
+        onSent(endpoint, sent);
+    }
+
+    // Check for error
+    if (error && (error != asio::error::timed_out))
+        SendError(error);
+
+    return sent;
+}
+
+bool UDSDatagramServer::SendAsync(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size)
+{
+    if (_sending)
+        return false;
+
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    // Check the send buffer limit
+    if ((size > _send_buffer_limit) && (_send_buffer_limit > 0))
+    {
+        SendError(asio::error::no_buffer_space);
+
+        // Call the buffer sent zero handler
+        onSent(_send_endpoint,  0);
+
+        return false;
+    }
+
+    // Fill the main send buffer
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    _send_buffer.assign(bytes, bytes + size);
+
+    // Update statistic
+    _bytes_sending = _send_buffer.size();
+
+    // Update send endpoint
+    _send_endpoint = endpoint;
+
+    // Async send-to with the send-to handler
+    _sending = true;
+    auto self(this->shared_from_this());
+    auto async_send_to_handler = make_alloc_handler(_send_storage, [this, self](std::error_code ec, size_t sent)
+    {
+        _sending = false;
+
+        if (!IsStarted())
+            return;
+
+        // Check for error
+        if (ec)
+        {
+            SendError(ec);
+
+            // Call the buffer sent zero handler
+            onSent(_send_endpoint, 0);
+
+            return;
+        }
+
+        // Send some data to the client
+        if (sent > 0)
+        {
+            // Update statistic
+            _bytes_sending = 0;
+            _bytes_sent += sent;
+
+            // Clear the send buffer
+            _send_buffer.clear();
+
+            // Call the buffer sent handler
+            onSent(_send_endpoint, sent);
+        }
+    });
+    if (_strand_required)
+        _socket.async_send_to(asio::buffer(_send_buffer.data(), _send_buffer.size()), _send_endpoint, bind_executor(_strand, async_send_to_handler));
+    else
+        _socket.async_send_to(asio::buffer(_send_buffer.data(), _send_buffer.size()), _send_endpoint, async_send_to_handler);
+
+    return true;
+}
+
+size_t UDSDatagramServer::Receive(asio::local::datagram_protocol::endpoint& endpoint, void* buffer, size_t size)
+{
+    if (!IsStarted())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    asio::error_code ec;
+
+    // Receive datagram from the client
+    size_t received = _socket.receive_from(asio::buffer(buffer, size), endpoint, 0, ec);
+
+    // Update statistic
+    ++_datagrams_received;
+    _bytes_received += received;
+
+    // Call the datagram received handler
+    onReceived(endpoint, buffer, received);
+
+    // Check for error
+    if (ec)
+        SendError(ec);
+
+    return received;
+}
+
+std::string UDSDatagramServer::Receive(asio::local::datagram_protocol::endpoint& endpoint, size_t size)
+{
+    std::string text(size, 0);
+    text.resize(Receive(endpoint, text.data(), text.size()));
+    return text;
+}
+
+size_t UDSDatagramServer::Receive(asio::local::datagram_protocol::endpoint& endpoint, void* buffer, size_t size, const CppCommon::Timespan& timeout)
+{
+    if (!IsStarted())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    asio::error_code error;
+
+    // Receive datagram from the client with timeout
+    size_t received = Poll::ReceiveFrom(_socket, endpoint, buffer, size, timeout, error);
+
+    // Update statistic
+    ++_datagrams_received;
+    _bytes_received += received;
+
+    // Call the datagram received handler
+    onReceived(endpoint, buffer, received);
+
+    // Check for error
+    if (error && (error != asio::error::timed_out))
+        SendError(error);
+
+    return received;
+}
+
+std::string UDSDatagramServer::Receive(asio::local::datagram_protocol::endpoint& endpoint, size_t size, const CppCommon::Timespan& timeout)
+{
+    std::string text(size, 0);
+    text.resize(Receive(endpoint, text.data(), text.size(), timeout));
+    return text;
+}
+
+void UDSDatagramServer::ReceiveAsync()
+{
+    // Try to receive datagrams from clients
+    TryReceive();
+}
+
+void UDSDatagramServer::TryReceive()
+{
+    if (_receiving)
+        return;
+
+    if (!IsStarted())
+        return;
+
+    // Async receive with the receive handler
+    _receiving = true;
+    auto self(this->shared_from_this());
+    auto async_receive_handler = make_alloc_handler(_receive_storage, [this, self](std::error_code ec, size_t size)
+    {
+        _receiving = false;
+
+        if (!IsStarted())
+            return;
+
+        // Check for error
+        if (ec)
+        {
+            SendError(ec);
+
+            // Call the datagram received zero handler
+            onReceived(_receive_endpoint, _receive_buffer.data(), 0);
+
+            return;
+        }
+
+        // Update statistic
+        ++_datagrams_received;
+        _bytes_received += size;
+
+        // Call the datagram received handler
+        onReceived(_receive_endpoint, _receive_buffer.data(), size);
+
+        // If the receive buffer is full increase its size
+        if (_receive_buffer.size() == size)
+        {
+            // Check the receive buffer limit
+            if (((2 * size) > _receive_buffer_limit) && (_receive_buffer_limit > 0))
+            {
+                SendError(asio::error::no_buffer_space);
+
+                // Call the datagram received zero handler
+                onReceived(_receive_endpoint, _receive_buffer.data(), 0);
+
+                return;
+            }
+
+            _receive_buffer.resize(2 * size);
+        }
+    });
+    if (_strand_required)
+        _socket.async_receive_from(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), _receive_endpoint, bind_executor(_strand, async_receive_handler));
+    else
+        _socket.async_receive_from(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), _receive_endpoint, async_receive_handler);
+}
+
+void UDSDatagramServer::ClearBuffers()
+{
+    // Clear send buffers
+    _send_buffer.clear();
+
+    // Update statistic
+    _bytes_sending = 0;
+}
+
+void UDSDatagramServer::SendError(std::error_code ec)
+{
+    // Skip Asio disconnect errors
+    if ((ec == asio::error::connection_aborted) ||
+        (ec == asio::error::connection_refused) ||
+        (ec == asio::error::connection_reset) ||
+        (ec == asio::error::eof) ||
+        (ec == asio::error::operation_aborted))
+        return;
+
+    onError(ec.value(), ec.category().name(), ec.message());
+}
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif
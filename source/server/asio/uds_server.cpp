@@ -0,0 +1,301 @@
+/*!
+    \file uds_server.cpp
+    \brief Unix domain socket server implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/uds_server.h"
+
+#include <cstdio>
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace Asio {
+
+UDSServer::UDSServer(const std::shared_ptr<Service>& service, const std::string& path)
+    : _id(CppCommon::UUID::Sequential()),
+      _service(service),
+      _io_service(_service->GetAsioService()),
+      _strand(*_io_service),
+      _strand_required(_service->IsStrandRequired()),
+      _path(path),
+      _endpoint(path),
+      _acceptor(*_io_service),
+      _started(false),
+      _bytes_pending(0),
+      _bytes_sent(0),
+      _bytes_received(0),
+      _option_unlink_path(true)
+{
+    assert((service != nullptr) && "Asio service is invalid!");
+    if (service == nullptr)
+        throw CppCommon::ArgumentException("Asio service is invalid!");
+}
+
+UDSServer::UDSServer(const std::shared_ptr<Service>& service, const asio::local::stream_protocol::endpoint& endpoint)
+    : _id(CppCommon::UUID::Sequential()),
+      _service(service),
+      _io_service(_service->GetAsioService()),
+      _strand(*_io_service),
+      _strand_required(_service->IsStrandRequired()),
+      _path(endpoint.path()),
+      _endpoint(endpoint),
+      _acceptor(*_io_service),
+      _started(false),
+      _bytes_pending(0),
+      _bytes_sent(0),
+      _bytes_received(0),
+      _option_unlink_path(true)
+{
+    assert((service != nullptr) && "Asio service is invalid!");
+    if (service == nullptr)
+        throw CppCommon::ArgumentException("Asio service is invalid!");
+}
+
+bool UDSServer::Start()
+{
+    assert(!IsStarted() && "Unix domain socket server is already started!");
+    if (IsStarted())
+        return false;
+
+    // Post the start handler
+    auto self(this->shared_from_this());
+    auto start_handler = [this, self]()
+    {
+        if (IsStarted())
+            return;
+
+        // Remove the stale socket file left by the previous server instance
+        if (option_unlink_path())
+            std::remove(_path.c_str());
+
+        // Create a server acceptor
+        _acceptor = asio::local::stream_protocol::acceptor(*_io_service);
+        _acceptor.open(_endpoint.protocol());
+        _acceptor.bind(_endpoint);
+        _acceptor.listen();
+
+        // Reset statistic
+        _bytes_pending = 0;
+        _bytes_sent = 0;
+        _bytes_received = 0;
+
+        // Update the started flag
+        _started = true;
+
+        // Call the server started handler
+        onStarted();
+
+        // Perform the first server accept
+        Accept();
+    };
+    if (_strand_required)
+        _strand.post(start_handler);
+    else
+        _io_service->post(start_handler);
+
+    return true;
+}
+
+bool UDSServer::Stop()
+{
+    assert(IsStarted() && "Unix domain socket server is not started!");
+    if (!IsStarted())
+        return false;
+
+    // Post the stop handler
+    auto self(this->shared_from_this());
+    auto stop_handler = [this, self]()
+    {
+        if (!IsStarted())
+            return;
+
+        // Close the server acceptor
+        _acceptor.close();
+
+        // Remove the socket file
+        if (option_unlink_path())
+            std::remove(_path.c_str());
+
+        // Reset the session
+        _session->ResetServer();
+
+        // Disconnect all sessions
+        DisconnectAll();
+
+        // Update the started flag
+        _started = false;
+
+        // Clear multicast buffer
+        ClearBuffers();
+
+        // Call the server stopped handler
+        onStopped();
+    };
+    if (_strand_required)
+        _strand.post(stop_handler);
+    else
+        _io_service->post(stop_handler);
+
+    return true;
+}
+
+bool UDSServer::Restart()
+{
+    if (!Stop())
+        return false;
+
+    while (IsStarted())
+        CppCommon::Thread::Yield();
+
+    return Start();
+}
+
+void UDSServer::Accept()
+{
+    if (!IsStarted())
+        return;
+
+    // Dispatch the accept handler
+    auto self(this->shared_from_this());
+    auto accept_handler = make_alloc_handler(_acceptor_storage, [this, self]()
+    {
+        if (!IsStarted())
+            return;
+
+        // Create a new session to accept
+        _session = CreateSession(self);
+
+        auto async_accept_handler = make_alloc_handler(_acceptor_storage, [this, self](std::error_code ec)
+        {
+            if (!ec)
+            {
+                RegisterSession();
+
+                // Connect a new session
+                _session->Connect();
+            }
+            else
+                SendError(ec);
+
+            // Perform the next server accept
+            Accept();
+        });
+        if (_strand_required)
+            _acceptor.async_accept(_session->socket(), bind_executor(_strand, async_accept_handler));
+        else
+            _acceptor.async_accept(_session->socket(), async_accept_handler);
+    });
+    if (_strand_required)
+        _strand.dispatch(accept_handler);
+    else
+        _io_service->dispatch(accept_handler);
+}
+
+bool UDSServer::Multicast(const void* buffer, size_t size)
+{
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+    // Multicast all sessions
+    for (auto& session : _sessions)
+        session.second->SendAsync(buffer, size);
+
+    return true;
+}
+
+bool UDSServer::DisconnectAll()
+{
+    if (!IsStarted())
+        return false;
+
+    // Dispatch the disconnect all handler
+    auto self(this->shared_from_this());
+    auto disconnect_all_handler = [this, self]()
+    {
+        if (!IsStarted())
+            return;
+
+        std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+        // Disconnect all sessions
+        for (auto& session : _sessions)
+            session.second->Disconnect();
+    };
+    if (_strand_required)
+        _strand.dispatch(disconnect_all_handler);
+    else
+        _io_service->dispatch(disconnect_all_handler);
+
+    return true;
+}
+
+std::shared_ptr<UDSSession> UDSServer::FindSession(const CppCommon::UUID& id)
+{
+    std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+    // Try to find the required session
+    auto it = _sessions.find(id);
+    return (it != _sessions.end()) ? it->second : nullptr;
+}
+
+void UDSServer::RegisterSession()
+{
+    std::unique_lock<std::shared_mutex> locker(_sessions_lock);
+
+    // Register a new session
+    _sessions.emplace(_session->id(), _session);
+}
+
+void UDSServer::UnregisterSession(const CppCommon::UUID& id)
+{
+    std::unique_lock<std::shared_mutex> locker(_sessions_lock);
+
+    // Try to find the unregistered session
+    auto it = _sessions.find(id);
+    if (it != _sessions.end())
+    {
+        // Erase the session
+        _sessions.erase(it);
+    }
+}
+
+void UDSServer::ClearBuffers()
+{
+    // Update statistic
+    _bytes_pending = 0;
+}
+
+void UDSServer::SendError(std::error_code ec)
+{
+    // Skip Asio disconnect errors
+    if ((ec == asio::error::connection_aborted) ||
+        (ec == asio::error::connection_refused) ||
+        (ec == asio::error::connection_reset) ||
+        (ec == asio::error::eof) ||
+        (ec == asio::error::operation_aborted))
+        return;
+
+    // Skip Winsock error 995: The I/O operation has been aborted because of either a thread exit or an application request
+    if (ec.value() == 995)
+        return;
+
+    onError(ec.value(), ec.category().name(), ec.message());
+}
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif
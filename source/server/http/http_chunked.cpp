@@ -0,0 +1,43 @@
+/*!
+    \file http_chunked.cpp
+    \brief HTTP chunked transfer encoding implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/http/http_chunked.h"
+
+namespace CppServer {
+namespace HTTP {
+
+std::string HTTPChunkedEncoder::Encode(const void* buffer, size_t size)
+{
+    std::string result;
+
+    // Empty chunk would complete the encoded body
+    if (size == 0)
+        return result;
+
+    // Format the chunk size as hex digits
+    char digits[16];
+    size_t index = sizeof(digits);
+    size_t value = size;
+    do
+    {
+        digits[--index] = "0123456789ABCDEF"[value & 0xF];
+        value >>= 4;
+    }
+    while (value > 0);
+
+    // Prepare the encoded chunk in one allocation
+    result.reserve(sizeof(digits) - index + 2 + size + 2);
+    result.append(digits + index, sizeof(digits) - index);
+    result.append("\r\n");
+    result.append((const char*)buffer, size);
+    result.append("\r\n");
+    return result;
+}
+
+} // namespace HTTP
+} // namespace CppServer
@@ -27,7 +27,7 @@ void HTTPClient::onReceived(const void* buffer, size_t size)
     {
         onReceivedResponseError(_response, "Invalid HTTP response!");
         _response.Clear();
-        DisconnectAsync();
+        DisconnectInternalAsync(false);
         return;
     }
 
@@ -44,7 +44,7 @@ void HTTPClient::onReceived(const void* buffer, size_t size)
     {
         onReceivedResponseError(_response, "Invalid HTTP response!");
         _response.Clear();
-        DisconnectAsync();
+        DisconnectInternalAsync(false);
         return;
     }
 }
@@ -62,9 +62,12 @@ void HTTPClient::onDisconnected()
 
 std::future<HTTPResponse> HTTPClientEx::SendRequest(const HTTPRequest& request, const CppCommon::Timespan& timeout)
 {
-    // Create TCP resolver if the current one is empty
+    // Create TCP resolver with the DNS resolver cache if the current one is empty
     if (!_resolver)
+    {
         _resolver = std::make_shared<Asio::TCPResolver>(service());
+        _resolver->SetupCache(true);
+    }
     // Create timeout check timer if the current one is empty
     if (!_timeout)
         _timeout = std::make_shared<Asio::Timer>(service());
@@ -108,7 +111,7 @@ std::future<HTTPResponse> HTTPClientEx::SendRequest(const HTTPRequest& request,
         // Disconnect on timeout
         onReceivedResponseError(_response, "Timeout!");
         _response.Clear();
-        DisconnectAsync();
+        DisconnectInternalAsync(false);
     };
     if (!_timeout->Setup(timeout_handler, timeout) || !_timeout->WaitAsync())
     {
@@ -136,6 +139,12 @@ void HTTPClientEx::onDisconnected()
         _timeout->Cancel();
 
     HTTPClient::onDisconnected();
+
+#if defined(CPPSERVER_COROUTINES)
+    // Fail the pending HTTP response awaiter
+    if (_response_awaiter != nullptr)
+        SetPromiseError("Connection closed!");
+#endif
 }
 
 void HTTPClientEx::onReceivedResponse(const HTTPResponse& response)
@@ -158,15 +167,126 @@ void HTTPClientEx::onReceivedResponseError(const HTTPResponse& response, const s
 
 void HTTPClientEx::SetPromiseValue(const HTTPResponse& response)
 {
+#if defined(CPPSERVER_COROUTINES)
+    // Resume the pending HTTP response awaiter
+    if (_response_awaiter != nullptr)
+    {
+        _request.Clear();
+        std::exchange(_response_awaiter, nullptr)->Complete(response);
+        return;
+    }
+#endif
+
     _promise.set_value(response);
     _request.Clear();
 }
 
 void HTTPClientEx::SetPromiseError(const std::string& error)
 {
+#if defined(CPPSERVER_COROUTINES)
+    // Resume the pending HTTP response awaiter with error
+    if (_response_awaiter != nullptr)
+    {
+        _request.Clear();
+        auto awaiter = std::exchange(_response_awaiter, nullptr);
+        awaiter->_error = error;
+        awaiter->Complete(HTTPResponse());
+        return;
+    }
+#endif
+
     _promise.set_exception(std::make_exception_ptr(std::runtime_error(error)));
     _request.Clear();
 }
 
+#if defined(CPPSERVER_COROUTINES)
+
+HTTPResponseAwaiter HTTPClientEx::SendRequestAsync(const HTTPRequest& request, const CppCommon::Timespan& timeout)
+{
+    return HTTPResponseAwaiter(std::static_pointer_cast<HTTPClientEx>(this->shared_from_this()), request, timeout);
+}
+
+void HTTPClientEx::StartResponseAwaiter(HTTPResponseAwaiter* awaiter)
+{
+    // Only one HTTP request could be pending
+    if (_response_awaiter != nullptr)
+    {
+        awaiter->_error = "HTTP request is already pending!";
+        awaiter->Complete(HTTPResponse());
+        return;
+    }
+
+    // Create TCP resolver with the DNS resolver cache if the current one is empty
+    if (!_resolver)
+    {
+        _resolver = std::make_shared<Asio::TCPResolver>(service());
+        _resolver->SetupCache(true);
+    }
+
+    _response_awaiter = awaiter;
+    _request = awaiter->_request;
+
+    // Check if the HTTP request is valid
+    if (_request.empty() || _request.error())
+    {
+        SetPromiseError("Invalid HTTP request!");
+        return;
+    }
+
+    if (!IsConnected())
+    {
+        // Connect to the Web server
+        if (!ConnectAsync(_resolver))
+            SetPromiseError("Connection failed!");
+    }
+    else
+    {
+        // Send prepared HTTP request
+        if (!SendRequestAsync())
+            SetPromiseError("Failed to send HTTP request!");
+    }
+}
+
+void HTTPClientEx::CancelResponseAwaiter(HTTPResponseAwaiter* awaiter)
+{
+    if (_response_awaiter != awaiter)
+        return;
+
+    _response_awaiter = nullptr;
+    awaiter->_error = "Timeout!";
+
+    // Disconnect on timeout
+    _request.Clear();
+    _response.Clear();
+    DisconnectInternalAsync(false);
+}
+
+HTTPResponseAwaiter::HTTPResponseAwaiter(const std::shared_ptr<HTTPClientEx>& client, const HTTPRequest& request, const CppCommon::Timespan& timeout)
+    : Asio::Awaiter<HTTPResponse>(client->io_service(), client->strand(), client->service()->IsStrandRequired(), timeout),
+      _client(client),
+      _request(request)
+{
+}
+
+HTTPResponse HTTPResponseAwaiter::await_resume()
+{
+    if (!_error.empty())
+        throw std::runtime_error(_error);
+
+    return std::move(_result);
+}
+
+void HTTPResponseAwaiter::onStart()
+{
+    _client->StartResponseAwaiter(this);
+}
+
+void HTTPResponseAwaiter::onTimeout()
+{
+    _client->CancelResponseAwaiter(this);
+}
+
+#endif
+
 } // namespace HTTP
 } // namespace CppServer
@@ -0,0 +1,309 @@
+/*!
+    \file http_proxy_client.cpp
+    \brief HTTP proxy client implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/http/http_proxy_client.h"
+#include "server/http/http_proxy_server.h"
+
+#include "string/string_utils.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+
+namespace CppServer {
+namespace HTTP {
+
+void HTTPProxyClient::Bind(const std::shared_ptr<HTTPProxySession>& session, const std::shared_ptr<HTTPProxyUpstream>& upstream, const std::shared_ptr<Asio::ClientPool<HTTPProxyClient>>& pool, bool head, size_t buffer_limit)
+{
+    {
+        std::scoped_lock locker(_session_lock);
+        _session = session;
+    }
+    _upstream = upstream;
+    _pool = pool;
+    _timestamp = CppCommon::Timestamp::nano();
+    _head = head;
+    _buffer_limit = buffer_limit;
+    _started = false;
+    _response.Clear();
+    _active = true;
+}
+
+void HTTPProxyClient::onReceived(const void* buffer, size_t size)
+{
+    // Unexpected data from the idle upstream connection
+    if (!_active)
+    {
+        DisconnectAsync();
+        return;
+    }
+
+    auto session = this->session();
+
+    const char* data = (const char*)buffer;
+
+    // Receive HTTP response header
+    while (_response.IsPendingHeader())
+    {
+        // Receive only the response header, so the response body is forwarded as it is
+        size_t header = _response.PendingHeaderSize(data, size);
+        bool received = _response.ReceiveHeader(data, header);
+        data += header;
+        size -= header;
+
+        if (!received)
+        {
+            // Check for HTTP response error
+            if (_response.error())
+            {
+                onReceivedResponseError(_response, "Invalid HTTP response!");
+                FailResponse();
+            }
+            return;
+        }
+
+        PrepareFraming();
+        ForwardHeader(session);
+
+        // Interim response is followed by the final one
+        int status = _response.status();
+        if ((status >= 100) && (status < 200))
+        {
+            _response.Clear();
+            if (size == 0)
+                return;
+        }
+    }
+
+    // Forward the response body
+    ForwardBody(session, data, size);
+}
+
+void HTTPProxyClient::onDisconnected()
+{
+    if (_active)
+    {
+        // Response delimited by the end of the connection is completed
+        if (_started && _until_close && !_response.IsPendingHeader())
+            CompleteResponse();
+        else
+            FailResponse();
+    }
+
+    // Call the base handler to notify the connection pool about the failed connect
+    Asio::PooledClient<HTTPClient>::onDisconnected();
+}
+
+void HTTPProxyClient::onSent(size_t sent, size_t pending)
+{
+    // Resume receiving of the session request body when the upstream consumed it
+    if (pending > _buffer_limit)
+        return;
+
+    // The session receive state is updated under the session lock, so the pause could not be missed
+    auto session = this->session();
+    if (session)
+        session->UpstreamSent();
+}
+
+std::shared_ptr<HTTPProxySession> HTTPProxyClient::session()
+{
+    std::scoped_lock locker(_session_lock);
+    return _session.lock();
+}
+
+std::shared_ptr<HTTPProxySession> HTTPProxyClient::Unbind()
+{
+    std::scoped_lock locker(_session_lock);
+    auto session = _session.lock();
+    _session.reset();
+    return session;
+}
+
+void HTTPProxyClient::PrepareFraming()
+{
+    int status = _response.status();
+
+    _keep_alive = (_response.protocol() != "HTTP/1.0");
+    _until_close = false;
+    _chunked = false;
+    _body_remaining = 0;
+    _chunked_decoder.Reset();
+
+    bool length = false;
+    for (size_t i = 0; i < _response.headers(); ++i)
+    {
+        auto [name, value] = _response.header(i);
+        if (CppCommon::StringUtils::CompareNoCase(name, "Connection"))
+        {
+            if (CppCommon::StringUtils::CompareNoCase(value, "close"))
+                _keep_alive = false;
+            else if (CppCommon::StringUtils::CompareNoCase(value, "keep-alive"))
+                _keep_alive = true;
+        }
+        else if (CppCommon::StringUtils::CompareNoCase(name, "Content-Length"))
+            length = true;
+        else if (CppCommon::StringUtils::CompareNoCase(name, "Transfer-Encoding"))
+            _chunked = (value.find("chunked") != std::string_view::npos);
+    }
+
+    // Responses without body
+    if (_head || ((status >= 100) && (status < 200)) || (status == 204) || (status == 304))
+        return;
+
+    if (_chunked)
+        return;
+
+    if (length)
+        _body_remaining = _response.body_length();
+    else
+    {
+        // Response body is delimited by the end of the connection
+        _until_close = true;
+        _keep_alive = false;
+    }
+}
+
+void HTTPProxyClient::ForwardHeader(const std::shared_ptr<HTTPProxySession>& session)
+{
+    _started = true;
+
+    if (!session)
+        return;
+
+    // Prepare the response header without hop-by-hop headers
+    std::string header;
+    header.append("HTTP/1.1 ");
+    header.append(std::to_string(_response.status()));
+    header.append(" ");
+    header.append(_response.status_phrase());
+    header.append("\r\n");
+    for (size_t i = 0; i < _response.headers(); ++i)
+    {
+        auto [name, value] = _response.header(i);
+        if (HTTPProxyServer::IsHopByHopHeader(name))
+            continue;
+        header.append(name);
+        header.append(": ");
+        header.append(value);
+        header.append("\r\n");
+    }
+
+    // The session connection will be closed to delimit the response body
+    if (_until_close)
+        header.append("Connection: close\r\n");
+
+    header.append("\r\n");
+
+    session->SendAsync(header);
+}
+
+bool HTTPProxyClient::ForwardBody(const std::shared_ptr<HTTPProxySession>& session, const char* buffer, size_t size)
+{
+    // Find the part of the buffer which belongs to the response body
+    size_t forward = size;
+    if (_chunked)
+        forward = _chunked_decoder.Decode(buffer, size, [](const char*, size_t) {});
+    else if (!_until_close)
+    {
+        forward = std::min(size, _body_remaining);
+        _body_remaining -= forward;
+    }
+
+    if ((forward > 0) && session)
+    {
+        session->SendAsync(buffer, forward);
+
+        // Pause receiving of the response until the session sends the pending data
+        if (session->bytes_pending() > _buffer_limit)
+        {
+            PauseReceive();
+
+            // The session could have sent the pending data before the receive was paused
+            if (session->bytes_pending() <= _buffer_limit)
+                ResumeReceive();
+        }
+    }
+
+    // Unexpected data after the response, the upstream connection could not be reused
+    if (forward < size)
+        _keep_alive = false;
+
+    // Check for the end of the response
+    bool completed = _chunked ? _chunked_decoder.IsCompleted() : (!_until_close && (_body_remaining == 0));
+    if (completed)
+        CompleteResponse();
+    return completed;
+}
+
+void HTTPProxyClient::CompleteResponse()
+{
+    if (!_active.exchange(false))
+        return;
+
+    // Update the upstream statistic
+    _upstream->RecordRequest(CppCommon::Timestamp::nano() - _timestamp);
+    --_upstream->_outstanding;
+
+    // Complete the session request
+    bool reusable = _keep_alive && IsConnected();
+    auto session = Unbind();
+    _response.Clear();
+    if (session && !session->CompleteRequest(_until_close))
+        reusable = false;
+
+    Release(reusable);
+}
+
+void HTTPProxyClient::FailResponse()
+{
+    if (!_active.exchange(false))
+        return;
+
+    // Update the upstream statistic
+    ++_upstream->_errors;
+    --_upstream->_outstanding;
+
+    // Fail the session request
+    auto session = Unbind();
+    _response.Clear();
+    if (session)
+        session->FailRequest(_started);
+
+    Release(false);
+}
+
+bool HTTPProxyClient::AbortResponse()
+{
+    if (!_active.exchange(false))
+        return false;
+
+    --_upstream->_outstanding;
+    Unbind();
+    return true;
+}
+
+void HTTPProxyClient::Release(bool reusable)
+{
+    auto self(std::static_pointer_cast<HTTPProxyClient>(this->shared_from_this()));
+
+    // Idle pooled connection should detect the upstream disconnect
+    ResumeReceive();
+
+    // Return the client to the pool or discard it
+    auto pool = _pool.lock();
+    _pool.reset();
+    if (!pool)
+        DisconnectAsync();
+    else if (reusable)
+        pool->Checkin(self);
+    else
+        pool->Discard(self);
+}
+
+} // namespace HTTP
+} // namespace CppServer
@@ -0,0 +1,235 @@
+/*!
+    \file http_proxy_server.cpp
+    \brief HTTP proxy server implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/http/http_proxy_server.h"
+
+#include "string/string_utils.h"
+
+namespace CppServer {
+namespace HTTP {
+
+namespace {
+
+// Health check client of the single upstream
+class HealthCheckClient : public HTTPClient
+{
+public:
+    typedef std::function<void(bool healthy)> Handler;
+
+    HealthCheckClient(const std::shared_ptr<Asio::Service>& service, const std::string& address, int port, const std::string& path, const Handler& handler)
+        : HTTPClient(service, address, port),
+          _path(path),
+          _handler(handler),
+          _completed(false)
+    {
+    }
+
+protected:
+    void onConnected() override
+    {
+        request().MakeGetRequest(_path);
+        SendRequestAsync();
+    }
+
+    void onDisconnected() override
+    {
+        HTTPClient::onDisconnected();
+        Complete(false);
+    }
+
+    void onReceivedResponse(const HTTPResponse& response) override
+    {
+        Complete((response.status() >= 200) && (response.status() < 400));
+        DisconnectAsync();
+    }
+
+    void onReceivedResponseError(const HTTPResponse& response, const std::string& error) override { Complete(false); }
+
+private:
+    std::string _path;
+    Handler _handler;
+    std::atomic<bool> _completed;
+
+    void Complete(bool healthy)
+    {
+        // Call the health check handler only once
+        if (!_completed.exchange(true))
+            _handler(healthy);
+    }
+};
+
+} // namespace
+
+void HTTPProxyUpstream::RecordRequest(uint64_t latency) noexcept
+{
+    _histogram.Record(latency);
+    _latency += latency;
+    ++_requests;
+
+    // Update the maximal latency
+    uint64_t latency_max = _latency_max;
+    while ((latency > latency_max) && !_latency_max.compare_exchange_weak(latency_max, latency));
+}
+
+HTTPProxyServer::HTTPProxyServer(const std::shared_ptr<Asio::Service>& service, int port, Asio::InternetProtocol protocol)
+    : HTTPServer(service, port, protocol),
+      _pool(std::make_shared<Asio::ClientPool<HTTPProxyClient>>(service))
+{
+}
+
+HTTPProxyServer::HTTPProxyServer(const std::shared_ptr<Asio::Service>& service, const std::string& address, int port)
+    : HTTPServer(service, address, port),
+      _pool(std::make_shared<Asio::ClientPool<HTTPProxyClient>>(service))
+{
+}
+
+std::shared_ptr<HTTPProxyUpstream> HTTPProxyServer::AddUpstream(const std::string& address, int port)
+{
+    auto upstream = std::make_shared<HTTPProxyUpstream>(address, port);
+    _upstreams.emplace_back(upstream);
+    return upstream;
+}
+
+bool HTTPProxyServer::Start()
+{
+    // Start the upstream connection pool
+    bool pool_started = _pool->Start();
+
+    // Start the server
+    if (!HTTPServer::Start())
+    {
+        if (pool_started)
+            _pool->Stop();
+        return false;
+    }
+
+    std::scoped_lock locker(_health_lock);
+
+    // All upstreams are healthy until checked
+    for (auto& upstream : _upstreams)
+        upstream->_healthy = true;
+
+    // Schedule the health check
+    if (IsHealthCheckEnabled())
+    {
+        std::weak_ptr<HTTPProxyServer> weak(std::dynamic_pointer_cast<HTTPProxyServer>(shared_from_this()));
+        _health_token = service()->SchedulePeriodic(io_service(), _option_health_check_interval, [weak]()
+        {
+            auto server = weak.lock();
+            if (server)
+                server->CheckHealth();
+        });
+    }
+
+    return true;
+}
+
+bool HTTPProxyServer::Stop()
+{
+    // Stop the server
+    if (!HTTPServer::Stop())
+        return false;
+
+    {
+        std::scoped_lock locker(_health_lock);
+
+        // Cancel the health check
+        _health_token.Cancel();
+        for (auto& upstream : _upstreams)
+        {
+            if (upstream->_health_client)
+            {
+                upstream->_health_client->DisconnectAsync();
+                upstream->_health_client.reset();
+            }
+            upstream->_health_pending = false;
+        }
+    }
+
+    // Stop the upstream connection pool
+    _pool->Stop();
+
+    return true;
+}
+
+bool HTTPProxyServer::IsHopByHopHeader(std::string_view name) noexcept
+{
+    return CppCommon::StringUtils::CompareNoCase(name, "Connection") ||
+           CppCommon::StringUtils::CompareNoCase(name, "Keep-Alive") ||
+           CppCommon::StringUtils::CompareNoCase(name, "Proxy-Connection") ||
+           CppCommon::StringUtils::CompareNoCase(name, "TE") ||
+           CppCommon::StringUtils::CompareNoCase(name, "Trailer") ||
+           CppCommon::StringUtils::CompareNoCase(name, "Upgrade");
+}
+
+std::shared_ptr<HTTPProxyUpstream> HTTPProxyServer::SelectUpstream(const HTTPRequest& request)
+{
+    size_t count = _upstreams.size();
+    if (count == 0)
+        return nullptr;
+
+    // Rotate the first upstream to check, so ties of the least outstanding requests are balanced as well
+    size_t first = _next++;
+
+    std::shared_ptr<HTTPProxyUpstream> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto& upstream = _upstreams[(first + i) % count];
+
+        // Skip unhealthy upstreams
+        if (!upstream->IsHealthy())
+            continue;
+
+        if (_option_balancing == HTTPProxyBalancing::RoundRobin)
+            return upstream;
+
+        if (!result || (upstream->outstanding() < result->outstanding()))
+            result = upstream;
+    }
+    return result;
+}
+
+void HTTPProxyServer::CheckHealth()
+{
+    std::scoped_lock locker(_health_lock);
+
+    if (!IsStarted())
+        return;
+
+    for (auto& upstream : _upstreams)
+    {
+        // The upstream is unhealthy if the previous health check is not completed in time
+        if (upstream->_health_pending)
+            upstream->_healthy = false;
+
+        // Disconnect the previous health check client
+        if (upstream->_health_client)
+            upstream->_health_client->DisconnectAsync();
+
+        // Results of previous health checks are ignored
+        uint64_t generation = ++upstream->_health_generation;
+        std::weak_ptr<HTTPProxyUpstream> weak(upstream);
+        auto handler = [weak, generation](bool healthy)
+        {
+            auto instance = weak.lock();
+            if (instance && (instance->_health_generation == generation))
+            {
+                instance->_health_pending = false;
+                instance->_healthy = healthy;
+            }
+        };
+
+        // Connect a new health check client
+        upstream->_health_pending = true;
+        upstream->_health_client = std::make_shared<HealthCheckClient>(service(), upstream->address(), upstream->port(), _option_health_check_path, handler);
+        upstream->_health_client->ConnectAsync();
+    }
+}
+
+} // namespace HTTP
+} // namespace CppServer
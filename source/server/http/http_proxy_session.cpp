@@ -0,0 +1,359 @@
+/*!
+    \file http_proxy_session.cpp
+    \brief HTTP proxy session implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/http/http_proxy_session.h"
+#include "server/http/http_proxy_server.h"
+
+#include "string/string_utils.h"
+
+#include <algorithm>
+
+namespace CppServer {
+namespace HTTP {
+
+namespace {
+
+// Preformatted error responses of the proxy session
+const std::string_view BAD_REQUEST_RESPONSE = "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+const std::string_view BAD_GATEWAY_RESPONSE = "HTTP/1.1 502 Bad Gateway\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+const std::string_view SERVICE_UNAVAILABLE_RESPONSE = "HTTP/1.1 503 Service Unavailable\r\nRetry-After: 1\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+
+} // namespace
+
+HTTPProxySession::HTTPProxySession(const std::shared_ptr<HTTPProxyServer>& server)
+    : HTTPSession(server),
+      _proxy_server(server),
+      _buffer_limit(server->option_buffer_limit())
+{
+}
+
+void HTTPProxySession::onReceived(const void* buffer, size_t size)
+{
+    std::scoped_lock locker(_proxy_lock);
+
+    const char* data = (const char*)buffer;
+
+    // Forward the request body of the current request or skip the rest of it which is not consumed by the upstream
+    if (IsBodyPending())
+    {
+        size_t body = ConsumeBody(data, size);
+        if (_busy)
+            ForwardBody(data, body);
+        data += body;
+        size -= body;
+    }
+
+    // Keep subsequent requests until the current one is completed
+    _input.append(data, size);
+
+    ProcessRequests();
+    UpdateReceive();
+}
+
+void HTTPProxySession::onDisconnected()
+{
+    std::shared_ptr<HTTPProxyClient> client;
+
+    {
+        std::scoped_lock locker(_proxy_lock);
+
+        client.swap(_client);
+        _busy = false;
+        _body_remaining = 0;
+        _body_chunked = false;
+        _input.clear();
+        _pending.clear();
+        _request.Clear();
+    }
+
+    // The upstream connection with the partially forwarded response could not be reused
+    if (client && client->AbortResponse())
+    {
+        auto server = _proxy_server.lock();
+        if (server)
+            server->pool()->Discard(client);
+        else
+            client->DisconnectAsync();
+    }
+}
+
+void HTTPProxySession::onSent(size_t sent, size_t pending)
+{
+    if (pending > _buffer_limit)
+        return;
+
+    std::shared_ptr<HTTPProxyClient> client;
+    {
+        std::scoped_lock locker(_proxy_lock);
+        client = _client;
+    }
+
+    // Resume receiving of the upstream response when the session sent it
+    if (client && client->IsReceivePaused())
+        client->ResumeReceive();
+}
+
+void HTTPProxySession::onEmpty()
+{
+    // Close the connection when the final response is sent
+    if (_close_on_empty)
+        Disconnect();
+}
+
+void HTTPProxySession::UpdateReceive()
+{
+    // Data buffered for the upstream: subsequent requests, the request waiting for the upstream and unsent request data
+    size_t buffered = _input.size() + _pending.size() + (_client ? _client->bytes_pending() : 0);
+    if (buffered > _buffer_limit)
+        PauseReceive();
+    else if (IsReceivePaused())
+        ResumeReceive();
+}
+
+void HTTPProxySession::UpstreamSent()
+{
+    std::scoped_lock locker(_proxy_lock);
+
+    UpdateReceive();
+}
+
+void HTTPProxySession::ProcessRequests()
+{
+    while (!_busy && !IsBodyPending() && !_input.empty() && !_close_on_empty && IsConnected())
+    {
+        // Receive HTTP request header
+        size_t header = _request.PendingHeaderSize(_input.data(), _input.size());
+        bool received = _request.ReceiveHeader(_input.data(), header);
+        _input.erase(0, header);
+
+        // Check for HTTP request error
+        if (_request.error())
+        {
+            onReceivedRequestError(_request, "Invalid HTTP request!");
+            _request.Clear();
+            SendErrorResponse(BAD_REQUEST_RESPONSE);
+            return;
+        }
+
+        // Wait for the rest of HTTP request header
+        if (!received)
+            return;
+
+        // Prepare the request body framing, chunked request body is forwarded as it is
+        _body_chunked = _request._body_chunked;
+        _body_remaining = _body_chunked ? 0 : _request.body_length();
+        _body_decoder.Reset();
+
+        // Start forwarding of the request with the received part of its body
+        bool started = StartRequest();
+        size_t body = ConsumeBody(_input.data(), _input.size());
+        if (started)
+            ForwardBody(_input.data(), body);
+
+        _input.erase(0, body);
+        _request.Clear();
+    }
+}
+
+bool HTTPProxySession::StartRequest()
+{
+    _busy = true;
+
+    // Select the upstream
+    auto server = _proxy_server.lock();
+    auto upstream = server ? server->SelectUpstream(_request) : nullptr;
+    if (!upstream)
+    {
+        SendErrorResponse(SERVICE_UNAVAILABLE_RESPONSE);
+        return false;
+    }
+
+    // Get the client address
+    asio::error_code ec;
+    std::string address = socket().remote_endpoint(ec).address().to_string();
+
+    // Prepare the upstream request header without hop-by-hop headers
+    bool forwarded = false;
+    _pending.clear();
+    _pending.append(_request.method());
+    _pending.append(" ");
+    _pending.append(_request.url());
+    _pending.append(" HTTP/1.1\r\n");
+    for (size_t i = 0; i < _request.headers(); ++i)
+    {
+        auto [name, value] = _request.header(i);
+        if (HTTPProxyServer::IsHopByHopHeader(name))
+            continue;
+        _pending.append(name);
+        _pending.append(": ");
+        _pending.append(value);
+
+        // Extend the forwarded addresses with the client address
+        if (CppCommon::StringUtils::CompareNoCase(name, "X-Forwarded-For"))
+        {
+            _pending.append(", ");
+            _pending.append(address);
+            forwarded = true;
+        }
+
+        _pending.append("\r\n");
+    }
+    if (!forwarded)
+    {
+        _pending.append("X-Forwarded-For: ");
+        _pending.append(address);
+        _pending.append("\r\n");
+    }
+    _pending.append("\r\n");
+
+    ++_requests;
+    ++upstream->_outstanding;
+
+    // Checkout the upstream client
+    bool head = (_request.method() == "HEAD");
+    auto self(std::static_pointer_cast<HTTPProxySession>(this->shared_from_this()));
+    auto checkout_handler = [self, upstream, head](const std::shared_ptr<HTTPProxyClient>& client)
+    {
+        self->CheckoutCompleted(upstream, client, head);
+    };
+    if (!server->pool()->CheckoutAsync(upstream->address(), upstream->port(), server->option_upstream_timeout(), checkout_handler))
+    {
+        --upstream->_outstanding;
+        _pending.clear();
+        SendErrorResponse(SERVICE_UNAVAILABLE_RESPONSE);
+        return false;
+    }
+
+    return true;
+}
+
+size_t HTTPProxySession::ConsumeBody(const char* buffer, size_t size)
+{
+    // Find the end of the chunked request body
+    if (_body_chunked)
+    {
+        size_t body = _body_decoder.Decode(buffer, size, [](const char*, size_t) {});
+        if (_body_decoder.IsError())
+        {
+            // Invalid chunked request body could not be forwarded
+            _body_chunked = false;
+            Disconnect();
+            return size;
+        }
+        if (_body_decoder.IsCompleted())
+            _body_chunked = false;
+        return body;
+    }
+
+    size_t body = std::min(size, _body_remaining);
+    _body_remaining -= body;
+    return body;
+}
+
+void HTTPProxySession::ForwardBody(const char* buffer, size_t size)
+{
+    if (size == 0)
+        return;
+
+    // Forward the request body directly into the bound upstream client or keep it until checkout
+    if (_client)
+        _client->SendAsync(buffer, size);
+    else if (_busy && !_close_on_empty)
+        _pending.append(buffer, size);
+}
+
+void HTTPProxySession::CheckoutCompleted(const std::shared_ptr<HTTPProxyUpstream>& upstream, const std::shared_ptr<HTTPProxyClient>& client, bool head)
+{
+    std::scoped_lock locker(_proxy_lock);
+
+    auto server = _proxy_server.lock();
+
+    // Failed to checkout the upstream client in time
+    if (!client)
+    {
+        --upstream->_outstanding;
+        ++upstream->_errors;
+
+        // Passively mark the upstream as unhealthy until the next successful health check
+        if (server && server->IsHealthCheckEnabled())
+            upstream->_healthy = false;
+
+        _pending.clear();
+        SendErrorResponse(BAD_GATEWAY_RESPONSE);
+        return;
+    }
+
+    // Return the client back if the session is already disconnected
+    if (!_busy || !IsConnected() || !server)
+    {
+        --upstream->_outstanding;
+        if (server)
+            server->pool()->Checkin(client);
+        else
+            client->DisconnectAsync();
+        return;
+    }
+
+    // Bind the client and forward the request
+    _client = client;
+    _client->Bind(std::static_pointer_cast<HTTPProxySession>(this->shared_from_this()), upstream, server->pool(), head, _buffer_limit);
+    _client->SendAsync(_pending);
+    _pending.clear();
+    UpdateReceive();
+}
+
+bool HTTPProxySession::CompleteRequest(bool close)
+{
+    std::scoped_lock locker(_proxy_lock);
+
+    // The rest of the request body is discarded if the response is completed earlier
+    bool forwarded = !IsBodyPending();
+    _client.reset();
+    _busy = false;
+
+    // Process subsequent requests
+    if (close)
+        DisconnectOnEmpty();
+    else
+    {
+        ProcessRequests();
+        UpdateReceive();
+    }
+
+    return forwarded;
+}
+
+void HTTPProxySession::FailRequest(bool started)
+{
+    std::scoped_lock locker(_proxy_lock);
+
+    _client.reset();
+
+    // Send the error response if the upstream response is not started yet
+    if (started)
+        Disconnect();
+    else
+        SendErrorResponse(BAD_GATEWAY_RESPONSE);
+}
+
+void HTTPProxySession::SendErrorResponse(std::string_view response)
+{
+    _input.clear();
+    SendAsync(response);
+    DisconnectOnEmpty();
+}
+
+void HTTPProxySession::DisconnectOnEmpty()
+{
+    _close_on_empty = true;
+    if (bytes_pending() == 0)
+        Disconnect();
+}
+
+} // namespace HTTP
+} // namespace CppServer
@@ -11,6 +11,7 @@
 #include "string/string_utils.h"
 #include "utility/countof.h"
 
+#include <algorithm>
 #include <cassert>
 
 namespace CppServer {
@@ -53,6 +54,8 @@ HTTPRequest& HTTPRequest::Clear()
     _body_size = 0;
     _body_length = 0;
     _body_length_provided = false;
+    _body_chunked = false;
+    _chunked_decoder.Reset();
 
     _cache.clear();
     _cache_size = 0;
@@ -414,6 +417,21 @@ bool HTTPRequest::ReceiveHeader(const void* buffer, size_t size)
                     }
                 }
 
+                // Try to find the chunked transfer encoding
+                if (CppCommon::StringUtils::CompareNoCase(std::string_view(_cache.data() + header_name_index, header_name_size), "Transfer-Encoding"))
+                {
+                    // The chunked transfer coding must be the final one
+                    std::string_view coding(_cache.data() + header_value_index, header_value_size);
+                    size_t separator = coding.rfind(',');
+                    if (separator != std::string_view::npos)
+                        coding.remove_prefix(separator + 1);
+                    while (!coding.empty() && std::isspace(coding.front()))
+                        coding.remove_prefix(1);
+                    while (!coding.empty() && std::isspace(coding.back()))
+                        coding.remove_suffix(1);
+                    _body_chunked = CppCommon::StringUtils::CompareNoCase(coding, "chunked");
+                }
+
                 // Try to find Cookies
                 if (CppCommon::StringUtils::CompareNoCase(std::string_view(_cache.data() + header_name_index, header_name_size), "Cookie"))
                 {
@@ -536,6 +554,19 @@ bool HTTPRequest::ReceiveHeader(const void* buffer, size_t size)
             // Update the parsed cache size
             _cache_size = _cache.size();
 
+            // Decode the chunked body received together with the header
+            if (_body_chunked)
+            {
+                std::string encoded(_cache, _body_index);
+                _cache.resize(_body_index);
+                _cache_size = _cache.size();
+                _body_size = 0;
+                _body_length = 0;
+                _body_length_provided = false;
+                if (!encoded.empty())
+                    ReceiveChunked(encoded.data(), encoded.size());
+            }
+
             return true;
         }
     }
@@ -548,6 +579,10 @@ bool HTTPRequest::ReceiveHeader(const void* buffer, size_t size)
 
 bool HTTPRequest::ReceiveBody(const void* buffer, size_t size)
 {
+    // Decode the chunked body
+    if (_body_chunked)
+        return ReceiveChunked(buffer, size);
+
     // Update HTTP request cache
     _cache.insert(_cache.end(), (const char*)buffer, (const char*)buffer + size);
 
@@ -595,6 +630,86 @@ bool HTTPRequest::ReceiveBody(const void* buffer, size_t size)
     return false;
 }
 
+bool HTTPRequest::ReceiveChunked(const void* buffer, size_t size)
+{
+    // Decode the chunked body directly into HTTP request cache
+    _chunked_decoder.Decode(buffer, size, [this](const char* chunk, size_t chunk_size)
+    {
+        _cache.append(chunk, chunk_size);
+        _body_size += chunk_size;
+    });
+
+    // Update the parsed cache size
+    _cache_size = _cache.size();
+
+    // Check for the invalid chunked body
+    if (_chunked_decoder.IsError())
+    {
+        _error = true;
+        return false;
+    }
+
+    // Was the body fully received?
+    if (_chunked_decoder.IsCompleted())
+    {
+        _body_length = _body_size;
+        return true;
+    }
+
+    // Body was received partially...
+    return false;
+}
+
+size_t HTTPRequest::PendingHeaderSize(const void* buffer, size_t size) const
+{
+    const char* data = (const char*)buffer;
+
+    // Count the header separator bytes already received at the end of the request cache
+    size_t matched = 0;
+    if ((_cache.size() >= 3) && (_cache.compare(_cache.size() - 3, 3, "\r\n\r") == 0))
+        matched = 3;
+    else if ((_cache.size() >= 2) && (_cache.compare(_cache.size() - 2, 2, "\r\n") == 0))
+        matched = 2;
+    else if (!_cache.empty() && (_cache.back() == '\r'))
+        matched = 1;
+
+    // Try to seek for the rest of HTTP header separator
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (data[i] == "\r\n\r\n"[matched])
+        {
+            if (++matched == 4)
+                return i + 1;
+        }
+        else
+            matched = (data[i] == '\r') ? 1 : 0;
+    }
+
+    // The whole buffer belongs to HTTP header
+    return size;
+}
+
+size_t HTTPRequest::PendingBodySize(const void* buffer, size_t size) const
+{
+    // Find the chunked body end with a copy of the decoder, so the current decoder state is kept
+    if (_body_chunked)
+    {
+        HTTPChunkedDecoder decoder(_chunked_decoder);
+        return decoder.Decode(buffer, size, [](const char*, size_t) {});
+    }
+
+    // Check if the body length was provided
+    if (_body_length_provided)
+        return (_body_length > _body_size) ? std::min(size, _body_length - _body_size) : 0;
+
+    // HEAD/GET/DELETE/OPTIONS/TRACE request might have no body
+    if ((method() == "HEAD") || (method() == "GET") || (method() == "DELETE") || (method() == "OPTIONS") || (method() == "TRACE"))
+        return 0;
+
+    // The request body end is found by its content
+    return size;
+}
+
 std::string_view HTTPRequest::FastConvert(size_t value, char* buffer, size_t size)
 {
     size_t index = size;
@@ -639,6 +754,8 @@ void HTTPRequest::swap(HTTPRequest& request) noexcept
     swap(_body_size, request._body_size);
     swap(_body_length, request._body_length);
     swap(_body_length_provided, request._body_length_provided);
+    swap(_body_chunked, request._body_chunked);
+    swap(_chunked_decoder, request._chunked_decoder);
     swap(_cache, request._cache);
     swap(_cache_size, request._cache_size);
 }
@@ -113,6 +113,8 @@ HTTPResponse& HTTPResponse::Clear()
     _body_size = 0;
     _body_length = 0;
     _body_length_provided = false;
+    _body_chunked = false;
+    _chunked_decoder.Reset();
 
     _cache.clear();
     _cache_size = 0;
@@ -356,6 +358,24 @@ HTTPResponse& HTTPResponse::SetBodyLength(size_t length)
     return *this;
 }
 
+HTTPResponse& HTTPResponse::SetBodyChunked()
+{
+    // Append chunked transfer encoding header
+    SetHeader("Transfer-Encoding", "chunked");
+
+    _cache.append("\r\n");
+
+    size_t index = _cache.size();
+
+    // Clear the HTTP response body
+    _body_index = index;
+    _body_size = 0;
+    _body_length = 0;
+    _body_length_provided = false;
+    _body_chunked = true;
+    return *this;
+}
+
 HTTPResponse& HTTPResponse::MakeOKResponse(int status)
 {
     Clear();
@@ -563,6 +583,21 @@ bool HTTPResponse::ReceiveHeader(const void* buffer, size_t size)
                         _body_length_provided = true;
                     }
                 }
+
+                // Try to find the chunked transfer encoding
+                if (CppCommon::StringUtils::CompareNoCase(std::string_view(_cache.data() + header_name_index, header_name_size), "Transfer-Encoding"))
+                {
+                    // The chunked transfer coding must be the final one
+                    std::string_view coding(_cache.data() + header_value_index, header_value_size);
+                    size_t separator = coding.rfind(',');
+                    if (separator != std::string_view::npos)
+                        coding.remove_prefix(separator + 1);
+                    while (!coding.empty() && std::isspace(coding.front()))
+                        coding.remove_prefix(1);
+                    while (!coding.empty() && std::isspace(coding.back()))
+                        coding.remove_suffix(1);
+                    _body_chunked = CppCommon::StringUtils::CompareNoCase(coding, "chunked");
+                }
             }
 
             // Reset the error flag
@@ -575,6 +610,19 @@ bool HTTPResponse::ReceiveHeader(const void* buffer, size_t size)
             // Update the parsed cache size
             _cache_size = _cache.size();
 
+            // Decode the chunked body received together with the header
+            if (_body_chunked)
+            {
+                std::string encoded(_cache, _body_index);
+                _cache.resize(_body_index);
+                _cache_size = _cache.size();
+                _body_size = 0;
+                _body_length = 0;
+                _body_length_provided = false;
+                if (!encoded.empty())
+                    ReceiveChunked(encoded.data(), encoded.size());
+            }
+
             return true;
         }
     }
@@ -587,6 +635,10 @@ bool HTTPResponse::ReceiveHeader(const void* buffer, size_t size)
 
 bool HTTPResponse::ReceiveBody(const void* buffer, size_t size)
 {
+    // Decode the chunked body
+    if (_body_chunked)
+        return ReceiveChunked(buffer, size);
+
     // Update HTTP response cache
     _cache.insert(_cache.end(), (const char*)buffer, (const char*)buffer + size);
 
@@ -626,6 +678,65 @@ bool HTTPResponse::ReceiveBody(const void* buffer, size_t size)
     return false;
 }
 
+bool HTTPResponse::ReceiveChunked(const void* buffer, size_t size)
+{
+    // Decode the chunked body directly into HTTP response cache
+    _chunked_decoder.Decode(buffer, size, [this](const char* chunk, size_t chunk_size)
+    {
+        _cache.append(chunk, chunk_size);
+        _body_size += chunk_size;
+    });
+
+    // Update the parsed cache size
+    _cache_size = _cache.size();
+
+    // Check for the invalid chunked body
+    if (_chunked_decoder.IsError())
+    {
+        _error = true;
+        return false;
+    }
+
+    // Was the body fully received?
+    if (_chunked_decoder.IsCompleted())
+    {
+        _body_length = _body_size;
+        return true;
+    }
+
+    // Body was received partially...
+    return false;
+}
+
+size_t HTTPResponse::PendingHeaderSize(const void* buffer, size_t size) const
+{
+    const char* data = (const char*)buffer;
+
+    // Count the header separator bytes already received at the end of the response cache
+    size_t matched = 0;
+    if ((_cache.size() >= 3) && (_cache.compare(_cache.size() - 3, 3, "\r\n\r") == 0))
+        matched = 3;
+    else if ((_cache.size() >= 2) && (_cache.compare(_cache.size() - 2, 2, "\r\n") == 0))
+        matched = 2;
+    else if (!_cache.empty() && (_cache.back() == '\r'))
+        matched = 1;
+
+    // Try to seek for the rest of HTTP header separator
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (data[i] == "\r\n\r\n"[matched])
+        {
+            if (++matched == 4)
+                return i + 1;
+        }
+        else
+            matched = (data[i] == '\r') ? 1 : 0;
+    }
+
+    // The whole buffer belongs to HTTP header
+    return size;
+}
+
 std::string_view HTTPResponse::FastConvert(size_t value, char* buffer, size_t size)
 {
     size_t index = size;
@@ -668,6 +779,8 @@ void HTTPResponse::swap(HTTPResponse& response) noexcept
     swap(_body_size, response._body_size);
     swap(_body_length, response._body_length);
     swap(_body_length_provided, response._body_length_provided);
+    swap(_body_chunked, response._body_chunked);
+    swap(_chunked_decoder, response._chunked_decoder);
     swap(_cache, response._cache);
     swap(_cache_size, response._cache_size);
 }
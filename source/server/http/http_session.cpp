@@ -12,6 +12,13 @@
 namespace CppServer {
 namespace HTTP {
 
+namespace {
+
+// Preformatted response for HTTP requests shed by the overload control
+const std::string_view SERVICE_UNAVAILABLE_RESPONSE = "HTTP/1.1 503 Service Unavailable\r\nRetry-After: 1\r\nContent-Length: 0\r\n\r\n";
+
+} // namespace
+
 HTTPSession::HTTPSession(const std::shared_ptr<HTTPServer>& server)
     : Asio::TCPSession(server),
       _cache(server->cache())
@@ -20,39 +27,67 @@ HTTPSession::HTTPSession(const std::shared_ptr<HTTPServer>& server)
 
 void HTTPSession::onReceived(const void* buffer, size_t size)
 {
-    // Receive HTTP request header
-    if (_request.IsPendingHeader())
+    const char* data = (const char*)buffer;
+
+    // Process all pipelined HTTP requests of the received buffer in order
+    while (size > 0)
     {
-        if (_request.ReceiveHeader(buffer, size))
-            onReceivedRequestHeader(_request);
+        // Receive HTTP request header
+        if (_request.IsPendingHeader())
+        {
+            size_t header = _request.PendingHeaderSize(data, size);
+            if (_request.ReceiveHeader(data, header))
+            {
+                // Shed the new HTTP request if the server is overloaded
+                if (server()->IsOverloaded())
+                {
+                    _request_shed = true;
+                    server()->AddShedRequest();
+                    onReceivedRequestShed(_request);
+                }
+                else
+                    onReceivedRequestHeader(_request);
+            }
 
-        size = 0;
-    }
+            data += header;
+            size -= header;
+        }
 
-    // Check for HTTP request error
-    if (_request.error())
-    {
-        onReceivedRequestError(_request, "Invalid HTTP request!");
-        _request.Clear();
-        Disconnect();
-        return;
-    }
+        // Check for HTTP request error
+        if (_request.error())
+        {
+            onReceivedRequestError(_request, "Invalid HTTP request!");
+            _request.Clear();
+            Disconnect();
+            return;
+        }
 
-    // Receive HTTP request body
-    if (_request.ReceiveBody(buffer, size))
-    {
-        onReceivedRequestInternal(_request);
-        _request.Clear();
-        return;
-    }
+        // Wait for the rest of HTTP request header
+        if (_request.IsPendingHeader())
+            return;
 
-    // Check for HTTP request error
-    if (_request.error())
-    {
-        onReceivedRequestError(_request, "Invalid HTTP request!");
-        _request.Clear();
-        Disconnect();
-        return;
+        // Receive HTTP request body
+        size_t body = _request.PendingBodySize(data, size);
+        bool received = _request.ReceiveBody(data, body);
+        data += body;
+        size -= body;
+        if (received)
+        {
+            if (!_request_shed)
+                onReceivedRequestInternal(_request);
+            _request_shed = false;
+            _request.Clear();
+            continue;
+        }
+
+        // Check for HTTP request error
+        if (_request.error())
+        {
+            onReceivedRequestError(_request, "Invalid HTTP request!");
+            _request.Clear();
+            Disconnect();
+            return;
+        }
     }
 }
 
@@ -61,10 +96,19 @@ void HTTPSession::onDisconnected()
     // Receive HTTP request body
     if (_request.IsPendingBody())
     {
-        onReceivedRequestInternal(_request);
+        if (!_request_shed)
+            onReceivedRequestInternal(_request);
+        _request_shed = false;
         _request.Clear();
         return;
     }
+
+    _request_shed = false;
+}
+
+void HTTPSession::onReceivedRequestShed(const HTTPRequest& request)
+{
+    SendAsync(SERVICE_UNAVAILABLE_RESPONSE);
 }
 
 void HTTPSession::onReceivedRequestInternal(const HTTPRequest& request)
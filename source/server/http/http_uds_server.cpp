@@ -0,0 +1,36 @@
+/*!
+    \file http_uds_server.cpp
+    \brief HTTP over Unix domain socket server implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/http/http_uds_server.h"
+
+#include "string/format.h"
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace HTTP {
+
+void HTTPUDSServer::AddStaticContent(const CppCommon::Path& path, const std::string& prefix, const CppCommon::Timespan& timeout)
+{
+    auto hanlder = [](CppCommon::FileCache & cache, const std::string& key, const std::string& value, const CppCommon::Timespan& timespan)
+    {
+        auto response = HTTPResponse();
+        response.SetBegin(200);
+        response.SetContentType(CppCommon::Path(key).extension().string());
+        response.SetHeader("Cache-Control", CppCommon::format("max-age={}", timespan.seconds()));
+        response.SetBody(value);
+        return cache.insert(key, response.cache(), timespan);
+    };
+
+    cache().insert_path(path, prefix, timeout, hanlder);
+}
+
+} // namespace HTTP
+} // namespace CppServer
+
+#endif
@@ -0,0 +1,111 @@
+/*!
+    \file http_uds_session.cpp
+    \brief HTTP over Unix domain socket session implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/http/http_uds_session.h"
+#include "server/http/http_uds_server.h"
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace HTTP {
+
+HTTPUDSSession::HTTPUDSSession(const std::shared_ptr<HTTPUDSServer>& server)
+    : Asio::UDSSession(server),
+      _cache(server->cache())
+{
+}
+
+void HTTPUDSSession::onReceived(const void* buffer, size_t size)
+{
+    const char* data = (const char*)buffer;
+
+    // Process all pipelined HTTP requests of the received buffer in order
+    while (size > 0)
+    {
+        // Receive HTTP request header
+        if (_request.IsPendingHeader())
+        {
+            size_t header = _request.PendingHeaderSize(data, size);
+            if (_request.ReceiveHeader(data, header))
+                onReceivedRequestHeader(_request);
+
+            data += header;
+            size -= header;
+        }
+
+        // Check for HTTP request error
+        if (_request.error())
+        {
+            onReceivedRequestError(_request, "Invalid HTTP request!");
+            _request.Clear();
+            Disconnect();
+            return;
+        }
+
+        // Wait for the rest of HTTP request header
+        if (_request.IsPendingHeader())
+            return;
+
+        // Receive HTTP request body
+        size_t body = _request.PendingBodySize(data, size);
+        bool received = _request.ReceiveBody(data, body);
+        data += body;
+        size -= body;
+        if (received)
+        {
+            onReceivedRequestInternal(_request);
+            _request.Clear();
+            continue;
+        }
+
+        // Check for HTTP request error
+        if (_request.error())
+        {
+            onReceivedRequestError(_request, "Invalid HTTP request!");
+            _request.Clear();
+            Disconnect();
+            return;
+        }
+    }
+}
+
+void HTTPUDSSession::onDisconnected()
+{
+    // Receive HTTP request body
+    if (_request.IsPendingBody())
+    {
+        onReceivedRequestInternal(_request);
+        _request.Clear();
+        return;
+    }
+}
+
+void HTTPUDSSession::onReceivedRequestInternal(const HTTPRequest& request)
+{
+    // Try to get the cached response
+    if (request.method() == "GET")
+    {
+        std::string_view url = request.url();
+        size_t index = url.find('?');
+        auto response = cache().find(std::string((index == std::string_view::npos) ? url : url.substr(0, index)));
+        if (response.first)
+        {
+            // Process the request with the cached response
+            onReceivedCachedRequest(request, response.second);
+            return;
+        }
+    }
+
+    // Process the request
+    onReceivedRequest(request);
+}
+
+} // namespace HTTP
+} // namespace CppServer
+
+#endif
@@ -27,7 +27,7 @@ void HTTPSClient::onReceived(const void* buffer, size_t size)
     {
         onReceivedResponseError(_response, "Invalid HTTP response!");
         _response.Clear();
-        DisconnectAsync();
+        DisconnectInternalAsync(false);
         return;
     }
 
@@ -44,7 +44,7 @@ void HTTPSClient::onReceived(const void* buffer, size_t size)
     {
         onReceivedResponseError(_response, "Invalid HTTP response!");
         _response.Clear();
-        DisconnectAsync();
+        DisconnectInternalAsync(false);
         return;
     }
 }
@@ -62,9 +62,12 @@ void HTTPSClient::onDisconnected()
 
 std::future<HTTPResponse> HTTPSClientEx::SendRequest(const HTTPRequest& request, const CppCommon::Timespan& timeout)
 {
-    // Create TCP resolver if the current one is empty
+    // Create TCP resolver with the DNS resolver cache if the current one is empty
     if (!_resolver)
+    {
         _resolver = std::make_shared<Asio::TCPResolver>(service());
+        _resolver->SetupCache(true);
+    }
     // Create timeout check timer if the current one is empty
     if (!_timeout)
         _timeout = std::make_shared<Asio::Timer>(service());
@@ -108,7 +111,7 @@ std::future<HTTPResponse> HTTPSClientEx::SendRequest(const HTTPRequest& request,
         // Disconnect on timeout
         onReceivedResponseError(_response, "Timeout!");
         _response.Clear();
-        DisconnectAsync();
+        DisconnectInternalAsync(false);
     };
     if (!_timeout->Setup(timeout_handler, timeout) || !_timeout->WaitAsync())
     {
@@ -20,39 +20,55 @@ HTTPSSession::HTTPSSession(const std::shared_ptr<HTTPSServer>& server)
 
 void HTTPSSession::onReceived(const void* buffer, size_t size)
 {
-    // Receive HTTP request header
-    if (_request.IsPendingHeader())
+    const char* data = (const char*)buffer;
+
+    // Process all pipelined HTTP requests of the received buffer in order
+    while (size > 0)
     {
-        if (_request.ReceiveHeader(buffer, size))
-            onReceivedRequestHeader(_request);
+        // Receive HTTP request header
+        if (_request.IsPendingHeader())
+        {
+            size_t header = _request.PendingHeaderSize(data, size);
+            if (_request.ReceiveHeader(data, header))
+                onReceivedRequestHeader(_request);
 
-        size = 0;
-    }
+            data += header;
+            size -= header;
+        }
 
-    // Check for HTTP request error
-    if (_request.error())
-    {
-        onReceivedRequestError(_request, "Invalid HTTP request!");
-        _request.Clear();
-        Disconnect();
-        return;
-    }
+        // Check for HTTP request error
+        if (_request.error())
+        {
+            onReceivedRequestError(_request, "Invalid HTTP request!");
+            _request.Clear();
+            Disconnect();
+            return;
+        }
 
-    // Receive HTTP request body
-    if (_request.ReceiveBody(buffer, size))
-    {
-        onReceivedRequestInternal(_request);
-        _request.Clear();
-        return;
-    }
+        // Wait for the rest of HTTP request header
+        if (_request.IsPendingHeader())
+            return;
 
-    // Check for HTTP request error
-    if (_request.error())
-    {
-        onReceivedRequestError(_request, "Invalid HTTP request!");
-        _request.Clear();
-        Disconnect();
-        return;
+        // Receive HTTP request body
+        size_t body = _request.PendingBodySize(data, size);
+        bool received = _request.ReceiveBody(data, body);
+        data += body;
+        size -= body;
+        if (received)
+        {
+            onReceivedRequestInternal(_request);
+            _request.Clear();
+            continue;
+        }
+
+        // Check for HTTP request error
+        if (_request.error())
+        {
+            onReceivedRequestError(_request, "Invalid HTTP request!");
+            _request.Clear();
+            Disconnect();
+            return;
+        }
     }
 }
 
@@ -98,6 +98,11 @@ void WSClient::onReceivedResponseHeader(const HTTP::HTTPResponse& response)
         HTTPClient::onReceivedResponseHeader(response);
         return;
     }
+
+#if defined(CPPSERVER_COROUTINES)
+    // Resume the connect awaiter
+    ResumeConnectAwaiter(true);
+#endif
 }
 
 void WSClient::onReceivedResponse(const HTTP::HTTPResponse& response)
@@ -45,20 +45,61 @@ bool WSServer::Multicast(const void* buffer, size_t size)
     if (buffer == nullptr)
         return false;
 
+    // Copy the multicast data once for all working threads
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    auto data = std::make_shared<const std::vector<uint8_t>>(bytes, bytes + size);
+
+    std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+    // Append the multicast data to the journal
+    uint64_t sequence = Journal(data);
+
+    // Multicast all WebSocket sessions with a single task per working thread
+    Asio::MulticastBatched(service(), _sessions, [data, sequence](const std::shared_ptr<Asio::TCPSession>& session)
+    {
+        auto ws_session = std::dynamic_pointer_cast<WSSession>(session);
+        if (ws_session)
+        {
+            std::scoped_lock ws_locker(ws_session->_ws_send_lock);
+
+            if (ws_session->_ws_handshaked)
+                SendJournaled(session, sequence, data);
+        }
+    });
+
+    return true;
+}
+
+bool WSServer::MulticastConflated(std::string_view key, const void* buffer, size_t size)
+{
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    // Copy the multicast key and data once for all working threads
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    auto data = std::make_shared<const std::pair<std::string, std::vector<uint8_t>>>(std::string(key), std::vector<uint8_t>(bytes, bytes + size));
+
     std::shared_lock<std::shared_mutex> locker(_sessions_lock);
 
-    // Multicast all WebSocket sessions
-    for (auto& session : _sessions)
+    // Multicast all WebSocket sessions with conflation with a single task per working thread
+    Asio::MulticastBatched(service(), _sessions, [data](const std::shared_ptr<Asio::TCPSession>& session)
     {
-        auto ws_session = std::dynamic_pointer_cast<WSSession>(session.second);
+        auto ws_session = std::dynamic_pointer_cast<WSSession>(session);
         if (ws_session)
         {
             std::scoped_lock ws_locker(ws_session->_ws_send_lock);
 
             if (ws_session->_ws_handshaked)
-                ws_session->SendAsync(buffer, size);
+                ws_session->SendConflatedAsync(data->first, data->second.data(), data->second.size());
         }
-    }
+    });
 
     return true;
 }
@@ -0,0 +1,246 @@
+/*!
+    \file ws_uds_client.cpp
+    \brief WebSocket over Unix domain socket client implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/ws/ws_uds_client.h"
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace WS {
+
+bool WSUDSClient::Connect()
+{
+    _sync_connect = true;
+    return HTTPUDSClient::Connect();
+}
+
+bool WSUDSClient::ConnectAsync()
+{
+    _sync_connect = false;
+    return HTTPUDSClient::ConnectAsync();
+}
+
+void WSUDSClient::onConnected()
+{
+    // Clear WebSocket send/receive buffers
+    ClearWSBuffers();
+
+    // Fill the WebSocket upgrade HTTP request
+    onWSConnecting(_request);
+
+    // Set empty body of the WebSocket upgrade HTTP request
+    _request.SetBody();
+
+    // Send the WebSocket upgrade HTTP request
+    if (_sync_connect)
+        Send(_request.cache());
+    else
+        SendAsync(_request.cache());
+}
+
+void WSUDSClient::onDisconnected()
+{
+    // Disconnect WebSocket
+    if (_ws_handshaked)
+    {
+        _ws_handshaked = false;
+        onWSDisconnected();
+    }
+
+    // Reset WebSocket upgrade HTTP request and response
+    _request.Clear();
+    _response.Clear();
+
+    // Clear WebSocket send/receive buffers
+    ClearWSBuffers();
+
+    // Initialize new WebSocket random nonce
+    InitWSNonce();
+}
+
+void WSUDSClient::onReceived(const void* buffer, size_t size)
+{
+    // Check for WebSocket handshaked status
+    if (_ws_handshaked)
+    {
+        // Prepare receive frame
+        PrepareReceiveFrame(buffer, size);
+        return;
+    }
+
+    HTTPUDSClient::onReceived(buffer, size);
+}
+
+void WSUDSClient::onReceivedResponseHeader(const HTTP::HTTPResponse& response)
+{
+    // Check for WebSocket handshaked status
+    if (_ws_handshaked)
+        return;
+
+    // Try to perform WebSocket upgrade
+    if (!PerformClientUpgrade(response, id()))
+    {
+        HTTPUDSClient::onReceivedResponseHeader(response);
+        return;
+    }
+}
+
+void WSUDSClient::onReceivedResponse(const HTTP::HTTPResponse& response)
+{
+    // Check for WebSocket handshaked status
+    if (_ws_handshaked)
+    {
+        // Prepare receive frame from the remaining response body
+        auto body = response.body();
+        PrepareReceiveFrame(body.data(), body.size());
+        return;
+    }
+
+    HTTPUDSClient::onReceivedResponse(response);
+}
+
+void WSUDSClient::onReceivedResponseError(const HTTP::HTTPResponse& response, const std::string& error)
+{
+    // Check for WebSocket handshaked status
+    if (_ws_handshaked)
+    {
+        onError(asio::error::fault, "WebSocket error", error);
+        return;
+    }
+
+    HTTPUDSClient::onReceivedResponseError(response, error);
+}
+
+std::string WSUDSClient::ReceiveText()
+{
+    std::string result;
+
+    if (!_ws_handshaked)
+        return result;
+
+    std::vector<uint8_t> cache;
+
+    // Receive WebSocket frame data
+    while (!_ws_final_received)
+    {
+        while (!_ws_frame_received)
+        {
+            size_t required = RequiredReceiveFrameSize();
+            cache.resize(required);
+            size_t received = HTTPUDSClient::Receive(cache.data(), required);
+            if (received != required)
+                return result;
+            PrepareReceiveFrame(cache.data(), received);
+        }
+        if (!_ws_final_received)
+            PrepareReceiveFrame(nullptr, 0);
+    }
+
+    // Copy WebSocket frame data
+    result.insert(result.end(), _ws_receive_final_buffer.data() + _ws_header_size, _ws_receive_final_buffer.data() + _ws_header_size + _ws_payload_size);
+    PrepareReceiveFrame(nullptr, 0);
+    return result;
+}
+
+std::string WSUDSClient::ReceiveText(const CppCommon::Timespan& timeout)
+{
+    std::string result;
+
+    if (!_ws_handshaked)
+        return result;
+
+    std::vector<uint8_t> cache;
+
+    // Receive WebSocket frame data
+    while (!_ws_final_received)
+    {
+        while (!_ws_frame_received)
+        {
+            size_t required = RequiredReceiveFrameSize();
+            cache.resize(required);
+            size_t received = HTTPUDSClient::Receive(cache.data(), required, timeout);
+            if (received != required)
+                return result;
+            PrepareReceiveFrame(cache.data(), received);
+        }
+        if (!_ws_final_received)
+            PrepareReceiveFrame(nullptr, 0);
+    }
+
+    // Copy WebSocket frame data
+    result.insert(result.end(), _ws_receive_final_buffer.data() + _ws_header_size, _ws_receive_final_buffer.data() + _ws_header_size + _ws_payload_size);
+    PrepareReceiveFrame(nullptr, 0);
+    return result;
+}
+
+std::vector<uint8_t> WSUDSClient::ReceiveBinary()
+{
+    std::vector<uint8_t> result;
+
+    if (!_ws_handshaked)
+        return result;
+
+    std::vector<uint8_t> cache;
+
+    // Receive WebSocket frame data
+    while (!_ws_final_received)
+    {
+        while (!_ws_frame_received)
+        {
+            size_t required = RequiredReceiveFrameSize();
+            cache.resize(required);
+            size_t received = HTTPUDSClient::Receive(cache.data(), required);
+            if (received != required)
+                return result;
+            PrepareReceiveFrame(cache.data(), received);
+        }
+        if (!_ws_final_received)
+            PrepareReceiveFrame(nullptr, 0);
+    }
+
+    // Copy WebSocket frame data
+    result.insert(result.end(), _ws_receive_final_buffer.data() + _ws_header_size, _ws_receive_final_buffer.data() + _ws_header_size + _ws_payload_size);
+    PrepareReceiveFrame(nullptr, 0);
+    return result;
+}
+
+std::vector<uint8_t> WSUDSClient::ReceiveBinary(const CppCommon::Timespan& timeout)
+{
+    std::vector<uint8_t> result;
+
+    if (!_ws_handshaked)
+        return result;
+
+    std::vector<uint8_t> cache;
+
+    // Receive WebSocket frame data
+    while (!_ws_final_received)
+    {
+        while (!_ws_frame_received)
+        {
+            size_t required = RequiredReceiveFrameSize();
+            cache.resize(required);
+            size_t received = HTTPUDSClient::Receive(cache.data(), required, timeout);
+            if (received != required)
+                return result;
+            PrepareReceiveFrame(cache.data(), received);
+        }
+        if (!_ws_final_received)
+            PrepareReceiveFrame(nullptr, 0);
+    }
+
+    // Copy WebSocket frame data
+    result.insert(result.end(), _ws_receive_final_buffer.data() + _ws_header_size, _ws_receive_final_buffer.data() + _ws_header_size + _ws_payload_size);
+    PrepareReceiveFrame(nullptr, 0);
+    return result;
+}
+
+} // namespace WS
+} // namespace CppServer
+
+#endif
@@ -0,0 +1,222 @@
+/*!
+    \file ws_uds_session.cpp
+    \brief WebSocket over Unix domain socket session implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "server/ws/ws_uds_session.h"
+#include "server/ws/ws_uds_server.h"
+
+#if defined(CPPSERVER_UDS)
+
+namespace CppServer {
+namespace WS {
+
+WSUDSSession::WSUDSSession(const std::shared_ptr<WSUDSServer>& server)
+    : HTTP::HTTPUDSSession(server)
+{
+}
+
+void WSUDSSession::onDisconnected()
+{
+    // Disconnect WebSocket
+    if (_ws_handshaked)
+    {
+        _ws_handshaked = false;
+        onWSDisconnected();
+    }
+
+    // Reset WebSocket upgrade HTTP request and response
+    _request.Clear();
+    _response.Clear();
+
+    // Clear WebSocket send/receive buffers
+    ClearWSBuffers();
+
+    // Initialize new WebSocket random nonce
+    InitWSNonce();
+}
+
+void WSUDSSession::onReceived(const void* buffer, size_t size)
+{
+    // Check for WebSocket handshaked status
+    if (_ws_handshaked)
+    {
+        // Prepare receive frame
+        PrepareReceiveFrame(buffer, size);
+        return;
+    }
+
+    HTTPUDSSession::onReceived(buffer, size);
+}
+
+void WSUDSSession::onReceivedRequestHeader(const HTTP::HTTPRequest& request)
+{
+    // Check for WebSocket handshaked status
+    if (_ws_handshaked)
+        return;
+
+    // Try to perform WebSocket upgrade
+    if (!PerformServerUpgrade(request, response()))
+    {
+        HTTPUDSSession::onReceivedRequestHeader(request);
+        return;
+    }
+}
+
+void WSUDSSession::onReceivedRequest(const HTTP::HTTPRequest& request)
+{
+    // Check for WebSocket handshaked status
+    if (_ws_handshaked)
+    {
+        // Prepare receive frame from the remaining request body
+        auto body = _request.body();
+        PrepareReceiveFrame(body.data(), body.size());
+        return;
+    }
+
+    HTTPUDSSession::onReceivedRequest(request);
+}
+
+void WSUDSSession::onReceivedRequestError(const HTTP::HTTPRequest& request, const std::string& error)
+{
+    // Check for WebSocket handshaked status
+    if (_ws_handshaked)
+    {
+        onError(asio::error::fault, "WebSocket error", error);
+        return;
+    }
+
+    HTTPUDSSession::onReceivedRequestError(request, error);
+}
+
+std::string WSUDSSession::ReceiveText()
+{
+    std::string result;
+
+    if (!_ws_handshaked)
+        return result;
+
+    std::vector<uint8_t> cache;
+
+    // Receive WebSocket frame data
+    while (!_ws_final_received)
+    {
+        while (!_ws_frame_received)
+        {
+            size_t required = RequiredReceiveFrameSize();
+            cache.resize(required);
+            size_t received = HTTPUDSSession::Receive(cache.data(), required);
+            if (received != required)
+                return result;
+            PrepareReceiveFrame(cache.data(), received);
+        }
+        if (!_ws_final_received)
+            PrepareReceiveFrame(nullptr, 0);
+    }
+
+    // Copy WebSocket frame data
+    result.insert(result.end(), _ws_receive_final_buffer.data() + _ws_header_size, _ws_receive_final_buffer.data() + _ws_header_size + _ws_payload_size);
+    PrepareReceiveFrame(nullptr, 0);
+    return result;
+}
+
+std::string WSUDSSession::ReceiveText(const CppCommon::Timespan& timeout)
+{
+    std::string result;
+
+    if (!_ws_handshaked)
+        return result;
+
+    std::vector<uint8_t> cache;
+
+    // Receive WebSocket frame data
+    while (!_ws_final_received)
+    {
+        while (!_ws_frame_received)
+        {
+            size_t required = RequiredReceiveFrameSize();
+            cache.resize(required);
+            size_t received = HTTPUDSSession::Receive(cache.data(), required, timeout);
+            if (received != required)
+                return result;
+            PrepareReceiveFrame(cache.data(), received);
+        }
+        if (!_ws_final_received)
+            PrepareReceiveFrame(nullptr, 0);
+    }
+
+    // Copy WebSocket frame data
+    result.insert(result.end(), _ws_receive_final_buffer.data() + _ws_header_size, _ws_receive_final_buffer.data() + _ws_header_size + _ws_payload_size);
+    PrepareReceiveFrame(nullptr, 0);
+    return result;
+}
+
+std::vector<uint8_t> WSUDSSession::ReceiveBinary()
+{
+    std::vector<uint8_t> result;
+
+    if (!_ws_handshaked)
+        return result;
+
+    std::vector<uint8_t> cache;
+
+    // Receive WebSocket frame data
+    while (!_ws_final_received)
+    {
+        while (!_ws_frame_received)
+        {
+            size_t required = RequiredReceiveFrameSize();
+            cache.resize(required);
+            size_t received = HTTPUDSSession::Receive(cache.data(), required);
+            if (received != required)
+                return result;
+            PrepareReceiveFrame(cache.data(), received);
+        }
+        if (!_ws_final_received)
+            PrepareReceiveFrame(nullptr, 0);
+    }
+
+    // Copy WebSocket frame data
+    result.insert(result.end(), _ws_receive_final_buffer.data() + _ws_header_size, _ws_receive_final_buffer.data() + _ws_header_size + _ws_payload_size);
+    PrepareReceiveFrame(nullptr, 0);
+    return result;
+}
+
+std::vector<uint8_t> WSUDSSession::ReceiveBinary(const CppCommon::Timespan& timeout)
+{
+    std::vector<uint8_t> result;
+
+    if (!_ws_handshaked)
+        return result;
+
+    std::vector<uint8_t> cache;
+
+    // Receive WebSocket frame data
+    while (!_ws_final_received)
+    {
+        while (!_ws_frame_received)
+        {
+            size_t required = RequiredReceiveFrameSize();
+            cache.resize(required);
+            size_t received = HTTPUDSSession::Receive(cache.data(), required, timeout);
+            if (received != required)
+                return result;
+            PrepareReceiveFrame(cache.data(), received);
+        }
+        if (!_ws_final_received)
+            PrepareReceiveFrame(nullptr, 0);
+    }
+
+    // Copy WebSocket frame data
+    result.insert(result.end(), _ws_receive_final_buffer.data() + _ws_header_size, _ws_receive_final_buffer.data() + _ws_header_size + _ws_payload_size);
+    PrepareReceiveFrame(nullptr, 0);
+    return result;
+}
+
+} // namespace WS
+} // namespace CppServer
+
+#endif
@@ -45,20 +45,58 @@ bool WSSServer::Multicast(const void* buffer, size_t size)
     if (buffer == nullptr)
         return false;
 
+    // Copy the multicast data once for all working threads
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    auto data = std::make_shared<const std::vector<uint8_t>>(bytes, bytes + size);
+
+    std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+    // Multicast all WebSocket sessions with a single task per working thread
+    Asio::MulticastBatched(service(), _sessions, [data](const std::shared_ptr<Asio::SSLSession>& session)
+    {
+        auto wss_session = std::dynamic_pointer_cast<WSSSession>(session);
+        if (wss_session)
+        {
+            std::scoped_lock ws_locker(wss_session->_ws_send_lock);
+
+            if (wss_session->_ws_handshaked)
+                wss_session->SendAsync(data->data(), data->size());
+        }
+    });
+
+    return true;
+}
+
+bool WSSServer::MulticastConflated(std::string_view key, const void* buffer, size_t size)
+{
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    // Copy the multicast key and data once for all working threads
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    auto data = std::make_shared<const std::pair<std::string, std::vector<uint8_t>>>(std::string(key), std::vector<uint8_t>(bytes, bytes + size));
+
     std::shared_lock<std::shared_mutex> locker(_sessions_lock);
 
-    // Multicast all WebSocket sessions
-    for (auto& session : _sessions)
+    // Multicast all WebSocket sessions with conflation with a single task per working thread
+    Asio::MulticastBatched(service(), _sessions, [data](const std::shared_ptr<Asio::SSLSession>& session)
     {
-        auto wss_session = std::dynamic_pointer_cast<WSSSession>(session.second);
+        auto wss_session = std::dynamic_pointer_cast<WSSSession>(session);
         if (wss_session)
         {
             std::scoped_lock ws_locker(wss_session->_ws_send_lock);
 
             if (wss_session->_ws_handshaked)
-                wss_session->SendAsync(buffer, size);
+                wss_session->SendConflatedAsync(data->first, data->second.data(), data->second.size());
         }
-    }
+    });
 
     return true;
 }
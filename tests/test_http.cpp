@@ -4,11 +4,13 @@
 
 #include "test.h"
 
+#include "server/asio/tcp_client.h"
 #include "server/http/http_client.h"
 #include "server/http/http_server.h"
 #include "string/string_utils.h"
 #include "threads/thread.h"
 
+#include <atomic>
 #include <map>
 #include <mutex>
 
@@ -187,6 +189,63 @@ protected:
     }
 };
 
+class PipelineTCPClient : public TCPClient
+{
+public:
+    using TCPClient::TCPClient;
+
+    std::string received()
+    {
+        std::scoped_lock locker(_received_lock);
+        return _received;
+    }
+
+    size_t responses()
+    {
+        std::scoped_lock locker(_received_lock);
+        size_t count = 0;
+        for (size_t index = _received.find("HTTP/1.1 "); index != std::string::npos; index = _received.find("HTTP/1.1 ", index + 1))
+            ++count;
+        return count;
+    }
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        std::scoped_lock locker(_received_lock);
+        _received.append((const char*)buffer, size);
+    }
+
+private:
+    std::mutex _received_lock;
+    std::string _received;
+};
+
+class ReconnectHTTPSession : public HTTPSession
+{
+public:
+    using HTTPSession::HTTPSession;
+
+protected:
+    void onReceivedRequest(const HTTPRequest& request) override
+    {
+        // Reply with the invalid response or do not reply at all
+        if (request.url() == "/invalid")
+            SendAsync("INVALID\r\n\r\n");
+        else if (request.url() != "/timeout")
+            SendResponseAsync(response().MakeOKResponse());
+    }
+};
+
+class ReconnectHTTPServer : public HTTPServer
+{
+public:
+    using HTTPServer::HTTPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<ReconnectHTTPSession>(std::dynamic_pointer_cast<HTTPServer>(server)); }
+};
+
 TEST_CASE("HTTP server & client test", "[CppServer][HTTP]")
 {
     // HTTP server address and port
@@ -237,3 +296,183 @@ TEST_CASE("HTTP server & client test", "[CppServer][HTTP]")
     while (service->IsStarted())
         Thread::Yield();
 }
+
+TEST_CASE("HTTP server overload test", "[CppServer][HTTP]")
+{
+    // HTTP server address and port
+    std::string address = "127.0.0.1";
+    int port = 8090;
+
+    // Create and start Asio service with the statistics instrumentation
+    auto service = std::make_shared<Service>();
+    service->SetupStatistics(true, Timespan::milliseconds(100));
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start HTTP server with the overload control
+    auto server = std::make_shared<HTTPCacheServer>(service, port);
+    server->SetupOverloadLoopLag(Timespan::hours(1));
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create a new HTTP client
+    auto client = std::make_shared<HTTPClientEx>(service, address, port);
+
+    // Process the request normally
+    auto response = client->SendGetRequest("/overload").get();
+    REQUIRE(response.status() == 404);
+
+    // Make any event loop lag to overload the server
+    server->SetupOverloadLoopLag(Timespan::nanoseconds(1));
+    while (!server->IsOverloaded())
+        Thread::Yield();
+
+    // Reject the request of the connected client
+    response = client->SendGetRequest("/overload").get();
+    REQUIRE(response.status() == 503);
+    REQUIRE(server->shed_requests() == 1);
+
+    // Stop the HTTP server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
+
+TEST_CASE("HTTP server pipelining test", "[CppServer][HTTP]")
+{
+    // HTTP server address and port
+    std::string address = "127.0.0.1";
+    int port = 8095;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start HTTP server
+    auto server = std::make_shared<HTTPCacheServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect TCP client
+    auto client = std::make_shared<PipelineTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Pipeline several HTTP requests in a single buffer
+    std::string requests;
+    requests += "POST /pipeline HTTP/1.1\r\nContent-Length: 6\r\n\r\nvalue1";
+    requests += "GET /pipeline HTTP/1.1\r\n\r\n";
+    requests += "PUT /pipeline HTTP/1.1\r\nContent-Length: 6\r\n\r\nvalue2";
+    requests += "GET /pipeline HTTP/1.1\r\n\r\n";
+    requests += "DELETE /pipeline HTTP/1.1\r\n\r\n";
+    REQUIRE(client->SendAsync(requests));
+    while (client->responses() < 5)
+        Thread::Yield();
+
+    // Pipeline HTTP requests split inside the header separator
+    std::string split = "GET /pipeline HTTP/1.1\r\n\r\nHEAD /pipeline HTTP/1.1\r\n\r";
+    REQUIRE(client->SendAsync(split));
+    Thread::Sleep(100);
+    REQUIRE(client->SendAsync("\nGET /pipeline HTTP/1.1\r\n\r\n"));
+    while (client->responses() < 8)
+        Thread::Yield();
+
+    // Responses must be received in the requests order
+    std::string received = client->received();
+    size_t index = 0;
+    for (std::string_view expected : { "200 OK", "value1", "200 OK", "value2", "value2", "404", "200 OK", "404" })
+    {
+        index = received.find(expected, index);
+        REQUIRE(index != std::string::npos);
+        index += expected.size();
+    }
+
+    // Disconnect TCP client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the HTTP server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
+
+TEST_CASE("HTTP client auto-reconnect test", "[CppServer][HTTP]")
+{
+    // HTTP server address and port
+    std::string address = "127.0.0.1";
+    int port = 8096;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start HTTP server
+    auto server = std::make_shared<ReconnectHTTPServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create a new HTTP client with auto-reconnect
+    auto client = std::make_shared<HTTPClientEx>(service, address, port);
+    client->SetupAutoReconnect(true);
+    client->SetupReconnectBackoff(Timespan::milliseconds(10), Timespan::milliseconds(100));
+
+    // HTTP client refuses to preserve the send buffer across reconnects
+    REQUIRE(!client->SetupPreserveSendBuffer(true));
+    REQUIRE(!client->option_preserve_send_buffer());
+
+    auto response = client->SendGetRequest("/").get();
+    REQUIRE(response.status() == 200);
+
+    // Invalid response disconnects the client, but keeps auto-reconnect
+    REQUIRE_THROWS(client->SendGetRequest("/invalid").get());
+    while ((client->reconnects() != 1) || !client->IsConnected())
+        Thread::Yield();
+    response = client->SendGetRequest("/").get();
+    REQUIRE(response.status() == 200);
+
+    // Response timeout disconnects the client, but keeps auto-reconnect
+    REQUIRE_THROWS(client->SendGetRequest("/timeout", Timespan::milliseconds(100)).get());
+    while ((client->reconnects() != 2) || !client->IsConnected())
+        Thread::Yield();
+    response = client->SendGetRequest("/").get();
+    REQUIRE(response.status() == 200);
+
+    // Requested disconnect stops auto-reconnect
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+    Thread::Sleep(200);
+    REQUIRE(!client->IsConnected());
+    REQUIRE(client->reconnects() == 2);
+
+    // Stop the HTTP server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
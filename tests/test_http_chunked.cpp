@@ -0,0 +1,316 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "server/asio/tcp_client.h"
+#include "server/http/http_chunked.h"
+#include "server/http/http_client.h"
+#include "server/http/http_proxy_server.h"
+#include "server/http/http_server.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+using namespace CppServer::HTTP;
+
+namespace {
+
+// Decode the encoded body in parts of the given size
+std::string Decode(HTTPChunkedDecoder& decoder, std::string_view encoded, size_t part, size_t& consumed)
+{
+    std::string result;
+    consumed = 0;
+    while (consumed < encoded.size())
+    {
+        size_t size = std::min(part, encoded.size() - consumed);
+        size_t decoded = decoder.Decode(encoded.data() + consumed, size, [&result](const char* data, size_t length) { result.append(data, length); });
+        consumed += decoded;
+        if ((decoded < size) || decoder.IsCompleted() || decoder.IsError())
+            break;
+    }
+    return result;
+}
+
+class ChunkedHTTPSession : public HTTPSession
+{
+public:
+    using HTTPSession::HTTPSession;
+
+protected:
+    void onReceivedRequest(const HTTPRequest& request) override
+    {
+        if (request.url() == "/stream")
+        {
+            // Stream the response body of the unknown length
+            SendResponseAsync(response().Clear().SetBegin(200).SetContentType(".txt").SetBodyChunked());
+            for (int i = 0; i < 10; ++i)
+                SendResponseChunkAsync("chunk" + std::to_string(i) + ";");
+            SendResponseChunkAsync(std::string(64 * 1024, 'x'));
+            SendResponseChunkAsync("");
+            SendResponseChunkEndAsync();
+        }
+        else if (request.method() == "POST")
+            SendResponseAsync(response().MakeGetResponse(request.body()));
+        else
+            SendResponseAsync(response().MakeErrorResponse(404));
+    }
+};
+
+class ChunkedHTTPServer : public HTTPServer
+{
+public:
+    using HTTPServer::HTTPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<ChunkedHTTPSession>(std::dynamic_pointer_cast<HTTPServer>(server)); }
+};
+
+class ChunkedTCPClient : public TCPClient
+{
+public:
+    using TCPClient::TCPClient;
+
+    std::string received()
+    {
+        std::scoped_lock locker(_received_lock);
+        return _received;
+    }
+
+    size_t responses()
+    {
+        std::scoped_lock locker(_received_lock);
+        size_t count = 0;
+        for (size_t index = _received.find("HTTP/1.1 "); index != std::string::npos; index = _received.find("HTTP/1.1 ", index + 1))
+            ++count;
+        return count;
+    }
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        std::scoped_lock locker(_received_lock);
+        _received.append((const char*)buffer, size);
+    }
+
+private:
+    std::mutex _received_lock;
+    std::string _received;
+};
+
+} // namespace
+
+TEST_CASE("HTTP chunked encoder & decoder test", "[CppServer][HTTP]")
+{
+    // Encode body chunks
+    REQUIRE(HTTPChunkedEncoder::Encode("hello") == "5\r\nhello\r\n");
+    REQUIRE(HTTPChunkedEncoder::Encode(std::string(255, 'x')).substr(0, 4) == "FF\r\n");
+    REQUIRE(HTTPChunkedEncoder::Encode("").empty());
+    REQUIRE(HTTPChunkedEncoder::LastChunk() == "0\r\n\r\n");
+
+    // Encoded body with chunk extensions, trailer fields and the next pipelined message
+    std::string encoded = "5;name=value\r\nhello\r\n1a\r\n" + std::string(26, 'z') + "\r\n0\r\nExpires: never\r\n\r\nGET / HTTP/1.1\r\n\r\n";
+    std::string expected = "hello" + std::string(26, 'z');
+    size_t length = encoded.find("GET /");
+
+    // Decode the encoded body in parts of different size
+    for (size_t part : { (size_t)1, (size_t)2, (size_t)3, (size_t)7, encoded.size() })
+    {
+        HTTPChunkedDecoder decoder;
+        size_t consumed;
+        REQUIRE(Decode(decoder, encoded, part, consumed) == expected);
+        REQUIRE(decoder.IsCompleted());
+        REQUIRE(!decoder.IsError());
+        REQUIRE(consumed == length);
+    }
+
+    // Decode invalid encoded bodies
+    for (std::string_view invalid : { "x\r\n", "\r\n", "5\r\nhello!\r\n", "1234567890ABCDEF\r\n", "0\r\n\rx" })
+    {
+        HTTPChunkedDecoder decoder;
+        size_t consumed;
+        Decode(decoder, invalid, 1, consumed);
+        REQUIRE(decoder.IsError());
+        REQUIRE(!decoder.IsCompleted());
+    }
+
+    // Reset the decoder to decode a new encoded body
+    HTTPChunkedDecoder decoder;
+    size_t consumed;
+    Decode(decoder, "x", 1, consumed);
+    REQUIRE(decoder.IsError());
+    decoder.Reset();
+    REQUIRE(Decode(decoder, HTTPChunkedEncoder::Encode("test") + std::string(HTTPChunkedEncoder::LastChunk()), 1, consumed) == "test");
+    REQUIRE(decoder.IsCompleted());
+}
+
+TEST_CASE("HTTP chunked server & client test", "[CppServer][HTTP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 8120;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start HTTP server
+    auto server = std::make_shared<ChunkedHTTPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Receive the streamed response with the chunked body
+    std::string expected;
+    for (int i = 0; i < 10; ++i)
+        expected += "chunk" + std::to_string(i) + ";";
+    expected += std::string(64 * 1024, 'x');
+    auto client = std::make_shared<HTTPClientEx>(service, address, port);
+    for (int i = 0; i < 3; ++i)
+    {
+        auto response = client->SendGetRequest("/stream").get();
+        REQUIRE(response.status() == 200);
+        REQUIRE(response.body() == expected);
+        REQUIRE(response.body_length() == expected.size());
+    }
+
+    // The connection is still usable after chunked responses
+    auto response = client->SendPostRequest("/echo", "test").get();
+    REQUIRE(response.status() == 200);
+    REQUIRE(response.body() == "test");
+
+    // Create and connect TCP client
+    auto raw = std::make_shared<ChunkedTCPClient>(service, address, port);
+    REQUIRE(raw->ConnectAsync());
+    while (!raw->IsConnected())
+        Thread::Yield();
+
+    // Pipeline requests with chunked bodies which are split across received buffers
+    std::string requests;
+    requests += "POST /echo HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n6\r\nvalue1\r\n0\r\n\r\n";
+    requests += "POST /echo HTTP/1.1\r\nTransfer-Encoding: gzip, chunked\r\n\r\n3;ext=1\r\nval\r\n3\r\nue2\r\n0\r\nTrailer: value\r\n\r\n";
+    requests += "GET /missing HTTP/1.1\r\n\r\n";
+    for (size_t i = 0; i < requests.size(); i += 7)
+    {
+        REQUIRE(raw->SendAsync(requests.substr(i, 7)));
+        Thread::Sleep(1);
+    }
+    while (raw->responses() < 3)
+        Thread::Yield();
+
+    // Responses must be received in the requests order
+    std::string received = raw->received();
+    size_t index = 0;
+    for (std::string_view fragment : { "200 OK", "value1", "200 OK", "value2", "404" })
+    {
+        index = received.find(fragment, index);
+        REQUIRE(index != std::string::npos);
+        index += fragment.size();
+    }
+
+    // Invalid chunked body closes the connection
+    REQUIRE(raw->SendAsync("POST /echo HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\nxyz\r\n"));
+    while (raw->IsConnected())
+        Thread::Yield();
+
+    // Disconnect HTTP client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the HTTP server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
+
+TEST_CASE("HTTP chunked proxy test", "[CppServer][HTTP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 8121;
+    const int proxy_port = 8122;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start upstream HTTP server
+    auto server = std::make_shared<ChunkedHTTPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and start HTTP proxy server
+    auto proxy = std::make_shared<HTTPProxyServer>(service, proxy_port);
+    proxy->SetupReuseAddress(true);
+    proxy->AddUpstream(address, port);
+    REQUIRE(proxy->Start());
+    while (!proxy->IsStarted())
+        Thread::Yield();
+
+    // Chunked response is forwarded through the proxy
+    std::string expected;
+    for (int i = 0; i < 10; ++i)
+        expected += "chunk" + std::to_string(i) + ";";
+    expected += std::string(64 * 1024, 'x');
+    auto client = std::make_shared<HTTPClientEx>(service, address, proxy_port);
+    auto response = client->SendGetRequest("/stream").get();
+    REQUIRE(response.status() == 200);
+    REQUIRE(response.body() == expected);
+
+    // Create and connect TCP client
+    auto raw = std::make_shared<ChunkedTCPClient>(service, address, proxy_port);
+    REQUIRE(raw->ConnectAsync());
+    while (!raw->IsConnected())
+        Thread::Yield();
+
+    // Chunked request bodies are forwarded through the proxy
+    std::string requests;
+    requests += "POST /echo HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n" + HTTPChunkedEncoder::Encode("value1") + std::string(HTTPChunkedEncoder::LastChunk());
+    requests += "POST /echo HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n" + HTTPChunkedEncoder::Encode("val") + HTTPChunkedEncoder::Encode("ue2") + std::string(HTTPChunkedEncoder::LastChunk());
+    REQUIRE(raw->SendAsync(requests));
+    while (raw->responses() < 2)
+        Thread::Yield();
+
+    // Responses must be received in the requests order
+    std::string received = raw->received();
+    size_t index = 0;
+    for (std::string_view fragment : { "200 OK", "value1", "200 OK", "value2" })
+    {
+        index = received.find(fragment, index);
+        REQUIRE(index != std::string::npos);
+        index += fragment.size();
+    }
+
+    // Disconnect clients
+    REQUIRE(raw->DisconnectAsync());
+    REQUIRE(client->DisconnectAsync());
+    while (raw->IsConnected() || client->IsConnected())
+        Thread::Yield();
+
+    // Stop the proxy and upstream HTTP servers
+    REQUIRE(proxy->Stop());
+    REQUIRE(server->Stop());
+    while (proxy->IsStarted() || server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
@@ -0,0 +1,419 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "server/asio/tcp_client.h"
+#include "server/http/http_client.h"
+#include "server/http/http_proxy_server.h"
+#include "server/http/http_server.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+using namespace CppServer::HTTP;
+
+namespace {
+
+class UpstreamHTTPSession : public HTTPSession
+{
+public:
+    UpstreamHTTPSession(const std::shared_ptr<HTTPServer>& server, const std::string& name, std::atomic<bool>& healthy)
+        : HTTPSession(server),
+          _name(name),
+          _healthy(healthy)
+    {
+    }
+
+protected:
+    void onReceivedRequest(const HTTPRequest& request) override
+    {
+        if (request.url() == "/health")
+            SendResponseAsync(response().MakeErrorResponse(_healthy ? 200 : 503));
+        else if (request.url() == "/close")
+            SendAsync("HTTP/1.0 200 OK\r\nContent-Length: 5\r\n\r\nclose");
+        else if (request.url() == "/large")
+            SendResponseAsync(response().MakeGetResponse(std::string(32 * 1024 * 1024, 'x')));
+        else if (request.method() == "POST")
+            SendResponseAsync(response().MakeGetResponse(request.body()));
+        else
+            SendResponseAsync(response().MakeGetResponse(_name));
+    }
+
+private:
+    std::string _name;
+    std::atomic<bool>& _healthy;
+};
+
+class UpstreamHTTPServer : public HTTPServer
+{
+public:
+    UpstreamHTTPServer(const std::shared_ptr<Service>& service, int port, const std::string& name)
+        : HTTPServer(service, port),
+          _name(name)
+    {
+    }
+
+    std::atomic<bool> healthy{true};
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<UpstreamHTTPSession>(std::dynamic_pointer_cast<HTTPServer>(server), _name, healthy); }
+
+private:
+    std::string _name;
+};
+
+class RawHTTPClient : public TCPClient
+{
+public:
+    using TCPClient::TCPClient;
+
+    std::string data()
+    {
+        std::scoped_lock locker(_lock);
+        return _data;
+    }
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        std::scoped_lock locker(_lock);
+        _data.append((const char*)buffer, size);
+    }
+
+private:
+    std::mutex _lock;
+    std::string _data;
+};
+
+class ProbeHTTPProxyServer : public HTTPProxyServer
+{
+public:
+    using HTTPProxyServer::HTTPProxyServer;
+
+    std::shared_ptr<HTTPProxySession> session()
+    {
+        std::scoped_lock locker(_lock);
+        return _session;
+    }
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override
+    {
+        std::scoped_lock locker(_lock);
+        _session = std::make_shared<HTTPProxySession>(std::dynamic_pointer_cast<HTTPProxyServer>(server));
+        return _session;
+    }
+
+private:
+    std::mutex _lock;
+    std::shared_ptr<HTTPProxySession> _session;
+};
+
+} // namespace
+
+TEST_CASE("HTTP proxy server balancing test", "[CppServer][HTTP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port1 = 8100;
+    const int port2 = 8101;
+    const int proxy_port = 8102;
+
+    for (auto balancing : { HTTPProxyBalancing::RoundRobin, HTTPProxyBalancing::LeastOutstanding })
+    {
+        // Create and start Asio service
+        auto service = std::make_shared<Service>();
+        REQUIRE(service->Start());
+        while (!service->IsStarted())
+            Thread::Yield();
+
+        // Create and start upstream HTTP servers
+        auto server1 = std::make_shared<UpstreamHTTPServer>(service, port1, "upstream1");
+        server1->SetupReuseAddress(true);
+        REQUIRE(server1->Start());
+        auto server2 = std::make_shared<UpstreamHTTPServer>(service, port2, "upstream2");
+        server2->SetupReuseAddress(true);
+        REQUIRE(server2->Start());
+        while (!server1->IsStarted() || !server2->IsStarted())
+            Thread::Yield();
+
+        // Create and start HTTP proxy server
+        auto proxy = std::make_shared<HTTPProxyServer>(service, proxy_port);
+        proxy->SetupReuseAddress(true);
+        proxy->SetupBalancing(balancing);
+        auto upstream1 = proxy->AddUpstream(address, port1);
+        auto upstream2 = proxy->AddUpstream(address, port2);
+        REQUIRE(proxy->Start());
+        while (!proxy->IsStarted())
+            Thread::Yield();
+
+        // Create a new HTTP client of the proxy server
+        auto client = std::make_shared<HTTPClientEx>(service, address, proxy_port);
+
+        // Requests are balanced between upstreams over the single client connection
+        int count1 = 0;
+        int count2 = 0;
+        for (int i = 0; i < 10; ++i)
+        {
+            auto response = client->SendGetRequest("/test").get();
+            REQUIRE(response.status() == 200);
+            if (response.body() == "upstream1")
+                ++count1;
+            else if (response.body() == "upstream2")
+                ++count2;
+        }
+        REQUIRE(count1 == 5);
+        REQUIRE(count2 == 5);
+
+        // Large request body is streamed to the upstream and back
+        std::string content(256 * 1024, 'x');
+        auto response = client->SendPostRequest("/echo", content).get();
+        REQUIRE(response.status() == 200);
+        REQUIRE(response.body() == content);
+
+        // Check the upstream statistic
+        REQUIRE(upstream1->requests() + upstream2->requests() == 11);
+        REQUIRE(upstream1->errors() == 0);
+        REQUIRE(upstream2->errors() == 0);
+        REQUIRE(upstream1->outstanding() == 0);
+        REQUIRE(upstream2->outstanding() == 0);
+        REQUIRE(upstream1->max_latency().total() >= upstream1->latency().total());
+        LatencyHistogramSnapshot snapshot;
+        upstream1->LatencySnapshot(snapshot);
+        REQUIRE(snapshot.count() == upstream1->requests());
+
+        // Upstream connections are reused
+        REQUIRE(proxy->pool()->size() <= 2);
+
+        // Stop the proxy and upstream HTTP servers
+        REQUIRE(proxy->Stop());
+        REQUIRE(server1->Stop());
+        REQUIRE(server2->Stop());
+        while (proxy->IsStarted() || server1->IsStarted() || server2->IsStarted())
+            Thread::Yield();
+
+        // Stop the Asio service
+        REQUIRE(service->Stop());
+        while (service->IsStarted())
+            Thread::Yield();
+    }
+}
+
+TEST_CASE("HTTP proxy server health check test", "[CppServer][HTTP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port1 = 8103;
+    const int port2 = 8104;
+    const int proxy_port = 8105;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start upstream HTTP servers
+    auto server1 = std::make_shared<UpstreamHTTPServer>(service, port1, "upstream1");
+    server1->SetupReuseAddress(true);
+    REQUIRE(server1->Start());
+    auto server2 = std::make_shared<UpstreamHTTPServer>(service, port2, "upstream2");
+    server2->SetupReuseAddress(true);
+    REQUIRE(server2->Start());
+    while (!server1->IsStarted() || !server2->IsStarted())
+        Thread::Yield();
+
+    // Create and start HTTP proxy server with the health check
+    auto proxy = std::make_shared<HTTPProxyServer>(service, proxy_port);
+    proxy->SetupReuseAddress(true);
+    proxy->SetupHealthCheck("/health", Timespan::milliseconds(50));
+    auto upstream1 = proxy->AddUpstream(address, port1);
+    auto upstream2 = proxy->AddUpstream(address, port2);
+    REQUIRE(proxy->Start());
+    while (!proxy->IsStarted())
+        Thread::Yield();
+
+    // Create a new HTTP client of the proxy server
+    auto client = std::make_shared<HTTPClientEx>(service, address, proxy_port);
+
+    // Make the second upstream unhealthy
+    server2->healthy = false;
+    while (upstream2->IsHealthy())
+        Thread::Yield();
+    REQUIRE(upstream1->IsHealthy());
+
+    // All requests are forwarded to the healthy upstream
+    for (int i = 0; i < 4; ++i)
+    {
+        auto response = client->SendGetRequest("/test").get();
+        REQUIRE(response.status() == 200);
+        REQUIRE(response.body() == "upstream1");
+    }
+
+    // Make all upstreams unhealthy
+    server1->healthy = false;
+    while (upstream1->IsHealthy())
+        Thread::Yield();
+    auto response = client->SendGetRequest("/test").get();
+    REQUIRE(response.status() == 503);
+
+    // Make the second upstream healthy again
+    server2->healthy = true;
+    while (!upstream2->IsHealthy())
+        Thread::Yield();
+    response = client->SendGetRequest("/test").get();
+    REQUIRE(response.status() == 200);
+    REQUIRE(response.body() == "upstream2");
+
+    // Stop the proxy and upstream HTTP servers
+    REQUIRE(proxy->Stop());
+    REQUIRE(server1->Stop());
+    REQUIRE(server2->Stop());
+    while (proxy->IsStarted() || server1->IsStarted() || server2->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
+
+TEST_CASE("HTTP proxy server backpressure test", "[CppServer][HTTP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 8106;
+    const int proxy_port = 8107;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start upstream HTTP server
+    auto server = std::make_shared<UpstreamHTTPServer>(service, port, "upstream");
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and start HTTP proxy server with the small buffer limit
+    auto proxy = std::make_shared<ProbeHTTPProxyServer>(service, proxy_port);
+    proxy->SetupReuseAddress(true);
+    proxy->SetupBufferLimit(64 * 1024);
+    proxy->AddUpstream(address, port);
+    REQUIRE(proxy->Start());
+    while (!proxy->IsStarted())
+        Thread::Yield();
+
+    // Create and connect the slow client of the proxy server
+    auto client = std::make_shared<RawHTTPClient>(service, address, proxy_port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || !proxy->session())
+        Thread::Yield();
+
+    // The slow client does not receive the large response
+    client->PauseReceive();
+    client->SendAsync("GET /large HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    Thread::Sleep(1000);
+
+    // Upstream response is paused instead of buffering it in the proxy session
+    REQUIRE(proxy->session()->bytes_pending() < (4 * 1024 * 1024));
+
+    // Resume the slow client and receive the whole response
+    client->ResumeReceive();
+    const size_t body = 32 * 1024 * 1024;
+    auto start = std::chrono::steady_clock::now();
+    while ((client->data().size() < body) && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(30)))
+        Thread::Yield();
+    std::string data = client->data();
+    REQUIRE(data.size() > body);
+    REQUIRE(data.compare(0, 15, "HTTP/1.1 200 OK") == 0);
+    REQUIRE(data.find("\r\n\r\n") == (data.size() - body - 4));
+
+    // Disconnect the slow client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the proxy and upstream HTTP servers
+    REQUIRE(proxy->Stop());
+    REQUIRE(server->Stop());
+    while (proxy->IsStarted() || server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
+
+TEST_CASE("HTTP proxy server upstream connection close test", "[CppServer][HTTP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 8108;
+    const int proxy_port = 8109;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start upstream HTTP server
+    auto server = std::make_shared<UpstreamHTTPServer>(service, port, "upstream");
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and start HTTP proxy server
+    auto proxy = std::make_shared<HTTPProxyServer>(service, proxy_port);
+    proxy->SetupReuseAddress(true);
+    auto upstream = proxy->AddUpstream(address, port);
+    REQUIRE(proxy->Start());
+    while (!proxy->IsStarted())
+        Thread::Yield();
+
+    // Create and connect the client of the proxy server
+    auto client = std::make_shared<RawHTTPClient>(service, address, proxy_port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Pipeline the request answered with HTTP/1.0 response and the next request
+    client->SendAsync("GET /close HTTP/1.1\r\nHost: localhost\r\n\r\nGET /test HTTP/1.1\r\nHost: localhost\r\n\r\n");
+
+    // Both responses are received over the same client connection
+    auto start = std::chrono::steady_clock::now();
+    while ((upstream->requests() != 2) && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(10)))
+        Thread::Yield();
+    while ((client->data().find("upstream") == std::string::npos) && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(10)))
+        Thread::Yield();
+    std::string data = client->data();
+    REQUIRE(data.find("close") != std::string::npos);
+    REQUIRE(data.find("upstream") > data.find("close"));
+    REQUIRE(data.find("Connection: close") == std::string::npos);
+    REQUIRE(client->IsConnected());
+
+    // Disconnect the client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the proxy and upstream HTTP servers
+    REQUIRE(proxy->Stop());
+    REQUIRE(server->Stop());
+    while (proxy->IsStarted() || server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
@@ -0,0 +1,287 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "server/asio/shm_client.h"
+#include "server/asio/shm_server.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+TEST_CASE("Shared memory ring buffer test", "[CppServer][SHM]")
+{
+    const size_t capacity = 16;
+    alignas(64) uint8_t memory[SHMRing::Size(capacity)];
+
+    SHMRing producer(memory, capacity, true);
+    SHMRing consumer(memory, capacity, false);
+    REQUIRE(producer.capacity() == capacity);
+    REQUIRE(consumer.empty());
+
+    // Write and read data several times to wrap around the end of the ring buffer
+    uint8_t value = 0;
+    uint8_t expected = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        uint8_t buffer[10];
+        for (auto& byte : buffer)
+            byte = value++;
+        REQUIRE(producer.Write(buffer, sizeof(buffer)) == sizeof(buffer));
+        REQUIRE(consumer.size() == sizeof(buffer));
+
+        size_t received = 0;
+        const void* data;
+        size_t size;
+        while ((size = consumer.Peek(data)) > 0)
+        {
+            for (size_t j = 0; j < size; ++j)
+                REQUIRE(((const uint8_t*)data)[j] == expected++);
+            consumer.Consume(size);
+            received += size;
+        }
+        REQUIRE(received == sizeof(buffer));
+    }
+
+    // Full ring buffer should accept only the free space
+    uint8_t buffer[32] = {};
+    REQUIRE(producer.Write(buffer, sizeof(buffer)) == capacity);
+    REQUIRE(producer.free() == 0);
+    REQUIRE(producer.Write(buffer, sizeof(buffer)) == 0);
+}
+
+#if defined(CPPSERVER_SHM)
+
+namespace {
+
+class EchoSHMService : public Service
+{
+public:
+    using Service::Service;
+
+protected:
+    void onThreadInitialize() override { thread_initialize = true; }
+    void onThreadCleanup() override { thread_cleanup = true; }
+    void onStarted() override { started = true; }
+    void onStopped() override { stopped = true; }
+    void onIdle() override { idle = true; }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<bool> thread_initialize{false};
+    std::atomic<bool> thread_cleanup{false};
+    std::atomic<bool> started{false};
+    std::atomic<bool> stopped{false};
+    std::atomic<bool> idle{false};
+    std::atomic<bool> errors{false};
+};
+
+class EchoSHMClient : public SHMClient
+{
+public:
+    using SHMClient::SHMClient;
+
+protected:
+    void onConnected() override { connected = true; }
+    void onDisconnected() override { disconnected = true; }
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Validate the received byte sequence
+        for (size_t i = 0; i < size; ++i)
+            if (((const uint8_t*)buffer)[i] != expected++)
+                corrupted = true;
+    }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<bool> connected{false};
+    std::atomic<bool> disconnected{false};
+    std::atomic<bool> corrupted{false};
+    std::atomic<bool> errors{false};
+    uint8_t expected{0};
+};
+
+class EchoSHMSession : public SHMSession
+{
+public:
+    using SHMSession::SHMSession;
+
+protected:
+    void onConnected() override { connected = true; }
+    void onDisconnected() override { disconnected = true; }
+    void onReceived(const void* buffer, size_t size) override { SendAsync(buffer, size); }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<bool> connected{false};
+    std::atomic<bool> disconnected{false};
+    std::atomic<bool> errors{false};
+};
+
+class EchoSHMServer : public SHMServer
+{
+public:
+    using SHMServer::SHMServer;
+
+protected:
+    std::shared_ptr<SHMSession> CreateSession(const std::shared_ptr<SHMServer>& server) override { return std::make_shared<EchoSHMSession>(server); }
+
+protected:
+    void onStarted() override { started = true; }
+    void onStopped() override { stopped = true; }
+    void onConnected(std::shared_ptr<SHMSession>& session) override { connected = true; ++clients; }
+    void onDisconnected(std::shared_ptr<SHMSession>& session) override { disconnected = true; --clients; }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<bool> started{false};
+    std::atomic<bool> stopped{false};
+    std::atomic<bool> connected{false};
+    std::atomic<bool> disconnected{false};
+    std::atomic<size_t> clients{0};
+    std::atomic<bool> errors{false};
+};
+
+} // namespace
+
+TEST_CASE("Shared memory server test", "[CppServer][SHM]")
+{
+    const std::string path = "/tmp/cppserver-test-shm.sock";
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSHMService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoSHMServer>(service, path);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoSHMClient>(service, path);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send a message to the Echo server
+    const uint8_t message[4] = { 0, 1, 2, 3 };
+    client->SendAsync(message, sizeof(message));
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Asio service state
+    REQUIRE(service->started);
+    REQUIRE(service->stopped);
+    REQUIRE(!service->errors);
+
+    // Check the Echo server state
+    REQUIRE(server->started);
+    REQUIRE(server->stopped);
+    REQUIRE(server->connected);
+    REQUIRE(server->disconnected);
+    REQUIRE(server->bytes_sent() == 4);
+    REQUIRE(server->bytes_received() == 4);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->connected);
+    REQUIRE(client->disconnected);
+    REQUIRE(client->bytes_sent() == 4);
+    REQUIRE(client->bytes_received() == 4);
+    REQUIRE(!client->corrupted);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("Shared memory server flow control test", "[CppServer][SHM]")
+{
+    const std::string path = "/tmp/cppserver-test-shm-flow.sock";
+    const size_t total = 1024 * 1024;
+
+    // Create and start Asio service with several working threads
+    auto service = std::make_shared<EchoSHMService>(4);
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with the small ring buffer
+    auto server = std::make_shared<EchoSHMServer>(service, path);
+    server->SetupRingSize(4096);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoSHMClient>(service, path);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send much more data than the ring buffer could hold
+    std::vector<uint8_t> buffer(1000);
+    uint8_t value = 0;
+    for (size_t sent = 0; sent < total; sent += buffer.size())
+    {
+        size_t size = std::min(buffer.size(), total - sent);
+        for (size_t i = 0; i < size; ++i)
+            buffer[i] = value++;
+        REQUIRE(client->SendAsync(buffer.data(), size));
+    }
+
+    // Wait for all data processed...
+    while (client->bytes_received() != total)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->bytes_sent() == total);
+    REQUIRE(server->bytes_received() == total);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->bytes_sent() == total);
+    REQUIRE(client->bytes_received() == total);
+    REQUIRE(!client->corrupted);
+    REQUIRE(!client->errors);
+}
+
+#endif
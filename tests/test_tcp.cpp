@@ -4,12 +4,18 @@
 
 #include "test.h"
 
+#include "server/asio/client_pool.h"
 #include "server/asio/tcp_client.h"
 #include "server/asio/tcp_server.h"
 #include "threads/thread.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <utility>
 #include <vector>
 
 using namespace CppCommon;
@@ -28,6 +34,7 @@ protected:
     void onStarted() override { started = true; }
     void onStopped() override { stopped = true; }
     void onIdle() override { idle = true; }
+    void onStatistics(const ServiceStatisticsSnapshot& statistics) override { ++notifications; }
     void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
 
 public:
@@ -36,6 +43,7 @@ public:
     std::atomic<bool> started{false};
     std::atomic<bool> stopped{false};
     std::atomic<bool> idle{false};
+    std::atomic<size_t> notifications{0};
     std::atomic<bool> errors{false};
 };
 
@@ -158,6 +166,9 @@ TEST_CASE("TCP server test", "[CppServer][TCP]")
     REQUIRE(server->disconnected);
     REQUIRE(server->bytes_sent() == 4);
     REQUIRE(server->bytes_received() == 4);
+    REQUIRE(server->statistics().connected_sessions == 0);
+    REQUIRE(server->statistics().bytes_sent == 4);
+    REQUIRE(server->statistics().bytes_received == 4);
     REQUIRE(!server->errors);
 
     // Check the Echo client state
@@ -421,3 +432,1836 @@ TEST_CASE("TCP server random test", "[CppServer][TCP]")
     REQUIRE(server->bytes_received() > 0);
     REQUIRE(!server->errors);
 }
+
+TEST_CASE("TCP server timed synchronous test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1115;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and synchronously connect Echo client
+    auto client = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(client->Connect());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send a message to the Echo server with timeout
+    REQUIRE(client->Send("test", Timespan::seconds(10)) == 4);
+
+    // Receive the message from the Echo server with timeout
+    std::string message;
+    while (message.size() < 4)
+    {
+        std::string part = client->Receive(4 - message.size(), Timespan::seconds(10));
+        REQUIRE(!part.empty());
+        message += part;
+    }
+    REQUIRE(message == "test");
+
+    // Receive timeout
+    auto start = std::chrono::steady_clock::now();
+    REQUIRE(client->Receive(4, Timespan::milliseconds(100)).empty());
+    REQUIRE((std::chrono::steady_clock::now() - start) >= std::chrono::milliseconds(100));
+    REQUIRE(client->IsConnected());
+
+    // Disconnect the Echo client
+    REQUIRE(client->Disconnect());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->bytes_sent() == 4);
+    REQUIRE(server->bytes_received() == 4);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->bytes_sent() == 4);
+    REQUIRE(client->bytes_received() == 4);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("TCP server idle timeout test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1116;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with the idle timeout
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupIdleTimeout(Timespan::milliseconds(500));
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Keep the session active for longer than the idle timeout
+    for (int i = 0; i < 10; ++i)
+    {
+        client->SendAsync("test");
+        Thread::Sleep(100);
+    }
+    REQUIRE(client->IsConnected());
+    REQUIRE(server->clients == 1);
+
+    // Wait for the idle session is disconnected by the server
+    auto start = std::chrono::steady_clock::now();
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+    REQUIRE((std::chrono::steady_clock::now() - start) >= std::chrono::milliseconds(300));
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->connected);
+    REQUIRE(server->disconnected);
+    REQUIRE(server->bytes_sent() == 40);
+    REQUIRE(server->bytes_received() == 40);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->disconnected);
+    REQUIRE(client->bytes_received() == 40);
+}
+
+TEST_CASE("TCP server service statistics test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1117;
+
+    // Create and start Asio service with the statistics instrumentation
+    auto service = std::make_shared<EchoTCPService>();
+    service->SetupStatistics(true, Timespan::milliseconds(100));
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send messages to the Echo server
+    for (int i = 0; i < 5; ++i)
+    {
+        client->SendAsync("test");
+        Thread::Sleep(100);
+    }
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 20)
+        Thread::Yield();
+
+    // Take the service statistics snapshot
+    auto statistics = service->statistics();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the service statistics
+    REQUIRE(service->notifications > 0);
+    REQUIRE(statistics.threads.size() == service->threads());
+    REQUIRE(statistics.threads[0].completions > 0);
+    REQUIRE(statistics.threads[0].handler_histogram.count() > 0);
+    REQUIRE(statistics.threads[0].loop_lag_histogram.count() > 0);
+    REQUIRE(!service->errors);
+}
+
+TEST_CASE("TCP server service loop lag test", "[CppServer][TCP]")
+{
+    // Create and start Asio service with the statistics instrumentation
+    auto service = std::make_shared<EchoTCPService>();
+    service->SetupStatistics(true, Timespan::milliseconds(100));
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Wait for the first event loop lag probes
+    Thread::Sleep(100);
+
+    // Block the event loop with the long handler
+    service->Post([]() { Thread::Sleep(300); });
+
+    // Track the maximal reported event loop lag
+    uint64_t loop_lag = 0;
+    auto start = std::chrono::steady_clock::now();
+    while ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(1))
+    {
+        loop_lag = std::max(loop_lag, service->loop_lag());
+        Thread::Yield();
+    }
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Delayed probe timer is included into the reported event loop lag
+    REQUIRE(loop_lag >= 250000000);
+    REQUIRE(loop_lag < 1000000000);
+    REQUIRE(!service->errors);
+}
+
+TEST_CASE("TCP server overload test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1118;
+
+    // Create and start Asio service with the statistics instrumentation
+    auto service = std::make_shared<EchoTCPService>();
+    service->SetupStatistics(true, Timespan::milliseconds(100));
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with the overload control
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupOverloadLoopLag(Timespan::hours(1));
+    server->SetupOverloadShedSessions(1);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client1 = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(client1->ConnectAsync());
+    while (!client1->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Make any event loop lag to overload the server
+    server->SetupOverloadLoopLag(Timespan::nanoseconds(1));
+    while (!server->IsOverloaded())
+        Thread::Yield();
+
+    // Wait for the lowest priority session is shed
+    while (client1->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Connect another Echo client while accepting is paused
+    auto client2 = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(client2->ConnectAsync());
+    Thread::Sleep(300);
+    REQUIRE(server->clients == 0);
+
+    // Disconnect the Echo client
+    client2->DisconnectAsync();
+    while (client2->IsConnected())
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->shed_connections() == 1);
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("TCP server rate limit test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1119;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with the receive rate limit
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupReceiveRateLimit(1000);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send more data than the receive budget allows
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 3; ++i)
+    {
+        client->SendAsync(std::string(1000, 'x'));
+        Thread::Sleep(10);
+    }
+
+    // Each receive is limited with the budget of one second
+    Thread::Sleep(500 - (int)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    REQUIRE(server->bytes_received() == 1000);
+    Thread::Sleep(1500 - (int)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    REQUIRE(server->bytes_received() == 2000);
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 3000)
+        Thread::Yield();
+    REQUIRE((std::chrono::steady_clock::now() - start) >= std::chrono::milliseconds(1900));
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->bytes_sent() == 3000);
+    REQUIRE(server->bytes_received() == 3000);
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("TCP server fair scheduling test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1120;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with the fair scheduling
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupFairQuantum(1024);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect heavy and light Echo clients
+    auto heavy = std::make_shared<EchoTCPClient>(service, address, port);
+    auto light = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(heavy->ConnectAsync());
+    REQUIRE(light->ConnectAsync());
+    while (!heavy->IsConnected() || !light->IsConnected() || (server->clients != 2))
+        Thread::Yield();
+
+    // Send a big buffer from the heavy client and a small one from the light client
+    heavy->SendAsync(std::string(100000, 'x'));
+    light->SendAsync("test");
+
+    // Wait for all data processed...
+    while ((heavy->bytes_received() != 100000) || (light->bytes_received() != 4))
+        Thread::Yield();
+
+    // Disconnect Echo clients
+    REQUIRE(heavy->DisconnectAsync());
+    REQUIRE(light->DisconnectAsync());
+    while (heavy->IsConnected() || light->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->bytes_sent() == 100004);
+    REQUIRE(server->bytes_received() == 100004);
+    REQUIRE(!server->errors);
+}
+
+namespace {
+
+class ReceiverTCPClient : public EchoTCPClient
+{
+public:
+    using EchoTCPClient::EchoTCPClient;
+
+    std::string data()
+    {
+        std::scoped_lock locker(_lock);
+        return _data;
+    }
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        std::scoped_lock locker(_lock);
+        _data.append((const char*)buffer, size);
+    }
+
+private:
+    std::mutex _lock;
+    std::string _data;
+};
+
+class PriorityTCPSession : public EchoTCPSession
+{
+public:
+    using EchoTCPSession::EchoTCPSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        if (std::exchange(_replied, true))
+            return;
+
+        // The first buffer is being written, so the high priority buffer goes ahead of the pending normal one
+        SendAsync("1");
+        SendAsync("3");
+        SendAsync("2", SendPriority::High);
+    }
+
+private:
+    bool _replied{false};
+};
+
+class PriorityTCPServer : public EchoTCPServer
+{
+public:
+    using EchoTCPServer::EchoTCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<PriorityTCPSession>(server); }
+};
+
+} // namespace
+
+TEST_CASE("TCP server send priority test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1121;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start priority server
+    auto server = std::make_shared<PriorityTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect receiver client
+    auto client = std::make_shared<ReceiverTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send a message to the priority server
+    client->SendAsync("test");
+
+    // Wait for all data processed...
+    while (client->data().size() != 3)
+        Thread::Yield();
+    REQUIRE(client->data() == "123");
+
+    // Disconnect the receiver client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the priority server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the priority server state
+    REQUIRE(server->bytes_sent() == 3);
+    REQUIRE(server->bytes_received() == 4);
+    REQUIRE(!server->errors);
+}
+
+namespace {
+
+class BacklogTCPSession : public EchoTCPSession
+{
+public:
+    using EchoTCPSession::EchoTCPSession;
+
+protected:
+    void onConnected() override
+    {
+        // Small socket buffer to keep the backlog in the session
+        SetupSendBufferSize(64 * 1024);
+        EchoTCPSession::onConnected();
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Queue the multi-megabyte backlog on the first request, then reply to pings with the high priority
+        if (!std::exchange(_queued, true))
+        {
+            std::string message(1024, '.');
+            for (size_t i = 0; i < 8192; ++i)
+                SendAsync(message);
+        }
+        else
+            SendAsync("H", SendPriority::High);
+    }
+
+private:
+    bool _queued{false};
+};
+
+class BacklogTCPServer : public EchoTCPServer
+{
+public:
+    using EchoTCPServer::EchoTCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<BacklogTCPSession>(server); }
+};
+
+class ProbeTCPClient : public EchoTCPClient
+{
+public:
+    using EchoTCPClient::EchoTCPClient;
+
+    std::atomic<uint64_t> received{0};
+    std::atomic<uint64_t> ping_offset{0};
+    std::atomic<uint64_t> high_offset{0};
+
+protected:
+    void onConnected() override
+    {
+        // Small socket buffer to keep the backlog in the session
+        SetupReceiveBufferSize(64 * 1024);
+        EchoTCPClient::onConnected();
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Find the high priority reply in the backlog
+        const char* data = (const char*)buffer;
+        for (size_t i = 0; i < size; ++i)
+            if (data[i] == 'H')
+                high_offset = received + i + 1;
+        received += size;
+
+        // Ping the session in the middle of the backlog
+        if ((ping_offset == 0) && (received >= 256 * 1024))
+        {
+            ping_offset = received.load();
+            SendAsync("ping");
+        }
+    }
+};
+
+} // namespace
+
+TEST_CASE("TCP server send priority backlog test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1132;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start backlog server
+    auto server = std::make_shared<BacklogTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect probe client
+    auto client = std::make_shared<ProbeTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Request the backlog from the server
+    client->SendAsync("bulk");
+
+    // Wait for all data processed...
+    const uint64_t total = 8192 * 1024 + 1;
+    auto start = std::chrono::steady_clock::now();
+    while ((client->received != total) && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(30)))
+        Thread::Yield();
+    REQUIRE(client->received == total);
+
+    // High priority reply waits for the slice in flight and socket buffers, not for the whole backlog
+    REQUIRE(client->ping_offset > 0);
+    REQUIRE(client->high_offset > client->ping_offset);
+    REQUIRE((client->high_offset - client->ping_offset) < (1024 * 1024));
+
+    // Disconnect the probe client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the backlog server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the backlog server state
+    REQUIRE(server->bytes_sent() == total);
+    REQUIRE(!server->errors);
+}
+
+namespace {
+
+class ConflationTCPSession : public EchoTCPSession
+{
+public:
+    using EchoTCPSession::EchoTCPSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        if (std::exchange(_replied, true))
+            return;
+
+        // The first buffer is being written, so the pending conflated data of the same key is replaced in place
+        SendAsync("0");
+        SendConflatedAsync("A", "1");
+        SendConflatedAsync("B", "2");
+        SendConflatedAsync("A", "3");
+    }
+
+private:
+    bool _replied{false};
+};
+
+class ConflationTCPServer : public EchoTCPServer
+{
+public:
+    using EchoTCPServer::EchoTCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<ConflationTCPSession>(server); }
+};
+
+} // namespace
+
+TEST_CASE("TCP server conflation test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1122;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start conflation server
+    auto server = std::make_shared<ConflationTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect receiver client
+    auto client = std::make_shared<ReceiverTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send a message to the conflation server
+    client->SendAsync("test");
+
+    // Wait for all data processed...
+    while (client->data().size() != 3)
+        Thread::Yield();
+    REQUIRE(client->data() == "032");
+
+    // Multicast conflated data to all sessions
+    REQUIRE(server->MulticastConflated("C", "4"));
+    while (client->data().size() != 4)
+        Thread::Yield();
+    REQUIRE(client->data() == "0324");
+
+    // Disconnect the receiver client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the conflation server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the conflation server state
+    REQUIRE(server->bytes_sent() == 4);
+    REQUIRE(server->bytes_received() == 4);
+    REQUIRE(!server->errors);
+}
+
+namespace {
+
+class InterleaveTCPSession : public EchoTCPSession
+{
+public:
+    using EchoTCPSession::EchoTCPSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        if (std::exchange(_queued, true))
+            return;
+
+        // Queue the normal priority backlog, then the conflated value which should not wait for the whole backlog
+        std::string message(1024, '.');
+        for (size_t i = 0; i < 1024; ++i)
+            SendAsync(message);
+        SendConflatedAsync("A", "H");
+    }
+
+private:
+    bool _queued{false};
+};
+
+class InterleaveTCPServer : public EchoTCPServer
+{
+public:
+    using EchoTCPServer::EchoTCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<InterleaveTCPSession>(server); }
+};
+
+} // namespace
+
+TEST_CASE("TCP server conflation interleave test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1133;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start interleave server
+    auto server = std::make_shared<InterleaveTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect probe client
+    auto client = std::make_shared<ProbeTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Request the backlog from the server
+    client->SendAsync("bulk");
+
+    // Wait for all data processed...
+    const uint64_t total = 1024 * 1024 + 1;
+    auto start = std::chrono::steady_clock::now();
+    while ((client->received != total) && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(10)))
+        Thread::Yield();
+    REQUIRE(client->received == total);
+
+    // Conflated value is sent at the next write boundary after the first slice of the backlog
+    REQUIRE(client->high_offset > 0);
+    REQUIRE(client->high_offset <= (TCPSession::SEND_SLICE + 1024 + 1));
+
+    // Disconnect the probe client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the interleave server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the interleave server state
+    REQUIRE(server->bytes_sent() == total);
+    REQUIRE(!server->errors);
+}
+
+namespace {
+
+class GroupTCPSession : public EchoTCPSession
+{
+public:
+    using EchoTCPSession::EchoTCPSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { JoinGroup(std::string_view((const char*)buffer, size)); }
+};
+
+class GroupTCPServer : public EchoTCPServer
+{
+public:
+    using EchoTCPServer::EchoTCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<GroupTCPSession>(server); }
+};
+
+} // namespace
+
+TEST_CASE("TCP server subscription groups test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1123;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>(4);
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start group server
+    auto server = std::make_shared<GroupTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect receiver clients
+    std::vector<std::shared_ptr<ReceiverTCPClient>> clients;
+    for (int i = 0; i < 3; ++i)
+    {
+        auto client = std::make_shared<ReceiverTCPClient>(service, address, port);
+        REQUIRE(client->ConnectAsync());
+        clients.emplace_back(client);
+    }
+    for (auto& client : clients)
+        while (!client->IsConnected())
+            Thread::Yield();
+    while (server->clients != 3)
+        Thread::Yield();
+
+    // Join the first two clients to the group
+    clients[0]->SendAsync("topic");
+    clients[1]->SendAsync("topic");
+    while (server->group_size("topic") != 2)
+        Thread::Yield();
+
+    // Publish data to the group members only
+    REQUIRE(server->PublishToGroup("topic", "data"));
+    while ((clients[0]->data() != "data") || (clients[1]->data() != "data"))
+        Thread::Yield();
+    REQUIRE(clients[2]->data().empty());
+
+    // Disconnected client leaves the group
+    REQUIRE(clients[0]->DisconnectAsync());
+    while (clients[0]->IsConnected() || (server->clients != 2) || (server->group_size("topic") != 1))
+        Thread::Yield();
+
+    // Disconnect receiver clients
+    REQUIRE(clients[1]->DisconnectAsync());
+    REQUIRE(clients[2]->DisconnectAsync());
+    while (clients[1]->IsConnected() || clients[2]->IsConnected() || (server->clients != 0) || (server->group_size("topic") != 0))
+        Thread::Yield();
+
+    // Stop the group server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the group server state
+    REQUIRE(server->bytes_sent() == 8);
+    REQUIRE(server->bytes_received() == 10);
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("TCP server thread pool subscription groups order test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1135;
+
+    // Create and start Asio service with the thread pool sharing one Asio IO service
+    auto service = std::make_shared<EchoTCPService>(4, true);
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start group server
+    auto server = std::make_shared<GroupTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect receiver clients
+    std::vector<std::shared_ptr<ReceiverTCPClient>> clients;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        auto client = std::make_shared<ReceiverTCPClient>(service, address, port);
+        REQUIRE(client->ConnectAsync());
+        clients.emplace_back(client);
+    }
+    for (const auto& client : clients)
+        while (!client->IsConnected())
+            Thread::Yield();
+    while (server->clients != clients.size())
+        Thread::Yield();
+
+    // Join all clients to the group
+    for (const auto& client : clients)
+        client->SendAsync("topic");
+    while (server->group_size("topic") != clients.size())
+        Thread::Yield();
+
+    // Publish numbered messages, consecutive publications may run on different working threads
+    std::string expected;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        std::string message = std::to_string(10000 + i);
+        REQUIRE(server->PublishToGroup("topic", message));
+        expected += message;
+    }
+
+    // Wait for all data processed...
+    for (const auto& client : clients)
+    {
+        while (client->data().size() != expected.size())
+            Thread::Yield();
+        REQUIRE(client->data() == expected);
+    }
+
+    // Disconnect receiver clients
+    for (const auto& client : clients)
+        REQUIRE(client->DisconnectAsync());
+    for (const auto& client : clients)
+        while (client->IsConnected())
+            Thread::Yield();
+    while ((server->clients != 0) || (server->group_size("topic") != 0))
+        Thread::Yield();
+
+    // Stop the group server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the group server state
+    REQUIRE(server->bytes_sent() == (expected.size() * clients.size()));
+    REQUIRE(!server->errors);
+}
+
+namespace {
+
+class ReplayTCPSession : public EchoTCPSession
+{
+public:
+    using EchoTCPSession::EchoTCPSession;
+
+    std::atomic<uint64_t> lost{0};
+    std::atomic<uint64_t> replayed{0};
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { ReplayAsync(std::stoull(std::string((const char*)buffer, size))); }
+    void onReplayed(uint64_t sequence) override { replayed = sequence; }
+    void onReplayLost(uint64_t sequence, uint64_t count) override { lost = count; }
+};
+
+class ReplayTCPServer : public EchoTCPServer
+{
+public:
+    using EchoTCPServer::EchoTCPServer;
+
+    std::shared_ptr<ReplayTCPSession> session;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { session = std::make_shared<ReplayTCPSession>(server); return session; }
+};
+
+} // namespace
+
+TEST_CASE("TCP server multicast journal replay test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1124;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start replay server with the journal of the last three messages
+    auto server = std::make_shared<ReplayTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    server->SetupJournal(3);
+    server->SetupReplayChunk(1);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Multicast data before any session is connected
+    REQUIRE(server->Multicast("1"));
+    REQUIRE(server->Multicast("2"));
+    REQUIRE(server->Multicast("3"));
+    REQUIRE(server->Multicast("4"));
+    REQUIRE(server->journal()->size() == 3);
+    REQUIRE(server->journal_sequence() == 5);
+
+    // Create and connect receiver client
+    auto client = std::make_shared<ReceiverTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Request the replay from the first message, which was already evicted
+    client->SendAsync("1");
+    while (client->data().size() != 3)
+        Thread::Yield();
+    REQUIRE(client->data() == "234");
+    while (server->session->replayed != 5)
+        Thread::Yield();
+    REQUIRE(server->session->lost == 1);
+
+    // Live multicast is delivered after the replay
+    REQUIRE(server->Multicast("5"));
+    while (client->data().size() != 4)
+        Thread::Yield();
+    REQUIRE(client->data() == "2345");
+
+    // Disconnect the receiver client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the replay server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the replay server state
+    REQUIRE(server->bytes_sent() == 4);
+    REQUIRE(server->bytes_received() == 1);
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("TCP server thread pool multicast order test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1130;
+
+    // Create and start Asio service with the thread pool sharing one Asio IO service
+    auto service = std::make_shared<EchoTCPService>(4, true);
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect receiver clients
+    std::vector<std::shared_ptr<ReceiverTCPClient>> clients;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        auto client = std::make_shared<ReceiverTCPClient>(service, address, port);
+        REQUIRE(client->ConnectAsync());
+        clients.emplace_back(client);
+    }
+    for (const auto& client : clients)
+        while (!client->IsConnected())
+            Thread::Yield();
+    while (server->clients != clients.size())
+        Thread::Yield();
+
+    // Multicast numbered messages, consecutive batches may run on different working threads
+    std::string expected;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        std::string message = std::to_string(10000 + i);
+        REQUIRE(server->Multicast(message));
+        expected += message;
+    }
+
+    // Wait for all data processed...
+    for (const auto& client : clients)
+    {
+        while (client->data().size() != expected.size())
+            Thread::Yield();
+        REQUIRE(client->data() == expected);
+    }
+
+    // Disconnect receiver clients
+    for (const auto& client : clients)
+        REQUIRE(client->DisconnectAsync());
+    for (const auto& client : clients)
+        while (client->IsConnected())
+            Thread::Yield();
+    while (server->clients != 0)
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->bytes_sent() == (expected.size() * clients.size()));
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("TCP client auto-reconnect test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1125;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client with auto-reconnect
+    auto client = std::make_shared<EchoTCPClient>(service, address, port);
+    client->SetupAutoReconnect(true);
+    client->SetupReconnectBackoff(Timespan::milliseconds(10), Timespan::milliseconds(100));
+    REQUIRE(client->SetupPreserveSendBuffer(true));
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Disconnected client is reconnected automatically
+    server->DisconnectAll();
+    while ((client->reconnects() != 1) || !client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted() || client->IsConnected())
+        Thread::Yield();
+
+    // Send a message while the client is reconnecting
+    REQUIRE(client->SendAsync("test"));
+
+    // Restart the Echo server and wait for the preserved message processed...
+    REQUIRE(server->Start());
+    while ((client->reconnects() != 2) || (client->bytes_received() != 4))
+        Thread::Yield();
+    REQUIRE(client->reconnect_attempts() >= 2);
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the client is not reconnected after the requested disconnect
+    REQUIRE(!client->IsConnected());
+    REQUIRE(client->reconnects() == 2);
+}
+
+TEST_CASE("TCP client pool test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1126;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and start the client pool with a single client per endpoint
+    auto pool = std::make_shared<ClientPool<PooledClient<EchoTCPClient>>>(service);
+    pool->SetupMaxSize(1);
+    pool->SetupHealthCheck(Timespan::milliseconds(10));
+    REQUIRE(pool->Start());
+
+    std::mutex lock;
+    std::shared_ptr<PooledClient<EchoTCPClient>> checked_out;
+    std::atomic<size_t> completed{0};
+    auto handler = [&](const std::shared_ptr<PooledClient<EchoTCPClient>>& client) { std::scoped_lock locker(lock); checked_out = client; ++completed; };
+
+    // The first checkout connects a new client
+    REQUIRE(pool->CheckoutAsync(address, port, Timespan::seconds(10), handler));
+    while (completed != 1)
+        Thread::Yield();
+    auto client = checked_out;
+    REQUIRE(client != nullptr);
+    REQUIRE(client->IsConnected());
+    REQUIRE(pool->size(address, port) == 1);
+
+    // Echo data through the checked out client
+    REQUIRE(client->SendAsync("test"));
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+
+    // The second checkout waits for the checked out client and expires
+    REQUIRE(pool->CheckoutAsync(address, port, Timespan::milliseconds(50), handler));
+    while (completed != 2)
+        Thread::Yield();
+    REQUIRE(checked_out == nullptr);
+    REQUIRE(pool->timeouts() == 1);
+
+    // Return the client and check it out again from idle clients
+    pool->Checkin(client);
+    REQUIRE(pool->idle() == 1);
+    REQUIRE(pool->CheckoutAsync(address, port, Timespan::seconds(10), handler));
+    while (completed != 3)
+        Thread::Yield();
+    REQUIRE(checked_out == client);
+    REQUIRE(server->clients == 1);
+    pool->Checkin(client);
+
+    // Check the pool statistic
+    REQUIRE(pool->checkouts() == 3);
+    REQUIRE(pool->hits() == 1);
+    REQUIRE(pool->hit_rate() > 0.0);
+
+    // Stop the client pool
+    REQUIRE(pool->Stop());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+    REQUIRE(pool->size() == 0);
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
+
+TEST_CASE("TCP client pool connect failure test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1134;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start the client pool without the health check
+    auto pool = std::make_shared<ClientPool<PooledClient<EchoTCPClient>>>(service);
+    pool->SetupConnectTimeout(Timespan::seconds(10));
+    pool->SetupHealthCheck(Timespan::zero());
+    REQUIRE(pool->Start());
+
+    std::atomic<size_t> completed{0};
+    auto handler = [&](const std::shared_ptr<PooledClient<EchoTCPClient>>& client) { if (client == nullptr) ++completed; };
+
+    // Checkout a client of the endpoint without the server
+    auto start = std::chrono::steady_clock::now();
+    REQUIRE(pool->CheckoutAsync(address, port, Timespan::seconds(1), handler));
+
+    // Failed connect is removed from the pool without waiting for the connect timeout
+    while ((pool->size(address, port) != 0) && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(5)))
+        Thread::Yield();
+    REQUIRE(pool->size(address, port) == 0);
+    REQUIRE((std::chrono::steady_clock::now() - start) < std::chrono::seconds(5));
+
+    // The checkout expires
+    while (completed != 1)
+        Thread::Yield();
+    REQUIRE(pool->timeouts() == 1);
+
+    // Stop the client pool
+    REQUIRE(pool->Stop());
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
+
+TEST_CASE("TCP client happy eyeballs test", "[CppServer][TCP]")
+{
+    const std::string address = "localhost";
+    const int port = 1127;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server listening IPv4 only
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client with parallel connection attempts to all resolved endpoints
+    auto resolver = std::make_shared<TCPResolver>(service);
+    auto client = std::make_shared<EchoTCPClient>(service, address, port);
+    client->SetupConnectStagger(Timespan::milliseconds(50));
+    client->SetupConnectAttemptTimeout(Timespan::seconds(1));
+    REQUIRE(client->ConnectAsync(resolver));
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+    REQUIRE(client->endpoint().address().is_v4());
+
+    // Echo data through the connected client
+    REQUIRE(client->SendAsync("test"));
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the client errors
+    REQUIRE(client->connected);
+    REQUIRE(client->disconnected);
+}
+
+TEST_CASE("TCP resolver cache test", "[CppServer][TCP]")
+{
+    const std::string address = "localhost";
+    const int port = 1128;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create TCP resolver with the DNS resolver cache
+    auto resolver = std::make_shared<TCPResolver>(service);
+    resolver->SetupCache(true, Timespan::seconds(60), Timespan::seconds(1));
+
+    // Concurrent lookups of the same host are resolved once
+    std::atomic<size_t> resolved{0};
+    auto handler = [&resolved](std::error_code ec, const asio::ip::tcp::resolver::results_type& results) { if (!ec && !results.empty()) ++resolved; };
+    for (size_t i = 0; i < 3; ++i)
+        resolver->ResolveAsync(address, std::to_string(port), handler);
+    while (resolved != 3)
+        Thread::Yield();
+    REQUIRE(resolver->cache()->lookups() == 3);
+    REQUIRE(resolver->cache()->resolutions() == 1);
+    REQUIRE((resolver->cache()->hits() + resolver->cache()->coalesced()) == 2);
+
+    // Connect Echo client with the cached DNS resolution
+    auto client = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync(resolver));
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+    REQUIRE(resolver->cache()->resolutions() == 1);
+    REQUIRE(resolver->cache()->size() == 1);
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Cleared cache resolves the host again
+    resolver->cache()->Clear();
+    resolver->ResolveAsync(address, std::to_string(port), handler);
+    while (resolved != 4)
+        Thread::Yield();
+    REQUIRE(resolver->cache()->resolutions() == 2);
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
+
+namespace {
+
+// Are both client and server TCP Fast Open modes enabled by the OS settings?
+bool IsFastOpenEnabled()
+{
+    std::ifstream sysctl("/proc/sys/net/ipv4/tcp_fastopen");
+    int value = 0;
+    return (sysctl >> value) && ((value & 3) == 3);
+}
+
+class FastOpenTCPClient : public EchoTCPClient
+{
+public:
+    using EchoTCPClient::EchoTCPClient;
+
+protected:
+    void onConnected() override
+    {
+        EchoTCPClient::onConnected();
+
+        // With the cached cookie the SYN packet is sent only with the first data
+        SendAsync("test");
+    }
+};
+
+} // namespace
+
+TEST_CASE("TCP Fast Open test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1129;
+
+    // Loopback TCP Fast Open requires the OS support of both client and server modes
+    if (!FastOpen::IsSupported() || !IsFastOpenEnabled())
+        SKIP("TCP Fast Open is not supported or not enabled with net.ipv4.tcp_fastopen = 3");
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with TCP Fast Open
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupReuseAddress(true);
+    server->SetupFastOpen(16);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Connect Echo clients with TCP Fast Open twice, so the second one uses the cached cookie
+    for (size_t i = 0; i < 2; ++i)
+    {
+        uint64_t fast_open_sessions = server->fast_open_sessions();
+
+        // Send the first data from the connected handler, so it is carried with the SYN packet
+        auto client = std::make_shared<FastOpenTCPClient>(service, address, port);
+        client->SetupFastOpen(true);
+        REQUIRE(client->ConnectAsync());
+
+        // Wait for the server session and the echoed data
+        while (!client->IsConnected() || (server->clients != 1))
+            Thread::Yield();
+        while (client->bytes_received() != 4)
+            Thread::Yield();
+
+        // The second connect must use TCP Fast Open
+        if (i > 0)
+        {
+            REQUIRE(client->fast_open_connects() == 1);
+            REQUIRE(server->fast_open_sessions() == (fast_open_sessions + 1));
+        }
+
+        // Disconnect the Echo client
+        REQUIRE(client->DisconnectAsync());
+        while (client->IsConnected() || (server->clients != 0))
+            Thread::Yield();
+    }
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
+
+#if defined(CPPSERVER_COROUTINES)
+
+namespace {
+
+class CoroutineTCPSession : public TCPSession
+{
+public:
+    using TCPSession::TCPSession;
+
+protected:
+    void onConnected() override { Echo(); }
+
+private:
+    Task Echo()
+    {
+        auto self(shared_from_this());
+
+        // Echo all received data until the client is disconnected
+        uint8_t buffer[64];
+        for (;;)
+        {
+            size_t received = co_await ReceiveAsync(buffer, sizeof(buffer), Timespan::seconds(10));
+            if (received == 0)
+                break;
+            co_await SendAsync(buffer, received, Timespan::seconds(10));
+        }
+    }
+};
+
+class CoroutineTCPServer : public EchoTCPServer
+{
+public:
+    using EchoTCPServer::EchoTCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<CoroutineTCPSession>(server); }
+};
+
+Task CoroutineTCPClientRun(std::shared_ptr<EchoTCPClient> client, std::atomic<int>& step)
+{
+    // Connect to the server
+    if (!co_await client->ConnectAsync(Timespan::seconds(10)))
+        co_return;
+    step = 1;
+
+    // Send a message to the server
+    if (co_await client->SendAsync("test", Timespan::seconds(10)) != 4)
+        co_return;
+    step = 2;
+
+    // Receive the message back from the server
+    char buffer[4];
+    size_t received = 0;
+    while (received < sizeof(buffer))
+    {
+        size_t size = co_await client->ReceiveAsync(buffer + received, sizeof(buffer) - received, Timespan::seconds(10));
+        if (size == 0)
+            co_return;
+        received += size;
+    }
+    if (std::string(buffer, received) != "test")
+        co_return;
+    step = 3;
+
+    // Receive timeout
+    if (co_await client->ReceiveAsync(buffer, sizeof(buffer), Timespan::milliseconds(100)) != 0)
+        co_return;
+    step = 4;
+}
+
+} // namespace
+
+TEST_CASE("TCP server coroutine test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1114;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start coroutine Echo server
+    auto server = std::make_shared<CoroutineTCPServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and run coroutine Echo client
+    std::atomic<int> step{0};
+    auto client = std::make_shared<EchoTCPClient>(service, address, port);
+    CoroutineTCPClientRun(client, step);
+
+    // Wait for the coroutine completed...
+    auto start = std::chrono::steady_clock::now();
+    while ((step != 4) && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(10)))
+        Thread::Yield();
+    REQUIRE(step == 4);
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->connected);
+    REQUIRE(server->disconnected);
+    REQUIRE(server->bytes_sent() == 4);
+    REQUIRE(server->bytes_received() == 4);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->connected);
+    REQUIRE(client->disconnected);
+    REQUIRE(client->bytes_sent() == 4);
+    REQUIRE(client->bytes_received() == 4);
+    REQUIRE(!client->errors);
+}
+
+namespace {
+
+class CoroutineGate
+{
+public:
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) { _handle = handle; _suspended = true; }
+    void await_resume() const noexcept {}
+
+    bool IsSuspended() const noexcept { return _suspended; }
+    void Resume() { _suspended = false; _handle.resume(); }
+
+private:
+    std::coroutine_handle<> _handle;
+    std::atomic<bool> _suspended{false};
+};
+
+Task CoroutineTCPClientAwaiting(std::shared_ptr<EchoTCPClient> client, CoroutineGate& gate, std::atomic<int>& step)
+{
+    // Connect to the server and start the receive awaiting mode
+    if (!co_await client->ConnectAsync(Timespan::seconds(10)))
+        co_return;
+    client->StartReceiveAwaiting();
+
+    // Receive the first message back from the server
+    char buffer[1];
+    if (co_await client->SendAsync("1", Timespan::seconds(10)) != 1)
+        co_return;
+    if ((co_await client->ReceiveAsync(buffer, sizeof(buffer), Timespan::seconds(10)) != 1) || (buffer[0] != '1'))
+        co_return;
+    step = 1;
+
+    // The second message is received between awaits and cached for the next await
+    client->SendAsync("2");
+    co_await gate;
+    if ((co_await client->ReceiveAsync(buffer, sizeof(buffer), Timespan::seconds(10)) != 1) || (buffer[0] != '2'))
+        co_return;
+    step = 2;
+
+    // The third message is received out of the awaiting mode and is not cached
+    client->StopReceiveAwaiting();
+    client->SendAsync("3");
+    co_await gate;
+    if (co_await client->ReceiveAsync(buffer, sizeof(buffer), Timespan::milliseconds(100)) != 0)
+        co_return;
+    step = 3;
+}
+
+} // namespace
+
+TEST_CASE("TCP client coroutine receive awaiting test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1131;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and run coroutine Echo client
+    CoroutineGate gate;
+    std::atomic<int> step{0};
+    auto client = std::make_shared<EchoTCPClient>(service, address, port);
+    CoroutineTCPClientAwaiting(client, gate, step);
+
+    // Resume the coroutine when the next message is received between awaits
+    for (int message = 2; message <= 3; ++message)
+    {
+        auto start = std::chrono::steady_clock::now();
+        while ((!gate.IsSuspended() || (client->bytes_received() != (uint64_t)message)) && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(10)))
+            Thread::Yield();
+        REQUIRE(gate.IsSuspended());
+        REQUIRE(client->bytes_received() == (uint64_t)message);
+        REQUIRE(step == (message - 1));
+        gate.Resume();
+    }
+
+    // Wait for the coroutine completed...
+    auto start = std::chrono::steady_clock::now();
+    while ((step != 3) && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(10)))
+        Thread::Yield();
+    REQUIRE(step == 3);
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo client state
+    REQUIRE(client->bytes_sent() == 3);
+    REQUIRE(client->bytes_received() == 3);
+    REQUIRE(!client->errors);
+}
+
+#endif
@@ -0,0 +1,336 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "server/asio/tcp_client.h"
+#include "server/asio/tcp_proxy_server.h"
+#include "server/asio/tcp_server.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+namespace {
+
+class ProxyTCPClient : public TCPClient
+{
+public:
+    using TCPClient::TCPClient;
+
+protected:
+    void onConnected() override { connected = true; }
+    void onDisconnected() override { disconnected = true; }
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Validate the received byte sequence
+        for (size_t i = 0; i < size; ++i)
+            if (((const uint8_t*)buffer)[i] != expected++)
+                corrupted = true;
+    }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<bool> connected{false};
+    std::atomic<bool> disconnected{false};
+    std::atomic<bool> corrupted{false};
+    std::atomic<bool> errors{false};
+    uint8_t expected{0};
+};
+
+class ProxyTCPSession : public TCPSession
+{
+public:
+    ProxyTCPSession(const std::shared_ptr<TCPServer>& server, bool close) : TCPSession(server), _close(close) {}
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { SendAsync(buffer, size); }
+    void onSent(size_t sent, size_t pending) override
+    {
+        // Close the connection after the reply if required
+        if (_close && (pending == 0))
+            Disconnect();
+    }
+
+private:
+    bool _close;
+};
+
+class ProxyTCPServer : public TCPServer
+{
+public:
+    ProxyTCPServer(const std::shared_ptr<Service>& service, int port, bool close) : TCPServer(service, port), _close(close) {}
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<ProxyTCPSession>(server, _close); }
+
+protected:
+    void onConnected(std::shared_ptr<TCPSession>& session) override { ++clients; }
+    void onDisconnected(std::shared_ptr<TCPSession>& session) override { --clients; }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<size_t> clients{0};
+    std::atomic<bool> errors{false};
+
+private:
+    bool _close;
+};
+
+class StreamTCPSession : public TCPSession
+{
+public:
+    using TCPSession::TCPSession;
+
+protected:
+    void onConnected() override { SendAsync(std::string(256 * 1024, 'x')); }
+    void onSent(size_t sent, size_t pending) override
+    {
+        // Stream data until the connection is closed
+        if (pending == 0)
+            SendAsync(std::string(256 * 1024, 'x'));
+    }
+};
+
+class StreamTCPServer : public ProxyTCPServer
+{
+public:
+    using ProxyTCPServer::ProxyTCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(const std::shared_ptr<TCPServer>& server) override { return std::make_shared<StreamTCPSession>(server); }
+};
+
+class ProxyServer : public TCPProxyServer
+{
+public:
+    using TCPProxyServer::TCPProxyServer;
+
+protected:
+    void onConnected(std::shared_ptr<TCPSession>& session) override { ++clients; }
+    void onDisconnected(std::shared_ptr<TCPSession>& session) override { --clients; }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<size_t> clients{0};
+    std::atomic<bool> errors{false};
+};
+
+} // namespace
+
+TEST_CASE("TCP proxy server test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1141;
+    const int proxy_port = 1142;
+    const size_t total = 1024 * 1024;
+
+    for (bool zero_copy : { false, true })
+    {
+        // Create and start Asio service with several working threads
+        auto service = std::make_shared<Service>(4);
+        REQUIRE(service->Start());
+        while (!service->IsStarted())
+            Thread::Yield();
+
+        // Create and start Echo server
+        auto server = std::make_shared<ProxyTCPServer>(service, port, false);
+        server->SetupReuseAddress(true);
+        REQUIRE(server->Start());
+        while (!server->IsStarted())
+            Thread::Yield();
+
+        // Create and start proxy server with the small pipe
+        auto proxy = std::make_shared<ProxyServer>(service, proxy_port, address, port);
+        proxy->SetupReuseAddress(true);
+        proxy->SetupZeroCopy(zero_copy);
+        proxy->SetupPipeSize(4096);
+        REQUIRE(proxy->Start());
+        while (!proxy->IsStarted())
+            Thread::Yield();
+
+        // Create and connect Echo client through the proxy server
+        auto client = std::make_shared<ProxyTCPClient>(service, address, proxy_port);
+        REQUIRE(client->ConnectAsync());
+        while (!client->IsConnected() || (proxy->clients != 1) || (server->clients != 1))
+            Thread::Yield();
+
+        // Send much more data than the proxy pipe could hold
+        std::vector<uint8_t> buffer(1000);
+        uint8_t value = 0;
+        for (size_t sent = 0; sent < total; sent += buffer.size())
+        {
+            size_t size = std::min(buffer.size(), total - sent);
+            for (size_t i = 0; i < size; ++i)
+                buffer[i] = value++;
+            REQUIRE(client->SendAsync(buffer.data(), size));
+        }
+
+        // Wait for all data processed...
+        while (client->bytes_received() != total)
+            Thread::Yield();
+
+        // Check the proxy statistic
+        REQUIRE(proxy->bytes_upstream() == total);
+        REQUIRE(proxy->bytes_downstream() == total);
+
+        // Disconnect the Echo client
+        REQUIRE(client->DisconnectAsync());
+        while (client->IsConnected() || (proxy->clients != 0) || (server->clients != 0))
+            Thread::Yield();
+
+        // Stop the proxy and Echo servers
+        REQUIRE(proxy->Stop());
+        REQUIRE(server->Stop());
+        while (proxy->IsStarted() || server->IsStarted())
+            Thread::Yield();
+
+        // Stop the Asio service
+        REQUIRE(service->Stop());
+        while (service->IsStarted())
+            Thread::Yield();
+
+        // Check the proxy and Echo servers state
+        REQUIRE(!proxy->errors);
+        REQUIRE(!server->errors);
+
+        // Check the Echo client state
+        REQUIRE(client->connected);
+        REQUIRE(client->disconnected);
+        REQUIRE(!client->corrupted);
+        REQUIRE(!client->errors);
+    }
+}
+
+TEST_CASE("TCP proxy server half-close test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1143;
+    const int proxy_port = 1144;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server which closes the connection after the reply
+    auto server = std::make_shared<ProxyTCPServer>(service, port, true);
+    server->SetupReuseAddress(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and start proxy server
+    auto proxy = std::make_shared<ProxyServer>(service, proxy_port, address, port);
+    proxy->SetupReuseAddress(true);
+    REQUIRE(proxy->Start());
+    while (!proxy->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client through the proxy server
+    auto client = std::make_shared<ProxyTCPClient>(service, address, proxy_port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (proxy->clients != 1))
+        Thread::Yield();
+
+    // Send a message to the Echo server
+    const uint8_t message[4] = { 0, 1, 2, 3 };
+    client->SendAsync(message, sizeof(message));
+
+    // The reply must be delivered before the end of stream from the upstream disconnects everything
+    while (client->IsConnected() || (proxy->clients != 0) || (server->clients != 0))
+        Thread::Yield();
+    REQUIRE(client->bytes_received() == 4);
+    REQUIRE(proxy->bytes_downstream() == 4);
+
+    // Stop the proxy and Echo servers
+    REQUIRE(proxy->Stop());
+    REQUIRE(server->Stop());
+    while (proxy->IsStarted() || server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the proxy and Echo servers state
+    REQUIRE(!proxy->errors);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->connected);
+    REQUIRE(client->disconnected);
+    REQUIRE(!client->corrupted);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("TCP proxy server downstream reset test", "[CppServer][TCP]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1145;
+    const int proxy_port = 1146;
+
+    for (bool zero_copy : { false, true })
+    {
+        // Create and start Asio service
+        auto service = std::make_shared<Service>();
+        REQUIRE(service->Start());
+        while (!service->IsStarted())
+            Thread::Yield();
+
+        // Create and start the server which streams data endlessly
+        auto server = std::make_shared<StreamTCPServer>(service, port, false);
+        server->SetupReuseAddress(true);
+        REQUIRE(server->Start());
+        while (!server->IsStarted())
+            Thread::Yield();
+
+        // Create and start proxy server
+        auto proxy = std::make_shared<ProxyServer>(service, proxy_port, address, port);
+        proxy->SetupReuseAddress(true);
+        proxy->SetupZeroCopy(zero_copy);
+        REQUIRE(proxy->Start());
+        while (!proxy->IsStarted())
+            Thread::Yield();
+
+        // Create and connect the client through the proxy server
+        auto client = std::make_shared<ProxyTCPClient>(service, address, proxy_port);
+        REQUIRE(client->ConnectAsync());
+        while (!client->IsConnected() || (proxy->clients != 1) || (server->clients != 1))
+            Thread::Yield();
+
+        // Wait for the streaming data
+        while (client->bytes_received() < (1024 * 1024))
+            Thread::Yield();
+
+        // Reset the client connection while the upstream data is still streaming
+        client->socket().set_option(asio::socket_base::linger(true, 0));
+        REQUIRE(client->DisconnectAsync());
+
+        // The proxy session is disconnected without SIGPIPE and errors
+        while (client->IsConnected() || (proxy->clients != 0) || (server->clients != 0))
+            Thread::Yield();
+
+        // Stop the proxy and streaming servers
+        REQUIRE(proxy->Stop());
+        REQUIRE(server->Stop());
+        while (proxy->IsStarted() || server->IsStarted())
+            Thread::Yield();
+
+        // Stop the Asio service
+        REQUIRE(service->Stop());
+        while (service->IsStarted())
+            Thread::Yield();
+
+        // Check the proxy server state
+        REQUIRE(!proxy->errors);
+    }
+}
@@ -5,8 +5,12 @@
 #include "test.h"
 
 #include "server/asio/timer.h"
+#include "server/asio/timing_wheel.h"
 #include "threads/thread.h"
 
+#include <random>
+#include <vector>
+
 using namespace CppCommon;
 using namespace CppServer::Asio;
 
@@ -34,6 +38,22 @@ public:
     std::atomic<bool> errors{false};
 };
 
+class WheelEntry : public TimingWheel::Entry
+{
+public:
+    WheelEntry(uint64_t& tick) : _tick(tick) {}
+
+protected:
+    void onExpired() override { ++expired; expired_tick = _tick; }
+
+public:
+    uint64_t expired{0};
+    uint64_t expired_tick{0};
+
+private:
+    uint64_t& _tick;
+};
+
 } // namespace
 
 TEST_CASE("Asio timer test", "[CppServer][Timer]")
@@ -81,3 +101,106 @@ TEST_CASE("Asio timer test", "[CppServer][Timer]")
     REQUIRE(timer->expired);
     REQUIRE(!timer->errors);
 }
+
+TEST_CASE("Asio timing wheel test", "[CppServer][Timer]")
+{
+    // Create the timing wheel on the Asio IO service which is not running, so it is advanced manually
+    auto io_service = std::make_shared<asio::io_service>();
+    auto wheel = std::make_shared<TimingWheel>(io_service, Timespan::milliseconds(10));
+    REQUIRE(wheel->ticks(Timespan::milliseconds(25)) == 3);
+
+    // Arm entries with random timeouts covering all wheel levels
+    uint64_t tick = 0;
+    std::vector<std::unique_ptr<WheelEntry>> entries;
+    std::vector<uint64_t> expected;
+    std::mt19937 generator(12345);
+    for (int i = 0; i < 1000; ++i)
+    {
+        uint64_t timeout = 1 + (generator() % (1ull << (6 * (1 + i % 4))));
+        entries.emplace_back(std::make_unique<WheelEntry>(tick));
+        wheel->ArmAt(*entries.back(), timeout);
+        expected.push_back(timeout);
+    }
+    REQUIRE(wheel->size() == 1000);
+
+    // Re-arm and cancel some entries
+    for (size_t i = 0; i < entries.size(); i += 10)
+    {
+        wheel->ArmAt(*entries[i], expected[i] + 100);
+        expected[i] += 100;
+    }
+    for (size_t i = 5; i < entries.size(); i += 10)
+    {
+        REQUIRE(wheel->Cancel(*entries[i]));
+        REQUIRE(!wheel->Cancel(*entries[i]));
+        expected[i] = 0;
+    }
+    REQUIRE(wheel->size() == 900);
+
+    // Advance the wheel tick by tick
+    while (wheel->size() > 0)
+    {
+        ++tick;
+        wheel->Advance(1);
+    }
+    REQUIRE(wheel->tick() == tick);
+
+    // Check all entries are expired exactly at their ticks
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        REQUIRE(!entries[i]->IsArmed());
+        REQUIRE(entries[i]->expired == (expected[i] > 0 ? 1 : 0));
+        REQUIRE(entries[i]->expired_tick == expected[i]);
+    }
+}
+
+TEST_CASE("Asio scheduler test", "[CppServer][Timer]")
+{
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    std::atomic<int> after{0};
+    std::atomic<int> at{0};
+    std::atomic<int> canceled{0};
+    std::atomic<int> periodic{0};
+
+    // Schedule delayed, absolute, canceled and periodic actions
+    auto after_token = service->ScheduleAfter(Timespan::milliseconds(100), [&]() { ++after; });
+    auto at_token = service->ScheduleAt(UtcTime() + Timespan::milliseconds(200), [&]() { ++at; });
+    auto canceled_token = service->ScheduleAfter(Timespan::milliseconds(300), [&]() { ++canceled; });
+    auto periodic_token = service->SchedulePeriodic(Timespan::milliseconds(50), [&]() { ++periodic; });
+    REQUIRE(after_token.IsPending());
+    REQUIRE(canceled_token.Cancel());
+    REQUIRE(!canceled_token.Cancel());
+    REQUIRE(!canceled_token.IsPending());
+
+    // Wait for a while...
+    Thread::Sleep(500);
+
+    // Cancel the periodic action
+    REQUIRE(periodic_token.IsPending());
+    REQUIRE(periodic_token.Cancel());
+    int periodic_count = periodic;
+
+    // Wait for a while...
+    Thread::Sleep(200);
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the scheduled actions state
+    REQUIRE(after == 1);
+    REQUIRE(at == 1);
+    REQUIRE(canceled == 0);
+    REQUIRE(periodic_count >= 5);
+    REQUIRE(periodic_count <= 10);
+    REQUIRE(periodic <= periodic_count + 1);
+    REQUIRE(!after_token.IsPending());
+    REQUIRE(!at_token.IsPending());
+    REQUIRE(!after_token.Cancel());
+}
@@ -0,0 +1,374 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "server/asio/uds_client.h"
+#include "server/asio/uds_datagram_client.h"
+#include "server/asio/uds_datagram_server.h"
+#include "server/asio/uds_server.h"
+#include "server/http/http_uds_client.h"
+#include "server/http/http_uds_server.h"
+#include "filesystem/path.h"
+#include "threads/thread.h"
+
+#include <atomic>
+
+#if defined(CPPSERVER_UDS)
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+using namespace CppServer::HTTP;
+
+namespace {
+
+std::string SocketPath(const std::string& name)
+{
+    return (Path::temp() / ("cppserver-test-uds-" + name + ".sock")).string();
+}
+
+class EchoUDSService : public Service
+{
+public:
+    using Service::Service;
+
+protected:
+    void onThreadInitialize() override { thread_initialize = true; }
+    void onThreadCleanup() override { thread_cleanup = true; }
+    void onStarted() override { started = true; }
+    void onStopped() override { stopped = true; }
+    void onIdle() override { idle = true; }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<bool> thread_initialize{false};
+    std::atomic<bool> thread_cleanup{false};
+    std::atomic<bool> started{false};
+    std::atomic<bool> stopped{false};
+    std::atomic<bool> idle{false};
+    std::atomic<bool> errors{false};
+};
+
+class EchoUDSClient : public UDSClient
+{
+public:
+    using UDSClient::UDSClient;
+
+protected:
+    void onConnected() override { connected = true; }
+    void onDisconnected() override { disconnected = true; }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<bool> connected{false};
+    std::atomic<bool> disconnected{false};
+    std::atomic<bool> errors{false};
+};
+
+class EchoUDSSession : public UDSSession
+{
+public:
+    using UDSSession::UDSSession;
+
+protected:
+    void onConnected() override { connected = true; }
+    void onDisconnected() override { disconnected = true; }
+    void onReceived(const void* buffer, size_t size) override { SendAsync(buffer, size); }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<bool> connected{false};
+    std::atomic<bool> disconnected{false};
+    std::atomic<bool> errors{false};
+};
+
+class EchoUDSServer : public UDSServer
+{
+public:
+    using UDSServer::UDSServer;
+
+protected:
+    std::shared_ptr<UDSSession> CreateSession(const std::shared_ptr<UDSServer>& server) override { return std::make_shared<EchoUDSSession>(server); }
+
+protected:
+    void onStarted() override { started = true; }
+    void onStopped() override { stopped = true; }
+    void onConnected(std::shared_ptr<UDSSession>& session) override { connected = true; ++clients; }
+    void onDisconnected(std::shared_ptr<UDSSession>& session) override { disconnected = true; --clients; }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<bool> started{false};
+    std::atomic<bool> stopped{false};
+    std::atomic<bool> connected{false};
+    std::atomic<bool> disconnected{false};
+    std::atomic<size_t> clients{0};
+    std::atomic<bool> errors{false};
+};
+
+class EchoUDSDatagramClient : public UDSDatagramClient
+{
+public:
+    using UDSDatagramClient::UDSDatagramClient;
+
+protected:
+    void onConnected() override { connected = true; ReceiveAsync(); }
+    void onDisconnected() override { disconnected = true; }
+    void onReceived(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size) override { ReceiveAsync(); }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<bool> connected{false};
+    std::atomic<bool> disconnected{false};
+    std::atomic<bool> errors{false};
+};
+
+class EchoUDSDatagramServer : public UDSDatagramServer
+{
+public:
+    using UDSDatagramServer::UDSDatagramServer;
+
+protected:
+    void onStarted() override { started = true; ReceiveAsync(); }
+    void onStopped() override { stopped = true; }
+    void onReceived(const asio::local::datagram_protocol::endpoint& endpoint, const void* buffer, size_t size) override { SendAsync(endpoint, buffer, size); }
+    void onSent(const asio::local::datagram_protocol::endpoint& endpoint, size_t sent) override { ReceiveAsync(); }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+
+public:
+    std::atomic<bool> started{false};
+    std::atomic<bool> stopped{false};
+    std::atomic<bool> errors{false};
+};
+
+class EchoHTTPUDSSession : public HTTPUDSSession
+{
+public:
+    using HTTPUDSSession::HTTPUDSSession;
+
+protected:
+    void onReceivedRequest(const HTTPRequest& request) override { SendResponseAsync(response().MakeGetResponse(request.body())); }
+};
+
+class EchoHTTPUDSServer : public HTTPUDSServer
+{
+public:
+    using HTTPUDSServer::HTTPUDSServer;
+
+protected:
+    std::shared_ptr<UDSSession> CreateSession(const std::shared_ptr<UDSServer>& server) override { return std::make_shared<EchoHTTPUDSSession>(std::dynamic_pointer_cast<HTTPUDSServer>(server)); }
+};
+
+} // namespace
+
+TEST_CASE("Unix domain socket server test", "[CppServer][UDS]")
+{
+    const std::string path = SocketPath("stream");
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDSService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoUDSServer>(service, path);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoUDSClient>(service, path);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send a message to the Echo server
+    client->SendAsync("test");
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Asio service state
+    REQUIRE(service->started);
+    REQUIRE(service->stopped);
+    REQUIRE(!service->errors);
+
+    // Check the Echo server state
+    REQUIRE(server->started);
+    REQUIRE(server->stopped);
+    REQUIRE(server->connected);
+    REQUIRE(server->disconnected);
+    REQUIRE(server->bytes_sent() == 4);
+    REQUIRE(server->bytes_received() == 4);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->connected);
+    REQUIRE(client->disconnected);
+    REQUIRE(client->bytes_sent() == 4);
+    REQUIRE(client->bytes_received() == 4);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("Unix domain socket server restart test", "[CppServer][UDS]")
+{
+    const std::string path = SocketPath("restart");
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDSService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Start the Echo server twice on the same socket path, the stale socket file must not prevent bind
+    for (int i = 0; i < 2; ++i)
+    {
+        auto server = std::make_shared<EchoUDSServer>(service, path);
+        REQUIRE(server->Start());
+        while (!server->IsStarted())
+            Thread::Yield();
+
+        auto client = std::make_shared<EchoUDSClient>(service, path);
+        REQUIRE(client->ConnectAsync());
+        while (!client->IsConnected() || (server->clients != 1))
+            Thread::Yield();
+
+        client->SendAsync("test");
+        while (client->bytes_received() != 4)
+            Thread::Yield();
+
+        REQUIRE(client->DisconnectAsync());
+        while (client->IsConnected() || (server->clients != 0))
+            Thread::Yield();
+
+        REQUIRE(server->Stop());
+        while (server->IsStarted())
+            Thread::Yield();
+
+        REQUIRE(!server->errors);
+        REQUIRE(!client->errors);
+    }
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
+
+TEST_CASE("Unix domain datagram socket server test", "[CppServer][UDS]")
+{
+    const std::string path = SocketPath("datagram");
+    const std::string local_path = SocketPath("datagram-client");
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDSService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoUDSDatagramServer>(service, path);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoUDSDatagramClient>(service, path, local_path);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Send a message to the Echo server
+    client->Send("test");
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->started);
+    REQUIRE(server->stopped);
+    REQUIRE(server->bytes_sent() == 4);
+    REQUIRE(server->bytes_received() == 4);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->connected);
+    REQUIRE(client->disconnected);
+    REQUIRE(client->bytes_sent() == 4);
+    REQUIRE(client->bytes_received() == 4);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("HTTP over Unix domain socket test", "[CppServer][UDS]")
+{
+    const std::string path = SocketPath("http");
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDSService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start HTTP server
+    auto server = std::make_shared<EchoHTTPUDSServer>(service, path);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create HTTP client and send the request
+    auto client = std::make_shared<HTTPUDSClientEx>(service, path);
+    auto response = client->SendPostRequest("/echo", "test").get();
+    REQUIRE(response.status() == 200);
+    REQUIRE(response.body() == "test");
+
+    // Disconnect HTTP client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop HTTP server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
+
+#endif